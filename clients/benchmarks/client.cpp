@@ -154,6 +154,12 @@ try
             "                           For example, the number of Householder reflections in a transformation.\n"
             "                           ")
 
+        ("kd",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Number of super/sub-diagonals of a band matrix.\n"
+            "                           ")
+
         ("m",
          value<rocblas_int>(),
             "Matrix/vector size parameter.\n"
@@ -167,6 +173,13 @@ try
             "                           or the order of a system or transformation.\n"
             "                           ")
 
+        ("nb",
+         value<rocblas_int>(),
+            "Matrix/vector size parameter.\n"
+            "                           Block size of a blocked factorization.\n"
+            "                           For example, the number of columns of each block reflector.\n"
+            "                           ")
+
         ("nrhs",
          value<rocblas_int>(),
             "Matrix/vector size parameter.\n"
@@ -192,6 +205,12 @@ try
             "                           Leading dimension of matrices C.\n"
             "                           ")
 
+        ("ldr",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices R.\n"
+            "                           ")
+
         ("ldt",
          value<rocblas_int>(),
             "Matrix size parameter.\n"
@@ -241,6 +260,12 @@ try
             "                           Stride for matrices/vectors B.\n"
             "                           ")
 
+        ("strideC",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices/vectors C.\n"
+            "                           ")
+
         ("strideD",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -269,7 +294,13 @@ try
         ("strideP",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
-            "                           Stride for vectors tau, taup, and ipiv.\n"
+            "                           Stride for vectors tau, taup, ipiv, and jpvt.\n"
+            "                           ")
+
+        ("strideR",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices R.\n"
             "                           ")
 
         ("strideS",
@@ -278,6 +309,12 @@ try
             "                           Stride for matrices/vectors S.\n"
             "                           ")
 
+        ("strideT",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices T.\n"
+            "                           ")
+
         ("strideU",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -296,6 +333,12 @@ try
             "                           Stride for matrices/vectors W.\n"
             "                           ")
 
+        ("strideX",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices/vectors X.\n"
+            "                           ")
+
         // bdsqr options
         ("nc",
          value<rocblas_int>()->default_value(0),
@@ -368,6 +411,41 @@ try
             "                           Only applicable to stebz.\n"
             "                           ")
 
+        // symmetric matrix function options
+        ("matfunc",
+         value<char>()->default_value('S'),
+            "S = square root, I = inverse square root, E = exponential, L = logarithm.\n"
+            "                           Indicates the function of the symmetric/hermitian matrix to be computed.\n"
+            "                           Only applicable to symatfunc and hematfunc.\n"
+            "                           ")
+
+        ("clamp",
+         value<double>()->default_value(0),
+            "Lower bound applied to the eigenvalues before evaluating the matrix function.\n"
+            "                           Only applicable to symatfunc and hematfunc.\n"
+            "                           ")
+
+        // SVD-based function options
+        ("rtol",
+         value<double>()->default_value(0),
+            "Relative tolerance. Singular values not larger than rtol times the largest one are discarded.\n"
+            "                           Only applicable to gepinv and gesvd_truncate.\n"
+            "                           ")
+
+        ("rcond",
+         value<double>()->default_value(-1),
+            "Relative threshold. Singular values not larger than rcond times the largest one are treated as zero.\n"
+            "                           If negative, machine precision is used. Only applicable to gelsd and gelsy.\n"
+            "                           ")
+
+        // pivoted Cholesky options
+        ("tol",
+         value<double>()->default_value(-1),
+            "Stopping tolerance. The factorization stops when the largest remaining diagonal element is not larger than tol.\n"
+            "                           If negative, n times machine precision times the largest diagonal element is used.\n"
+            "                           Only applicable to pstrf.\n"
+            "                           ")
+
         // partial eigenvalue decomposition options
         ("abstol",
          value<double>()->default_value(0),
@@ -505,6 +583,7 @@ try
     argus.validate_erange("erange");
     argus.validate_eorder("eorder");
     argus.validate_itype("itype");
+    argus.validate_matfunc("matfunc");
 
     // prepare logging infrastructure and ignore environment variables
     rocsolver_log_begin();
@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <chrono>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <filesystem>
+#include <link.h>
+
+#include <fmt/core.h>
+#include <hip/hip_runtime_api.h>
+#include <rocblas/rocblas.h>
+
+// Measures the costs paid by short-lived processes that use rocSOLVER: the size of the library
+// binary, the time to load it, the latency of the first call to a routine that uses the
+// size-specialized kernels, and the steady-state latency of the same call.
+//
+// Usage: ./rocsolver-startup-bench [n] [batch_count] [iters]
+
+using getrf_batched_t = rocblas_status (*)(rocblas_handle,
+                                           const rocblas_int,
+                                           const rocblas_int,
+                                           float* const[],
+                                           const rocblas_int,
+                                           rocblas_int*,
+                                           const rocblas_stride,
+                                           rocblas_int*,
+                                           const rocblas_int);
+
+using clock_type = std::chrono::steady_clock;
+
+static double elapsed_us(clock_type::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+    rocblas_int n = argc > 1 ? std::atoi(argv[1]) : 32;
+    rocblas_int bc = argc > 2 ? std::atoi(argv[2]) : 1000;
+    rocblas_int iters = argc > 3 ? std::atoi(argv[3]) : 10;
+    if(n <= 0 || bc <= 0 || iters <= 0)
+    {
+        fmt::print(stderr, "Usage: {} [n] [batch_count] [iters]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // initialize the runtime before loading the library so that its cost is not included
+    rocblas_handle handle;
+    if(rocblas_create_handle(&handle) != rocblas_status_success)
+    {
+        fmt::print(stderr, "Could not create rocBLAS handle\n");
+        return EXIT_FAILURE;
+    }
+
+    // library load (the library is found by its soname through the search path of the loader)
+    auto start = clock_type::now();
+    void* lib = dlopen(ROCSOLVER_LIB_NAME, RTLD_NOW | RTLD_LOCAL);
+    double load_time = elapsed_us(start);
+    if(!lib)
+    {
+        fmt::print(stderr, "{}\n", dlerror());
+        return EXIT_FAILURE;
+    }
+
+    // the file that was actually loaded
+    link_map* map = nullptr;
+    if(dlinfo(lib, RTLD_DI_LINKMAP, &map) != 0 || !map)
+    {
+        fmt::print(stderr, "{}\n", dlerror());
+        return EXIT_FAILURE;
+    }
+    fmt::print("library: {}\n", map->l_name);
+    fmt::print("binary size (bytes): {}\n", std::filesystem::file_size(map->l_name));
+    auto getrf = reinterpret_cast<getrf_batched_t>(dlsym(lib, "rocsolver_sgetrf_batched"));
+    if(!getrf)
+    {
+        fmt::print(stderr, "{}\n", dlerror());
+        return EXIT_FAILURE;
+    }
+    fmt::print("library load (us): {:.1f}\n", load_time);
+
+    // data for sgetrf_batched
+    size_t nn = size_t(n) * n;
+    float* A;
+    float** dA;
+    rocblas_int *ipiv, *info;
+    if(hipMalloc(&A, sizeof(float) * nn * bc) != hipSuccess
+       || hipMalloc(&dA, sizeof(float*) * bc) != hipSuccess
+       || hipMalloc(&ipiv, sizeof(rocblas_int) * n * bc) != hipSuccess
+       || hipMalloc(&info, sizeof(rocblas_int) * bc) != hipSuccess)
+    {
+        fmt::print(stderr, "Could not allocate device memory\n");
+        return EXIT_FAILURE;
+    }
+
+    // diagonal matrices so that every factorization is well defined
+    float* hA = new float[nn * bc]();
+    float** hdA = new float*[bc];
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int i = 0; i < n; ++i)
+            hA[b * nn + i + i * n] = 1;
+        hdA[b] = A + b * nn;
+    }
+    (void)hipMemcpy(dA, hdA, sizeof(float*) * bc, hipMemcpyHostToDevice);
+
+    // first call latency (includes loading the kernels of the code object)
+    (void)hipMemcpy(A, hA, sizeof(float) * nn * bc, hipMemcpyHostToDevice);
+    start = clock_type::now();
+    rocblas_status status = getrf(handle, n, n, dA, n, ipiv, n, info, bc);
+    (void)hipDeviceSynchronize();
+    double first_time = elapsed_us(start);
+    if(status != rocblas_status_success)
+    {
+        fmt::print(stderr, "rocsolver_sgetrf_batched failed with status {}\n", int(status));
+        return EXIT_FAILURE;
+    }
+    fmt::print("first call (us): {:.1f}\n", first_time);
+
+    // steady-state latency
+    double steady_time = 0;
+    for(rocblas_int i = 0; i < iters; ++i)
+    {
+        (void)hipMemcpy(A, hA, sizeof(float) * nn * bc, hipMemcpyHostToDevice);
+        start = clock_type::now();
+        getrf(handle, n, n, dA, n, ipiv, n, info, bc);
+        (void)hipDeviceSynchronize();
+        steady_time += elapsed_us(start);
+    }
+    fmt::print("steady-state call (us): {:.1f}\n", steady_time / iters);
+
+    delete[] hA;
+    delete[] hdA;
+    (void)hipFree(A);
+    (void)hipFree(dA);
+    (void)hipFree(ipiv);
+    (void)hipFree(info);
+    rocblas_destroy_handle(handle);
+    dlclose(lib);
+
+    return EXIT_SUCCESS;
+}
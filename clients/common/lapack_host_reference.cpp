@@ -237,6 +237,29 @@ void dpotrf_(char* uplo, int* n, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* n, rocblas_float_complex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* n, rocblas_double_complex* A, int* lda, int* info);
 
+void spstrf_(char* uplo, int* n, float* A, int* lda, int* piv, int* rank, float* tol, float* work,
+             int* info);
+void dpstrf_(char* uplo, int* n, double* A, int* lda, int* piv, int* rank, double* tol,
+             double* work, int* info);
+void cpstrf_(char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* piv,
+             int* rank,
+             float* tol,
+             float* work,
+             int* info);
+void zpstrf_(char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* piv,
+             int* rank,
+             double* tol,
+             double* work,
+             int* info);
+
 void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
 void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
 void cpotrs_(char* uplo,
@@ -370,6 +393,116 @@ void zgels_(char* trans,
             int* lwork,
             int* info);
 
+void sgelss_(int* m,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             float* S,
+             float* rcond,
+             int* rank,
+             float* work,
+             int* lwork,
+             int* info);
+void dgelss_(int* m,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             double* S,
+             double* rcond,
+             int* rank,
+             double* work,
+             int* lwork,
+             int* info);
+void cgelss_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             float* S,
+             float* rcond,
+             int* rank,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgelss_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             double* S,
+             double* rcond,
+             int* rank,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
+void sgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
+             float* work,
+             int* lwork,
+             int* info);
+void dgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
+             double* work,
+             int* lwork,
+             int* info);
+void cgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
 void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
 void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
 void cgetri_(int* n,
@@ -811,6 +944,11 @@ void dlaswp_(int* n, double* A, int* lda, int* k1, int* k2, int* ipiv, int* inc)
 void claswp_(int* n, rocblas_float_complex* A, int* lda, int* k1, int* k2, int* ipiv, int* inc);
 void zlaswp_(int* n, rocblas_double_complex* A, int* lda, int* k1, int* k2, int* ipiv, int* inc);
 
+void slauum_(char* uplo, int* n, float* A, int* lda, int* info);
+void dlauum_(char* uplo, int* n, double* A, int* lda, int* info);
+void clauum_(char* uplo, int* n, rocblas_float_complex* A, int* lda, int* info);
+void zlauum_(char* uplo, int* n, rocblas_double_complex* A, int* lda, int* info);
+
 void sorg2r_(int* m, int* n, int* k, float* A, int* lda, float* ipiv, float* work, int* info);
 void dorg2r_(int* m, int* n, int* k, double* A, int* lda, double* ipiv, double* work, int* info);
 void cung2r_(int* m,
@@ -1534,6 +1672,55 @@ void zhetrd_(char* uplo,
              int* size_w,
              int* info);
 
+void ssbtrd_(char* vect,
+             char* uplo,
+             int* n,
+             int* kd,
+             float* AB,
+             int* ldab,
+             float* D,
+             float* E,
+             float* Q,
+             int* ldq,
+             float* work,
+             int* info);
+void dsbtrd_(char* vect,
+             char* uplo,
+             int* n,
+             int* kd,
+             double* AB,
+             int* ldab,
+             double* D,
+             double* E,
+             double* Q,
+             int* ldq,
+             double* work,
+             int* info);
+void chbtrd_(char* vect,
+             char* uplo,
+             int* n,
+             int* kd,
+             rocblas_float_complex* AB,
+             int* ldab,
+             float* D,
+             float* E,
+             rocblas_float_complex* Q,
+             int* ldq,
+             rocblas_float_complex* work,
+             int* info);
+void zhbtrd_(char* vect,
+             char* uplo,
+             int* n,
+             int* kd,
+             rocblas_double_complex* AB,
+             int* ldab,
+             double* D,
+             double* E,
+             rocblas_double_complex* Q,
+             int* ldq,
+             rocblas_double_complex* work,
+             int* info);
+
 void ssytd2_(char* uplo, int* n, float* A, int* lda, float* D, float* E, float* tau, int* info);
 void dsytd2_(char* uplo, int* n, double* A, int* lda, double* D, double* E, double* tau, int* info);
 void chetd2_(char* uplo,
@@ -1899,6 +2086,114 @@ void zheevd_(char* evect,
              int* liwork,
              int* info);
 
+void ssbev_(char* evect,
+            char* uplo,
+            int* n,
+            int* kd,
+            float* AB,
+            int* ldab,
+            float* W,
+            float* Z,
+            int* ldz,
+            float* work,
+            int* info);
+void dsbev_(char* evect,
+            char* uplo,
+            int* n,
+            int* kd,
+            double* AB,
+            int* ldab,
+            double* W,
+            double* Z,
+            int* ldz,
+            double* work,
+            int* info);
+void chbev_(char* evect,
+            char* uplo,
+            int* n,
+            int* kd,
+            rocblas_float_complex* AB,
+            int* ldab,
+            float* W,
+            rocblas_float_complex* Z,
+            int* ldz,
+            rocblas_float_complex* work,
+            float* rwork,
+            int* info);
+void zhbev_(char* evect,
+            char* uplo,
+            int* n,
+            int* kd,
+            rocblas_double_complex* AB,
+            int* ldab,
+            double* W,
+            rocblas_double_complex* Z,
+            int* ldz,
+            rocblas_double_complex* work,
+            double* rwork,
+            int* info);
+
+void ssbevd_(char* evect,
+             char* uplo,
+             int* n,
+             int* kd,
+             float* AB,
+             int* ldab,
+             float* W,
+             float* Z,
+             int* ldz,
+             float* work,
+             int* lwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void dsbevd_(char* evect,
+             char* uplo,
+             int* n,
+             int* kd,
+             double* AB,
+             int* ldab,
+             double* W,
+             double* Z,
+             int* ldz,
+             double* work,
+             int* lwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void chbevd_(char* evect,
+             char* uplo,
+             int* n,
+             int* kd,
+             rocblas_float_complex* AB,
+             int* ldab,
+             float* W,
+             rocblas_float_complex* Z,
+             int* ldz,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* lrwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+void zhbevd_(char* evect,
+             char* uplo,
+             int* n,
+             int* kd,
+             rocblas_double_complex* AB,
+             int* ldab,
+             double* W,
+             rocblas_double_complex* Z,
+             int* ldz,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* lrwork,
+             int* iwork,
+             int* liwork,
+             int* info);
+
 void ssyevx_(char* evect,
              char* erange,
              char* uplo,
@@ -2326,6 +2621,46 @@ void cblas_laswp<rocblas_double_complex>(rocblas_int n,
     zlaswp_(&n, A, &lda, &k1, &k2, ipiv, &inc);
 }
 
+// lauum
+
+template <>
+void cblas_lauum<float>(rocblas_fill uplo, rocblas_int n, float* A, rocblas_int lda)
+{
+    char uploC = rocblas2char_fill(uplo);
+    int info;
+    slauum_(&uploC, &n, A, &lda, &info);
+}
+
+template <>
+void cblas_lauum<double>(rocblas_fill uplo, rocblas_int n, double* A, rocblas_int lda)
+{
+    char uploC = rocblas2char_fill(uplo);
+    int info;
+    dlauum_(&uploC, &n, A, &lda, &info);
+}
+
+template <>
+void cblas_lauum<rocblas_float_complex>(rocblas_fill uplo,
+                                        rocblas_int n,
+                                        rocblas_float_complex* A,
+                                        rocblas_int lda)
+{
+    char uploC = rocblas2char_fill(uplo);
+    int info;
+    clauum_(&uploC, &n, A, &lda, &info);
+}
+
+template <>
+void cblas_lauum<rocblas_double_complex>(rocblas_fill uplo,
+                                         rocblas_int n,
+                                         rocblas_double_complex* A,
+                                         rocblas_int lda)
+{
+    char uploC = rocblas2char_fill(uplo);
+    int info;
+    zlauum_(&uploC, &n, A, &lda, &info);
+}
+
 // larfg
 
 template <>
@@ -4925,46 +5260,107 @@ void cblas_potrf(rocblas_fill uplo,
     zpotrf_(&uploC, &n, A, &lda, info);
 }
 
-// potrs
+// pstrf
 template <>
-void cblas_potrs(rocblas_fill uplo,
-                 rocblas_int n,
-                 rocblas_int nrhs,
-                 float* A,
-                 rocblas_int lda,
-                 float* B,
-                 rocblas_int ldb)
+void cblas_pstrf<float, float>(rocblas_fill uplo,
+                               rocblas_int n,
+                               float* A,
+                               rocblas_int lda,
+                               rocblas_int* piv,
+                               rocblas_int* rank,
+                               float tol,
+                               float* work,
+                               rocblas_int* info)
 {
-    int info;
     char uploC = rocblas2char_fill(uplo);
-    spotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
+    spstrf_(&uploC, &n, A, &lda, piv, rank, &tol, work, info);
 }
 
 template <>
-void cblas_potrs(rocblas_fill uplo,
-                 rocblas_int n,
-                 rocblas_int nrhs,
-                 double* A,
-                 rocblas_int lda,
-                 double* B,
-                 rocblas_int ldb)
+void cblas_pstrf<double, double>(rocblas_fill uplo,
+                                 rocblas_int n,
+                                 double* A,
+                                 rocblas_int lda,
+                                 rocblas_int* piv,
+                                 rocblas_int* rank,
+                                 double tol,
+                                 double* work,
+                                 rocblas_int* info)
 {
-    int info;
     char uploC = rocblas2char_fill(uplo);
-    dpotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
+    dpstrf_(&uploC, &n, A, &lda, piv, rank, &tol, work, info);
 }
 
 template <>
-void cblas_potrs(rocblas_fill uplo,
-                 rocblas_int n,
-                 rocblas_int nrhs,
-                 rocblas_float_complex* A,
-                 rocblas_int lda,
-                 rocblas_float_complex* B,
-                 rocblas_int ldb)
-{
-    int info;
-    char uploC = rocblas2char_fill(uplo);
+void cblas_pstrf<rocblas_float_complex, float>(rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_int* piv,
+                                               rocblas_int* rank,
+                                               float tol,
+                                               float* work,
+                                               rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    cpstrf_(&uploC, &n, A, &lda, piv, rank, &tol, work, info);
+}
+
+template <>
+void cblas_pstrf<rocblas_double_complex, double>(rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_int* piv,
+                                                 rocblas_int* rank,
+                                                 double tol,
+                                                 double* work,
+                                                 rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    zpstrf_(&uploC, &n, A, &lda, piv, rank, &tol, work, info);
+}
+
+// potrs
+template <>
+void cblas_potrs(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 float* A,
+                 rocblas_int lda,
+                 float* B,
+                 rocblas_int ldb)
+{
+    int info;
+    char uploC = rocblas2char_fill(uplo);
+    spotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+template <>
+void cblas_potrs(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 double* A,
+                 rocblas_int lda,
+                 double* B,
+                 rocblas_int ldb)
+{
+    int info;
+    char uploC = rocblas2char_fill(uplo);
+    dpotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+template <>
+void cblas_potrs(rocblas_fill uplo,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 rocblas_float_complex* A,
+                 rocblas_int lda,
+                 rocblas_float_complex* B,
+                 rocblas_int ldb)
+{
+    int info;
+    char uploC = rocblas2char_fill(uplo);
     cpotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
 }
 
@@ -5349,6 +5745,160 @@ void cblas_gels<rocblas_double_complex>(rocblas_operation transR,
     zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
 }
 
+// gelss
+template <>
+void cblas_gelss<float, float>(rocblas_int m,
+                               rocblas_int n,
+                               rocblas_int nrhs,
+                               float* A,
+                               rocblas_int lda,
+                               float* B,
+                               rocblas_int ldb,
+                               float* S,
+                               float rcond,
+                               rocblas_int* rank,
+                               float* work,
+                               rocblas_int lwork,
+                               float* rwork,
+                               rocblas_int* info)
+{
+    sgelss_(&m, &n, &nrhs, A, &lda, B, &ldb, S, &rcond, rank, work, &lwork, info);
+}
+
+template <>
+void cblas_gelss<double, double>(rocblas_int m,
+                                 rocblas_int n,
+                                 rocblas_int nrhs,
+                                 double* A,
+                                 rocblas_int lda,
+                                 double* B,
+                                 rocblas_int ldb,
+                                 double* S,
+                                 double rcond,
+                                 rocblas_int* rank,
+                                 double* work,
+                                 rocblas_int lwork,
+                                 double* rwork,
+                                 rocblas_int* info)
+{
+    dgelss_(&m, &n, &nrhs, A, &lda, B, &ldb, S, &rcond, rank, work, &lwork, info);
+}
+
+template <>
+void cblas_gelss<rocblas_float_complex, float>(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_int nrhs,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_float_complex* B,
+                                               rocblas_int ldb,
+                                               float* S,
+                                               float rcond,
+                                               rocblas_int* rank,
+                                               rocblas_float_complex* work,
+                                               rocblas_int lwork,
+                                               float* rwork,
+                                               rocblas_int* info)
+{
+    cgelss_(&m, &n, &nrhs, A, &lda, B, &ldb, S, &rcond, rank, work, &lwork, rwork, info);
+}
+
+template <>
+void cblas_gelss<rocblas_double_complex, double>(rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_double_complex* B,
+                                                 rocblas_int ldb,
+                                                 double* S,
+                                                 double rcond,
+                                                 rocblas_int* rank,
+                                                 rocblas_double_complex* work,
+                                                 rocblas_int lwork,
+                                                 double* rwork,
+                                                 rocblas_int* info)
+{
+    zgelss_(&m, &n, &nrhs, A, &lda, B, &ldb, S, &rcond, rank, work, &lwork, rwork, info);
+}
+
+// gelsy
+template <>
+void cblas_gelsy<float, float>(rocblas_int m,
+                               rocblas_int n,
+                               rocblas_int nrhs,
+                               float* A,
+                               rocblas_int lda,
+                               float* B,
+                               rocblas_int ldb,
+                               rocblas_int* jpvt,
+                               float rcond,
+                               rocblas_int* rank,
+                               float* work,
+                               rocblas_int lwork,
+                               float* rwork,
+                               rocblas_int* info)
+{
+    sgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, info);
+}
+
+template <>
+void cblas_gelsy<double, double>(rocblas_int m,
+                                 rocblas_int n,
+                                 rocblas_int nrhs,
+                                 double* A,
+                                 rocblas_int lda,
+                                 double* B,
+                                 rocblas_int ldb,
+                                 rocblas_int* jpvt,
+                                 double rcond,
+                                 rocblas_int* rank,
+                                 double* work,
+                                 rocblas_int lwork,
+                                 double* rwork,
+                                 rocblas_int* info)
+{
+    dgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, info);
+}
+
+template <>
+void cblas_gelsy<rocblas_float_complex, float>(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_int nrhs,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_float_complex* B,
+                                               rocblas_int ldb,
+                                               rocblas_int* jpvt,
+                                               float rcond,
+                                               rocblas_int* rank,
+                                               rocblas_float_complex* work,
+                                               rocblas_int lwork,
+                                               float* rwork,
+                                               rocblas_int* info)
+{
+    cgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, info);
+}
+
+template <>
+void cblas_gelsy<rocblas_double_complex, double>(rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int nrhs,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_double_complex* B,
+                                                 rocblas_int ldb,
+                                                 rocblas_int* jpvt,
+                                                 double rcond,
+                                                 rocblas_int* rank,
+                                                 rocblas_double_complex* work,
+                                                 rocblas_int lwork,
+                                                 double* rwork,
+                                                 rocblas_int* info)
+{
+    zgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, info);
+}
+
 // trtri
 template <>
 void cblas_trtri<float>(rocblas_fill uplo,
@@ -6030,6 +6580,83 @@ void cblas_sytrd_hetrd<rocblas_double_complex, double>(rocblas_fill uplo,
     zhetrd_(&uploC, &n, A, &lda, D, E, tau, work, &size_w, &info);
 }
 
+// sbtrd & hbtrd
+template <>
+void cblas_sbtrd_hbtrd<float, float>(rocblas_evect evect,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     float* A,
+                                     rocblas_int lda,
+                                     float* D,
+                                     float* E,
+                                     float* Q,
+                                     rocblas_int ldq,
+                                     float* work)
+{
+    rocblas_int info;
+    char vectC = (evect == rocblas_evect_original ? 'U' : rocblas2char_evect(evect));
+    char uploC = rocblas2char_fill(uplo);
+    ssbtrd_(&vectC, &uploC, &n, &kd, A, &lda, D, E, Q, &ldq, work, &info);
+}
+
+template <>
+void cblas_sbtrd_hbtrd<double, double>(rocblas_evect evect,
+                                       rocblas_fill uplo,
+                                       rocblas_int n,
+                                       rocblas_int kd,
+                                       double* A,
+                                       rocblas_int lda,
+                                       double* D,
+                                       double* E,
+                                       double* Q,
+                                       rocblas_int ldq,
+                                       double* work)
+{
+    rocblas_int info;
+    char vectC = (evect == rocblas_evect_original ? 'U' : rocblas2char_evect(evect));
+    char uploC = rocblas2char_fill(uplo);
+    dsbtrd_(&vectC, &uploC, &n, &kd, A, &lda, D, E, Q, &ldq, work, &info);
+}
+
+template <>
+void cblas_sbtrd_hbtrd<rocblas_float_complex, float>(rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_int kd,
+                                                     rocblas_float_complex* A,
+                                                     rocblas_int lda,
+                                                     float* D,
+                                                     float* E,
+                                                     rocblas_float_complex* Q,
+                                                     rocblas_int ldq,
+                                                     rocblas_float_complex* work)
+{
+    rocblas_int info;
+    char vectC = (evect == rocblas_evect_original ? 'U' : rocblas2char_evect(evect));
+    char uploC = rocblas2char_fill(uplo);
+    chbtrd_(&vectC, &uploC, &n, &kd, A, &lda, D, E, Q, &ldq, work, &info);
+}
+
+template <>
+void cblas_sbtrd_hbtrd<rocblas_double_complex, double>(rocblas_evect evect,
+                                                       rocblas_fill uplo,
+                                                       rocblas_int n,
+                                                       rocblas_int kd,
+                                                       rocblas_double_complex* A,
+                                                       rocblas_int lda,
+                                                       double* D,
+                                                       double* E,
+                                                       rocblas_double_complex* Q,
+                                                       rocblas_int ldq,
+                                                       rocblas_double_complex* work)
+{
+    rocblas_int info;
+    char vectC = (evect == rocblas_evect_original ? 'U' : rocblas2char_evect(evect));
+    char uploC = rocblas2char_fill(uplo);
+    zhbtrd_(&vectC, &uploC, &n, &kd, A, &lda, D, E, Q, &ldq, work, &info);
+}
+
 // sytd2 & hetd2
 template <>
 void cblas_sytd2_hetd2<float, float>(rocblas_fill uplo,
@@ -6636,6 +7263,178 @@ void cblas_syevd_heevd<rocblas_double_complex, double>(rocblas_evect evect,
     zheevd_(&evectC, &uploC, &n, A, &lda, W, work, &lwork, rwork, &lrwork, iwork, &liwork, info);
 }
 
+// sbev & hbev
+template <>
+void cblas_sbev_hbev<float, float>(rocblas_evect evect,
+                                   rocblas_fill uplo,
+                                   rocblas_int n,
+                                   rocblas_int kd,
+                                   float* A,
+                                   rocblas_int lda,
+                                   float* W,
+                                   float* Z,
+                                   rocblas_int ldz,
+                                   float* work,
+                                   float* rwork,
+                                   rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    ssbev_(&evectC, &uploC, &n, &kd, A, &lda, W, Z, &ldz, rwork, info);
+}
+
+template <>
+void cblas_sbev_hbev<double, double>(rocblas_evect evect,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     double* A,
+                                     rocblas_int lda,
+                                     double* W,
+                                     double* Z,
+                                     rocblas_int ldz,
+                                     double* work,
+                                     double* rwork,
+                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    dsbev_(&evectC, &uploC, &n, &kd, A, &lda, W, Z, &ldz, rwork, info);
+}
+
+template <>
+void cblas_sbev_hbev<rocblas_float_complex, float>(rocblas_evect evect,
+                                                   rocblas_fill uplo,
+                                                   rocblas_int n,
+                                                   rocblas_int kd,
+                                                   rocblas_float_complex* A,
+                                                   rocblas_int lda,
+                                                   float* W,
+                                                   rocblas_float_complex* Z,
+                                                   rocblas_int ldz,
+                                                   rocblas_float_complex* work,
+                                                   float* rwork,
+                                                   rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    chbev_(&evectC, &uploC, &n, &kd, A, &lda, W, Z, &ldz, work, rwork, info);
+}
+
+template <>
+void cblas_sbev_hbev<rocblas_double_complex, double>(rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_int kd,
+                                                     rocblas_double_complex* A,
+                                                     rocblas_int lda,
+                                                     double* W,
+                                                     rocblas_double_complex* Z,
+                                                     rocblas_int ldz,
+                                                     rocblas_double_complex* work,
+                                                     double* rwork,
+                                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    zhbev_(&evectC, &uploC, &n, &kd, A, &lda, W, Z, &ldz, work, rwork, info);
+}
+
+// sbevd & hbevd
+template <>
+void cblas_sbevd_hbevd<float, float>(rocblas_evect evect,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     float* A,
+                                     rocblas_int lda,
+                                     float* W,
+                                     float* Z,
+                                     rocblas_int ldz,
+                                     float* work,
+                                     rocblas_int lwork,
+                                     float* rwork,
+                                     rocblas_int lrwork,
+                                     rocblas_int* iwork,
+                                     rocblas_int liwork,
+                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    ssbevd_(&evectC, &uploC, &n, &kd, A, &lda, W, Z, &ldz, rwork, &lrwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_sbevd_hbevd<double, double>(rocblas_evect evect,
+                                       rocblas_fill uplo,
+                                       rocblas_int n,
+                                       rocblas_int kd,
+                                       double* A,
+                                       rocblas_int lda,
+                                       double* W,
+                                       double* Z,
+                                       rocblas_int ldz,
+                                       double* work,
+                                       rocblas_int lwork,
+                                       double* rwork,
+                                       rocblas_int lrwork,
+                                       rocblas_int* iwork,
+                                       rocblas_int liwork,
+                                       rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    dsbevd_(&evectC, &uploC, &n, &kd, A, &lda, W, Z, &ldz, rwork, &lrwork, iwork, &liwork, info);
+}
+
+template <>
+void cblas_sbevd_hbevd<rocblas_float_complex, float>(rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_int kd,
+                                                     rocblas_float_complex* A,
+                                                     rocblas_int lda,
+                                                     float* W,
+                                                     rocblas_float_complex* Z,
+                                                     rocblas_int ldz,
+                                                     rocblas_float_complex* work,
+                                                     rocblas_int lwork,
+                                                     float* rwork,
+                                                     rocblas_int lrwork,
+                                                     rocblas_int* iwork,
+                                                     rocblas_int liwork,
+                                                     rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    chbevd_(&evectC, &uploC, &n, &kd, A, &lda, W, Z, &ldz, work, &lwork, rwork, &lrwork, iwork,
+            &liwork, info);
+}
+
+template <>
+void cblas_sbevd_hbevd<rocblas_double_complex, double>(rocblas_evect evect,
+                                                       rocblas_fill uplo,
+                                                       rocblas_int n,
+                                                       rocblas_int kd,
+                                                       rocblas_double_complex* A,
+                                                       rocblas_int lda,
+                                                       double* W,
+                                                       rocblas_double_complex* Z,
+                                                       rocblas_int ldz,
+                                                       rocblas_double_complex* work,
+                                                       rocblas_int lwork,
+                                                       double* rwork,
+                                                       rocblas_int lrwork,
+                                                       rocblas_int* iwork,
+                                                       rocblas_int liwork,
+                                                       rocblas_int* info)
+{
+    char evectC = rocblas2char_evect(evect);
+    char uploC = rocblas2char_fill(uplo);
+    zhbevd_(&evectC, &uploC, &n, &kd, A, &lda, W, Z, &ldz, work, &lwork, rwork, &lrwork, iwork,
+            &liwork, info);
+}
+
 // syevx & heevx
 template <>
 void cblas_syevx_heevx<float, float>(rocblas_evect evect,
@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_cholqr.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> cholqr_tuple;
+
+// each matrix_size_range is a {m, lda, singular}
+// if singular = 1, then some of the matrices in the batch are ill-conditioned
+// (only in double precision)
+
+// case when m = n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {20, 5, 0},
+    // normal (valid) samples
+    {50, 50, 0},
+    {70, 100, 1},
+    {130, 130, 0},
+    {150, 200, 1}};
+
+const vector<int> n_size_range = {
+    // quick return
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    1,
+    16,
+    20,
+    50};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {640, 640, 1},
+    {1000, 1024, 0},
+    {3000, 3000, 1},
+};
+
+const vector<int> large_n_size_range = {64, 98, 130, 256};
+
+Arguments cholqr_setup_arguments(cholqr_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int n_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", n_size);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    // only testing standard use case/defaults for ldr and strides
+
+    arg.timing = 0;
+    arg.singular = matrix_size[2];
+
+    return arg;
+}
+
+class CHOLQR : public ::TestWithParam<cholqr_tuple>
+{
+protected:
+    CHOLQR() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = cholqr_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_cholqr_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_cholqr<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(CHOLQR, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(CHOLQR, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(CHOLQR, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(CHOLQR, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(CHOLQR, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(CHOLQR, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(CHOLQR, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(CHOLQR, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched cases
+
+TEST_P(CHOLQR, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(CHOLQR, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(CHOLQR, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(CHOLQR, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         CHOLQR,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         CHOLQR,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
@@ -5,6 +5,7 @@
 
 #include "testing_gels.hpp"
 #include "testing_gels_outofplace.hpp"
+#include "testing_gels_solve.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -143,6 +144,30 @@ protected:
     }
 };
 
+class GELS_SOLVE : public ::TestWithParam<gels_tuple>
+{
+protected:
+    GELS_SOLVE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gels_setup_arguments(GetParam(), false);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gels_solve_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gels_solve<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_gels_solve<BATCHED, STRIDED, T>(arg);
+    }
+};
+
 // non-batch tests
 
 TEST_P(GELS, __float)
@@ -185,6 +210,26 @@ TEST_P(GELS_OUTOFPLACE, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(GELS_SOLVE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GELS_SOLVE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELS_SOLVE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GELS_SOLVE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // batched tests
 
 TEST_P(GELS, batched__float)
@@ -207,6 +252,26 @@ TEST_P(GELS, batched__double_complex)
     run_tests<true, true, rocblas_double_complex>();
 }
 
+TEST_P(GELS_SOLVE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GELS_SOLVE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GELS_SOLVE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GELS_SOLVE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
 // strided_batched tests
 
 TEST_P(GELS, strided_batched__float)
@@ -229,6 +294,26 @@ TEST_P(GELS, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+TEST_P(GELS_SOLVE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GELS_SOLVE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GELS_SOLVE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GELS_SOLVE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GELS,
                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -246,3 +331,12 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GELS_OUTOFPLACE,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GELS_SOLVE,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS_SOLVE,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
@@ -0,0 +1,191 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gels_rowmajor.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<int, int, int, int> gels_rowmajor_params_A;
+typedef std::tuple<int, int, printable_char> gels_rowmajor_params_B;
+
+typedef std::tuple<gels_rowmajor_params_A, gels_rowmajor_params_B> gels_rowmajor_tuple;
+
+// each A_range tuple is a {M, N, lda, singular};
+// if singular = 1, then the used matrix for the tests is singular
+
+// each B_range tuple is a {nrhs, ldb, trans};
+// (the matrices are row-major, so lda >= N and ldb >= nrhs)
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<gels_rowmajor_params_A> matrix_sizeA_range = {
+    // quick return
+    {0, 0, 0, 0},
+    // invalid
+    {-1, 1, 1, 0},
+    {1, -1, 1, 0},
+    {10, 10, 1, 0},
+    // normal (valid) samples
+    {20, 20, 20, 1},
+    {30, 20, 40, 0},
+    {20, 30, 30, 0},
+    {40, 20, 40, 1},
+    {20, 40, 40, 1},
+};
+const vector<gels_rowmajor_params_B> matrix_sizeB_range = {
+    // quick return
+    {0, 0, 'N'},
+    // invalid
+    {-1, 1, 'N'},
+    {10, 1, 'N'},
+    // normal (valid) samples
+    {10, 10, 'N'},
+    {20, 30, 'N'},
+    {30, 30, 'N'},
+    // invalid for complex precision
+    {10, 20, 'T'},
+    {30, 30, 'T'},
+    // invalid for real precision
+    {20, 20, 'C'},
+};
+
+// for daily_lapack tests
+const vector<gels_rowmajor_params_A> large_matrix_sizeA_range = {
+    {75, 25, 75, 1}, {25, 75, 75, 1}, {150, 150, 150, 1}, {500, 50, 600, 0}, {50, 500, 600, 0},
+};
+const vector<gels_rowmajor_params_B> large_matrix_sizeB_range = {
+    {100, 100, 'N'},
+    {200, 250, 'T'},
+    {500, 500, 'C'},
+    {1000, 1000, 'N'},
+};
+
+Arguments gels_rowmajor_setup_arguments(gels_rowmajor_tuple tup)
+{
+    gels_rowmajor_params_A matrix_sizeA = std::get<0>(tup);
+    gels_rowmajor_params_B matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", std::get<0>(matrix_sizeA));
+    arg.set<rocblas_int>("n", std::get<1>(matrix_sizeA));
+    arg.set<rocblas_int>("lda", std::get<2>(matrix_sizeA));
+
+    arg.set<rocblas_int>("nrhs", std::get<0>(matrix_sizeB));
+    arg.set<rocblas_int>("ldb", std::get<1>(matrix_sizeB));
+    arg.set<char>("trans", std::get<2>(matrix_sizeB));
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = std::get<3>(matrix_sizeA);
+
+    return arg;
+}
+
+class GELS_ROWMAJOR : public ::TestWithParam<gels_rowmajor_tuple>
+{
+protected:
+    GELS_ROWMAJOR() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gels_rowmajor_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gels_rowmajor_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gels_rowmajor<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_gels_rowmajor<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GELS_ROWMAJOR, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GELS_ROWMAJOR, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELS_ROWMAJOR, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GELS_ROWMAJOR, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GELS_ROWMAJOR, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GELS_ROWMAJOR, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GELS_ROWMAJOR, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GELS_ROWMAJOR, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched cases
+
+TEST_P(GELS_ROWMAJOR, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GELS_ROWMAJOR, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GELS_ROWMAJOR, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GELS_ROWMAJOR, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GELS_ROWMAJOR,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS_ROWMAJOR,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
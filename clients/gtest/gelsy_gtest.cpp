@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gelsy.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, double> gelsy_tuple;
+
+// each size_range vector is a {m, n, nrhs, lda, ldb, singular};
+// if singular = 1, then some of the matrices in the batch are exactly rank-deficient
+// (every other column is zero, as well as the columns beyond m)
+
+// each rcond_range value is the relative threshold used to determine the effective rank
+// (if negative, machine precision is used)
+
+// case when m = 0 and rcond < 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<double> rcond_range = {-1, 0.01};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1, 1, 1, 1, 0},
+    {1, 0, 1, 1, 1, 0},
+    {1, 1, 0, 1, 1, 0},
+    // invalid
+    {-1, 1, 1, 1, 1, 0},
+    {1, -1, 1, 1, 1, 0},
+    {1, 1, -1, 1, 1, 0},
+    {20, 20, 10, 10, 20, 0},
+    {20, 20, 10, 20, 10, 0},
+    {20, 30, 10, 20, 20, 0},
+    // normal (valid) samples
+    {1, 1, 1, 1, 1, 1},
+    {20, 20, 10, 20, 20, 1},
+    {40, 30, 15, 50, 40, 1},
+    {30, 40, 20, 30, 45, 1},
+    {60, 25, 5, 60, 60, 0},
+    {25, 60, 30, 30, 60, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {{120, 100, 50, 120, 120, 0},
+                                              {300, 120, 100, 300, 300, 1},
+                                              {120, 300, 200, 120, 310, 1}};
+
+Arguments gelsy_setup_arguments(gelsy_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    double rcond = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", size[0]);
+    arg.set<rocblas_int>("n", size[1]);
+    arg.set<rocblas_int>("nrhs", size[2]);
+    arg.set<rocblas_int>("lda", size[3]);
+    arg.set<rocblas_int>("ldb", size[4]);
+    arg.set<double>("rcond", rcond);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = size[5];
+
+    return arg;
+}
+
+class GELSY : public ::TestWithParam<gelsy_tuple>
+{
+protected:
+    GELSY() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gelsy_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<double>("rcond") < 0)
+            testing_gelsy_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gelsy<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_gelsy<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GELSY, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GELSY, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELSY, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GELSY, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GELSY, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GELSY, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GELSY, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GELSY, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GELSY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GELSY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GELSY, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GELSY, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GELSY,
+                         Combine(ValuesIn(large_size_range), ValuesIn(rcond_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELSY,
+                         Combine(ValuesIn(size_range), ValuesIn(rcond_range)));
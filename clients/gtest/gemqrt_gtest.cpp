@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemqrt.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gemqrt_tuple;
+
+// each size_range vector is a {M, N, K, NB}
+
+// each op_range vector is a {ldv, ldc, s, t}
+// if ldv = -1, then ldv < limit (invalid size)
+// if ldv = 0, then ldv = limit
+// if ldv = 1, then ldv > limit
+// if ldc = -1, then ldc < limit (invalid size)
+// if ldc = 0, then ldc = limit
+// if ldc = 1, then ldc > limit
+// if s = 0, then side = 'L'
+// if s = 1, then side = 'R'
+// if t = 0, then trans = 'N'
+// if t = 1, then trans = 'T'
+// if t = 2, then trans = 'C'
+
+// case when m = 0, side = L and trans = T will also execute the bad arguments
+// test (null handle, null pointers and invalid values)
+
+const vector<vector<int>> op_range = {
+    // invalid
+    {-1, 0, 0, 0},
+    {0, -1, 0, 0},
+    // normal (valid) samples
+    {0, 0, 0, 0},
+    {0, 0, 0, 1},
+    {0, 0, 0, 2},
+    {0, 0, 1, 0},
+    {0, 0, 1, 1},
+    {0, 0, 1, 2},
+    {1, 1, 0, 0}};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1, 0, 1},
+    {1, 0, 0, 1},
+    {30, 30, 0, 1},
+    // always invalid
+    {-1, 1, 1, 1},
+    {1, -1, 1, 1},
+    {1, 1, -1, 1},
+    {30, 30, 20, 0},
+    {30, 30, 20, 21},
+    // invalid for side = 'R'
+    {20, 10, 20, 8},
+    // invalid for side = 'L'
+    {15, 25, 25, 8},
+    // normal (valid) samples
+    {40, 40, 40, 16},
+    {45, 40, 30, 30},
+    {50, 50, 20, 7}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {{100, 100, 100, 32},
+                                              {150, 100, 80, 64},
+                                              {300, 400, 300, 32},
+                                              {1024, 1000, 950, 64},
+                                              {1500, 1500, 1000, 32}};
+
+Arguments gemqrt_setup_arguments(gemqrt_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<int> op = std::get<1>(tup);
+
+    Arguments arg;
+
+    rocblas_int m = size[0];
+    rocblas_int n = size[1];
+    rocblas_int k = size[2];
+    arg.set<rocblas_int>("m", m);
+    arg.set<rocblas_int>("n", n);
+    arg.set<rocblas_int>("k", k);
+    arg.set<rocblas_int>("nb", size[3]);
+
+    if(op[2] == 0)
+        arg.set<rocblas_int>("ldv", m + op[0] * 10);
+    else
+        arg.set<rocblas_int>("ldv", n + op[0] * 10);
+    arg.set<rocblas_int>("ldc", m + op[1] * 10);
+    arg.set<char>("side", op[2] == 0 ? 'L' : 'R');
+    arg.set<char>("trans", (op[3] == 0 ? 'N' : (op[3] == 1 ? 'T' : 'C')));
+
+    // only testing standard use case/defaults for ldt and strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GEMQRT : public ::TestWithParam<gemqrt_tuple>
+{
+protected:
+    GEMQRT() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gemqrt_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<char>("side") == 'L'
+           && arg.peek<char>("trans") == 'T')
+            testing_gemqrt_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_gemqrt<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GEMQRT, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEMQRT, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEMQRT, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEMQRT, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GEMQRT, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GEMQRT, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GEMQRT, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GEMQRT, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched cases
+
+TEST_P(GEMQRT, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEMQRT, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEMQRT, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEMQRT, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GEMQRT,
+                         Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEMQRT, Combine(ValuesIn(size_range), ValuesIn(op_range)));
@@ -73,7 +73,8 @@ const vector<vector<int>> opt_range = {
 
 // for daily_lapack tests
 const vector<vector<int>> large_size_range
-    = {{120, 100, 0}, {300, 120, 0}, {300, 120, 1}, {100, 120, 1}, {120, 300, 0}, {120, 300, 1}};
+    = {{120, 100, 0}, {300, 120, 0}, {300, 120, 1}, {100, 120, 1}, {120, 300, 0},
+       {120, 300, 1}, {300, 250, 0}, {250, 300, 0}};
 
 const vector<vector<int>> large_opt_range
     = {{0, 0, 0, 3, 3}, {1, 0, 0, 0, 1}, {0, 1, 0, 1, 0}, {0, 0, 1, 1, 1},
@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesvd_truncate.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int, double> gesvd_truncate_tuple;
+
+// each size_range vector is a {m, n, lda, ldc}
+
+// each k_range value is the maximum number of retained singular values
+
+// each rtol_range value is the relative tolerance used to discard singular values
+
+// case when m = 0, k = 1 and rtol = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<int> k_range = {
+    // invalid
+    -1,
+    // normal (valid) samples
+    1, 10, 1000};
+
+const vector<double> rtol_range = {0, 0.01};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1, 1, 1},
+    {1, 0, 1, 1},
+    // invalid
+    {-1, 1, 1, 1},
+    {1, -1, 1, 1},
+    {20, 20, 10, 20},
+    {20, 20, 20, 10},
+    // normal (valid) samples
+    {1, 1, 1, 1},
+    {20, 20, 20, 20},
+    {40, 30, 50, 40},
+    {30, 40, 30, 35},
+    {60, 25, 60, 60},
+    {25, 60, 30, 25}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range
+    = {{120, 100, 120, 120}, {300, 120, 300, 300}, {120, 300, 120, 130}};
+
+Arguments gesvd_truncate_setup_arguments(gesvd_truncate_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    int k = std::get<1>(tup);
+    double rtol = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", size[0]);
+    arg.set<rocblas_int>("n", size[1]);
+    arg.set<rocblas_int>("lda", size[2]);
+    arg.set<rocblas_int>("ldc", size[3]);
+    arg.set<rocblas_int>("k", k);
+    arg.set<double>("rtol", rtol);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GESVD_TRUNCATE : public ::TestWithParam<gesvd_truncate_tuple>
+{
+protected:
+    GESVD_TRUNCATE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gesvd_truncate_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("k") == 1
+           && arg.peek<double>("rtol") == 0)
+            testing_gesvd_truncate_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_gesvd_truncate<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GESVD_TRUNCATE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GESVD_TRUNCATE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GESVD_TRUNCATE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GESVD_TRUNCATE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GESVD_TRUNCATE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GESVD_TRUNCATE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GESVD_TRUNCATE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GESVD_TRUNCATE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GESVD_TRUNCATE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GESVD_TRUNCATE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GESVD_TRUNCATE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GESVD_TRUNCATE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GESVD_TRUNCATE,
+                         Combine(ValuesIn(large_size_range),
+                                 ValuesIn(k_range),
+                                 ValuesIn(rtol_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESVD_TRUNCATE,
+                         Combine(ValuesIn(size_range), ValuesIn(k_range), ValuesIn(rtol_range)));
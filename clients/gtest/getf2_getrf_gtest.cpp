@@ -3,6 +3,10 @@
  *
  * ************************************************************************ */
 
+#include <algorithm>
+#include <optional>
+
+#include "client_environment_helpers.hpp"
 #include "testing_getf2_getrf.hpp"
 #include "testing_getf2_getrf_npvt.hpp"
 
@@ -49,12 +53,53 @@ const vector<vector<int>> large_matrix_size_range = {
     {192, 192, 0},
     {640, 640, 1},
     {1000, 1024, 0},
+    {2500, 2500, 1},
 };
 
 const vector<int> large_n_size_range = {
     45, 64, 520, 1024, 2000,
 };
 
+// for the cooperative panel kernel (m > GETF2_SPKER_MAX_M, n <= GETF2_COOP_MAX_N),
+// which is opt-in through ROCSOLVER_GETF2_COOPERATIVE
+const vector<vector<int>> coop_matrix_size_range = {
+    {1025, 1025, 1},
+    {1100, 1200, 0},
+};
+
+const vector<int> coop_n_size_range = {
+    1,
+    16,
+    65,
+};
+
+const vector<vector<int>> large_coop_matrix_size_range = {
+    {2049, 2049, 1},
+    {4000, 4000, 0},
+};
+
+const vector<int> large_coop_n_size_range = {
+    256,
+    300,
+    640,
+};
+
+// for the cooperative panel kernel with many matrices in the batch
+// (the batch counts are determined at run time from the properties of the device)
+const vector<vector<int>> coop_batch_matrix_size_range = {
+    {1025, 1025, 0},
+    {1500, 1600, 1},
+};
+
+const vector<int> coop_batch_n_size_range = {
+    16,
+};
+
+// workgroup size and maximum number of workgroups per matrix of the cooperative kernel
+// (GETF2_COOP_THDS and GETF2_COOP_MAX_BLOCKS in the library)
+const int coop_threads = 256;
+const int coop_max_blocks = 64;
+
 Arguments getrf_setup_arguments(getrf_tuple tup)
 {
     vector<int> matrix_size = std::get<0>(tup);
@@ -74,7 +119,7 @@ Arguments getrf_setup_arguments(getrf_tuple tup)
     return arg;
 }
 
-template <bool BLOCKED>
+template <bool BLOCKED, bool COOP = false>
 class GETF2_GETRF : public ::TestWithParam<getrf_tuple>
 {
 protected:
@@ -87,6 +132,11 @@ protected:
     {
         Arguments arg = getrf_setup_arguments(GetParam());
 
+        // opt in to the cooperative panel kernel if required
+        std::optional<scoped_envvar> coop;
+        if(COOP)
+            coop.emplace("ROCSOLVER_GETF2_COOPERATIVE", "1");
+
         if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
             testing_getf2_getrf_bad_arg<BATCHED, STRIDED, BLOCKED, T>();
 
@@ -99,7 +149,7 @@ protected:
     }
 };
 
-template <bool BLOCKED>
+template <bool BLOCKED, bool COOP = false>
 class GETF2_GETRF_NPVT : public ::TestWithParam<getrf_tuple>
 {
 protected:
@@ -112,6 +162,11 @@ protected:
     {
         Arguments arg = getrf_setup_arguments(GetParam());
 
+        // opt in to the cooperative panel kernel if required
+        std::optional<scoped_envvar> coop;
+        if(COOP)
+            coop.emplace("ROCSOLVER_GETF2_COOPERATIVE", "1");
+
         if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
             testing_getf2_getrf_npvt_bad_arg<BATCHED, STRIDED, BLOCKED, T>();
 
@@ -124,6 +179,60 @@ protected:
     }
 };
 
+/* The cooperative kernel can only be used if the workgroups of all the matrices in the batch
+   are resident at the same time. These tests use a batch count for which all the workgroups fit
+   in the device (at most one per compute unit), and one for which they cannot fit (more than
+   the compute units can hold), so that the non-cooperative path is taken instead. */
+template <bool NPVT>
+class GETF2_COOP_BATCH_BASE : public ::TestWithParam<getrf_tuple>
+{
+protected:
+    GETF2_COOP_BATCH_BASE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_setup_arguments(GetParam());
+
+        // opt in to the cooperative panel kernel
+        scoped_envvar coop("ROCSOLVER_GETF2_COOPERATIVE", "1");
+
+        int device;
+        hipDeviceProp_t props;
+        ASSERT_EQ(hipGetDevice(&device), hipSuccess);
+        ASSERT_EQ(hipGetDeviceProperties(&props, device), hipSuccess);
+
+        rocblas_int m = arg.peek<rocblas_int>("m");
+        rocblas_int nblk = std::min((m - 1) / coop_threads + 1, coop_max_blocks);
+        rocblas_int cus = props.multiProcessorCount;
+        rocblas_int bc_fit = std::max(cus / nblk, 2);
+        rocblas_int bc_over = (props.maxThreadsPerMultiProcessor / coop_threads) * cus / nblk + 1;
+
+        rocblas_int singular = arg.singular;
+        for(rocblas_int bc : {bc_fit, bc_over})
+        {
+            arg.batch_count = bc;
+            arg.singular = singular;
+            if(arg.singular == 1)
+                run_test<BATCHED, STRIDED, T>(arg);
+
+            arg.singular = 0;
+            run_test<BATCHED, STRIDED, T>(arg);
+        }
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_test(Arguments& arg)
+    {
+        if constexpr(NPVT)
+            testing_getf2_getrf_npvt<BATCHED, STRIDED, false, T>(arg);
+        else
+            testing_getf2_getrf<BATCHED, STRIDED, false, T>(arg);
+    }
+};
+
 class GETF2 : public GETF2_GETRF<false>
 {
 };
@@ -140,6 +249,30 @@ class GETRF_NPVT : public GETF2_GETRF_NPVT<true>
 {
 };
 
+class GETF2_COOP : public GETF2_GETRF<false, true>
+{
+};
+
+class GETRF_COOP : public GETF2_GETRF<true, true>
+{
+};
+
+class GETF2_NPVT_COOP : public GETF2_GETRF_NPVT<false, true>
+{
+};
+
+class GETRF_NPVT_COOP : public GETF2_GETRF_NPVT<true, true>
+{
+};
+
+class GETF2_COOP_BATCH : public GETF2_COOP_BATCH_BASE<false>
+{
+};
+
+class GETF2_NPVT_COOP_BATCH : public GETF2_COOP_BATCH_BASE<true>
+{
+};
+
 // non-batch tests
 TEST_P(GETF2_NPVT, __float)
 {
@@ -414,3 +547,373 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GETRF,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+// non-batch tests (cooperative panel kernel)
+TEST_P(GETF2_NPVT_COOP, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GETF2_NPVT_COOP, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GETF2_NPVT_COOP, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GETF2_NPVT_COOP, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_NPVT_COOP, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GETRF_NPVT_COOP, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GETRF_NPVT_COOP, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NPVT_COOP, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GETF2_COOP, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GETF2_COOP, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GETF2_COOP, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GETF2_COOP, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_COOP, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GETRF_COOP, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GETRF_COOP, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_COOP, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests (cooperative panel kernel)
+TEST_P(GETF2_NPVT_COOP, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETF2_NPVT_COOP, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETF2_NPVT_COOP, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETF2_NPVT_COOP, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_NPVT_COOP, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETRF_NPVT_COOP, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETRF_NPVT_COOP, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NPVT_COOP, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(GETF2_COOP, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETF2_COOP, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETF2_COOP, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETF2_COOP, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_COOP, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETRF_COOP, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETRF_COOP, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_COOP, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched cases (cooperative panel kernel)
+TEST_P(GETF2_NPVT_COOP, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETF2_NPVT_COOP, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETF2_NPVT_COOP, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETF2_NPVT_COOP, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_NPVT_COOP, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_NPVT_COOP, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_NPVT_COOP, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NPVT_COOP, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GETF2_COOP, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETF2_COOP, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETF2_COOP, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETF2_COOP, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_COOP, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_COOP, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_COOP, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_COOP, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// batched and strided_batched tests (cooperative panel kernel, many matrices)
+TEST_P(GETF2_NPVT_COOP_BATCH, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETF2_NPVT_COOP_BATCH, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETF2_NPVT_COOP_BATCH, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETF2_NPVT_COOP_BATCH, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(GETF2_NPVT_COOP_BATCH, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETF2_NPVT_COOP_BATCH, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETF2_NPVT_COOP_BATCH, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETF2_NPVT_COOP_BATCH, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GETF2_COOP_BATCH, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETF2_COOP_BATCH, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETF2_COOP_BATCH, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETF2_COOP_BATCH, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(GETF2_COOP_BATCH, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETF2_COOP_BATCH, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETF2_COOP_BATCH, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETF2_COOP_BATCH, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETF2_NPVT_COOP,
+                         Combine(ValuesIn(large_coop_matrix_size_range),
+                                 ValuesIn(large_coop_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETF2_NPVT_COOP,
+                         Combine(ValuesIn(coop_matrix_size_range), ValuesIn(coop_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_NPVT_COOP,
+                         Combine(ValuesIn(large_coop_matrix_size_range),
+                                 ValuesIn(large_coop_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_NPVT_COOP,
+                         Combine(ValuesIn(coop_matrix_size_range), ValuesIn(coop_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETF2_COOP,
+                         Combine(ValuesIn(large_coop_matrix_size_range),
+                                 ValuesIn(large_coop_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETF2_COOP,
+                         Combine(ValuesIn(coop_matrix_size_range), ValuesIn(coop_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_COOP,
+                         Combine(ValuesIn(large_coop_matrix_size_range),
+                                 ValuesIn(large_coop_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_COOP,
+                         Combine(ValuesIn(coop_matrix_size_range), ValuesIn(coop_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETF2_NPVT_COOP_BATCH,
+                         Combine(ValuesIn(coop_batch_matrix_size_range),
+                                 ValuesIn(coop_batch_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETF2_COOP_BATCH,
+                         Combine(ValuesIn(coop_batch_matrix_size_range),
+                                 ValuesIn(coop_batch_n_size_range)));
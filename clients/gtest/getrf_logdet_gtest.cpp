@@ -0,0 +1,224 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_getrf_logdet.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef vector<int> getrf_logdet_tuple;
+
+// each matrix_size_range vector is a {n, lda, singular}
+// if singular = 1, then the used matrix for the tests is singular
+
+// case when n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {20, 5, 0},
+    // normal (valid) samples
+    {1, 1, 0},
+    {8, 8, 1},
+    {32, 32, 0},
+    {50, 50, 1},
+    {70, 100, 0},
+    {130, 130, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192, 1},
+    {640, 640, 0},
+    {1000, 1024, 1},
+};
+
+Arguments getrf_logdet_setup_arguments(getrf_logdet_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", tup[0]);
+    arg.set<rocblas_int>("lda", tup[1]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = tup[2];
+
+    return arg;
+}
+
+template <bool FUSED>
+class GETRF_LOGDET_GELOGDET : public ::TestWithParam<getrf_logdet_tuple>
+{
+protected:
+    GETRF_LOGDET_GELOGDET() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_logdet_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0)
+            testing_getrf_logdet_bad_arg<BATCHED, STRIDED, FUSED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_getrf_logdet<BATCHED, STRIDED, FUSED, T>(arg);
+
+        arg.singular = 0;
+        testing_getrf_logdet<BATCHED, STRIDED, FUSED, T>(arg);
+    }
+};
+
+class GETRF_LOGDET : public GETRF_LOGDET_GELOGDET<true>
+{
+};
+
+class GELOGDET : public GETRF_LOGDET_GELOGDET<false>
+{
+};
+
+// non-batch tests
+
+TEST_P(GETRF_LOGDET, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GETRF_LOGDET, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GETRF_LOGDET, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_LOGDET, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GELOGDET, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GELOGDET, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELOGDET, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GELOGDET, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GETRF_LOGDET, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETRF_LOGDET, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETRF_LOGDET, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_LOGDET, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(GELOGDET, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GELOGDET, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GELOGDET, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GELOGDET, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched cases
+
+TEST_P(GETRF_LOGDET, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_LOGDET, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_LOGDET, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_LOGDET, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GELOGDET, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GELOGDET, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GELOGDET, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GELOGDET, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRF_LOGDET, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRF_LOGDET, ValuesIn(matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GELOGDET, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GELOGDET, ValuesIn(matrix_size_range));
@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_getrf_rowmajor.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> getrf_rowmajor_tuple;
+
+// each matrix_size_range vector is a {n, lda, singular}
+// (the matrix is row-major, so lda must be at least the number of columns n)
+// if singular = 1, then the used matrix for the tests is singular
+
+// case when m = n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {20, 5, 0},
+    // normal (valid) samples
+    {32, 32, 0},
+    {50, 50, 1},
+    {70, 100, 0}};
+
+const vector<int> m_size_range = {
+    // quick return
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    16,
+    20,
+    50,
+    100,
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192, 0},
+    {640, 640, 1},
+    {1000, 1024, 0},
+};
+
+const vector<int> large_m_size_range = {
+    45, 64, 520, 1024, 2000,
+};
+
+Arguments getrf_rowmajor_setup_arguments(getrf_rowmajor_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int m_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", m_size);
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = matrix_size[2];
+
+    return arg;
+}
+
+class GETRF_ROWMAJOR : public ::TestWithParam<getrf_rowmajor_tuple>
+{
+protected:
+    GETRF_ROWMAJOR() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_rowmajor_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_getrf_rowmajor_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_getrf_rowmajor<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_getrf_rowmajor<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GETRF_ROWMAJOR, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GETRF_ROWMAJOR, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GETRF_ROWMAJOR, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_ROWMAJOR, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GETRF_ROWMAJOR, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETRF_ROWMAJOR, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETRF_ROWMAJOR, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_ROWMAJOR, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched cases
+
+TEST_P(GETRF_ROWMAJOR, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_ROWMAJOR, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_ROWMAJOR, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_ROWMAJOR, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_ROWMAJOR,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_m_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_ROWMAJOR,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(m_size_range)));
@@ -33,11 +33,23 @@ const vector<vector<int>> matrix_size_range = {
     {32, 32, 0},
     {50, 50, 1},
     {70, 100, 0},
-    {100, 150, 1}};
+    {100, 150, 1},
+    // batched sizes in (TRTRI_MAX_COLS, GETRI_GJ_MAX_COLS] use the Gauss-Jordan kernel:
+    // a single partial block, and several blocks with a partial last one
+    {65, 65, 1},
+    {130, 140, 1}};
 
 // for daily_lapack tests
-const vector<vector<int>> large_matrix_size_range
-    = {{192, 192, 1}, {500, 600, 1}, {640, 640, 0}, {1000, 1024, 0}, {1200, 1230, 0}};
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192, 1},
+    {500, 600, 1},
+    {640, 640, 0},
+    {1000, 1024, 0},
+    {1200, 1230, 0},
+    // Gauss-Jordan kernel with more rows than threads, at its size limit, and just above it
+    {300, 300, 1},
+    {512, 512, 1},
+    {513, 520, 0}};
 
 Arguments getri_setup_arguments(getri_tuple tup, bool outofplace)
 {
@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_lauum.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, printable_char> lauum_tuple;
+
+// each size_range vector is a {n, lda}
+
+// each uplo_range is a {uplo}
+
+// case when n = 0 and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<printable_char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {10, 2},
+    // normal (valid) samples
+    {1, 1},
+    {10, 10},
+    {32, 40},
+    {33, 33},
+    {70, 80},
+    {100, 100}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {{192, 192}, {500, 600}, {1000, 1000}};
+
+Arguments lauum_setup_arguments(lauum_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    char uplo = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("lda", size[1]);
+
+    arg.set<char>("uplo", uplo);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class LAUUM : public ::TestWithParam<lauum_tuple>
+{
+protected:
+    LAUUM() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = lauum_setup_arguments(GetParam());
+
+        if(arg.peek<char>("uplo") == 'L' && arg.peek<rocblas_int>("n") == 0)
+            testing_lauum_bad_arg<T>();
+
+        testing_lauum<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(LAUUM, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(LAUUM, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(LAUUM, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(LAUUM, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         LAUUM,
+                         Combine(ValuesIn(large_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         LAUUM,
+                         Combine(ValuesIn(size_range), ValuesIn(uplo_range)));
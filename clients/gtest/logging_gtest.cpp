@@ -247,6 +247,113 @@ TEST_F(checkin_misc_LOGGING, rocsolver_log_flush_profile)
     ASSERT_EQ(rocsolver_log_end(), rocblas_status_success); // reset global state for other tests
 }
 
+TEST_F(checkin_misc_LOGGING, rocblas_layer_mode_ex_log_phases)
+{
+    rocblas_local_handle handle;
+    scoped_envvar logpath_variable("ROCSOLVER_LOG_PROFILE_PATH",
+                                   log_filepath.generic_string().c_str());
+
+    ASSERT_EQ(rocsolver_log_begin(), rocblas_status_success);
+    EXPECT_EQ(rocsolver_log_set_layer_mode(rocblas_layer_mode_ex_log_phases),
+              rocblas_status_success);
+    EXPECT_EQ(rocsolver_dgetrf_strided_batched(handle, m, n, dA, lda, stA, dP, stP, dinfo, bc),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_log_end(), rocblas_status_success);
+
+    std::vector<std::string> expected_lines = {
+        "ROCSOLVER LOG FILE",
+        "rocSOLVER Version: .*",
+        "rocBLAS Version: .*",
+        ".*HOST PHASES.*",
+        "rocsolver_dgetrf_strided_batched: Calls: 1",
+        "    arg_check: Calls: 1, Total Time: .+ ms, Histogram: .+: 1.",
+        "    memory_size: Calls: 1, Total Time: .+ ms, Histogram: .+: 1.",
+        "    device_malloc: Calls: 1, Total Time: .+ ms, Histogram: .+: 1.",
+        "    init_scalars: Calls: 1, Total Time: .+ ms, Histogram: .+: 1.",
+        "    execution: Calls: 1, Total Time: .+ ms, Histogram: .+: 1.",
+        "    pointer_mode: Calls: 1, Total Time: .+ ms, Histogram: .+: 1.",
+        "\\s*",
+    };
+    verify_file(log_filepath, expected_lines);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_log_get_phase_stats)
+{
+    rocblas_local_handle handle;
+    scoped_envvar logpath_variable("ROCSOLVER_LOG_PROFILE_PATH",
+                                   log_filepath.generic_string().c_str());
+    const char* name = "rocsolver_dgetrf_strided_batched";
+    const rocblas_int hist_size = 4;
+    rocblas_int calls, histogram[hist_size];
+    double total_time;
+
+    EXPECT_EQ(rocsolver_log_get_phase_stats(name, rocblas_log_phase_arg_check, &calls, &total_time,
+                                            histogram, hist_size),
+              rocblas_status_internal_error);
+
+    ASSERT_EQ(rocsolver_log_begin(), rocblas_status_success);
+    EXPECT_EQ(rocsolver_log_set_layer_mode(rocblas_layer_mode_ex_log_phases),
+              rocblas_status_success);
+
+    // two complete calls, one device memory size query and one call with invalid size
+    EXPECT_EQ(rocsolver_dgetrf_strided_batched(handle, m, n, dA, lda, stA, dP, stP, dinfo, bc),
+              rocblas_status_success);
+    EXPECT_EQ(rocsolver_dgetrf_strided_batched(handle, m, n, dA, lda, stA, dP, stP, dinfo, bc),
+              rocblas_status_success);
+    size_t size;
+    EXPECT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    rocsolver_dgetrf_strided_batched(handle, m, n, dA, lda, stA, dP, stP, dinfo, bc);
+    EXPECT_EQ(rocblas_stop_device_memory_size_query(handle, &size), rocblas_status_success);
+    EXPECT_EQ(rocsolver_dgetrf_strided_batched(handle, m, n, dA, lda, stA, dP, stP, dinfo, -1),
+              rocblas_status_invalid_size);
+
+    const rocblas_log_phase phases[] = {rocblas_log_phase_arg_check,
+                                        rocblas_log_phase_memory_size,
+                                        rocblas_log_phase_device_malloc,
+                                        rocblas_log_phase_init_scalars,
+                                        rocblas_log_phase_execution,
+                                        rocblas_log_phase_pointer_mode};
+    const rocblas_int expected_calls[] = {4, 3, 2, 2, 2, 2};
+    for(int p = 0; p < 6; ++p)
+    {
+        EXPECT_EQ(rocsolver_log_get_phase_stats(name, phases[p], &calls, &total_time, histogram,
+                                                hist_size),
+                  rocblas_status_success);
+        EXPECT_EQ(calls, expected_calls[p]);
+        EXPECT_GE(total_time, 0);
+        EXPECT_EQ(histogram[0] + histogram[1] + histogram[2] + histogram[3], calls);
+    }
+
+    // functions that were not called have no records
+    EXPECT_EQ(rocsolver_log_get_phase_stats("rocsolver_dpotrf", rocblas_log_phase_arg_check, &calls,
+                                            &total_time, nullptr, 0),
+              rocblas_status_success);
+    EXPECT_EQ(calls, 0);
+
+    // invalid arguments
+    EXPECT_EQ(rocsolver_log_get_phase_stats(name, rocblas_log_phase(-1), &calls, &total_time,
+                                            histogram, hist_size),
+              rocblas_status_invalid_value);
+    EXPECT_EQ(rocsolver_log_get_phase_stats(name, rocblas_log_phase_arg_check, &calls, &total_time,
+                                            histogram, -1),
+              rocblas_status_invalid_size);
+    EXPECT_EQ(rocsolver_log_get_phase_stats(nullptr, rocblas_log_phase_arg_check, &calls,
+                                            &total_time, histogram, hist_size),
+              rocblas_status_invalid_pointer);
+    EXPECT_EQ(rocsolver_log_get_phase_stats(name, rocblas_log_phase_arg_check, &calls, &total_time,
+                                            nullptr, hist_size),
+              rocblas_status_invalid_pointer);
+
+    // flushing the profile clears the records
+    EXPECT_EQ(rocsolver_log_flush_profile(), rocblas_status_success);
+    EXPECT_EQ(rocsolver_log_get_phase_stats(name, rocblas_log_phase_arg_check, &calls, &total_time,
+                                            histogram, hist_size),
+              rocblas_status_success);
+    EXPECT_EQ(calls, 0);
+
+    ASSERT_EQ(rocsolver_log_end(), rocblas_status_success);
+}
+
 TEST_F(checkin_misc_LOGGING, rocsolver_log_restore_defaults_resets_layer_mode)
 {
     rocblas_local_handle handle;
@@ -2,6 +2,7 @@
  * Copyright (c) 2020-2022 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
+#include <algorithm>
 #include <stdlib.h>
 
 #include <gtest/gtest.h>
@@ -336,3 +337,99 @@ TEST_F(checkin_misc_MEMORY_MODEL, user_owned)
     hipFree(W);
     EXPECT_EQ(rocblas_destroy_handle(handle), rocblas_status_success);
 }
+
+/*************************************/
+/******** planned workspaces *********/
+/*************************************/
+// GELS and SYEVX share a single workspace among the phases of the algorithm. The size they
+// request can never be smaller than the peak of live memory (the largest workspace required
+// by the routine called in any phase, plus the buffers that persist through that phase), and
+// it is checked against 25% above that peak, as for the placement itself in
+// checkin_misc_WORKSPACE_PLANNER. The workspaces of the routines called in each phase are
+// obtained from their own size queries, which include a few scalars and a different alignment
+// of every buffer; the slack absorbs these differences.
+static const size_t planned_slack = 4096;
+
+template <typename F>
+static size_t query_size(rocblas_handle handle, F call)
+{
+    size_t size;
+    rocblas_start_device_memory_size_query(handle);
+    call();
+    rocblas_stop_device_memory_size_query(handle, &size);
+    return size;
+}
+
+TEST_F(checkin_misc_MEMORY_MODEL, planned_workspace_gels)
+{
+    rocblas_handle handle;
+    ASSERT_EQ(rocblas_create_handle(&handle), rocblas_status_success);
+
+    const rocblas_int nrhs = 100;
+    const double one = 1;
+
+    size_t gels = query_size(handle, [&] {
+        return rocsolver_dgels(handle, rocblas_operation_none, m, n, nrhs, dA, lda, dA, lda, dinfo);
+    });
+
+    // phases: factorization, application of Q', and triangular solve
+    size_t geqrf = query_size(handle, [&] { return rocsolver_dgeqrf(handle, m, n, dA, lda, dA); });
+    size_t ormqr = query_size(handle, [&] {
+        return rocsolver_dormqr(handle, rocblas_side_left, rocblas_operation_transpose, m, nrhs, n,
+                                dA, lda, dA, dA, lda);
+    });
+    size_t trsm = query_size(handle, [&] {
+        return rocblas_dtrsm(handle, rocblas_side_left, rocblas_fill_upper,
+                             rocblas_operation_none, rocblas_diagonal_non_unit, n, nrhs, &one, dA,
+                             lda, dA, lda);
+    });
+
+    // the copy of B persists through all the phases
+    size_t savedB = sizeof(double) * n * nrhs;
+    size_t peak = savedB + std::max({geqrf, ormqr, trsm});
+
+    EXPECT_GE(gels + planned_slack, peak);
+    EXPECT_LE(gels, peak * 5 / 4);
+
+    EXPECT_EQ(rocblas_destroy_handle(handle), rocblas_status_success);
+}
+
+TEST_F(checkin_misc_MEMORY_MODEL, planned_workspace_syevx)
+{
+    rocblas_handle handle;
+    ASSERT_EQ(rocblas_create_handle(&handle), rocblas_status_success);
+
+    size_t syevx = query_size(handle, [&] {
+        return rocsolver_dsyevx(handle, rocblas_evect_original, rocblas_erange_all,
+                                rocblas_fill_lower, n, dA, lda, 0, 0, 0, 0, 0, dinfo, dA, dA, lda,
+                                dP, dinfo);
+    });
+
+    // phases: tridiagonalization, eigenvalues, eigenvectors, and back-transformation
+    size_t sytrd = query_size(handle, [&] {
+        return rocsolver_dsytrd(handle, rocblas_fill_lower, n, dA, lda, dA, dA, dA);
+    });
+    size_t stebz = query_size(handle, [&] {
+        return rocsolver_dstebz(handle, rocblas_erange_all, rocblas_eorder_blocks, n, 0, 0, 0, 0,
+                                0, dA, dA, dinfo, dinfo, dA, dP, dP, dinfo);
+    });
+    size_t stein = query_size(handle, [&] {
+        return rocsolver_dstein(handle, n, dA, dA, dinfo, dA, dP, dP, dA, lda, dP, dinfo);
+    });
+    size_t ormtr = query_size(handle, [&] {
+        return rocsolver_dormtr(handle, rocblas_side_left, rocblas_fill_lower,
+                                rocblas_operation_none, n, n, dA, lda, dA, dA, lda);
+    });
+
+    // D, E and tau persist from the tridiagonalization, and iblock and isplit from the
+    // computation of the eigenvalues, until they are last used
+    size_t vec = sizeof(double) * n;
+    size_t ivec = sizeof(rocblas_int) * n;
+    size_t peak = std::max({sytrd + 3 * vec, stebz + 3 * vec + 2 * ivec,
+                            stein + 3 * vec + 2 * ivec, ormtr + vec});
+
+    EXPECT_GE(syevx + planned_slack, peak);
+    EXPECT_LE(syevx, peak * 5 / 4);
+
+    EXPECT_EQ(rocblas_destroy_handle(handle), rocblas_status_success);
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_orgqrt_ungqrt.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> orgqrt_tuple;
+
+// each m_size_range vector is a {M, lda}
+
+// each n_size_range vector is a {N, K, NB}
+
+// case when m = 0 and n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> m_size_range = {
+    // quick return
+    {0, 1},
+    // always invalid
+    {-1, 1},
+    {20, 5},
+    // invalid for case *
+    {50, 50},
+    // normal (valid) samples
+    {70, 100},
+    {130, 130}};
+
+const vector<vector<int>> n_size_range = {
+    // quick return
+    {0, 1, 1},
+    // always invalid
+    {-1, 1, 1},
+    {1, -1, 1},
+    {10, 20, 1},
+    {20, 20, 0},
+    {20, 10, 16},
+    // invalid for case *
+    {55, 55, 16},
+    // normal (valid) samples
+    {10, 0, 1},
+    {20, 20, 1},
+    {35, 25, 8},
+    {35, 35, 16},
+    {48, 45, 32}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_m_size_range = {{400, 410}, {640, 640}, {1000, 1024}, {2000, 2000}};
+
+const vector<vector<int>> large_n_size_range
+    = {{164, 162, 32}, {198, 140, 64}, {130, 130, 20}, {220, 220, 32}, {400, 200, 64}};
+
+Arguments orgqrt_setup_arguments(orgqrt_tuple tup)
+{
+    vector<int> m_size = std::get<0>(tup);
+    vector<int> n_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", m_size[0]);
+    arg.set<rocblas_int>("lda", m_size[1]);
+
+    arg.set<rocblas_int>("n", n_size[0]);
+    arg.set<rocblas_int>("k", n_size[1]);
+    arg.set<rocblas_int>("nb", n_size[2]);
+    arg.set<rocblas_int>("ldt", n_size[2]);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class ORGQRT_UNGQRT : public ::TestWithParam<orgqrt_tuple>
+{
+protected:
+    ORGQRT_UNGQRT() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = orgqrt_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_orgqrt_ungqrt_bad_arg<T>();
+
+        testing_orgqrt_ungqrt<T>(arg);
+    }
+};
+
+class ORGQRT : public ORGQRT_UNGQRT
+{
+};
+
+class UNGQRT : public ORGQRT_UNGQRT
+{
+};
+
+// non-batch tests
+
+TEST_P(ORGQRT, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(ORGQRT, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(UNGQRT, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(UNGQRT, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         ORGQRT,
+                         Combine(ValuesIn(large_m_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         ORGQRT,
+                         Combine(ValuesIn(m_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         UNGQRT,
+                         Combine(ValuesIn(large_m_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         UNGQRT,
+                         Combine(ValuesIn(m_size_range), ValuesIn(n_size_range)));
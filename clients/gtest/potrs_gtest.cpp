@@ -3,6 +3,8 @@
  *
  * ************************************************************************ */
 
+#include <stdlib.h>
+
 #include "testing_potrs.hpp"
 
 using ::testing::Combine;
@@ -53,6 +55,34 @@ const vector<vector<int>> large_matrix_sizeB_range = {
     {100, 0}, {150, 0}, {200, 1}, {524, 1}, {1000, 0},
 };
 
+// for the triangular solves with inverted diagonal blocks of the batched routines,
+// which are opt-in through ROCSOLVER_TRSM_INVDIAG
+// (sizes that are and are not multiples of the block sizes in the TRSM_INVDIAG tables).
+// The library reads the variable only once, so these tests are skipped unless it is set
+// for the whole run (see the rocsolver-test-trsm-invdiag test)
+const vector<vector<int>> invdiag_matrix_sizeA_range = {
+    {40, 40, 40},
+    {64, 64, 64},
+    {100, 110, 100},
+};
+const vector<vector<int>> invdiag_matrix_sizeB_range = {
+    {5, 0},
+    {20, 1},
+    {70, 1},
+};
+
+// for daily_lapack tests of the triangular solves with inverted diagonal blocks
+const vector<vector<int>> large_invdiag_matrix_sizeA_range = {
+    {200, 200, 210},
+    {256, 256, 256},
+    {300, 300, 300},
+    {500, 500, 500},
+};
+const vector<vector<int>> large_invdiag_matrix_sizeB_range = {
+    {10, 0},
+    {100, 1},
+};
+
 Arguments potrs_setup_arguments(potrs_tuple tup)
 {
     vector<int> matrix_sizeA = std::get<0>(tup);
@@ -77,11 +107,16 @@ Arguments potrs_setup_arguments(potrs_tuple tup)
     return arg;
 }
 
-class POTRS : public ::TestWithParam<potrs_tuple>
+template <bool INVDIAG = false>
+class POTRS_BASE : public ::TestWithParam<potrs_tuple>
 {
 protected:
-    POTRS() {}
-    virtual void SetUp() {}
+    POTRS_BASE() {}
+    virtual void SetUp()
+    {
+        if(INVDIAG && !getenv("ROCSOLVER_TRSM_INVDIAG"))
+            GTEST_SKIP() << "Requires ROCSOLVER_TRSM_INVDIAG=1 in the environment";
+    }
     virtual void TearDown() {}
 
     template <bool BATCHED, bool STRIDED, typename T>
@@ -97,6 +132,14 @@ protected:
     }
 };
 
+class POTRS : public POTRS_BASE<false>
+{
+};
+
+class POTRS_INVDIAG : public POTRS_BASE<true>
+{
+};
+
 // non-batch tests
 
 TEST_P(POTRS, __float)
@@ -163,6 +206,50 @@ TEST_P(POTRS, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+// batched tests (triangular solves with inverted diagonal blocks)
+
+TEST_P(POTRS_INVDIAG, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POTRS_INVDIAG, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POTRS_INVDIAG, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRS_INVDIAG, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests (triangular solves with inverted diagonal blocks)
+
+TEST_P(POTRS_INVDIAG, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRS_INVDIAG, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRS_INVDIAG, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRS_INVDIAG, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 // daily_lapack tests normal execution with medium to large sizes
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          POTRS,
@@ -174,3 +261,13 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          POTRS,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRS_INVDIAG,
+                         Combine(ValuesIn(large_invdiag_matrix_sizeA_range),
+                                 ValuesIn(large_invdiag_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRS_INVDIAG,
+                         Combine(ValuesIn(invdiag_matrix_sizeA_range),
+                                 ValuesIn(invdiag_matrix_sizeB_range)));
@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_sbevd_hbevd.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<printable_char>> sbevd_hbevd_tuple;
+
+// each size_range vector is a {n, kd, lda, ldz}
+
+// each op_range vector is a {evect, uplo}
+
+// case when n == 0, evect == N, and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<printable_char>> op_range = {{'N', 'L'}, {'N', 'U'}, {'V', 'L'}, {'V', 'U'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1, 2, 1},
+    // invalid
+    {-1, 1, 2, 1},
+    {10, -1, 1, 10},
+    {10, 3, 3, 10},
+    {10, 3, 4, 5},
+    // normal (valid) samples
+    {1, 0, 1, 1},
+    {12, 0, 1, 12},
+    {12, 1, 2, 12},
+    {20, 5, 8, 25},
+    {35, 10, 11, 35},
+    {50, 49, 50, 60}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range
+    = {{192, 16, 17, 192}, {256, 64, 70, 270}, {300, 120, 121, 300}};
+
+Arguments sbevd_hbevd_setup_arguments(sbevd_hbevd_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<printable_char> op = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("kd", size[1]);
+    arg.set<rocblas_int>("lda", size[2]);
+    arg.set<rocblas_int>("ldz", size[3]);
+
+    arg.set<char>("evect", op[0]);
+    arg.set<char>("uplo", op[1]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class SBEVD_HBEVD : public ::TestWithParam<sbevd_hbevd_tuple>
+{
+protected:
+    SBEVD_HBEVD() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = sbevd_hbevd_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("evect") == 'N'
+           && arg.peek<char>("uplo") == 'L')
+            testing_sbevd_hbevd_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_sbevd_hbevd<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class SBEVD : public SBEVD_HBEVD
+{
+};
+
+class HBEVD : public SBEVD_HBEVD
+{
+};
+
+// non-batch tests
+
+TEST_P(SBEVD, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(SBEVD, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(HBEVD, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(HBEVD, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(SBEVD, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(SBEVD, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(HBEVD, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(HBEVD, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(SBEVD, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SBEVD, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HBEVD, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HBEVD, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         SBEVD,
+                         Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         HBEVD,
+                         Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, SBEVD, Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, HBEVD, Combine(ValuesIn(size_range), ValuesIn(op_range)));
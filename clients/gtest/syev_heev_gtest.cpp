@@ -13,7 +13,8 @@ using namespace std;
 
 typedef std::tuple<vector<int>, vector<printable_char>> syev_heev_tuple;
 
-// each size_range vector is a {n, lda}
+// each size_range vector is a {n, lda, [batch_count]}
+// (if batch_count is not given, batched tests use 3 instances)
 
 // each op_range vector is a {evect, uplo}
 
@@ -34,7 +35,10 @@ const vector<vector<int>> size_range = {
     {12, 12},
     {20, 30},
     {35, 35},
-    {50, 60}};
+    {50, 60},
+    // large batches of small matrices
+    {16, 16, 100},
+    {32, 40, 100}};
 
 // for daily_lapack tests
 const vector<vector<int>> large_size_range = {{192, 192}, {256, 270}, {300, 300}};
@@ -75,7 +79,9 @@ protected:
            && arg.peek<char>("uplo") == 'L')
             testing_syev_heev_bad_arg<BATCHED, STRIDED, T>();
 
-        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        vector<int> size = std::get<0>(GetParam());
+        rocblas_int bc = (size.size() > 2 ? size[2] : 3);
+        arg.batch_count = (BATCHED || STRIDED ? bc : 1);
         testing_syev_heev<BATCHED, STRIDED, T>(arg);
     }
 };
@@ -43,6 +43,16 @@ const vector<vector<int>> large_matrix_size_range = {
     {1000, 1024, 1024},
 };
 
+// for daily_lapack tests of the blocked routines only
+// (sizes large enough to reach the inversion-based algorithm, see xxGST_INVERSE_SWITCHSIZE)
+const vector<vector<int>> inverse_matrix_size_range = {
+    {1024, 1024, 1024},
+    {1100, 1150, 1200},
+};
+
+// for daily_lapack tests of the blocked routines only
+const vector<vector<printable_char>> inverse_type_range = {{'1', 'U'}, {'1', 'L'}};
+
 Arguments sygst_setup_arguments(sygst_tuple tup)
 {
     vector<int> matrix_size = std::get<0>(tup);
@@ -252,6 +262,11 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          SYGST,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(type_range)));
 
+INSTANTIATE_TEST_SUITE_P(daily_lapack_inverse,
+                         SYGST,
+                         Combine(ValuesIn(inverse_matrix_size_range),
+                                 ValuesIn(inverse_type_range)));
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          HEGST,
                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(type_range)));
@@ -259,3 +274,8 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          HEGST,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(type_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack_inverse,
+                         HEGST,
+                         Combine(ValuesIn(inverse_matrix_size_range),
+                                 ValuesIn(inverse_type_range)));
@@ -0,0 +1,183 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_symatfunc_hematfunc.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<printable_char>, double> symatfunc_tuple;
+
+// each size_range vector is a {n, lda}
+
+// each op_range vector is a {matfunc, uplo}
+
+// each clamp_range value is the lower bound applied to the eigenvalues
+// (0 has no effect on the positive definite test matrices)
+
+// case when n == 0, matfunc == S, uplo = L and clamp = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<printable_char>> op_range
+    = {{'S', 'L'}, {'S', 'U'}, {'I', 'L'}, {'I', 'U'}, {'E', 'L'}, {'L', 'U'}};
+
+const vector<double> clamp_range = {0, 12};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {10, 5},
+    // normal (valid) samples
+    {1, 1},
+    {7, 7},
+    {16, 20},
+    {32, 32},
+    {33, 33},
+    {50, 60}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {{192, 192}, {256, 270}, {300, 300}};
+
+Arguments symatfunc_setup_arguments(symatfunc_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<printable_char> op = std::get<1>(tup);
+    double clamp = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("lda", size[1]);
+
+    arg.set<char>("matfunc", op[0]);
+    arg.set<char>("uplo", op[1]);
+    arg.set<double>("clamp", clamp);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class SYMATFUNC_HEMATFUNC : public ::TestWithParam<symatfunc_tuple>
+{
+protected:
+    SYMATFUNC_HEMATFUNC() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = symatfunc_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("matfunc") == 'S'
+           && arg.peek<char>("uplo") == 'L' && arg.peek<double>("clamp") == 0)
+            testing_symatfunc_hematfunc_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_symatfunc_hematfunc<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class SYMATFUNC : public SYMATFUNC_HEMATFUNC
+{
+};
+
+class HEMATFUNC : public SYMATFUNC_HEMATFUNC
+{
+};
+
+// non-batch tests
+
+TEST_P(SYMATFUNC, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(SYMATFUNC, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(HEMATFUNC, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(HEMATFUNC, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(SYMATFUNC, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(SYMATFUNC, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(HEMATFUNC, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(HEMATFUNC, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(SYMATFUNC, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYMATFUNC, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HEMATFUNC, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEMATFUNC, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         SYMATFUNC,
+                         Combine(ValuesIn(large_size_range), ValuesIn(op_range), ValuesIn(clamp_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         HEMATFUNC,
+                         Combine(ValuesIn(large_size_range), ValuesIn(op_range), ValuesIn(clamp_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYMATFUNC,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range), ValuesIn(clamp_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         HEMATFUNC,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range), ValuesIn(clamp_range)));
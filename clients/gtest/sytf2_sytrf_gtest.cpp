@@ -31,8 +31,12 @@ const vector<vector<int>> matrix_size_range = {
     {-1, 1, 0},
     {20, 5, 0},
     // normal (valid) samples
+    {8, 10, 0},
     {32, 32, 1},
+    {33, 40, 1},
     {50, 50, 0},
+    {64, 64, 1},
+    {65, 65, 0},
     {70, 100, 1}};
 
 // for daily_lapack tests
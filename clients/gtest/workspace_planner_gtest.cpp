@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "workspace_planner.hpp"
+
+constexpr size_t align = workspace_planner::alignment;
+
+struct planned_buffer
+{
+    size_t size;
+    int first;
+    int last;
+    int id;
+};
+
+// checks that buffers with intersecting lifetimes do not share memory
+static void check_layout(workspace_planner& plan, const std::vector<planned_buffer>& bufs)
+{
+    for(size_t i = 0; i < bufs.size(); i++)
+    {
+        size_t oi = plan.offset(bufs[i].id);
+        EXPECT_EQ(oi % align, 0);
+        EXPECT_LE(oi + bufs[i].size, plan.size());
+
+        for(size_t j = i + 1; j < bufs.size(); j++)
+        {
+            if(bufs[i].size == 0 || bufs[j].size == 0)
+                continue;
+            if(bufs[i].first > bufs[j].last || bufs[j].first > bufs[i].last)
+                continue;
+
+            size_t oj = plan.offset(bufs[j].id);
+            EXPECT_TRUE(oi + bufs[i].size <= oj || oj + bufs[j].size <= oi)
+                << "buffers " << i << " and " << j << " overlap";
+        }
+    }
+}
+
+TEST(checkin_misc_WORKSPACE_PLANNER, empty)
+{
+    workspace_planner plan;
+    EXPECT_EQ(plan.size(), 0);
+    EXPECT_EQ(plan.size_unaliased(), 0);
+    EXPECT_EQ(plan.size_peak(), 0);
+
+    int id = plan.add(0, 0, 3);
+    EXPECT_EQ(plan.size(), 0);
+    EXPECT_EQ(plan.offset(id), 0);
+}
+
+TEST(checkin_misc_WORKSPACE_PLANNER, disjoint_lifetimes_alias)
+{
+    workspace_planner plan;
+    int a = plan.add(10 * align, 0);
+    int b = plan.add(4 * align, 1);
+    int c = plan.add(7 * align, 2);
+
+    EXPECT_EQ(plan.size(), 10 * align);
+    EXPECT_EQ(plan.size_unaliased(), 21 * align);
+    EXPECT_EQ(plan.offset(a), 0);
+    EXPECT_EQ(plan.offset(b), 0);
+    EXPECT_EQ(plan.offset(c), 0);
+}
+
+TEST(checkin_misc_WORKSPACE_PLANNER, overlapping_lifetimes_do_not_alias)
+{
+    workspace_planner plan;
+    std::vector<planned_buffer> bufs = {{3 * align, 0, 1, 0}, {5 * align, 1, 2, 0}};
+    for(auto& b : bufs)
+        b.id = plan.add(b.size, b.first, b.last);
+
+    EXPECT_EQ(plan.size(), 8 * align);
+    check_layout(plan, bufs);
+}
+
+TEST(checkin_misc_WORKSPACE_PLANNER, sizes_are_aligned)
+{
+    workspace_planner plan;
+    std::vector<planned_buffer> bufs = {{1, 0, 0, 0}, {align + 1, 0, 0, 0}, {3, 0, 0, 0}};
+    for(auto& b : bufs)
+        b.id = plan.add(b.size, b.first, b.last);
+
+    EXPECT_EQ(plan.size(), 4 * align);
+    EXPECT_EQ(plan.size_unaliased(), 4 * align);
+    check_layout(plan, bufs);
+}
+
+// typical layout of a driver routine: a few buffers that persist through all the
+// phases, plus the workspace of the routine called in each phase
+TEST(checkin_misc_WORKSPACE_PLANNER, driver_layout)
+{
+    const std::vector<std::vector<size_t>> phase_bufs
+        = {{40 * align, 3 * align, 12 * align}, {2 * align, 30 * align}, {25 * align, 25 * align}};
+    const std::vector<size_t> persistent = {6 * align, align};
+
+    const int last = phase_bufs.size() - 1;
+
+    workspace_planner plan;
+    std::vector<planned_buffer> bufs;
+    for(size_t s : persistent)
+        bufs.push_back({s, 0, last, plan.add(s, 0, last)});
+
+    size_t slot_max[3] = {0, 0, 0};
+    size_t peak = 0;
+    for(int p = 0; p <= last; p++)
+    {
+        size_t live = 0;
+        for(size_t i = 0; i < phase_bufs[p].size(); i++)
+        {
+            bufs.push_back({phase_bufs[p][i], p, p, plan.add(phase_bufs[p][i], p)});
+            slot_max[i] = std::max(slot_max[i], phase_bufs[p][i]);
+            live += phase_bufs[p][i];
+        }
+        peak = std::max(peak, live);
+    }
+    peak += 7 * align;
+
+    // previous approach: one buffer per slot, sized for the largest requirement
+    size_t slots = slot_max[0] + slot_max[1] + slot_max[2] + 7 * align;
+
+    EXPECT_EQ(plan.size_peak(), peak);
+    EXPECT_EQ(plan.size(), peak);
+    EXPECT_LT(plan.size(), slots);
+    check_layout(plan, bufs);
+}
+
+TEST(checkin_misc_WORKSPACE_PLANNER, random_layouts)
+{
+    std::mt19937 gen(15);
+    std::uniform_int_distribution<int> phase(0, 9);
+    std::uniform_int_distribution<size_t> bytes(0, 100 * align);
+
+    for(int test = 0; test < 50; test++)
+    {
+        workspace_planner plan;
+        std::vector<planned_buffer> bufs(1 + test);
+        for(auto& b : bufs)
+        {
+            b.size = bytes(gen);
+            b.first = phase(gen);
+            b.last = phase(gen);
+            b.id = plan.add(b.size, b.first, b.last);
+            b.size = (b.size + align - 1) / align * align;
+            if(b.first > b.last)
+                std::swap(b.first, b.last);
+        }
+
+        // the workspace can never be smaller than the live memory of any phase
+        size_t live_max = 0;
+        for(int p = 0; p < 10; p++)
+        {
+            size_t live = 0;
+            for(auto& b : bufs)
+                live += (b.first <= p && p <= b.last) ? b.size : 0;
+            live_max = std::max(live_max, live);
+        }
+
+        EXPECT_EQ(plan.size_peak(), live_max);
+        EXPECT_GE(plan.size(), live_max);
+        EXPECT_LE(plan.size(), plan.size_unaliased());
+        check_layout(plan, bufs);
+
+        // first-fit does not guarantee to reach the peak; with these layouts the
+        // fragmentation stays below 18%, and it is checked against 25% to catch
+        // regressions of the placement
+        EXPECT_LE(plan.size(), live_max * 5 / 4);
+    }
+}
+
+// small layout where the greedy placement does not attain the peak: the unit buffers are
+// placed in declaration order above the largest one, and the last of them (live in phases 1
+// and 2) finds no free gap below 5 units, although a layout of 5 units exists
+TEST(checkin_misc_WORKSPACE_PLANNER, first_fit_above_peak)
+{
+    workspace_planner plan;
+    std::vector<planned_buffer> bufs = {{align, 0, 0, 0},     {align, 2, 2, 0},
+                                        {3 * align, 0, 2, 0}, {align, 0, 1, 0},
+                                        {align, 1, 2, 0}};
+    for(auto& b : bufs)
+        b.id = plan.add(b.size, b.first, b.last);
+
+    EXPECT_EQ(plan.size_peak(), 5 * align);
+    EXPECT_GE(plan.size(), plan.size_peak());
+    EXPECT_LE(plan.size(), 6 * align);
+    check_layout(plan, bufs);
+}
+
+TEST(checkin_misc_WORKSPACE_PLANNER, deterministic)
+{
+    auto build = [](workspace_planner& plan) {
+        plan.add(5 * align, 0, 2);
+        plan.add(5 * align, 1);
+        plan.add(5 * align, 2);
+        plan.add(9 * align, 0);
+        plan.add(5 * align, 0, 1);
+    };
+
+    workspace_planner plan1, plan2;
+    build(plan1);
+    build(plan2);
+
+    EXPECT_EQ(plan1.size(), plan2.size());
+    for(int id = 0; id < 5; id++)
+        EXPECT_EQ(plan1.offset(id), plan2.offset(id));
+}
@@ -140,6 +140,17 @@ void cblas_potf2(rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, rocbla
 template <typename T>
 void cblas_potrf(rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, rocblas_int* info);
 
+template <typename T, typename S>
+void cblas_pstrf(rocblas_fill uplo,
+                 rocblas_int n,
+                 T* A,
+                 rocblas_int lda,
+                 rocblas_int* piv,
+                 rocblas_int* rank,
+                 S tol,
+                 S* work,
+                 rocblas_int* info);
+
 template <typename T>
 void cblas_potrs(rocblas_fill uplo,
                  rocblas_int n,
@@ -201,6 +212,38 @@ void cblas_gels(rocblas_operation transR,
                 rocblas_int lwork,
                 rocblas_int* info);
 
+template <typename T, typename S>
+void cblas_gelss(rocblas_int m,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 T* A,
+                 rocblas_int lda,
+                 T* B,
+                 rocblas_int ldb,
+                 S* sv,
+                 S rcond,
+                 rocblas_int* rank,
+                 T* work,
+                 rocblas_int lwork,
+                 S* rwork,
+                 rocblas_int* info);
+
+template <typename T, typename S>
+void cblas_gelsy(rocblas_int m,
+                 rocblas_int n,
+                 rocblas_int nrhs,
+                 T* A,
+                 rocblas_int lda,
+                 T* B,
+                 rocblas_int ldb,
+                 rocblas_int* jpvt,
+                 S rcond,
+                 rocblas_int* rank,
+                 T* work,
+                 rocblas_int lwork,
+                 S* rwork,
+                 rocblas_int* info);
+
 template <typename T>
 void cblas_getri(rocblas_int n,
                  T* A,
@@ -339,6 +382,9 @@ void cblas_laswp(rocblas_int n,
                  rocblas_int* ipiv,
                  rocblas_int inc);
 
+template <typename T>
+void cblas_lauum(rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda);
+
 template <typename T>
 void cblas_org2r_ung2r(rocblas_int m,
                        rocblas_int n,
@@ -552,6 +598,19 @@ void cblas_sytrd_hetrd(rocblas_fill uplo,
                        T* work,
                        rocblas_int size_w);
 
+template <typename T, typename S>
+void cblas_sbtrd_hbtrd(rocblas_evect evect,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       rocblas_int kd,
+                       T* A,
+                       rocblas_int lda,
+                       S* D,
+                       S* E,
+                       T* Q,
+                       rocblas_int ldq,
+                       T* work);
+
 template <typename T, typename S>
 void cblas_sytd2_hetd2(rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, S* D, S* E, T* tau);
 
@@ -681,6 +740,38 @@ void cblas_syevd_heevd(rocblas_evect evect,
                        rocblas_int liwork,
                        rocblas_int* info);
 
+template <typename T, typename S>
+void cblas_sbev_hbev(rocblas_evect evect,
+                     rocblas_fill uplo,
+                     rocblas_int n,
+                     rocblas_int kd,
+                     T* A,
+                     rocblas_int lda,
+                     S* W,
+                     T* Z,
+                     rocblas_int ldz,
+                     T* work,
+                     S* rwork,
+                     rocblas_int* info);
+
+template <typename T, typename S>
+void cblas_sbevd_hbevd(rocblas_evect evect,
+                       rocblas_fill uplo,
+                       rocblas_int n,
+                       rocblas_int kd,
+                       T* A,
+                       rocblas_int lda,
+                       S* W,
+                       T* Z,
+                       rocblas_int ldz,
+                       T* work,
+                       rocblas_int lwork,
+                       S* rwork,
+                       rocblas_int lrwork,
+                       rocblas_int* iwork,
+                       rocblas_int liwork,
+                       rocblas_int* info);
+
 template <typename T, typename S>
 void cblas_syevx_heevx(rocblas_evect evect,
                        rocblas_erange erange,
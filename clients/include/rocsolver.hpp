@@ -222,6 +222,44 @@ inline rocblas_status rocsolver_laswp(rocblas_handle handle,
 }
 /*****************************************************/
 
+/******************** LAUUM ********************/
+inline rocblas_status rocsolver_lauum(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_slauum(handle, uplo, n, A, lda);
+}
+
+inline rocblas_status rocsolver_lauum(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_dlauum(handle, uplo, n, A, lda);
+}
+
+inline rocblas_status rocsolver_lauum(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_clauum(handle, uplo, n, A, lda);
+}
+
+inline rocblas_status rocsolver_lauum(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_zlauum(handle, uplo, n, A, lda);
+}
+/*****************************************************/
+
 /******************** LARFG ********************/
 inline rocblas_status rocsolver_larfg(rocblas_handle handle,
                                       rocblas_int n,
@@ -1676,6 +1714,282 @@ inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
 }
 /********************************************************/
 
+/******************** POTRF_LOGDET ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             float* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return FUSED
+            ? rocsolver_spotrf_logdet_strided_batched(handle, uplo, n, A, lda, stA, logdet, info,
+                                                      bc)
+            : rocsolver_spologdet_strided_batched(handle, n, A, lda, stA, logdet, bc);
+    else
+        return FUSED ? rocsolver_spotrf_logdet(handle, uplo, n, A, lda, logdet, info)
+                     : rocsolver_spologdet(handle, n, A, lda, logdet);
+}
+
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             double* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return FUSED
+            ? rocsolver_dpotrf_logdet_strided_batched(handle, uplo, n, A, lda, stA, logdet, info,
+                                                      bc)
+            : rocsolver_dpologdet_strided_batched(handle, n, A, lda, stA, logdet, bc);
+    else
+        return FUSED ? rocsolver_dpotrf_logdet(handle, uplo, n, A, lda, logdet, info)
+                     : rocsolver_dpologdet(handle, n, A, lda, logdet);
+}
+
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return FUSED
+            ? rocsolver_cpotrf_logdet_strided_batched(handle, uplo, n, A, lda, stA, logdet, info,
+                                                      bc)
+            : rocsolver_cpologdet_strided_batched(handle, n, A, lda, stA, logdet, bc);
+    else
+        return FUSED ? rocsolver_cpotrf_logdet(handle, uplo, n, A, lda, logdet, info)
+                     : rocsolver_cpologdet(handle, n, A, lda, logdet);
+}
+
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return FUSED
+            ? rocsolver_zpotrf_logdet_strided_batched(handle, uplo, n, A, lda, stA, logdet, info,
+                                                      bc)
+            : rocsolver_zpologdet_strided_batched(handle, n, A, lda, stA, logdet, bc);
+    else
+        return FUSED ? rocsolver_zpotrf_logdet(handle, uplo, n, A, lda, logdet, info)
+                     : rocsolver_zpologdet(handle, n, A, lda, logdet);
+}
+
+// batched
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             float* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return FUSED ? rocsolver_spotrf_logdet_batched(handle, uplo, n, A, lda, logdet, info, bc)
+                 : rocsolver_spologdet_batched(handle, n, A, lda, logdet, bc);
+}
+
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             double* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return FUSED ? rocsolver_dpotrf_logdet_batched(handle, uplo, n, A, lda, logdet, info, bc)
+                 : rocsolver_dpologdet_batched(handle, n, A, lda, logdet, bc);
+}
+
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_float_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return FUSED ? rocsolver_cpotrf_logdet_batched(handle, uplo, n, A, lda, logdet, info, bc)
+                 : rocsolver_cpologdet_batched(handle, n, A, lda, logdet, bc);
+}
+
+inline rocblas_status rocsolver_potrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_double_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return FUSED ? rocsolver_zpotrf_logdet_batched(handle, uplo, n, A, lda, logdet, info, bc)
+                 : rocsolver_zpologdet_batched(handle, n, A, lda, logdet, bc);
+}
+/********************************************************/
+
+/******************** POTRF_ROWMAJOR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_potrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               float* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_spotrf_rowmajor_strided_batched(handle, uplo, n, A, lda, stA, info, bc);
+    else
+        return rocsolver_spotrf_rowmajor(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               double* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dpotrf_rowmajor_strided_batched(handle, uplo, n, A, lda, stA, info, bc);
+    else
+        return rocsolver_dpotrf_rowmajor(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cpotrf_rowmajor_strided_batched(handle, uplo, n, A, lda, stA, info, bc);
+    else
+        return rocsolver_cpotrf_rowmajor(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zpotrf_rowmajor_strided_batched(handle, uplo, n, A, lda, stA, info, bc);
+    else
+        return rocsolver_zpotrf_rowmajor(handle, uplo, n, A, lda, info);
+}
+
+// batched
+inline rocblas_status rocsolver_potrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               float* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_spotrf_rowmajor_batched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               double* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_dpotrf_rowmajor_batched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_float_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_cpotrf_rowmajor_batched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_double_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_zpotrf_rowmajor_batched(handle, uplo, n, A, lda, info, bc);
+}
+/********************************************************/
+
 /******************** POTRS ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_potrs(bool STRIDED,
@@ -2400,6 +2714,326 @@ inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
 }
 /********************************************************/
 
+/******************** GETRF_LOGDET ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             float* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* ipiv,
+                                             rocblas_stride stP,
+                                             float* sign,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return FUSED
+            ? rocsolver_sgetrf_logdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, sign,
+                                                      logdet, info, bc)
+            : rocsolver_sgelogdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, sign, logdet,
+                                                  bc);
+    else
+        return FUSED ? rocsolver_sgetrf_logdet(handle, n, A, lda, ipiv, sign, logdet, info)
+                     : rocsolver_sgelogdet(handle, n, A, lda, ipiv, sign, logdet);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             double* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* ipiv,
+                                             rocblas_stride stP,
+                                             double* sign,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return FUSED
+            ? rocsolver_dgetrf_logdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, sign,
+                                                      logdet, info, bc)
+            : rocsolver_dgelogdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, sign, logdet,
+                                                  bc);
+    else
+        return FUSED ? rocsolver_dgetrf_logdet(handle, n, A, lda, ipiv, sign, logdet, info)
+                     : rocsolver_dgelogdet(handle, n, A, lda, ipiv, sign, logdet);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* ipiv,
+                                             rocblas_stride stP,
+                                             rocblas_float_complex* sign,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return FUSED
+            ? rocsolver_cgetrf_logdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, sign,
+                                                      logdet, info, bc)
+            : rocsolver_cgelogdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, sign, logdet,
+                                                  bc);
+    else
+        return FUSED ? rocsolver_cgetrf_logdet(handle, n, A, lda, ipiv, sign, logdet, info)
+                     : rocsolver_cgelogdet(handle, n, A, lda, ipiv, sign, logdet);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* ipiv,
+                                             rocblas_stride stP,
+                                             rocblas_double_complex* sign,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(STRIDED)
+        return FUSED
+            ? rocsolver_zgetrf_logdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, sign,
+                                                      logdet, info, bc)
+            : rocsolver_zgelogdet_strided_batched(handle, n, A, lda, stA, ipiv, stP, sign, logdet,
+                                                  bc);
+    else
+        return FUSED ? rocsolver_zgetrf_logdet(handle, n, A, lda, ipiv, sign, logdet, info)
+                     : rocsolver_zgelogdet(handle, n, A, lda, ipiv, sign, logdet);
+}
+
+// batched
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             float* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* ipiv,
+                                             rocblas_stride stP,
+                                             float* sign,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return FUSED ? rocsolver_sgetrf_logdet_batched(handle, n, A, lda, ipiv, stP, sign, logdet, info,
+                                                   bc)
+                 : rocsolver_sgelogdet_batched(handle, n, A, lda, ipiv, stP, sign, logdet, bc);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             double* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* ipiv,
+                                             rocblas_stride stP,
+                                             double* sign,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return FUSED ? rocsolver_dgetrf_logdet_batched(handle, n, A, lda, ipiv, stP, sign, logdet, info,
+                                                   bc)
+                 : rocsolver_dgelogdet_batched(handle, n, A, lda, ipiv, stP, sign, logdet, bc);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_float_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* ipiv,
+                                             rocblas_stride stP,
+                                             rocblas_float_complex* sign,
+                                             float* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return FUSED ? rocsolver_cgetrf_logdet_batched(handle, n, A, lda, ipiv, stP, sign, logdet, info,
+                                                   bc)
+                 : rocsolver_cgelogdet_batched(handle, n, A, lda, ipiv, stP, sign, logdet, bc);
+}
+
+inline rocblas_status rocsolver_getrf_logdet(bool STRIDED,
+                                             bool FUSED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_double_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* ipiv,
+                                             rocblas_stride stP,
+                                             rocblas_double_complex* sign,
+                                             double* logdet,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return FUSED ? rocsolver_zgetrf_logdet_batched(handle, n, A, lda, ipiv, stP, sign, logdet, info,
+                                                   bc)
+                 : rocsolver_zgelogdet_batched(handle, n, A, lda, ipiv, stP, sign, logdet, bc);
+}
+/********************************************************/
+
+/******************** GETRF_ROWMAJOR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               float* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgetrf_rowmajor_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info,
+                                                         bc);
+    else
+        return rocsolver_sgetrf_rowmajor(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               double* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgetrf_rowmajor_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info,
+                                                         bc);
+    else
+        return rocsolver_dgetrf_rowmajor(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgetrf_rowmajor_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info,
+                                                         bc);
+    else
+        return rocsolver_cgetrf_rowmajor(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgetrf_rowmajor_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info,
+                                                         bc);
+    else
+        return rocsolver_zgetrf_rowmajor(handle, m, n, A, lda, ipiv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_getrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               float* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_sgetrf_rowmajor_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               double* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_dgetrf_rowmajor_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_float_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_cgetrf_rowmajor_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_double_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_zgetrf_rowmajor_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+/********************************************************/
+
 /******************** GESVD ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_gesvd(bool STRIDED,
@@ -2628,6 +3262,246 @@ inline rocblas_status rocsolver_gesvd(bool STRIDED,
 }
 /********************************************************/
 
+/******************** GESVD_ROWMAJOR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvd_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_svect leftv,
+                                               rocblas_svect rightv,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               float* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               float* S,
+                                               rocblas_stride stS,
+                                               float* U,
+                                               rocblas_int ldu,
+                                               rocblas_stride stU,
+                                               float* V,
+                                               rocblas_int ldv,
+                                               rocblas_stride stV,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgesvd_rowmajor_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                         S, stS, U, ldu, stU, V, ldv, stV, E, stE,
+                                                         fast_alg, info, bc);
+    else
+        return rocsolver_sgesvd_rowmajor(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E,
+                                         fast_alg, info);
+}
+
+inline rocblas_status rocsolver_gesvd_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_svect leftv,
+                                               rocblas_svect rightv,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               double* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               double* S,
+                                               rocblas_stride stS,
+                                               double* U,
+                                               rocblas_int ldu,
+                                               rocblas_stride stU,
+                                               double* V,
+                                               rocblas_int ldv,
+                                               rocblas_stride stV,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgesvd_rowmajor_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                         S, stS, U, ldu, stU, V, ldv, stV, E, stE,
+                                                         fast_alg, info, bc);
+    else
+        return rocsolver_dgesvd_rowmajor(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E,
+                                         fast_alg, info);
+}
+
+inline rocblas_status rocsolver_gesvd_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_svect leftv,
+                                               rocblas_svect rightv,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               float* S,
+                                               rocblas_stride stS,
+                                               rocblas_float_complex* U,
+                                               rocblas_int ldu,
+                                               rocblas_stride stU,
+                                               rocblas_float_complex* V,
+                                               rocblas_int ldv,
+                                               rocblas_stride stV,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgesvd_rowmajor_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                         S, stS, U, ldu, stU, V, ldv, stV, E, stE,
+                                                         fast_alg, info, bc);
+    else
+        return rocsolver_cgesvd_rowmajor(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E,
+                                         fast_alg, info);
+}
+
+inline rocblas_status rocsolver_gesvd_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_svect leftv,
+                                               rocblas_svect rightv,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               double* S,
+                                               rocblas_stride stS,
+                                               rocblas_double_complex* U,
+                                               rocblas_int ldu,
+                                               rocblas_stride stU,
+                                               rocblas_double_complex* V,
+                                               rocblas_int ldv,
+                                               rocblas_stride stV,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgesvd_rowmajor_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                         S, stS, U, ldu, stU, V, ldv, stV, E, stE,
+                                                         fast_alg, info, bc);
+    else
+        return rocsolver_zgesvd_rowmajor(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E,
+                                         fast_alg, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvd_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_svect leftv,
+                                               rocblas_svect rightv,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               float* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               float* S,
+                                               rocblas_stride stS,
+                                               float* U,
+                                               rocblas_int ldu,
+                                               rocblas_stride stU,
+                                               float* V,
+                                               rocblas_int ldv,
+                                               rocblas_stride stV,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_sgesvd_rowmajor_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu,
+                                             stU, V, ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_svect leftv,
+                                               rocblas_svect rightv,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               double* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               double* S,
+                                               rocblas_stride stS,
+                                               double* U,
+                                               rocblas_int ldu,
+                                               rocblas_stride stU,
+                                               double* V,
+                                               rocblas_int ldv,
+                                               rocblas_stride stV,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_dgesvd_rowmajor_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu,
+                                             stU, V, ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_svect leftv,
+                                               rocblas_svect rightv,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_float_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               float* S,
+                                               rocblas_stride stS,
+                                               rocblas_float_complex* U,
+                                               rocblas_int ldu,
+                                               rocblas_stride stU,
+                                               rocblas_float_complex* V,
+                                               rocblas_int ldv,
+                                               rocblas_stride stV,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_cgesvd_rowmajor_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu,
+                                             stU, V, ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_rowmajor(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_svect leftv,
+                                               rocblas_svect rightv,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_double_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               double* S,
+                                               rocblas_stride stS,
+                                               rocblas_double_complex* U,
+                                               rocblas_int ldu,
+                                               rocblas_stride stU,
+                                               rocblas_double_complex* V,
+                                               rocblas_int ldv,
+                                               rocblas_stride stV,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_workmode fast_alg,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_zgesvd_rowmajor_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu,
+                                             stU, V, ldv, stV, E, stE, fast_alg, info, bc);
+}
+/********************************************************/
+
 /******************** GETRS ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_getrs(bool STRIDED,
@@ -3957,100 +4831,646 @@ inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
 }
 /********************************************************/
 
-/******************** GERQ2_GERQF ********************/
+/******************** GEQRT ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqrt(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      float* T,
+                                      rocblas_int ldt,
+                                      rocblas_stride stT,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GERQF ? rocsolver_sgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
-    else
-        return GERQF ? rocsolver_sgerqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgerq2(handle, m, n, A, lda, ipiv);
+    return STRIDED ? rocsolver_sgeqrt_strided_batched(handle, m, n, nb, A, lda, stA, ipiv, stP, T,
+                                                      ldt, stT, bc)
+                   : rocsolver_sgeqrt(handle, m, n, nb, A, lda, ipiv, T, ldt);
 }
 
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqrt(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      double* T,
+                                      rocblas_int ldt,
+                                      rocblas_stride stT,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GERQF ? rocsolver_dgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
-    else
-        return GERQF ? rocsolver_dgerqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgerq2(handle, m, n, A, lda, ipiv);
+    return STRIDED ? rocsolver_dgeqrt_strided_batched(handle, m, n, nb, A, lda, stA, ipiv, stP, T,
+                                                      ldt, stT, bc)
+                   : rocsolver_dgeqrt(handle, m, n, nb, A, lda, ipiv, T, ldt);
 }
 
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqrt(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* T,
+                                      rocblas_int ldt,
+                                      rocblas_stride stT,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GERQF ? rocsolver_cgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
-    else
-        return GERQF ? rocsolver_cgerqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgerq2(handle, m, n, A, lda, ipiv);
+    return STRIDED ? rocsolver_cgeqrt_strided_batched(handle, m, n, nb, A, lda, stA, ipiv, stP, T,
+                                                      ldt, stT, bc)
+                   : rocsolver_cgeqrt(handle, m, n, nb, A, lda, ipiv, T, ldt);
 }
 
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqrt(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* T,
+                                      rocblas_int ldt,
+                                      rocblas_stride stT,
+                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return GERQF ? rocsolver_zgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
-    else
-        return GERQF ? rocsolver_zgerqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgerq2(handle, m, n, A, lda, ipiv);
+    return STRIDED ? rocsolver_zgeqrt_strided_batched(handle, m, n, nb, A, lda, stA, ipiv, stP, T,
+                                                      ldt, stT, bc)
+                   : rocsolver_zgeqrt(handle, m, n, nb, A, lda, ipiv, T, ldt);
 }
 
 // batched
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqrt(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      float* T,
+                                      rocblas_int ldt,
+                                      rocblas_stride stT,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgeqrt_batched(handle, m, n, nb, A, lda, ipiv, stP, T, ldt, stT, bc);
+}
+
+inline rocblas_status rocsolver_geqrt(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      double* T,
+                                      rocblas_int ldt,
+                                      rocblas_stride stT,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgeqrt_batched(handle, m, n, nb, A, lda, ipiv, stP, T, ldt, stT, bc);
+}
+
+inline rocblas_status rocsolver_geqrt(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* T,
+                                      rocblas_int ldt,
+                                      rocblas_stride stT,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgeqrt_batched(handle, m, n, nb, A, lda, ipiv, stP, T, ldt, stT, bc);
+}
+
+inline rocblas_status rocsolver_geqrt(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* T,
+                                      rocblas_int ldt,
+                                      rocblas_stride stT,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgeqrt_batched(handle, m, n, nb, A, lda, ipiv, stP, T, ldt, stT, bc);
+}
+/********************************************************/
+
+/******************** GEMQRT ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gemqrt(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       float* T,
+                                       rocblas_int ldt,
+                                       rocblas_stride stT,
+                                       float* C,
+                                       rocblas_int ldc,
+                                       rocblas_stride stC,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgemqrt_strided_batched(handle, side, trans, m, n, k, nb, V, ldv,
+                                                       stV, T, ldt, stT, C, ldc, stC, bc)
+                   : rocsolver_sgemqrt(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, C, ldc);
+}
+
+inline rocblas_status rocsolver_gemqrt(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       double* T,
+                                       rocblas_int ldt,
+                                       rocblas_stride stT,
+                                       double* C,
+                                       rocblas_int ldc,
+                                       rocblas_stride stC,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgemqrt_strided_batched(handle, side, trans, m, n, k, nb, V, ldv,
+                                                       stV, T, ldt, stT, C, ldc, stC, bc)
+                   : rocsolver_dgemqrt(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, C, ldc);
+}
+
+inline rocblas_status rocsolver_gemqrt(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_float_complex* T,
+                                       rocblas_int ldt,
+                                       rocblas_stride stT,
+                                       rocblas_float_complex* C,
+                                       rocblas_int ldc,
+                                       rocblas_stride stC,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgemqrt_strided_batched(handle, side, trans, m, n, k, nb, V, ldv,
+                                                       stV, T, ldt, stT, C, ldc, stC, bc)
+                   : rocsolver_cgemqrt(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, C, ldc);
+}
+
+inline rocblas_status rocsolver_gemqrt(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_double_complex* T,
+                                       rocblas_int ldt,
+                                       rocblas_stride stT,
+                                       rocblas_double_complex* C,
+                                       rocblas_int ldc,
+                                       rocblas_stride stC,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgemqrt_strided_batched(handle, side, trans, m, n, k, nb, V, ldv,
+                                                       stV, T, ldt, stT, C, ldc, stC, bc)
+                   : rocsolver_zgemqrt(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, C, ldc);
+}
+
+// batched
+inline rocblas_status rocsolver_gemqrt(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       float* const V[],
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       float* T,
+                                       rocblas_int ldt,
+                                       rocblas_stride stT,
+                                       float* const C[],
+                                       rocblas_int ldc,
+                                       rocblas_stride stC,
+                                       rocblas_int bc)
+{
+    return rocsolver_sgemqrt_batched(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, stT, C, ldc,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gemqrt(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       double* const V[],
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       double* T,
+                                       rocblas_int ldt,
+                                       rocblas_stride stT,
+                                       double* const C[],
+                                       rocblas_int ldc,
+                                       rocblas_stride stC,
+                                       rocblas_int bc)
+{
+    return rocsolver_dgemqrt_batched(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, stT, C, ldc,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gemqrt(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       rocblas_float_complex* const V[],
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_float_complex* T,
+                                       rocblas_int ldt,
+                                       rocblas_stride stT,
+                                       rocblas_float_complex* const C[],
+                                       rocblas_int ldc,
+                                       rocblas_stride stC,
+                                       rocblas_int bc)
+{
+    return rocsolver_cgemqrt_batched(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, stT, C, ldc,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gemqrt(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       rocblas_double_complex* const V[],
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_double_complex* T,
+                                       rocblas_int ldt,
+                                       rocblas_stride stT,
+                                       rocblas_double_complex* const C[],
+                                       rocblas_int ldc,
+                                       rocblas_stride stC,
+                                       rocblas_int bc)
+{
+    return rocsolver_zgemqrt_batched(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, stT, C, ldc,
+                                     bc);
+}
+/********************************************************/
+
+/******************** ORGQRT_UNGQRT ********************/
+inline rocblas_status rocsolver_orgqrt_ungqrt(rocblas_handle handle,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int k,
+                                              rocblas_int nb,
+                                              float* A,
+                                              rocblas_int lda,
+                                              float* Ipiv,
+                                              float* T,
+                                              rocblas_int ldt)
+{
+    return rocsolver_sorgqrt(handle, m, n, k, nb, A, lda, Ipiv, T, ldt);
+}
+
+inline rocblas_status rocsolver_orgqrt_ungqrt(rocblas_handle handle,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int k,
+                                              rocblas_int nb,
+                                              double* A,
+                                              rocblas_int lda,
+                                              double* Ipiv,
+                                              double* T,
+                                              rocblas_int ldt)
+{
+    return rocsolver_dorgqrt(handle, m, n, k, nb, A, lda, Ipiv, T, ldt);
+}
+
+inline rocblas_status rocsolver_orgqrt_ungqrt(rocblas_handle handle,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int k,
+                                              rocblas_int nb,
+                                              rocblas_float_complex* A,
+                                              rocblas_int lda,
+                                              rocblas_float_complex* Ipiv,
+                                              rocblas_float_complex* T,
+                                              rocblas_int ldt)
+{
+    return rocsolver_cungqrt(handle, m, n, k, nb, A, lda, Ipiv, T, ldt);
+}
+
+inline rocblas_status rocsolver_orgqrt_ungqrt(rocblas_handle handle,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int k,
+                                              rocblas_int nb,
+                                              rocblas_double_complex* A,
+                                              rocblas_int lda,
+                                              rocblas_double_complex* Ipiv,
+                                              rocblas_double_complex* T,
+                                              rocblas_int ldt)
+{
+    return rocsolver_zungqrt(handle, m, n, k, nb, A, lda, Ipiv, T, ldt);
+}
+/********************************************************/
+
+/******************** CHOLQR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_scholqr_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, info,
+                                                       bc)
+                   : rocsolver_scholqr(handle, m, n, A, lda, R, ldr, info);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dcholqr_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, info,
+                                                       bc)
+                   : rocsolver_dcholqr(handle, m, n, A, lda, R, ldr, info);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_float_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ccholqr_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, info,
+                                                       bc)
+                   : rocsolver_ccholqr(handle, m, n, A, lda, R, ldr, info);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_double_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zcholqr_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, info,
+                                                       bc)
+                   : rocsolver_zcholqr(handle, m, n, A, lda, R, ldr, info);
+}
+
+// batched
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_scholqr_batched(handle, m, n, A, lda, R, ldr, stR, info, bc);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_dcholqr_batched(handle, m, n, A, lda, R, ldr, stR, info, bc);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_float_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_ccholqr_batched(handle, m, n, A, lda, R, ldr, stR, info, bc);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_double_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_zcholqr_batched(handle, m, n, A, lda, R, ldr, stR, info, bc);
+}
+/********************************************************/
+
+/******************** GERQ2_GERQF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GERQF ? rocsolver_sgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GERQF ? rocsolver_sgerqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgerq2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GERQF ? rocsolver_dgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GERQF ? rocsolver_dgerqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgerq2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GERQF ? rocsolver_cgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GERQF ? rocsolver_cgerqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgerq2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GERQF ? rocsolver_zgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GERQF ? rocsolver_zgerqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgerq2(handle, m, n, A, lda, ipiv);
+}
+
+// batched
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
     return GERQF ? rocsolver_sgerqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
                  : rocsolver_sgerq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
@@ -4565,6 +5985,170 @@ inline rocblas_status rocsolver_gels(bool STRIDED,
 }
 /********************************************************/
 
+/******************** GELS_ROWMAJOR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gels_rowmajor(bool STRIDED,
+                                              rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int nrhs,
+                                              float* A,
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              float* B,
+                                              rocblas_int ldb,
+                                              rocblas_stride stB,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgels_rowmajor_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B,
+                                                        ldb, stB, info, bc);
+    else
+        return rocsolver_sgels_rowmajor(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels_rowmajor(bool STRIDED,
+                                              rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int nrhs,
+                                              double* A,
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              double* B,
+                                              rocblas_int ldb,
+                                              rocblas_stride stB,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgels_rowmajor_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B,
+                                                        ldb, stB, info, bc);
+    else
+        return rocsolver_dgels_rowmajor(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels_rowmajor(bool STRIDED,
+                                              rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int nrhs,
+                                              rocblas_float_complex* A,
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              rocblas_float_complex* B,
+                                              rocblas_int ldb,
+                                              rocblas_stride stB,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgels_rowmajor_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B,
+                                                        ldb, stB, info, bc);
+    else
+        return rocsolver_cgels_rowmajor(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels_rowmajor(bool STRIDED,
+                                              rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int nrhs,
+                                              rocblas_double_complex* A,
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              rocblas_double_complex* B,
+                                              rocblas_int ldb,
+                                              rocblas_stride stB,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgels_rowmajor_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B,
+                                                        ldb, stB, info, bc);
+    else
+        return rocsolver_zgels_rowmajor(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gels_rowmajor(bool STRIDED,
+                                              rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int nrhs,
+                                              float* const A[],
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              float* const B[],
+                                              rocblas_int ldb,
+                                              rocblas_stride stB,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
+{
+    return rocsolver_sgels_rowmajor_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_rowmajor(bool STRIDED,
+                                              rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int nrhs,
+                                              double* const A[],
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              double* const B[],
+                                              rocblas_int ldb,
+                                              rocblas_stride stB,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
+{
+    return rocsolver_dgels_rowmajor_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_rowmajor(bool STRIDED,
+                                              rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int nrhs,
+                                              rocblas_float_complex* const A[],
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              rocblas_float_complex* const B[],
+                                              rocblas_int ldb,
+                                              rocblas_stride stB,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
+{
+    return rocsolver_cgels_rowmajor_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_rowmajor(bool STRIDED,
+                                              rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int nrhs,
+                                              rocblas_double_complex* const A[],
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              rocblas_double_complex* const B[],
+                                              rocblas_int ldb,
+                                              rocblas_stride stB,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
+{
+    return rocsolver_zgels_rowmajor_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+/********************************************************/
+
 /******************** GELS_OUTOFPLACE ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
@@ -4749,114 +6333,422 @@ inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
 }
 /********************************************************/
 
-/******************** GEBD2_GEBRD ********************/
+/******************** GELS_FACTOR ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gels_factor(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tauq,
-                                            rocblas_stride stQ,
-                                            float* taup,
+                                            float* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GEBRD ? rocsolver_sgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_sgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
-    else
-        return GEBRD ? rocsolver_sgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_sgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+    return STRIDED ? rocsolver_sgels_factor_strided_batched(handle, m, n, A, lda, stA, ipiv, stP,
+                                                            info, bc)
+                   : rocsolver_sgels_factor(handle, m, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gels_factor(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tauq,
-                                            rocblas_stride stQ,
-                                            double* taup,
+                                            double* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GEBRD ? rocsolver_dgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_dgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
-    else
-        return GEBRD ? rocsolver_dgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_dgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+    return STRIDED ? rocsolver_dgels_factor_strided_batched(handle, m, n, A, lda, stA, ipiv, stP,
+                                                            info, bc)
+                   : rocsolver_dgels_factor(handle, m, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gels_factor(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_float_complex* taup,
+                                            rocblas_float_complex* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GEBRD ? rocsolver_cgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_cgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
-    else
-        return GEBRD ? rocsolver_cgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_cgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+    return STRIDED ? rocsolver_cgels_factor_strided_batched(handle, m, n, A, lda, stA, ipiv, stP,
+                                                            info, bc)
+                   : rocsolver_cgels_factor(handle, m, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gels_factor(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_double_complex* taup,
+                                            rocblas_double_complex* ipiv,
                                             rocblas_stride stP,
+                                            rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return GEBRD ? rocsolver_zgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_zgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+    return STRIDED ? rocsolver_zgels_factor_strided_batched(handle, m, n, A, lda, stA, ipiv, stP,
+                                                            info, bc)
+                   : rocsolver_zgels_factor(handle, m, n, A, lda, ipiv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gels_factor(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_sgels_factor_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_factor(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_dgels_factor_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_factor(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_cgels_factor_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_factor(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_zgels_factor_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+/********************************************************/
+
+/******************** GELS_SOLVE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gels_solve(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_operation trans,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           float* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           float* ipiv,
+                                           rocblas_stride stP,
+                                           float* B,
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgels_solve_strided_batched(handle, trans, m, n, nrhs, A, lda, stA,
+                                                           ipiv, stP, B, ldb, stB, info, bc)
+                   : rocsolver_sgels_solve(handle, trans, m, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels_solve(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_operation trans,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           double* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           double* ipiv,
+                                           rocblas_stride stP,
+                                           double* B,
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgels_solve_strided_batched(handle, trans, m, n, nrhs, A, lda, stA,
+                                                           ipiv, stP, B, ldb, stB, info, bc)
+                   : rocsolver_dgels_solve(handle, trans, m, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels_solve(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_operation trans,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           rocblas_float_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_float_complex* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_float_complex* B,
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgels_solve_strided_batched(handle, trans, m, n, nrhs, A, lda, stA,
+                                                           ipiv, stP, B, ldb, stB, info, bc)
+                   : rocsolver_cgels_solve(handle, trans, m, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels_solve(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_operation trans,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           rocblas_double_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_double_complex* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_double_complex* B,
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgels_solve_strided_batched(handle, trans, m, n, nrhs, A, lda, stA,
+                                                           ipiv, stP, B, ldb, stB, info, bc)
+                   : rocsolver_zgels_solve(handle, trans, m, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gels_solve(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_operation trans,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           float* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           float* ipiv,
+                                           rocblas_stride stP,
+                                           float* const B[],
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_sgels_solve_batched(handle, trans, m, n, nrhs, A, lda, ipiv, stP, B, ldb, info,
+                                         bc);
+}
+
+inline rocblas_status rocsolver_gels_solve(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_operation trans,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           double* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           double* ipiv,
+                                           rocblas_stride stP,
+                                           double* const B[],
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_dgels_solve_batched(handle, trans, m, n, nrhs, A, lda, ipiv, stP, B, ldb, info,
+                                         bc);
+}
+
+inline rocblas_status rocsolver_gels_solve(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_operation trans,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           rocblas_float_complex* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_float_complex* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_float_complex* const B[],
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_cgels_solve_batched(handle, trans, m, n, nrhs, A, lda, ipiv, stP, B, ldb, info,
+                                         bc);
+}
+
+inline rocblas_status rocsolver_gels_solve(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_operation trans,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           rocblas_double_complex* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_double_complex* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_double_complex* const B[],
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_zgels_solve_batched(handle, trans, m, n, nrhs, A, lda, ipiv, stP, B, ldb, info,
+                                         bc);
+}
+/********************************************************/
+
+/******************** GEBD2_GEBRD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tauq,
+                                            rocblas_stride stQ,
+                                            float* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_sgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_sgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_sgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_sgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tauq,
+                                            rocblas_stride stQ,
+                                            double* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_dgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_dgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_dgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_dgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_cgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_cgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_cgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_cgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_zgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_zgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
                                                         tauq, stQ, taup, stP, bc);
     else
         return GEBRD ? rocsolver_zgebrd(handle, m, n, A, lda, D, E, tauq, taup)
@@ -5145,21 +7037,201 @@ inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
 }
 /********************************************************/
 
-/******************** SYGS2/SYGST_HEGS2/HEGST ********************/
+/******************** SBTRD/HBTRD ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
+inline rocblas_status rocsolver_sbtrd_hbtrd(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
+                                            rocblas_int kd,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            rocblas_int bc)
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssbtrd_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                      stD, E, stE, Q, ldq, stQ, bc)
+                   : rocsolver_ssbtrd(handle, evect, uplo, n, kd, A, lda, D, E, Q, ldq);
+}
+
+inline rocblas_status rocsolver_sbtrd_hbtrd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_int kd,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsbtrd_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                      stD, E, stE, Q, ldq, stQ, bc)
+                   : rocsolver_dsbtrd(handle, evect, uplo, n, kd, A, lda, D, E, Q, ldq);
+}
+
+inline rocblas_status rocsolver_sbtrd_hbtrd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_int kd,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_chbtrd_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                      stD, E, stE, Q, ldq, stQ, bc)
+                   : rocsolver_chbtrd(handle, evect, uplo, n, kd, A, lda, D, E, Q, ldq);
+}
+
+inline rocblas_status rocsolver_sbtrd_hbtrd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_int kd,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* Q,
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zhbtrd_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                      stD, E, stE, Q, ldq, stQ, bc)
+                   : rocsolver_zhbtrd(handle, evect, uplo, n, kd, A, lda, D, E, Q, ldq);
+}
+
+// batched
+inline rocblas_status rocsolver_sbtrd_hbtrd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_int kd,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_int bc)
+{
+    return rocsolver_ssbtrd_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Q, ldq, bc);
+}
+
+inline rocblas_status rocsolver_sbtrd_hbtrd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_int kd,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_int bc)
+{
+    return rocsolver_dsbtrd_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Q, ldq, bc);
+}
+
+inline rocblas_status rocsolver_sbtrd_hbtrd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_int kd,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_int bc)
+{
+    return rocsolver_chbtrd_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Q, ldq, bc);
+}
+
+inline rocblas_status rocsolver_sbtrd_hbtrd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_int kd,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* const Q[],
+                                            rocblas_int ldq,
+                                            rocblas_stride stQ,
+                                            rocblas_int bc)
+{
+    return rocsolver_zhbtrd_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Q, ldq, bc);
+}
+/********************************************************/
+
+/******************** SYGS2/SYGST_HEGS2/HEGST ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
 {
     if(STRIDED)
         return SYGST
@@ -5625,659 +7697,394 @@ inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
 }
 /********************************************************/
 
-/******************** SYEVX/HEEVX ********************/
+/******************** SBEV/HBEV ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float vl,
-                                            float vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            float abstol,
-                                            rocblas_int* nev,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            float* Z,
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
-{
-    return STRIDED ? rocsolver_ssyevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
-                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
-                                                      stZ, ifail, stF, info, bc)
-                   : rocsolver_ssyevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
-                                      abstol, nev, W, Z, ldz, ifail, info);
-}
-
-inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double vl,
-                                            double vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            double abstol,
-                                            rocblas_int* nev,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            double* Z,
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sbev_hbev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_int kd,
+                                          float* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          float* Z,
+                                          rocblas_int ldz,
+                                          rocblas_stride stZ,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dsyevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
-                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
-                                                      stZ, ifail, stF, info, bc)
-                   : rocsolver_dsyevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
-                                      abstol, nev, W, Z, ldz, ifail, info);
+    return STRIDED ? rocsolver_ssbev_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                     stD, E, stE, Z, ldz, stZ, info, bc)
+                   : rocsolver_ssbev(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz, info);
 }
 
-inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float vl,
-                                            float vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            float abstol,
-                                            rocblas_int* nev,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            rocblas_float_complex* Z,
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sbev_hbev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_int kd,
+                                          double* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          double* Z,
+                                          rocblas_int ldz,
+                                          rocblas_stride stZ,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cheevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
-                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
-                                                      stZ, ifail, stF, info, bc)
-                   : rocsolver_cheevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
-                                      abstol, nev, W, Z, ldz, ifail, info);
+    return STRIDED ? rocsolver_dsbev_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                     stD, E, stE, Z, ldz, stZ, info, bc)
+                   : rocsolver_dsbev(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz, info);
 }
 
-inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double vl,
-                                            double vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            double abstol,
-                                            rocblas_int* nev,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            rocblas_double_complex* Z,
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
-{
-    return STRIDED ? rocsolver_zheevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
-                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
-                                                      stZ, ifail, stF, info, bc)
-                   : rocsolver_zheevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
-                                      abstol, nev, W, Z, ldz, ifail, info);
-}
-
-// batched
-inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float vl,
-                                            float vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            float abstol,
-                                            rocblas_int* nev,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            float* const Z[],
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
-{
-    return rocsolver_ssyevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
-                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
-}
-
-inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double vl,
-                                            double vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            double abstol,
-                                            rocblas_int* nev,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            double* const Z[],
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
-{
-    return rocsolver_dsyevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
-                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
-}
-
-inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float vl,
-                                            float vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            float abstol,
-                                            rocblas_int* nev,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            rocblas_float_complex* const Z[],
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
-{
-    return rocsolver_cheevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
-                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
-}
-
-inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double vl,
-                                            double vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            double abstol,
-                                            rocblas_int* nev,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            rocblas_double_complex* const Z[],
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
-{
-    return rocsolver_zheevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
-                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
-}
-/********************************************************/
-
-/******************** SYGV_HEGV ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_eform itype,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          float* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* B,
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
-{
-    if(STRIDED)
-        return rocsolver_ssygv_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                               stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_ssygv(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
-}
-
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_eform itype,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          double* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* B,
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
-{
-    if(STRIDED)
-        return rocsolver_dsygv_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                               stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_dsygv(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
-}
-
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+inline rocblas_status rocsolver_sbev_hbev(bool STRIDED,
                                           rocblas_handle handle,
-                                          rocblas_eform itype,
                                           rocblas_evect evect,
                                           rocblas_fill uplo,
                                           rocblas_int n,
+                                          rocblas_int kd,
                                           rocblas_float_complex* A,
                                           rocblas_int lda,
                                           rocblas_stride stA,
-                                          rocblas_float_complex* B,
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
                                           float* D,
                                           rocblas_stride stD,
                                           float* E,
                                           rocblas_stride stE,
+                                          rocblas_float_complex* Z,
+                                          rocblas_int ldz,
+                                          rocblas_stride stZ,
                                           rocblas_int* info,
                                           rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_chegv_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                               stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_chegv(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+    return STRIDED ? rocsolver_chbev_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                     stD, E, stE, Z, ldz, stZ, info, bc)
+                   : rocsolver_chbev(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz, info);
 }
 
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+inline rocblas_status rocsolver_sbev_hbev(bool STRIDED,
                                           rocblas_handle handle,
-                                          rocblas_eform itype,
                                           rocblas_evect evect,
                                           rocblas_fill uplo,
                                           rocblas_int n,
+                                          rocblas_int kd,
                                           rocblas_double_complex* A,
                                           rocblas_int lda,
                                           rocblas_stride stA,
-                                          rocblas_double_complex* B,
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
                                           double* D,
                                           rocblas_stride stD,
                                           double* E,
                                           rocblas_stride stE,
+                                          rocblas_double_complex* Z,
+                                          rocblas_int ldz,
+                                          rocblas_stride stZ,
                                           rocblas_int* info,
                                           rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_zhegv_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                               stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_zhegv(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+    return STRIDED ? rocsolver_zhbev_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                     stD, E, stE, Z, ldz, stZ, info, bc)
+                   : rocsolver_zhbev(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+inline rocblas_status rocsolver_sbev_hbev(bool STRIDED,
                                           rocblas_handle handle,
-                                          rocblas_eform itype,
                                           rocblas_evect evect,
                                           rocblas_fill uplo,
                                           rocblas_int n,
+                                          rocblas_int kd,
                                           float* const A[],
                                           rocblas_int lda,
                                           rocblas_stride stA,
-                                          float* const B[],
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
                                           float* D,
                                           rocblas_stride stD,
                                           float* E,
                                           rocblas_stride stE,
+                                          float* const Z[],
+                                          rocblas_int ldz,
+                                          rocblas_stride stZ,
                                           rocblas_int* info,
                                           rocblas_int bc)
 {
-    return rocsolver_ssygv_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                   info, bc);
+    return rocsolver_ssbev_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Z, ldz, info,
+                                   bc);
 }
 
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+inline rocblas_status rocsolver_sbev_hbev(bool STRIDED,
                                           rocblas_handle handle,
-                                          rocblas_eform itype,
                                           rocblas_evect evect,
                                           rocblas_fill uplo,
                                           rocblas_int n,
+                                          rocblas_int kd,
                                           double* const A[],
                                           rocblas_int lda,
                                           rocblas_stride stA,
-                                          double* const B[],
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
                                           double* D,
                                           rocblas_stride stD,
                                           double* E,
                                           rocblas_stride stE,
+                                          double* const Z[],
+                                          rocblas_int ldz,
+                                          rocblas_stride stZ,
                                           rocblas_int* info,
                                           rocblas_int bc)
 {
-    return rocsolver_dsygv_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                   info, bc);
+    return rocsolver_dsbev_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Z, ldz, info,
+                                   bc);
 }
 
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+inline rocblas_status rocsolver_sbev_hbev(bool STRIDED,
                                           rocblas_handle handle,
-                                          rocblas_eform itype,
                                           rocblas_evect evect,
                                           rocblas_fill uplo,
                                           rocblas_int n,
+                                          rocblas_int kd,
                                           rocblas_float_complex* const A[],
                                           rocblas_int lda,
                                           rocblas_stride stA,
-                                          rocblas_float_complex* const B[],
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
                                           float* D,
                                           rocblas_stride stD,
                                           float* E,
                                           rocblas_stride stE,
+                                          rocblas_float_complex* const Z[],
+                                          rocblas_int ldz,
+                                          rocblas_stride stZ,
                                           rocblas_int* info,
                                           rocblas_int bc)
 {
-    return rocsolver_chegv_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                   info, bc);
+    return rocsolver_chbev_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Z, ldz, info,
+                                   bc);
 }
 
-inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+inline rocblas_status rocsolver_sbev_hbev(bool STRIDED,
                                           rocblas_handle handle,
-                                          rocblas_eform itype,
                                           rocblas_evect evect,
                                           rocblas_fill uplo,
                                           rocblas_int n,
+                                          rocblas_int kd,
                                           rocblas_double_complex* const A[],
                                           rocblas_int lda,
                                           rocblas_stride stA,
-                                          rocblas_double_complex* const B[],
-                                          rocblas_int ldb,
-                                          rocblas_stride stB,
                                           double* D,
                                           rocblas_stride stD,
                                           double* E,
                                           rocblas_stride stE,
+                                          rocblas_double_complex* const Z[],
+                                          rocblas_int ldz,
+                                          rocblas_stride stZ,
                                           rocblas_int* info,
                                           rocblas_int bc)
 {
-    return rocsolver_zhegv_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                   info, bc);
+    return rocsolver_zhbev_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Z, ldz, info,
+                                   bc);
 }
 /********************************************************/
 
-/******************** SYGVD_HEGVD ********************/
+/******************** SBEVD/HBEVD ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sbevd_hbevd(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
+                                            rocblas_int kd,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             float* D,
                                             rocblas_stride stD,
                                             float* E,
                                             rocblas_stride stE,
+                                            float* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_ssygvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                                stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_ssygvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+    return STRIDED ? rocsolver_ssbevd_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                      stD, E, stE, Z, ldz, stZ, info, bc)
+                   : rocsolver_ssbevd(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz, info);
 }
 
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sbevd_hbevd(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
+                                            rocblas_int kd,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             double* D,
                                             rocblas_stride stD,
                                             double* E,
                                             rocblas_stride stE,
+                                            double* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_dsygvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                                stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_dsygvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+    return STRIDED ? rocsolver_dsbevd_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                      stD, E, stE, Z, ldz, stZ, info, bc)
+                   : rocsolver_dsbevd(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz, info);
 }
 
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sbevd_hbevd(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
+                                            rocblas_int kd,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             float* D,
                                             rocblas_stride stD,
                                             float* E,
                                             rocblas_stride stE,
+                                            rocblas_float_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_chegvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                                stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_chegvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+    return STRIDED ? rocsolver_chbevd_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                      stD, E, stE, Z, ldz, stZ, info, bc)
+                   : rocsolver_chbevd(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz, info);
 }
 
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sbevd_hbevd(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
+                                            rocblas_int kd,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             double* D,
                                             rocblas_stride stD,
                                             double* E,
                                             rocblas_stride stE,
+                                            rocblas_double_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_zhegvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                                stB, D, stD, E, stE, info, bc);
-    else
-        return rocsolver_zhegvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+    return STRIDED ? rocsolver_zhbevd_strided_batched(handle, evect, uplo, n, kd, A, lda, stA, D,
+                                                      stD, E, stE, Z, ldz, stZ, info, bc)
+                   : rocsolver_zhbevd(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sbevd_hbevd(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
+                                            rocblas_int kd,
                                             float* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             float* D,
                                             rocblas_stride stD,
                                             float* E,
                                             rocblas_stride stE,
+                                            float* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_ssygvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+    return rocsolver_ssbevd_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Z, ldz,
                                     info, bc);
 }
 
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sbevd_hbevd(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
+                                            rocblas_int kd,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             double* D,
                                             rocblas_stride stD,
                                             double* E,
                                             rocblas_stride stE,
+                                            double* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_dsygvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+    return rocsolver_dsbevd_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Z, ldz,
                                     info, bc);
 }
 
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sbevd_hbevd(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
+                                            rocblas_int kd,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             float* D,
                                             rocblas_stride stD,
                                             float* E,
                                             rocblas_stride stE,
+                                            rocblas_float_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_chegvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+    return rocsolver_chbevd_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Z, ldz,
                                     info, bc);
 }
 
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sbevd_hbevd(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
+                                            rocblas_int kd,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             double* D,
                                             rocblas_stride stD,
                                             double* E,
                                             rocblas_stride stE,
+                                            rocblas_double_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_zhegvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+    return rocsolver_zhbevd_batched(handle, evect, uplo, n, kd, A, lda, D, stD, E, stE, Z, ldz,
                                     info, bc);
 }
 /********************************************************/
 
-/******************** SYGVX/HEGVX ********************/
+/******************** SYEVX/HEEVX ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_erange erange,
                                             rocblas_fill uplo,
@@ -6285,9 +8092,6 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             float vl,
                                             float vu,
                                             rocblas_int il,
@@ -6304,16 +8108,15 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return STRIDED ? rocsolver_ssygvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
-                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
-                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
-                   : rocsolver_ssygvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+    return STRIDED ? rocsolver_ssyevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_ssyevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_erange erange,
                                             rocblas_fill uplo,
@@ -6321,9 +8124,6 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             double vl,
                                             double vu,
                                             rocblas_int il,
@@ -6340,16 +8140,15 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dsygvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
-                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
-                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
-                   : rocsolver_dsygvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+    return STRIDED ? rocsolver_dsyevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_dsyevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_erange erange,
                                             rocblas_fill uplo,
@@ -6357,9 +8156,6 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             float vl,
                                             float vu,
                                             rocblas_int il,
@@ -6376,16 +8172,15 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return STRIDED ? rocsolver_chegvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
-                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
-                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
-                   : rocsolver_chegvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+    return STRIDED ? rocsolver_cheevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_cheevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_erange erange,
                                             rocblas_fill uplo,
@@ -6393,9 +8188,6 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             double vl,
                                             double vu,
                                             rocblas_int il,
@@ -6412,17 +8204,16 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zhegvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
-                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
-                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
-                   : rocsolver_zhegvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+    return STRIDED ? rocsolver_zheevx_strided_batched(handle, evect, erange, uplo, n, A, lda, stA,
+                                                      vl, vu, il, iu, abstol, nev, W, stW, Z, ldz,
+                                                      stZ, ifail, stF, info, bc)
+                   : rocsolver_zheevx(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu,
+                                      abstol, nev, W, Z, ldz, ifail, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_erange erange,
                                             rocblas_fill uplo,
@@ -6430,9 +8221,6 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             float* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             float vl,
                                             float vu,
                                             rocblas_int il,
@@ -6449,13 +8237,12 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_ssygvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+    return rocsolver_ssyevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_erange erange,
                                             rocblas_fill uplo,
@@ -6463,9 +8250,6 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             double vl,
                                             double vu,
                                             rocblas_int il,
@@ -6482,13 +8266,12 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_dsygvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+    return rocsolver_dsyevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_erange erange,
                                             rocblas_fill uplo,
@@ -6496,14 +8279,11 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             float vl,
                                             float vu,
                                             rocblas_int il,
                                             rocblas_int iu,
-                                            double abstol,
+                                            float abstol,
                                             rocblas_int* nev,
                                             float* W,
                                             rocblas_stride stW,
@@ -6515,13 +8295,12 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_chegvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+    return rocsolver_cheevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
                                             rocblas_evect evect,
                                             rocblas_erange erange,
                                             rocblas_fill uplo,
@@ -6529,9 +8308,6 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
                                             double vl,
                                             double vu,
                                             rocblas_int il,
@@ -6548,167 +8324,2299 @@ inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_zhegvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+    return rocsolver_zheevx_batched(handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                                    nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 /********************************************************/
 
-/******************** SYTF2_SYTRF ********************/
+/******************** SYGV_HEGV ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
-{
-    if(STRIDED)
-        return SYTRF
-            ? rocsolver_ssytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_ssytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
-    else
-        return SYTRF ? rocsolver_ssytrf(handle, uplo, n, A, lda, ipiv, info)
-                     : rocsolver_ssytf2(handle, uplo, n, A, lda, ipiv, info);
-}
-
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          float* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
 {
     if(STRIDED)
-        return SYTRF
-            ? rocsolver_dsytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_dsytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+        return rocsolver_ssygv_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                               stB, D, stD, E, stE, info, bc);
     else
-        return SYTRF ? rocsolver_dsytrf(handle, uplo, n, A, lda, ipiv, info)
-                     : rocsolver_dsytf2(handle, uplo, n, A, lda, ipiv, info);
+        return rocsolver_ssygv(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          double* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dsygv_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                               stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_dsygv(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_float_complex* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_chegv_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                               stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_chegv(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_double_complex* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zhegv_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                               stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_zhegv(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          float* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_ssygv_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                   info, bc);
+}
+
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          double* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_dsygv_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                   info, bc);
+}
+
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_float_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_float_complex* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_chegv_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                   info, bc);
+}
+
+inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_eform itype,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_double_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          rocblas_double_complex* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_zhegv_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                   info, bc);
+}
+/********************************************************/
+
+/******************** SYGVD_HEGVD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
-                                            rocblas_float_complex* A,
+                                            float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
+                                            float* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return SYTRF
-            ? rocsolver_csytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_csytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+        return rocsolver_ssygvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                                stB, D, stD, E, stE, info, bc);
     else
-        return SYTRF ? rocsolver_csytrf(handle, uplo, n, A, lda, ipiv, info)
-                     : rocsolver_csytf2(handle, uplo, n, A, lda, ipiv, info);
+        return rocsolver_ssygvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
-                                            rocblas_double_complex* A,
+                                            double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
+                                            double* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return SYTRF
-            ? rocsolver_zsytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_zsytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+        return rocsolver_dsygvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                                stB, D, stD, E, stE, info, bc);
     else
-        return SYTRF ? rocsolver_zsytrf(handle, uplo, n, A, lda, ipiv, info)
-                     : rocsolver_zsytf2(handle, uplo, n, A, lda, ipiv, info);
+        return rocsolver_dsygvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
 }
 
-// batched
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
-                                            float* const A[],
+                                            rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
+                                            rocblas_float_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRF ? rocsolver_ssytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_ssytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+    if(STRIDED)
+        return rocsolver_chegvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                                stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_chegvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
-                                            double* const A[],
+                                            rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
-{
-    return SYTRF ? rocsolver_dsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_dsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+                                            rocblas_double_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zhegvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                                stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_zhegvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
+// batched
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_ssygvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_dsygvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
+                                            rocblas_float_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRF ? rocsolver_csytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_csytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_chegvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
+                                            rocblas_double_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRF ? rocsolver_zsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_zsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_zhegvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
+}
+/********************************************************/
+
+/******************** SYGVX/HEGVX ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            float* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssygvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_ssygvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            double* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsygvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_dsygvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_float_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_chegvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_chegvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_double_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zhegvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_zhegvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            float* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_ssygvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            double* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_dsygvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_float_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_chegvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_double_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_zhegvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+}
+/********************************************************/
+
+/******************** SYGVD_HEGVD_FACTORED ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygvd_hegvd_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     float* A,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     float* B,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     float* D,
+                                                     rocblas_stride stD,
+                                                     float* E,
+                                                     rocblas_stride stE,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_ssygvd_factored_strided_batched(handle, itype, evect, uplo, n, A, lda, stA,
+                                                         B, ldb, stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_ssygvd_factored(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     double* A,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     double* B,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     double* D,
+                                                     rocblas_stride stD,
+                                                     double* E,
+                                                     rocblas_stride stE,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dsygvd_factored_strided_batched(handle, itype, evect, uplo, n, A, lda, stA,
+                                                         B, ldb, stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_dsygvd_factored(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_float_complex* A,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_float_complex* B,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     float* D,
+                                                     rocblas_stride stD,
+                                                     float* E,
+                                                     rocblas_stride stE,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_chegvd_factored_strided_batched(handle, itype, evect, uplo, n, A, lda, stA,
+                                                         B, ldb, stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_chegvd_factored(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_double_complex* A,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_double_complex* B,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     double* D,
+                                                     rocblas_stride stD,
+                                                     double* E,
+                                                     rocblas_stride stE,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zhegvd_factored_strided_batched(handle, itype, evect, uplo, n, A, lda, stA,
+                                                         B, ldb, stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_zhegvd_factored(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sygvd_hegvd_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     float* const A[],
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     float* const B[],
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     float* D,
+                                                     rocblas_stride stD,
+                                                     float* E,
+                                                     rocblas_stride stE,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_ssygvd_factored_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD,
+                                             E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     double* const A[],
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     double* const B[],
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     double* D,
+                                                     rocblas_stride stD,
+                                                     double* E,
+                                                     rocblas_stride stE,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_dsygvd_factored_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD,
+                                             E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_float_complex* const A[],
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_float_complex* const B[],
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     float* D,
+                                                     rocblas_stride stD,
+                                                     float* E,
+                                                     rocblas_stride stE,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_chegvd_factored_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD,
+                                             E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_double_complex* const A[],
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_double_complex* const B[],
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     double* D,
+                                                     rocblas_stride stD,
+                                                     double* E,
+                                                     rocblas_stride stE,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_zhegvd_factored_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD,
+                                             E, stE, info, bc);
+}
+/********************************************************/
+
+/******************** SYGVX/HEGVX_FACTORED ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygvx_hegvx_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_erange erange,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     float* A,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     float* B,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     float vl,
+                                                     float vu,
+                                                     rocblas_int il,
+                                                     rocblas_int iu,
+                                                     float abstol,
+                                                     rocblas_int* nev,
+                                                     float* W,
+                                                     rocblas_stride stW,
+                                                     float* Z,
+                                                     rocblas_int ldz,
+                                                     rocblas_stride stZ,
+                                                     rocblas_int* ifail,
+                                                     rocblas_stride stF,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_ssygvx_factored_strided_batched(
+            handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol,
+            nev, W, stW, Z, ldz, stZ, ifail, stF, info, bc);
+    else
+        return rocsolver_ssygvx_factored(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl,
+                                         vu, il, iu, abstol, nev, W, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_erange erange,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     double* A,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     double* B,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     double vl,
+                                                     double vu,
+                                                     rocblas_int il,
+                                                     rocblas_int iu,
+                                                     double abstol,
+                                                     rocblas_int* nev,
+                                                     double* W,
+                                                     rocblas_stride stW,
+                                                     double* Z,
+                                                     rocblas_int ldz,
+                                                     rocblas_stride stZ,
+                                                     rocblas_int* ifail,
+                                                     rocblas_stride stF,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dsygvx_factored_strided_batched(
+            handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol,
+            nev, W, stW, Z, ldz, stZ, ifail, stF, info, bc);
+    else
+        return rocsolver_dsygvx_factored(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl,
+                                         vu, il, iu, abstol, nev, W, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_erange erange,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_float_complex* A,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_float_complex* B,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     float vl,
+                                                     float vu,
+                                                     rocblas_int il,
+                                                     rocblas_int iu,
+                                                     float abstol,
+                                                     rocblas_int* nev,
+                                                     float* W,
+                                                     rocblas_stride stW,
+                                                     rocblas_float_complex* Z,
+                                                     rocblas_int ldz,
+                                                     rocblas_stride stZ,
+                                                     rocblas_int* ifail,
+                                                     rocblas_stride stF,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_chegvx_factored_strided_batched(
+            handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol,
+            nev, W, stW, Z, ldz, stZ, ifail, stF, info, bc);
+    else
+        return rocsolver_chegvx_factored(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl,
+                                         vu, il, iu, abstol, nev, W, Z, ldz, ifail, info);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_erange erange,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_double_complex* A,
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_double_complex* B,
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     double vl,
+                                                     double vu,
+                                                     rocblas_int il,
+                                                     rocblas_int iu,
+                                                     double abstol,
+                                                     rocblas_int* nev,
+                                                     double* W,
+                                                     rocblas_stride stW,
+                                                     rocblas_double_complex* Z,
+                                                     rocblas_int ldz,
+                                                     rocblas_stride stZ,
+                                                     rocblas_int* ifail,
+                                                     rocblas_stride stF,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zhegvx_factored_strided_batched(
+            handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol,
+            nev, W, stW, Z, ldz, stZ, ifail, stF, info, bc);
+    else
+        return rocsolver_zhegvx_factored(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl,
+                                         vu, il, iu, abstol, nev, W, Z, ldz, ifail, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sygvx_hegvx_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_erange erange,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     float* const A[],
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     float* const B[],
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     float vl,
+                                                     float vu,
+                                                     rocblas_int il,
+                                                     rocblas_int iu,
+                                                     float abstol,
+                                                     rocblas_int* nev,
+                                                     float* W,
+                                                     rocblas_stride stW,
+                                                     float* const Z[],
+                                                     rocblas_int ldz,
+                                                     rocblas_stride stZ,
+                                                     rocblas_int* ifail,
+                                                     rocblas_stride stF,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_ssygvx_factored_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb,
+                                             vl, vu, il, iu, abstol, nev, W, stW, Z, ldz, ifail,
+                                             stF, info, bc);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_erange erange,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     double* const A[],
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     double* const B[],
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     double vl,
+                                                     double vu,
+                                                     rocblas_int il,
+                                                     rocblas_int iu,
+                                                     double abstol,
+                                                     rocblas_int* nev,
+                                                     double* W,
+                                                     rocblas_stride stW,
+                                                     double* const Z[],
+                                                     rocblas_int ldz,
+                                                     rocblas_stride stZ,
+                                                     rocblas_int* ifail,
+                                                     rocblas_stride stF,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_dsygvx_factored_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb,
+                                             vl, vu, il, iu, abstol, nev, W, stW, Z, ldz, ifail,
+                                             stF, info, bc);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_erange erange,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_float_complex* const A[],
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_float_complex* const B[],
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     float vl,
+                                                     float vu,
+                                                     rocblas_int il,
+                                                     rocblas_int iu,
+                                                     double abstol,
+                                                     rocblas_int* nev,
+                                                     float* W,
+                                                     rocblas_stride stW,
+                                                     rocblas_float_complex* const Z[],
+                                                     rocblas_int ldz,
+                                                     rocblas_stride stZ,
+                                                     rocblas_int* ifail,
+                                                     rocblas_stride stF,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_chegvx_factored_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb,
+                                             vl, vu, il, iu, abstol, nev, W, stW, Z, ldz, ifail,
+                                             stF, info, bc);
+}
+
+inline rocblas_status rocsolver_sygvx_hegvx_factored(bool STRIDED,
+                                                     rocblas_handle handle,
+                                                     rocblas_eform itype,
+                                                     rocblas_evect evect,
+                                                     rocblas_erange erange,
+                                                     rocblas_fill uplo,
+                                                     rocblas_int n,
+                                                     rocblas_double_complex* const A[],
+                                                     rocblas_int lda,
+                                                     rocblas_stride stA,
+                                                     rocblas_double_complex* const B[],
+                                                     rocblas_int ldb,
+                                                     rocblas_stride stB,
+                                                     double vl,
+                                                     double vu,
+                                                     rocblas_int il,
+                                                     rocblas_int iu,
+                                                     double abstol,
+                                                     rocblas_int* nev,
+                                                     double* W,
+                                                     rocblas_stride stW,
+                                                     rocblas_double_complex* const Z[],
+                                                     rocblas_int ldz,
+                                                     rocblas_stride stZ,
+                                                     rocblas_int* ifail,
+                                                     rocblas_stride stF,
+                                                     rocblas_int* info,
+                                                     rocblas_int bc)
+{
+    return rocsolver_zhegvx_factored_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb,
+                                             vl, vu, il, iu, abstol, nev, W, stW, Z, ldz, ifail,
+                                             stF, info, bc);
+}
+/********************************************************/
+
+/******************** SYTF2_SYTRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRF
+            ? rocsolver_ssytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_ssytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return SYTRF ? rocsolver_ssytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_ssytf2(handle, uplo, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRF
+            ? rocsolver_dsytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_dsytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return SYTRF ? rocsolver_dsytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_dsytf2(handle, uplo, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRF
+            ? rocsolver_csytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_csytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return SYTRF ? rocsolver_csytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_csytf2(handle, uplo, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRF
+            ? rocsolver_zsytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_zsytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return SYTRF ? rocsolver_zsytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_zsytf2(handle, uplo, n, A, lda, ipiv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return SYTRF ? rocsolver_ssytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_ssytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return SYTRF ? rocsolver_dsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_dsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return SYTRF ? rocsolver_csytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_csytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return SYTRF ? rocsolver_zsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_zsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+}
+/********************************************************/
+
+/******************** SYMATFUNC/HEMATFUNC ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_symatfunc_hematfunc(bool STRIDED,
+                                                    rocblas_handle handle,
+                                                    rocblas_matfunc func,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    float* A,
+                                                    rocblas_int lda,
+                                                    rocblas_stride stA,
+                                                    float clamp,
+                                                    rocblas_int* info,
+                                                    rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssymatfunc_strided_batched(handle, func, uplo, n, A, lda, stA, clamp,
+                                                          info, bc)
+                   : rocsolver_ssymatfunc(handle, func, uplo, n, A, lda, clamp, info);
+}
+
+inline rocblas_status rocsolver_symatfunc_hematfunc(bool STRIDED,
+                                                    rocblas_handle handle,
+                                                    rocblas_matfunc func,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    double* A,
+                                                    rocblas_int lda,
+                                                    rocblas_stride stA,
+                                                    double clamp,
+                                                    rocblas_int* info,
+                                                    rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsymatfunc_strided_batched(handle, func, uplo, n, A, lda, stA, clamp,
+                                                          info, bc)
+                   : rocsolver_dsymatfunc(handle, func, uplo, n, A, lda, clamp, info);
+}
+
+inline rocblas_status rocsolver_symatfunc_hematfunc(bool STRIDED,
+                                                    rocblas_handle handle,
+                                                    rocblas_matfunc func,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    rocblas_float_complex* A,
+                                                    rocblas_int lda,
+                                                    rocblas_stride stA,
+                                                    float clamp,
+                                                    rocblas_int* info,
+                                                    rocblas_int bc)
+{
+    return STRIDED ? rocsolver_chematfunc_strided_batched(handle, func, uplo, n, A, lda, stA, clamp,
+                                                          info, bc)
+                   : rocsolver_chematfunc(handle, func, uplo, n, A, lda, clamp, info);
+}
+
+inline rocblas_status rocsolver_symatfunc_hematfunc(bool STRIDED,
+                                                    rocblas_handle handle,
+                                                    rocblas_matfunc func,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    rocblas_double_complex* A,
+                                                    rocblas_int lda,
+                                                    rocblas_stride stA,
+                                                    double clamp,
+                                                    rocblas_int* info,
+                                                    rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zhematfunc_strided_batched(handle, func, uplo, n, A, lda, stA, clamp,
+                                                          info, bc)
+                   : rocsolver_zhematfunc(handle, func, uplo, n, A, lda, clamp, info);
+}
+
+// batched
+inline rocblas_status rocsolver_symatfunc_hematfunc(bool STRIDED,
+                                                    rocblas_handle handle,
+                                                    rocblas_matfunc func,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    float* const A[],
+                                                    rocblas_int lda,
+                                                    rocblas_stride stA,
+                                                    float clamp,
+                                                    rocblas_int* info,
+                                                    rocblas_int bc)
+{
+    return rocsolver_ssymatfunc_batched(handle, func, uplo, n, A, lda, clamp, info, bc);
+}
+
+inline rocblas_status rocsolver_symatfunc_hematfunc(bool STRIDED,
+                                                    rocblas_handle handle,
+                                                    rocblas_matfunc func,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    double* const A[],
+                                                    rocblas_int lda,
+                                                    rocblas_stride stA,
+                                                    double clamp,
+                                                    rocblas_int* info,
+                                                    rocblas_int bc)
+{
+    return rocsolver_dsymatfunc_batched(handle, func, uplo, n, A, lda, clamp, info, bc);
+}
+
+inline rocblas_status rocsolver_symatfunc_hematfunc(bool STRIDED,
+                                                    rocblas_handle handle,
+                                                    rocblas_matfunc func,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    rocblas_float_complex* const A[],
+                                                    rocblas_int lda,
+                                                    rocblas_stride stA,
+                                                    float clamp,
+                                                    rocblas_int* info,
+                                                    rocblas_int bc)
+{
+    return rocsolver_chematfunc_batched(handle, func, uplo, n, A, lda, clamp, info, bc);
+}
+
+inline rocblas_status rocsolver_symatfunc_hematfunc(bool STRIDED,
+                                                    rocblas_handle handle,
+                                                    rocblas_matfunc func,
+                                                    rocblas_fill uplo,
+                                                    rocblas_int n,
+                                                    rocblas_double_complex* const A[],
+                                                    rocblas_int lda,
+                                                    rocblas_stride stA,
+                                                    double clamp,
+                                                    rocblas_int* info,
+                                                    rocblas_int bc)
+{
+    return rocsolver_zhematfunc_batched(handle, func, uplo, n, A, lda, clamp, info, bc);
+}
+/********************************************************/
+
+/******************** GEPINV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gepinv(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float rtol,
+                                       float* X,
+                                       rocblas_int ldx,
+                                       rocblas_stride stX,
+                                       rocblas_int* rank,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgepinv_strided_batched(handle, m, n, A, lda, stA, rtol, X, ldx, stX,
+                                                       rank, info, bc)
+                   : rocsolver_sgepinv(handle, m, n, A, lda, rtol, X, ldx, rank, info);
+}
+
+inline rocblas_status rocsolver_gepinv(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double rtol,
+                                       double* X,
+                                       rocblas_int ldx,
+                                       rocblas_stride stX,
+                                       rocblas_int* rank,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgepinv_strided_batched(handle, m, n, A, lda, stA, rtol, X, ldx, stX,
+                                                       rank, info, bc)
+                   : rocsolver_dgepinv(handle, m, n, A, lda, rtol, X, ldx, rank, info);
+}
+
+inline rocblas_status rocsolver_gepinv(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float rtol,
+                                       rocblas_float_complex* X,
+                                       rocblas_int ldx,
+                                       rocblas_stride stX,
+                                       rocblas_int* rank,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgepinv_strided_batched(handle, m, n, A, lda, stA, rtol, X, ldx, stX,
+                                                       rank, info, bc)
+                   : rocsolver_cgepinv(handle, m, n, A, lda, rtol, X, ldx, rank, info);
+}
+
+inline rocblas_status rocsolver_gepinv(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double rtol,
+                                       rocblas_double_complex* X,
+                                       rocblas_int ldx,
+                                       rocblas_stride stX,
+                                       rocblas_int* rank,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgepinv_strided_batched(handle, m, n, A, lda, stA, rtol, X, ldx, stX,
+                                                       rank, info, bc)
+                   : rocsolver_zgepinv(handle, m, n, A, lda, rtol, X, ldx, rank, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gepinv(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float rtol,
+                                       float* const X[],
+                                       rocblas_int ldx,
+                                       rocblas_stride stX,
+                                       rocblas_int* rank,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_sgepinv_batched(handle, m, n, A, lda, rtol, X, ldx, rank, info, bc);
+}
+
+inline rocblas_status rocsolver_gepinv(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double rtol,
+                                       double* const X[],
+                                       rocblas_int ldx,
+                                       rocblas_stride stX,
+                                       rocblas_int* rank,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_dgepinv_batched(handle, m, n, A, lda, rtol, X, ldx, rank, info, bc);
+}
+
+inline rocblas_status rocsolver_gepinv(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float rtol,
+                                       rocblas_float_complex* const X[],
+                                       rocblas_int ldx,
+                                       rocblas_stride stX,
+                                       rocblas_int* rank,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_cgepinv_batched(handle, m, n, A, lda, rtol, X, ldx, rank, info, bc);
+}
+
+inline rocblas_status rocsolver_gepinv(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double rtol,
+                                       rocblas_double_complex* const X[],
+                                       rocblas_int ldx,
+                                       rocblas_stride stX,
+                                       rocblas_int* rank,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_zgepinv_batched(handle, m, n, A, lda, rtol, X, ldx, rank, info, bc);
+}
+/********************************************************/
+
+/******************** GESVD_TRUNCATE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvd_truncate(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               float* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int k,
+                                               float rtol,
+                                               float* C,
+                                               rocblas_int ldc,
+                                               rocblas_stride stC,
+                                               rocblas_int* rank,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgesvd_truncate_strided_batched(handle, m, n, A, lda, stA, k, rtol,
+                                                               C, ldc, stC, rank, info, bc)
+                   : rocsolver_sgesvd_truncate(handle, m, n, A, lda, k, rtol, C, ldc, rank, info);
+}
+
+inline rocblas_status rocsolver_gesvd_truncate(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               double* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int k,
+                                               double rtol,
+                                               double* C,
+                                               rocblas_int ldc,
+                                               rocblas_stride stC,
+                                               rocblas_int* rank,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgesvd_truncate_strided_batched(handle, m, n, A, lda, stA, k, rtol,
+                                                               C, ldc, stC, rank, info, bc)
+                   : rocsolver_dgesvd_truncate(handle, m, n, A, lda, k, rtol, C, ldc, rank, info);
+}
+
+inline rocblas_status rocsolver_gesvd_truncate(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int k,
+                                               float rtol,
+                                               rocblas_float_complex* C,
+                                               rocblas_int ldc,
+                                               rocblas_stride stC,
+                                               rocblas_int* rank,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgesvd_truncate_strided_batched(handle, m, n, A, lda, stA, k, rtol,
+                                                               C, ldc, stC, rank, info, bc)
+                   : rocsolver_cgesvd_truncate(handle, m, n, A, lda, k, rtol, C, ldc, rank, info);
+}
+
+inline rocblas_status rocsolver_gesvd_truncate(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int k,
+                                               double rtol,
+                                               rocblas_double_complex* C,
+                                               rocblas_int ldc,
+                                               rocblas_stride stC,
+                                               rocblas_int* rank,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgesvd_truncate_strided_batched(handle, m, n, A, lda, stA, k, rtol,
+                                                               C, ldc, stC, rank, info, bc)
+                   : rocsolver_zgesvd_truncate(handle, m, n, A, lda, k, rtol, C, ldc, rank, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvd_truncate(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               float* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int k,
+                                               float rtol,
+                                               float* const C[],
+                                               rocblas_int ldc,
+                                               rocblas_stride stC,
+                                               rocblas_int* rank,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_sgesvd_truncate_batched(handle, m, n, A, lda, k, rtol, C, ldc, rank, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_truncate(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               double* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int k,
+                                               double rtol,
+                                               double* const C[],
+                                               rocblas_int ldc,
+                                               rocblas_stride stC,
+                                               rocblas_int* rank,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_dgesvd_truncate_batched(handle, m, n, A, lda, k, rtol, C, ldc, rank, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_truncate(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_float_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int k,
+                                               float rtol,
+                                               rocblas_float_complex* const C[],
+                                               rocblas_int ldc,
+                                               rocblas_stride stC,
+                                               rocblas_int* rank,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_cgesvd_truncate_batched(handle, m, n, A, lda, k, rtol, C, ldc, rank, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd_truncate(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_double_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_int k,
+                                               double rtol,
+                                               rocblas_double_complex* const C[],
+                                               rocblas_int ldc,
+                                               rocblas_stride stC,
+                                               rocblas_int* rank,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_zgesvd_truncate_batched(handle, m, n, A, lda, k, rtol, C, ldc, rank, info, bc);
+}
+/********************************************************/
+
+/******************** GELSD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgelsd_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                      S, stS, rcond, rank, info, bc)
+                   : rocsolver_sgelsd(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgelsd_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                      S, stS, rcond, rank, info, bc)
+                   : rocsolver_dgelsd(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgelsd_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                      S, stS, rcond, rank, info, bc)
+                   : rocsolver_cgelsd(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgelsd_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                      S, stS, rcond, rank, info, bc)
+                   : rocsolver_zgelsd(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgelsd_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgelsd_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgelsd_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgelsd_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
+}
+/********************************************************/
+
+/******************** GELSY ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stP,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                      jpvt, stP, rcond, rank, bc)
+                   : rocsolver_sgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stP,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                      jpvt, stP, rcond, rank, bc)
+                   : rocsolver_dgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stP,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                      jpvt, stP, rcond, rank, bc)
+                   : rocsolver_cgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stP,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                      jpvt, stP, rcond, rank, bc)
+                   : rocsolver_zgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+// batched
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stP,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stP, rcond, rank,
+                                    bc);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stP,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stP, rcond, rank,
+                                    bc);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stP,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stP, rcond, rank,
+                                    bc);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stP,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stP, rcond, rank,
+                                    bc);
+}
+/********************************************************/
+
+/******************** PSTRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* piv,
+                                      rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      float tol,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_spstrf_strided_batched(handle, uplo, n, A, lda, stA, piv, stP, rank,
+                                                      tol, info, bc)
+                   : rocsolver_spstrf(handle, uplo, n, A, lda, piv, rank, tol, info);
+}
+
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* piv,
+                                      rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      double tol,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dpstrf_strided_batched(handle, uplo, n, A, lda, stA, piv, stP, rank,
+                                                      tol, info, bc)
+                   : rocsolver_dpstrf(handle, uplo, n, A, lda, piv, rank, tol, info);
+}
+
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* piv,
+                                      rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      float tol,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cpstrf_strided_batched(handle, uplo, n, A, lda, stA, piv, stP, rank,
+                                                      tol, info, bc)
+                   : rocsolver_cpstrf(handle, uplo, n, A, lda, piv, rank, tol, info);
+}
+
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* piv,
+                                      rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      double tol,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zpstrf_strided_batched(handle, uplo, n, A, lda, stA, piv, stP, rank,
+                                                      tol, info, bc)
+                   : rocsolver_zpstrf(handle, uplo, n, A, lda, piv, rank, tol, info);
+}
+
+// batched
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* piv,
+                                      rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      float tol,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_spstrf_batched(handle, uplo, n, A, lda, piv, stP, rank, tol, info, bc);
+}
+
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* piv,
+                                      rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      double tol,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dpstrf_batched(handle, uplo, n, A, lda, piv, stP, rank, tol, info, bc);
+}
+
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* piv,
+                                      rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      float tol,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_cpstrf_batched(handle, uplo, n, A, lda, piv, stP, rank, tol, info, bc);
+}
+
+inline rocblas_status rocsolver_pstrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* piv,
+                                      rocblas_stride stP,
+                                      rocblas_int* rank,
+                                      double tol,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_zpstrf_batched(handle, uplo, n, A, lda, piv, stP, rank, tol, info, bc);
 }
 /********************************************************/
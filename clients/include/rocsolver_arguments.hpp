@@ -235,6 +235,17 @@ public:
             throw std::invalid_argument("Invalid value for " + name);
     }
 
+    void validate_matfunc(const std::string name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char func = val->second.as<char>();
+        if(func != 'S' && func != 'I' && func != 'E' && func != 'L')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
     void validate_itype(const std::string name) const
     {
         auto val = find(name);
@@ -10,16 +10,28 @@
 #include <string>
 
 #include "testing_bdsqr.hpp"
+#include "testing_cholqr.hpp"
 #include "testing_gebd2_gebrd.hpp"
 #include "testing_gelq2_gelqf.hpp"
+#include "testing_gemqrt.hpp"
 #include "testing_gels.hpp"
+#include "testing_gels_rowmajor.hpp"
+#include "testing_gels_solve.hpp"
+#include "testing_gelsd.hpp"
+#include "testing_gelsy.hpp"
+#include "testing_gepinv.hpp"
 #include "testing_geql2_geqlf.hpp"
 #include "testing_geqr2_geqrf.hpp"
+#include "testing_geqrt.hpp"
 #include "testing_gerq2_gerqf.hpp"
 #include "testing_gesv.hpp"
 #include "testing_gesvd.hpp"
+#include "testing_gesvd_rowmajor.hpp"
+#include "testing_gesvd_truncate.hpp"
 #include "testing_getf2_getrf.hpp"
 #include "testing_getf2_getrf_npvt.hpp"
+#include "testing_getrf_logdet.hpp"
+#include "testing_getrf_rowmajor.hpp"
 #include "testing_getri.hpp"
 #include "testing_getri_npvt.hpp"
 #include "testing_getri_npvt_outofplace.hpp"
@@ -32,9 +44,11 @@
 #include "testing_larfg.hpp"
 #include "testing_larft.hpp"
 #include "testing_laswp.hpp"
+#include "testing_lauum.hpp"
 #include "testing_lasyf.hpp"
 #include "testing_latrd.hpp"
 #include "testing_orgbr_ungbr.hpp"
+#include "testing_orgqrt_ungqrt.hpp"
 #include "testing_orglx_unglx.hpp"
 #include "testing_orgtr_ungtr.hpp"
 #include "testing_orgxl_ungxl.hpp"
@@ -46,8 +60,14 @@
 #include "testing_ormxr_unmxr.hpp"
 #include "testing_posv.hpp"
 #include "testing_potf2_potrf.hpp"
+#include "testing_potrf_logdet.hpp"
+#include "testing_potrf_rowmajor.hpp"
 #include "testing_potri.hpp"
 #include "testing_potrs.hpp"
+#include "testing_pstrf.hpp"
+#include "testing_sbev_hbev.hpp"
+#include "testing_sbevd_hbevd.hpp"
+#include "testing_sbtrd_hbtrd.hpp"
 #include "testing_stebz.hpp"
 #include "testing_stedc.hpp"
 #include "testing_stein.hpp"
@@ -59,7 +79,10 @@
 #include "testing_sygsx_hegsx.hpp"
 #include "testing_sygv_hegv.hpp"
 #include "testing_sygvd_hegvd.hpp"
+#include "testing_sygvd_hegvd_factored.hpp"
 #include "testing_sygvx_hegvx.hpp"
+#include "testing_sygvx_hegvx_factored.hpp"
+#include "testing_symatfunc_hematfunc.hpp"
 #include "testing_sytf2_sytrf.hpp"
 #include "testing_sytxx_hetxx.hpp"
 #include "testing_trtri.hpp"
@@ -84,6 +107,7 @@ class rocsolver_dispatcher
         // Map for functions that support all precisions
         static const func_map map = {
             {"laswp", testing_laswp<T>},
+            {"lauum", testing_lauum<T>},
             {"larfg", testing_larfg<T>},
             {"larf", testing_larf<T>},
             {"larft", testing_larft<T>},
@@ -102,6 +126,21 @@ class rocsolver_dispatcher
             {"potrf", testing_potf2_potrf<false, false, 1, T>},
             {"potrf_batched", testing_potf2_potrf<true, true, 1, T>},
             {"potrf_strided_batched", testing_potf2_potrf<false, true, 1, T>},
+            // potrf_logdet & pologdet
+            {"potrf_logdet", testing_potrf_logdet<false, false, true, T>},
+            {"potrf_logdet_batched", testing_potrf_logdet<true, true, true, T>},
+            {"potrf_logdet_strided_batched", testing_potrf_logdet<false, true, true, T>},
+            {"pologdet", testing_potrf_logdet<false, false, false, T>},
+            {"pologdet_batched", testing_potrf_logdet<true, true, false, T>},
+            {"pologdet_strided_batched", testing_potrf_logdet<false, true, false, T>},
+            // potrf_rowmajor
+            {"potrf_rowmajor", testing_potrf_rowmajor<false, false, T>},
+            {"potrf_rowmajor_batched", testing_potrf_rowmajor<true, true, T>},
+            {"potrf_rowmajor_strided_batched", testing_potrf_rowmajor<false, true, T>},
+            // pstrf
+            {"pstrf", testing_pstrf<false, false, T>},
+            {"pstrf_batched", testing_pstrf<true, true, T>},
+            {"pstrf_strided_batched", testing_pstrf<false, true, T>},
             // potrs
             {"potrs", testing_potrs<false, false, T>},
             {"potrs_batched", testing_potrs<true, true, T>},
@@ -128,6 +167,17 @@ class rocsolver_dispatcher
             {"getrf", testing_getf2_getrf<false, false, 1, T>},
             {"getrf_batched", testing_getf2_getrf<true, true, 1, T>},
             {"getrf_strided_batched", testing_getf2_getrf<false, true, 1, T>},
+            // getrf_logdet & gelogdet
+            {"getrf_logdet", testing_getrf_logdet<false, false, true, T>},
+            {"getrf_logdet_batched", testing_getrf_logdet<true, true, true, T>},
+            {"getrf_logdet_strided_batched", testing_getrf_logdet<false, true, true, T>},
+            {"gelogdet", testing_getrf_logdet<false, false, false, T>},
+            {"gelogdet_batched", testing_getrf_logdet<true, true, false, T>},
+            {"gelogdet_strided_batched", testing_getrf_logdet<false, true, false, T>},
+            // getrf_rowmajor
+            {"getrf_rowmajor", testing_getrf_rowmajor<false, false, T>},
+            {"getrf_rowmajor_batched", testing_getrf_rowmajor<true, true, T>},
+            {"getrf_rowmajor_strided_batched", testing_getrf_rowmajor<false, true, T>},
             // geqrf
             {"geqr2", testing_geqr2_geqrf<false, false, 0, T>},
             {"geqr2_batched", testing_geqr2_geqrf<true, true, 0, T>},
@@ -136,6 +186,18 @@ class rocsolver_dispatcher
             {"geqrf_batched", testing_geqr2_geqrf<true, true, 1, T>},
             {"geqrf_strided_batched", testing_geqr2_geqrf<false, true, 1, T>},
             {"geqrf_ptr_batched", testing_geqr2_geqrf<true, false, 1, T>},
+            // geqrt
+            {"geqrt", testing_geqrt<false, false, T>},
+            {"geqrt_batched", testing_geqrt<true, true, T>},
+            {"geqrt_strided_batched", testing_geqrt<false, true, T>},
+            // gemqrt
+            {"gemqrt", testing_gemqrt<false, false, T>},
+            {"gemqrt_batched", testing_gemqrt<true, true, T>},
+            {"gemqrt_strided_batched", testing_gemqrt<false, true, T>},
+            // cholqr
+            {"cholqr", testing_cholqr<false, false, T>},
+            {"cholqr_batched", testing_cholqr<true, true, T>},
+            {"cholqr_strided_batched", testing_cholqr<false, true, T>},
             // gerqf
             {"gerq2", testing_gerq2_gerqf<false, false, 0, T>},
             {"gerq2_batched", testing_gerq2_gerqf<true, true, 0, T>},
@@ -169,6 +231,18 @@ class rocsolver_dispatcher
             {"gesvd", testing_gesvd<false, false, T>},
             {"gesvd_batched", testing_gesvd<true, true, T>},
             {"gesvd_strided_batched", testing_gesvd<false, true, T>},
+            // gesvd_rowmajor
+            {"gesvd_rowmajor", testing_gesvd_rowmajor<false, false, T>},
+            {"gesvd_rowmajor_batched", testing_gesvd_rowmajor<true, true, T>},
+            {"gesvd_rowmajor_strided_batched", testing_gesvd_rowmajor<false, true, T>},
+            // gesvd_truncate
+            {"gesvd_truncate", testing_gesvd_truncate<false, false, T>},
+            {"gesvd_truncate_batched", testing_gesvd_truncate<true, true, T>},
+            {"gesvd_truncate_strided_batched", testing_gesvd_truncate<false, true, T>},
+            // gepinv
+            {"gepinv", testing_gepinv<false, false, T>},
+            {"gepinv_batched", testing_gepinv<true, true, T>},
+            {"gepinv_strided_batched", testing_gepinv<false, true, T>},
             // trtri
             {"trtri", testing_trtri<false, false, T>},
             {"trtri_batched", testing_trtri<true, true, T>},
@@ -193,6 +267,21 @@ class rocsolver_dispatcher
             {"gels", testing_gels<false, false, T>},
             {"gels_batched", testing_gels<true, true, T>},
             {"gels_strided_batched", testing_gels<false, true, T>},
+            {"gels_solve", testing_gels_solve<false, false, T>},
+            {"gels_solve_batched", testing_gels_solve<true, true, T>},
+            {"gels_solve_strided_batched", testing_gels_solve<false, true, T>},
+            // gels_rowmajor
+            {"gels_rowmajor", testing_gels_rowmajor<false, false, T>},
+            {"gels_rowmajor_batched", testing_gels_rowmajor<true, true, T>},
+            {"gels_rowmajor_strided_batched", testing_gels_rowmajor<false, true, T>},
+            // gelsd
+            {"gelsd", testing_gelsd<false, false, T>},
+            {"gelsd_batched", testing_gelsd<true, true, T>},
+            {"gelsd_strided_batched", testing_gelsd<false, true, T>},
+            // gelsy
+            {"gelsy", testing_gelsy<false, false, T>},
+            {"gelsy_batched", testing_gelsy<true, true, T>},
+            {"gelsy_strided_batched", testing_gelsy<false, true, T>},
             // gebrd
             {"gebd2", testing_gebd2_gebrd<false, false, 0, T>},
             {"gebd2_batched", testing_gebd2_gebrd<true, true, 0, T>},
@@ -236,6 +325,7 @@ class rocsolver_dispatcher
             {"orglq", testing_orglx_unglx<T, 1>},
             {"orgbr", testing_orgbr_ungbr<T>},
             {"orgtr", testing_orgtr_ungtr<T>},
+            {"orgqrt", testing_orgqrt_ungqrt<T>},
             // ormxx
             {"orm2r", testing_ormxr_unmxr<T, 0>},
             {"ormqr", testing_ormxr_unmxr<T, 1>},
@@ -252,6 +342,10 @@ class rocsolver_dispatcher
             {"sytrd", testing_sytxx_hetxx<false, false, 1, T>},
             {"sytrd_batched", testing_sytxx_hetxx<true, true, 1, T>},
             {"sytrd_strided_batched", testing_sytxx_hetxx<false, true, 1, T>},
+            // sbtrd
+            {"sbtrd", testing_sbtrd_hbtrd<false, false, T>},
+            {"sbtrd_batched", testing_sbtrd_hbtrd<true, true, T>},
+            {"sbtrd_strided_batched", testing_sbtrd_hbtrd<false, true, T>},
             // sygst
             {"sygs2", testing_sygsx_hegsx<false, false, 0, T>},
             {"sygs2_batched", testing_sygsx_hegsx<true, true, 0, T>},
@@ -267,6 +361,14 @@ class rocsolver_dispatcher
             {"syevd", testing_syevd_heevd<false, false, T>},
             {"syevd_batched", testing_syevd_heevd<true, true, T>},
             {"syevd_strided_batched", testing_syevd_heevd<false, true, T>},
+            // sbev
+            {"sbev", testing_sbev_hbev<false, false, T>},
+            {"sbev_batched", testing_sbev_hbev<true, true, T>},
+            {"sbev_strided_batched", testing_sbev_hbev<false, true, T>},
+            // sbevd
+            {"sbevd", testing_sbevd_hbevd<false, false, T>},
+            {"sbevd_batched", testing_sbevd_hbevd<true, true, T>},
+            {"sbevd_strided_batched", testing_sbevd_hbevd<false, true, T>},
             // syevx
             {"syevx", testing_syevx_heevx<false, false, T>},
             {"syevx_batched", testing_syevx_heevx<true, true, T>},
@@ -279,10 +381,22 @@ class rocsolver_dispatcher
             {"sygvd", testing_sygvd_hegvd<false, false, T>},
             {"sygvd_batched", testing_sygvd_hegvd<true, true, T>},
             {"sygvd_strided_batched", testing_sygvd_hegvd<false, true, T>},
+            // sygvd_factored
+            {"sygvd_factored", testing_sygvd_hegvd_factored<false, false, T>},
+            {"sygvd_factored_batched", testing_sygvd_hegvd_factored<true, true, T>},
+            {"sygvd_factored_strided_batched", testing_sygvd_hegvd_factored<false, true, T>},
             // sygvx
             {"sygvx", testing_sygvx_hegvx<false, false, T>},
             {"sygvx_batched", testing_sygvx_hegvx<true, true, T>},
             {"sygvx_strided_batched", testing_sygvx_hegvx<false, true, T>},
+            // sygvx_factored
+            {"sygvx_factored", testing_sygvx_hegvx_factored<false, false, T>},
+            {"sygvx_factored_batched", testing_sygvx_hegvx_factored<true, true, T>},
+            {"sygvx_factored_strided_batched", testing_sygvx_hegvx_factored<false, true, T>},
+            // symatfunc
+            {"symatfunc", testing_symatfunc_hematfunc<false, false, T>},
+            {"symatfunc_batched", testing_symatfunc_hematfunc<true, true, T>},
+            {"symatfunc_strided_batched", testing_symatfunc_hematfunc<false, true, T>},
         };
 
         // Grab function from the map and execute
@@ -311,6 +425,7 @@ class rocsolver_dispatcher
             {"unglq", testing_orglx_unglx<T, 1>},
             {"ungbr", testing_orgbr_ungbr<T>},
             {"ungtr", testing_orgtr_ungtr<T>},
+            {"ungqrt", testing_orgqrt_ungqrt<T>},
             // unmxx
             {"unm2r", testing_ormxr_unmxr<T, 0>},
             {"unmqr", testing_ormxr_unmxr<T, 1>},
@@ -327,6 +442,10 @@ class rocsolver_dispatcher
             {"hetrd", testing_sytxx_hetxx<false, false, 1, T>},
             {"hetrd_batched", testing_sytxx_hetxx<true, true, 1, T>},
             {"hetrd_strided_batched", testing_sytxx_hetxx<false, true, 1, T>},
+            // hbtrd
+            {"hbtrd", testing_sbtrd_hbtrd<false, false, T>},
+            {"hbtrd_batched", testing_sbtrd_hbtrd<true, true, T>},
+            {"hbtrd_strided_batched", testing_sbtrd_hbtrd<false, true, T>},
             // hegst
             {"hegs2", testing_sygsx_hegsx<false, false, 0, T>},
             {"hegs2_batched", testing_sygsx_hegsx<true, true, 0, T>},
@@ -342,6 +461,14 @@ class rocsolver_dispatcher
             {"heevd", testing_syevd_heevd<false, false, T>},
             {"heevd_batched", testing_syevd_heevd<true, true, T>},
             {"heevd_strided_batched", testing_syevd_heevd<false, true, T>},
+            // hbev
+            {"hbev", testing_sbev_hbev<false, false, T>},
+            {"hbev_batched", testing_sbev_hbev<true, true, T>},
+            {"hbev_strided_batched", testing_sbev_hbev<false, true, T>},
+            // hbevd
+            {"hbevd", testing_sbevd_hbevd<false, false, T>},
+            {"hbevd_batched", testing_sbevd_hbevd<true, true, T>},
+            {"hbevd_strided_batched", testing_sbevd_hbevd<false, true, T>},
             // heevx
             {"heevx", testing_syevx_heevx<false, false, T>},
             {"heevx_batched", testing_syevx_heevx<true, true, T>},
@@ -354,10 +481,22 @@ class rocsolver_dispatcher
             {"hegvd", testing_sygvd_hegvd<false, false, T>},
             {"hegvd_batched", testing_sygvd_hegvd<true, true, T>},
             {"hegvd_strided_batched", testing_sygvd_hegvd<false, true, T>},
+            // hegvd_factored
+            {"hegvd_factored", testing_sygvd_hegvd_factored<false, false, T>},
+            {"hegvd_factored_batched", testing_sygvd_hegvd_factored<true, true, T>},
+            {"hegvd_factored_strided_batched", testing_sygvd_hegvd_factored<false, true, T>},
             // hegvx
             {"hegvx", testing_sygvx_hegvx<false, false, T>},
             {"hegvx_batched", testing_sygvx_hegvx<true, true, T>},
             {"hegvx_strided_batched", testing_sygvx_hegvx<false, true, T>},
+            // hegvx_factored
+            {"hegvx_factored", testing_sygvx_hegvx_factored<false, false, T>},
+            {"hegvx_factored_batched", testing_sygvx_hegvx_factored<true, true, T>},
+            {"hegvx_factored_strided_batched", testing_sygvx_hegvx_factored<false, true, T>},
+            // hematfunc
+            {"hematfunc", testing_symatfunc_hematfunc<false, false, T>},
+            {"hematfunc_batched", testing_symatfunc_hematfunc<true, true, T>},
+            {"hematfunc_strided_batched", testing_symatfunc_hematfunc<false, true, T>},
         };
 
         // Grab function from the map and execute
@@ -0,0 +1,508 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void cholqr_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         T dA,
+                         const rocblas_int lda,
+                         const rocblas_stride stA,
+                         U dR,
+                         const rocblas_int ldr,
+                         const rocblas_stride stR,
+                         rocblas_int* dInfo,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_cholqr(STRIDED, nullptr, m, n, dA, lda, stA, dR, ldr, stR, dInfo, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_cholqr(STRIDED, handle, m, n, dA, lda, stA, dR, ldr, stR, dInfo, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_cholqr(STRIDED, handle, m, n, (T) nullptr, lda, stA, dR, ldr, stR, dInfo, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_cholqr(STRIDED, handle, m, n, dA, lda, stA, (U) nullptr, ldr, stR, dInfo, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, dA, lda, stA, dR, ldr, stR,
+                                           (rocblas_int*)nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, 0, 0, (T) nullptr, lda, stA,
+                                           (U) nullptr, ldr, stR, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, dA, lda, stA, dR, ldr, stR,
+                                               (rocblas_int*)nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_cholqr_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldr = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stR = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<T> dR(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        cholqr_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dR.data(), ldr, stR,
+                                     dInfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dR(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        cholqr_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dR.data(), ldr, stR,
+                                     dInfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void cholqr_initData(const rocblas_handle handle,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     Td& dA,
+                     const rocblas_int lda,
+                     const rocblas_int bc,
+                     Th& hA,
+                     const bool singular)
+{
+    using S = decltype(std::real(T{}));
+
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid ill-conditioning
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+        }
+
+        // make some matrices in the batch ill-conditioned, so that A'*A is not
+        // numerically positive definite and the shifted CholeskyQR3 path is used
+        // (only in double precision; in single precision, the range of condition numbers
+        // for which the shift is needed but still effective is too narrow).
+        // If the batch is large enough, the first matrix is only moderately ill-conditioned:
+        // A'*A can be factorized, but the shifted path is still selected from the condition
+        // estimate
+        if(singular && std::is_same<S, double>::value && n > 1)
+        {
+            S c = std::sqrt(std::numeric_limits<S>::epsilon()) / 100;
+            for(rocblas_int b = 0; b < bc; ++b)
+            {
+                S cb = (b == 0 && bc > 2) ? c * 1000 : c;
+                if(b == bc / 2 || b == bc - 1 || cb != c)
+                {
+                    // the last column is almost equal to the first one
+                    for(rocblas_int i = 0; i < m; i++)
+                        hA[b][i + (n - 1) * lda] = hA[b][i] + T(cb) * hA[b][i + (n - 1) * lda];
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Vd, typename Th, typename Uh, typename Vh>
+void cholqr_getError(const rocblas_handle handle,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     Td& dA,
+                     const rocblas_int lda,
+                     const rocblas_stride stA,
+                     Ud& dR,
+                     const rocblas_int ldr,
+                     const rocblas_stride stR,
+                     Vd& dInfo,
+                     const rocblas_int bc,
+                     Th& hA,
+                     Th& hQ,
+                     Uh& hR,
+                     Vh& hInfo,
+                     double* max_err,
+                     const bool singular)
+{
+    std::vector<T> hQR(lda * n);
+    std::vector<T> hQQ(n * n);
+    std::vector<T> hI(n * n);
+
+    // input data initialization
+    cholqr_initData<true, true, T>(handle, m, n, dA, lda, bc, hA, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_cholqr(STRIDED, handle, m, n, dA.data(), lda, stA, dR.data(), ldr,
+                                         stR, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hQ.transfer_from(dA));
+    CHECK_HIP_ERROR(hR.transfer_from(dR));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+    // there is no equivalent routine in LAPACK; the error is measured as
+    // max(||A - Q*R|| / ||A||, ||I - Q'*Q|| / ||I||)
+    // using frobenius norm
+    for(rocblas_int i = 0; i < n * n; i++)
+        hI[i] = (i % (n + 1) == 0 ? 1 : 0);
+
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // the matrices are not too ill-conditioned
+        EXPECT_EQ(hInfo[b][0], 0) << "where b = " << b;
+
+        // R must be upper triangular
+        for(rocblas_int j = 0; j < n; j++)
+            for(rocblas_int i = j + 1; i < n; i++)
+                EXPECT_EQ(hR[b][i + j * ldr], T(0)) << "where b = " << b;
+
+        cblas_gemm<T>(rocblas_operation_none, rocblas_operation_none, m, n, n, 1, hQ[b], lda,
+                      hR[b], ldr, 0, hQR.data(), lda);
+        err = norm_error('F', m, n, lda, hA[b], hQR.data());
+        *max_err = err > *max_err ? err : *max_err;
+
+        cblas_gemm<T>(rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, m, 1,
+                      hQ[b], lda, hQ[b], lda, 0, hQQ.data(), n);
+        err = norm_error('F', n, n, n, hI.data(), hQQ.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Vd, typename Th, typename Uh>
+void cholqr_getPerfData(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Td& dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        Ud& dR,
+                        const rocblas_int ldr,
+                        const rocblas_stride stR,
+                        Vd& dInfo,
+                        const rocblas_int bc,
+                        Th& hA,
+                        Uh& hIpiv,
+                        double* gpu_time_used,
+                        double* cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const int profile,
+                        const bool profile_kernels,
+                        const bool perf,
+                        const bool singular)
+{
+    std::vector<T> hW(n);
+
+    if(!perf)
+    {
+        cholqr_initData<true, false, T>(handle, m, n, dA, lda, bc, hA, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (there is no equivalent routine in LAPACK; time GEQRF followed by ORGQR/UNGQR)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cblas_geqrf<T>(m, n, hA[b], lda, hIpiv[b], hW.data(), n);
+            cblas_orgqr_ungqr<T>(m, n, n, hA[b], lda, hIpiv[b], hW.data(), n);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    cholqr_initData<true, false, T>(handle, m, n, dA, lda, bc, hA, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        cholqr_initData<false, true, T>(handle, m, n, dA, lda, bc, hA, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_cholqr(STRIDED, handle, m, n, dA.data(), lda, stA, dR.data(),
+                                             ldr, stR, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        cholqr_initData<false, true, T>(handle, m, n, dA, lda, bc, hA, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_cholqr(STRIDED, handle, m, n, dA.data(), lda, stA, dR.data(), ldr, stR,
+                         dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_cholqr(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldr = argus.get<rocblas_int>("ldr", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stR = argus.get<rocblas_stride>("strideR", ldr * n);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stQ = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_R = size_t(ldr) * n;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_Q = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || m < n || lda < m || ldr < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, (T* const*)nullptr, lda,
+                                                   stA, (T*)nullptr, ldr, stR,
+                                                   (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                                   (T*)nullptr, ldr, stR, (rocblas_int*)nullptr,
+                                                   bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_cholqr(STRIDED, handle, m, n, (T* const*)nullptr, lda, stA,
+                                               (T*)nullptr, ldr, stR, (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_cholqr(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                               (T*)nullptr, ldr, stR, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (R, info and the Householder scalars are always strided)
+    host_strided_batch_vector<T> hR(size_R, 1, stR, bc);
+    host_strided_batch_vector<T> hIpiv(size_P, 1, size_P, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    device_strided_batch_vector<T> dR(size_R, 1, stR, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_R)
+        CHECK_HIP_ERROR(dR.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hQ(size_Q, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                   dR.data(), ldr, stR, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            cholqr_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, dInfo, bc, hA,
+                                        hQ, hR, hInfo, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            cholqr_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, dInfo, bc, hA,
+                                           hIpiv, &gpu_time_used, &cpu_time_used, hot_calls,
+                                           argus.profile, argus.profile_kernels, argus.perf,
+                                           argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hQ(size_Q, 1, stQ, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                   dR.data(), ldr, stR, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            cholqr_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, dInfo, bc, hA,
+                                        hQ, hR, hInfo, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            cholqr_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, dInfo, bc, hA,
+                                           hIpiv, &gpu_time_used, &cpu_time_used, hot_calls,
+                                           argus.profile, argus.profile_kernels, argus.perf,
+                                           argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "ldr", "strideR", "batch_c");
+                rocsolver_bench_output(m, n, lda, ldr, stR, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideA", "ldr", "strideR", "batch_c");
+                rocsolver_bench_output(m, n, lda, stA, ldr, stR, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "lda", "ldr");
+                rocsolver_bench_output(m, n, lda, ldr);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
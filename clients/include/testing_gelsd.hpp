@@ -0,0 +1,582 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S, typename U>
+void gelsd_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        T dB,
+                        const rocblas_int ldb,
+                        const rocblas_stride stB,
+                        S dS,
+                        const rocblas_stride stS,
+                        U drank,
+                        U dinfo,
+                        const rocblas_int bc)
+{
+    using SS = std::remove_pointer_t<S>;
+    const SS rcond = -1;
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, nullptr, m, n, nrhs, dA, lda, stA, dB, ldb, stB,
+                                          dS, stS, rcond, drank, dinfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb,
+                                              stB, dS, stS, rcond, drank, dinfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, (T) nullptr, lda, stA, dB,
+                                          ldb, stB, dS, stS, rcond, drank, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, dA, lda, stA, (T) nullptr,
+                                          ldb, stB, dS, stS, rcond, drank, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB,
+                                          (S) nullptr, stS, rcond, drank, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB,
+                                          dS, stS, rcond, (U) nullptr, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB,
+                                          dS, stS, rcond, drank, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, 0, n, nrhs, (T) nullptr, lda, stA, dB,
+                                          ldb, stB, (S) nullptr, stS, rcond, drank, dinfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, 0, nrhs, (T) nullptr, lda, stA, dB,
+                                          ldb, stB, (S) nullptr, stS, rcond, drank, dinfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, 0, dA, lda, stA, (T) nullptr, ldb,
+                                          stB, dS, stS, rcond, drank, dinfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb,
+                                              stB, dS, stS, rcond, (U) nullptr, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gelsd_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stB = 1;
+    rocblas_stride stS = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<S> dS(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> drank(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(drank.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+
+        // check bad arguments
+        gelsd_checkBadArgs<STRIDED>(handle, m, n, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB,
+                                    dS.data(), stS, drank.data(), dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+
+        // check bad arguments
+        gelsd_checkBadArgs<STRIDED>(handle, m, n, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB,
+                                    dS.data(), stS, drank.data(), dinfo.data(), bc);
+    }
+}
+
+/** The test matrices are well conditioned. If gap < min(m,n), the rows from index gap on are
+    scaled down, so that there is a large gap between the gap-th and the (gap+1)-th singular
+    values and the effective rank is well defined. **/
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gelsd_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int nrhs,
+                    Td& dA,
+                    const rocblas_int lda,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_int gap,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+
+                    if(i >= gap)
+                        hA[b][i + j * lda] *= T(1e-3);
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Sd, typename Ud, typename Th, typename Sh, typename Uh>
+void gelsd_getError(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int nrhs,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Sd& dS,
+                    const rocblas_stride stS,
+                    const S rcond,
+                    Ud& drank,
+                    Ud& dinfo,
+                    const rocblas_int bc,
+                    const rocblas_int gap,
+                    Th& hA,
+                    Th& hB,
+                    Th& hBres,
+                    Sh& hS,
+                    Sh& hSres,
+                    Uh& hrank,
+                    Uh& hrankRes,
+                    Uh& hinfo,
+                    Uh& hinfoRes,
+                    double* max_err)
+{
+    rocblas_int mn = std::min(m, n);
+    rocblas_int lwork = 3 * mn + std::max({2 * mn, std::max(m, n), nrhs}) + 64 * (m + n);
+    std::vector<T> work(lwork);
+    std::vector<S> rwork(5 * mn);
+
+    // input data initialization
+    gelsd_initData<true, true, T>(handle, m, n, nrhs, dA, lda, dB, ldb, gap, bc, hA, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                        dB.data(), ldb, stB, dS.data(), stS, rcond, drank.data(),
+                                        dinfo.data(), bc));
+    CHECK_HIP_ERROR(hBres.transfer_from(dB));
+    CHECK_HIP_ERROR(hSres.transfer_from(dS));
+    CHECK_HIP_ERROR(hrankRes.transfer_from(drank));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        cblas_gelss<T>(m, n, nrhs, hA[b], lda, hB[b], ldb, hS[b], rcond, hrank[b], work.data(),
+                       lwork, rwork.data(), hinfo[b]);
+
+    // check info and rank
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hinfo[b][0] != hinfoRes[b][0])
+            *max_err += 1;
+        if(hrank[b][0] != hrankRes[b][0])
+            *max_err += 1;
+    }
+
+    // error is ||hB - hBres|| / ||hB|| (only the rows of the solution)
+    // and ||hS - hSres|| / ||hS||, using frobenius norm
+    double err;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hinfo[b][0] == 0)
+        {
+            err = norm_error('F', 1, mn, 1, hS[b], hSres[b]);
+            *max_err = err > *max_err ? err : *max_err;
+
+            err = norm_error('F', n, nrhs, ldb, hB[b], hBres[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Sd, typename Ud, typename Th, typename Sh, typename Uh>
+void gelsd_getPerfData(const rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       const rocblas_int nrhs,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Td& dB,
+                       const rocblas_int ldb,
+                       const rocblas_stride stB,
+                       Sd& dS,
+                       const rocblas_stride stS,
+                       const S rcond,
+                       Ud& drank,
+                       Ud& dinfo,
+                       const rocblas_int bc,
+                       const rocblas_int gap,
+                       Th& hA,
+                       Th& hB,
+                       Sh& hS,
+                       Uh& hrank,
+                       Uh& hinfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    rocblas_int mn = std::min(m, n);
+    rocblas_int lwork = 3 * mn + std::max({2 * mn, std::max(m, n), nrhs}) + 64 * (m + n);
+    std::vector<T> work(lwork);
+    std::vector<S> rwork(5 * mn);
+
+    if(!perf)
+    {
+        gelsd_initData<true, false, T>(handle, m, n, nrhs, dA, lda, dB, ldb, gap, bc, hA, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_gelss<T>(m, n, nrhs, hA[b], lda, hB[b], ldb, hS[b], rcond, hrank[b],
+                           work.data(), lwork, rwork.data(), hinfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gelsd_initData<true, false, T>(handle, m, n, nrhs, dA, lda, dB, ldb, gap, bc, hA, hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gelsd_initData<false, true, T>(handle, m, n, nrhs, dA, lda, dB, ldb, gap, bc, hA, hB);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                            dB.data(), ldb, stB, dS.data(), stS, rcond,
+                                            drank.data(), dinfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gelsd_initData<false, true, T>(handle, m, n, nrhs, dA, lda, dB, ldb, gap, bc, hA, hB);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gelsd(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB,
+                        dS.data(), stS, rcond, drank.data(), dinfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gelsd(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", std::max(m, n));
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nrhs);
+    rocblas_stride stS = argus.get<rocblas_stride>("strideS", std::min(m, n));
+    S rcond = S(argus.get<double>("rcond", -1));
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stSres = (argus.unit_check || argus.norm_check) ? stS : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_S = size_t(std::min(m, n));
+    size_t size_Bres = (argus.unit_check || argus.norm_check) ? size_B : 0;
+    size_t size_Sres = (argus.unit_check || argus.norm_check) ? size_S : 0;
+
+    // position of the gap in the singular values of the test matrices
+    rocblas_int mn = std::max(std::min(m, n), 0);
+    rocblas_int gap = (rcond > 0 ? mn / 2 : mn);
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, (T* const*)nullptr,
+                                                  lda, stA, (T* const*)nullptr, ldb, stB,
+                                                  (S*)nullptr, stS, rcond, (rocblas_int*)nullptr,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, (T*)nullptr, lda,
+                                                  stA, (T*)nullptr, ldb, stB, (S*)nullptr, stS,
+                                                  rcond, (rocblas_int*)nullptr,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, (T* const*)nullptr, lda,
+                                              stA, (T* const*)nullptr, ldb, stB, (S*)nullptr, stS,
+                                              rcond, (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                              bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, (T*)nullptr, lda, stA,
+                                              (T*)nullptr, ldb, stB, (S*)nullptr, stS, rcond,
+                                              (rocblas_int*)nullptr, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<S> hS(size_S, 1, stS, bc);
+    host_strided_batch_vector<S> hSres(size_Sres, 1, stSres, bc);
+    host_strided_batch_vector<rocblas_int> hrank(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hrankRes(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hinfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<S> dS(size_S, 1, stS, bc);
+    device_strided_batch_vector<rocblas_int> drank(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, bc);
+    if(size_S)
+        CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(drank.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hBres(size_Bres, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                                  dB.data(), ldb, stB, dS.data(), stS, rcond,
+                                                  drank.data(), dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gelsd_getError<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dS, stS,
+                                       rcond, drank, dinfo, bc, gap, hA, hB, hBres, hS, hSres,
+                                       hrank, hrankRes, hinfo, hinfoRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gelsd_getPerfData<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dS, stS,
+                                          rcond, drank, dinfo, bc, gap, hA, hB, hS, hrank, hinfo,
+                                          &gpu_time_used, &cpu_time_used, hot_calls,
+                                          argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hBres(size_Bres, 1, stB, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsd(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                                  dB.data(), ldb, stB, dS.data(), stS, rcond,
+                                                  drank.data(), dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gelsd_getError<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dS, stS,
+                                       rcond, drank, dinfo, bc, gap, hA, hB, hBres, hS, hSres,
+                                       hrank, hrankRes, hinfo, hinfoRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gelsd_getPerfData<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dS, stS,
+                                          rcond, drank, dinfo, bc, gap, hA, hB, hS, hrank, hinfo,
+                                          &gpu_time_used, &cpu_time_used, hot_calls,
+                                          argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "ldb", "strideS", "rcond",
+                                       "batch_c");
+                rocsolver_bench_output(m, n, nrhs, lda, ldb, stS, rcond, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "strideA", "ldb", "strideB",
+                                       "strideS", "rcond", "batch_c");
+                rocsolver_bench_output(m, n, nrhs, lda, stA, ldb, stB, stS, rcond, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "ldb", "rcond");
+                rocsolver_bench_output(m, n, nrhs, lda, ldb, rcond);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -0,0 +1,614 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void gelsy_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        T dB,
+                        const rocblas_int ldb,
+                        const rocblas_stride stB,
+                        U djpvt,
+                        const rocblas_stride stP,
+                        U drank,
+                        const rocblas_int bc)
+{
+    using S = decltype(std::real(std::remove_pointer_t<std::remove_pointer_t<T>>{}));
+    const S rcond = -1;
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, nullptr, m, n, nrhs, dA, lda, stA, dB, ldb, stB,
+                                          djpvt, stP, rcond, drank, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb,
+                                              stB, djpvt, stP, rcond, drank, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, (T) nullptr, lda, stA, dB,
+                                          ldb, stB, djpvt, stP, rcond, drank, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA, lda, stA, (T) nullptr,
+                                          ldb, stB, djpvt, stP, rcond, drank, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB,
+                                          (U) nullptr, stP, rcond, drank, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB,
+                                          djpvt, stP, rcond, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, 0, n, nrhs, (T) nullptr, lda, stA, dB,
+                                          ldb, stB, djpvt, stP, rcond, drank, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, 0, nrhs, (T) nullptr, lda, stA, dB,
+                                          ldb, stB, (U) nullptr, stP, rcond, drank, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, 0, dA, lda, stA, (T) nullptr, ldb,
+                                          stB, djpvt, stP, rcond, drank, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb,
+                                              stB, djpvt, stP, rcond, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gelsy_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stB = 1;
+    rocblas_stride stP = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<rocblas_int> djpvt(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> drank(1, 1, 1, 1);
+    CHECK_HIP_ERROR(djpvt.memcheck());
+    CHECK_HIP_ERROR(drank.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+
+        // check bad arguments
+        gelsy_checkBadArgs<STRIDED>(handle, m, n, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB,
+                                    djpvt.data(), stP, drank.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+
+        // check bad arguments
+        gelsy_checkBadArgs<STRIDED>(handle, m, n, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB,
+                                    djpvt.data(), stP, drank.data(), bc);
+    }
+}
+
+/** The test matrices are well conditioned. If gap < min(m,n), the rows from index gap on are
+    scaled down, so that the effective rank determined by the condition estimation is well
+    defined. If singular is true, the even columns (and the columns beyond m) of every other
+    matrix in the batch are set to zero, so that those matrices are exactly rank-deficient
+    (with rank 0 if n = 1). **/
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gelsy_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int nrhs,
+                    Td& dA,
+                    const rocblas_int lda,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_int gap,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hB,
+                    const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+
+                    if(i >= gap)
+                        hA[b][i + j * lda] *= T(1e-3);
+                }
+            }
+
+            // make some matrices rank-deficient if required
+            // (the zero columns are interleaved, so that the pivoting must move them; the
+            // columns beyond m are also zero, so that the rank is min(m,n)/2 for any rcond)
+            if(singular && b % 2 == 0)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(j % 2 == 0 || j >= m)
+                    {
+                        for(rocblas_int i = 0; i < m; i++)
+                            hA[b][i + j * lda] = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+void gelsy_getError(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int nrhs,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Ud& djpvt,
+                    const rocblas_stride stP,
+                    const S rcond,
+                    Ud& drank,
+                    const rocblas_int bc,
+                    const rocblas_int gap,
+                    Th& hA,
+                    Th& hB,
+                    Th& hBres,
+                    Uh& hjpvt,
+                    Uh& hjpvtRes,
+                    Uh& hrank,
+                    Uh& hrankRes,
+                    double* max_err,
+                    const bool singular)
+{
+    rocblas_int mn = std::min(m, n);
+    rocblas_int lwork = std::max({mn + 2 * n + 64 * (n + 1), 2 * mn + 64 * nrhs});
+    std::vector<T> work(lwork);
+    std::vector<S> rwork(2 * n);
+    rocblas_int info;
+
+    // a negative rcond means that machine precision is used as threshold
+    // (LAPACK would consider all the columns instead)
+    const S rc = (rcond < 0) ? std::numeric_limits<S>::epsilon() : rcond;
+
+    // input data initialization
+    gelsy_initData<true, true, T>(handle, m, n, nrhs, dA, lda, dB, ldb, gap, bc, hA, hB,
+                                  singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                        dB.data(), ldb, stB, djpvt.data(), stP, rcond,
+                                        drank.data(), bc));
+    CHECK_HIP_ERROR(hBres.transfer_from(dB));
+    CHECK_HIP_ERROR(hjpvtRes.transfer_from(djpvt));
+    CHECK_HIP_ERROR(hrankRes.transfer_from(drank));
+
+    // CPU lapack
+    // (all the columns are free to be pivoted)
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+            hjpvt[b][j] = 0;
+        cblas_gelsy<T>(m, n, nrhs, hA[b], lda, hB[b], ldb, hjpvt[b], rc, hrank[b], work.data(),
+                       lwork, rwork.data(), &info);
+    }
+
+    // check rank, and check that jpvt is a permutation
+    // (the pivots are not compared, as columns with equal norms may be chosen in any order)
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hrank[b][0] != hrankRes[b][0])
+            *max_err += 1;
+
+        // the rank-deficient matrices have rank min(m,n)/2
+        if(singular && b % 2 == 0 && hrankRes[b][0] != mn / 2)
+            *max_err += 1;
+
+        std::vector<bool> seen(n, false);
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            rocblas_int p = hjpvtRes[b][j];
+            if(p < 1 || p > n || seen[p - 1])
+                *max_err += 1;
+            else
+                seen[p - 1] = true;
+        }
+    }
+
+    // error is ||hB - hBres|| / ||hB|| (only the rows of the solution)
+    // using frobenius norm
+    double err;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('F', n, nrhs, ldb, hB[b], hBres[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+void gelsy_getPerfData(const rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       const rocblas_int nrhs,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Td& dB,
+                       const rocblas_int ldb,
+                       const rocblas_stride stB,
+                       Ud& djpvt,
+                       const rocblas_stride stP,
+                       const S rcond,
+                       Ud& drank,
+                       const rocblas_int bc,
+                       const rocblas_int gap,
+                       Th& hA,
+                       Th& hB,
+                       Uh& hjpvt,
+                       Uh& hrank,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf,
+                       const bool singular)
+{
+    rocblas_int mn = std::min(m, n);
+    rocblas_int lwork = std::max({mn + 2 * n + 64 * (n + 1), 2 * mn + 64 * nrhs});
+    std::vector<T> work(lwork);
+    std::vector<S> rwork(2 * n);
+    rocblas_int info;
+    const S rc = (rcond < 0) ? std::numeric_limits<S>::epsilon() : rcond;
+
+    if(!perf)
+    {
+        gelsy_initData<true, false, T>(handle, m, n, nrhs, dA, lda, dB, ldb, gap, bc, hA, hB,
+                                       singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+                hjpvt[b][j] = 0;
+            cblas_gelsy<T>(m, n, nrhs, hA[b], lda, hB[b], ldb, hjpvt[b], rc, hrank[b],
+                           work.data(), lwork, rwork.data(), &info);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gelsy_initData<true, false, T>(handle, m, n, nrhs, dA, lda, dB, ldb, gap, bc, hA, hB,
+                                   singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gelsy_initData<false, true, T>(handle, m, n, nrhs, dA, lda, dB, ldb, gap, bc, hA, hB,
+                                       singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                            dB.data(), ldb, stB, djpvt.data(), stP, rcond,
+                                            drank.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gelsy_initData<false, true, T>(handle, m, n, nrhs, dA, lda, dB, ldb, gap, bc, hA, hB,
+                                       singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB,
+                        djpvt.data(), stP, rcond, drank.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gelsy(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", std::max(m, n));
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nrhs);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", n);
+    S rcond = S(argus.get<double>("rcond", -1));
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stPres = (argus.unit_check || argus.norm_check) ? stP : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_P = size_t(n);
+    size_t size_Bres = (argus.unit_check || argus.norm_check) ? size_B : 0;
+    size_t size_Pres = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // position of the gap in the singular values of the test matrices
+    // (the rank-deficient matrices are not scaled, so that their rank is well defined)
+    rocblas_int mn = std::max(std::min(m, n), 0);
+    rocblas_int gap = (rcond > 0 && !argus.singular ? mn / 2 : mn);
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, (T* const*)nullptr,
+                                                  lda, stA, (T* const*)nullptr, ldb, stB,
+                                                  (rocblas_int*)nullptr, stP, rcond,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, (T*)nullptr, lda,
+                                                  stA, (T*)nullptr, ldb, stB, (rocblas_int*)nullptr,
+                                                  stP, rcond, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, (T* const*)nullptr, lda,
+                                              stA, (T* const*)nullptr, ldb, stB,
+                                              (rocblas_int*)nullptr, stP, rcond,
+                                              (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, (T*)nullptr, lda, stA,
+                                              (T*)nullptr, ldb, stB, (rocblas_int*)nullptr, stP,
+                                              rcond, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<rocblas_int> hjpvt(size_P, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hjpvtRes(size_Pres, 1, stPres, bc);
+    host_strided_batch_vector<rocblas_int> hrank(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hrankRes(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<rocblas_int> djpvt(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> drank(1, 1, 1, bc);
+    if(size_P)
+        CHECK_HIP_ERROR(djpvt.memcheck());
+    CHECK_HIP_ERROR(drank.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hBres(size_Bres, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                                  dB.data(), ldb, stB, djpvt.data(), stP, rcond,
+                                                  drank.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gelsy_getError<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, djpvt, stP,
+                                       rcond, drank, bc, gap, hA, hB, hBres, hjpvt, hjpvtRes,
+                                       hrank, hrankRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            gelsy_getPerfData<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, djpvt,
+                                          stP, rcond, drank, bc, gap, hA, hB, hjpvt, hrank,
+                                          &gpu_time_used, &cpu_time_used, hot_calls,
+                                          argus.profile, argus.profile_kernels, argus.perf,
+                                          argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hBres(size_Bres, 1, stB, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                                  dB.data(), ldb, stB, djpvt.data(), stP, rcond,
+                                                  drank.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gelsy_getError<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, djpvt, stP,
+                                       rcond, drank, bc, gap, hA, hB, hBres, hjpvt, hjpvtRes,
+                                       hrank, hrankRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            gelsy_getPerfData<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, djpvt,
+                                          stP, rcond, drank, bc, gap, hA, hB, hjpvt, hrank,
+                                          &gpu_time_used, &cpu_time_used, hot_calls,
+                                          argus.profile, argus.profile_kernels, argus.perf,
+                                          argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "ldb", "strideP", "rcond",
+                                       "batch_c");
+                rocsolver_bench_output(m, n, nrhs, lda, ldb, stP, rcond, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "strideA", "ldb", "strideB",
+                                       "strideP", "rcond", "batch_c");
+                rocsolver_bench_output(m, n, nrhs, lda, stA, ldb, stB, stP, rcond, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "ldb", "rcond");
+                rocsolver_bench_output(m, n, nrhs, lda, ldb, rcond);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -0,0 +1,596 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, bool COMPLEX, typename T, typename U>
+void gemqrt_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_side side,
+                         const rocblas_operation trans,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         const rocblas_int k,
+                         const rocblas_int nb,
+                         T dV,
+                         const rocblas_int ldv,
+                         const rocblas_stride stV,
+                         U dT,
+                         const rocblas_int ldt,
+                         const rocblas_stride stT,
+                         T dC,
+                         const rocblas_int ldc,
+                         const rocblas_stride stC,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, nullptr, side, trans, m, n, k, nb, dV, ldv, stV,
+                                           dT, ldt, stT, dC, ldc, stC, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, rocblas_side(-1), trans, m, n, k, nb,
+                                           dV, ldv, stV, dT, ldt, stT, dC, ldc, stC, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, rocblas_operation(-1), m, n, k,
+                                           nb, dV, ldv, stV, dT, ldt, stT, dC, ldc, stC, bc),
+                          rocblas_status_invalid_value);
+    if(COMPLEX)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, rocblas_operation_transpose,
+                                               m, n, k, nb, dV, ldv, stV, dT, ldt, stT, dC, ldc,
+                                               stC, bc),
+                              rocblas_status_invalid_value);
+    else
+        EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side,
+                                               rocblas_operation_conjugate_transpose, m, n, k, nb,
+                                               dV, ldv, stV, dT, ldt, stT, dC, ldc, stC, bc),
+                              rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb, dV, ldv,
+                                               stV, dT, ldt, stT, dC, ldc, stC, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb, (T) nullptr,
+                                           ldv, stV, dT, ldt, stT, dC, ldc, stC, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb, dV, ldv, stV,
+                                           (U) nullptr, ldt, stT, dC, ldc, stC, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb, dV, ldv, stV,
+                                           dT, ldt, stT, (T) nullptr, ldc, stC, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, rocblas_side_right, trans, 0, n, k, nb,
+                                           dV, ldv, stV, dT, ldt, stT, (T) nullptr, ldc, stC, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, rocblas_side_left, trans, m, 0, k, nb,
+                                           dV, ldv, stV, dT, ldt, stT, (T) nullptr, ldc, stC, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, rocblas_side_left, trans, m, n, 0, nb,
+                                           (T) nullptr, ldv, stV, (U) nullptr, ldt, stT, dC, ldc,
+                                           stC, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb, dV, ldv,
+                                               stV, dT, ldt, stT, dC, ldc, stC, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, bool COMPLEX = is_complex<T>>
+void testing_gemqrt_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_side side = rocblas_side_left;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int k = 1;
+    rocblas_int nb = 1;
+    rocblas_int ldv = 1;
+    rocblas_int ldt = 1;
+    rocblas_int ldc = 1;
+    rocblas_stride stV = 1;
+    rocblas_stride stT = 1;
+    rocblas_stride stC = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dV(1, 1, 1);
+        device_strided_batch_vector<T> dT(1, 1, 1, 1);
+        device_batch_vector<T> dC(1, 1, 1);
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dT.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+
+        // check bad arguments
+        gemqrt_checkBadArgs<STRIDED, COMPLEX>(handle, side, trans, m, n, k, nb, dV.data(), ldv, stV,
+                                              dT.data(), ldt, stT, dC.data(), ldc, stC, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dV(1, 1, 1, 1);
+        device_strided_batch_vector<T> dT(1, 1, 1, 1);
+        device_strided_batch_vector<T> dC(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dT.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+
+        // check bad arguments
+        gemqrt_checkBadArgs<STRIDED, COMPLEX>(handle, side, trans, m, n, k, nb, dV.data(), ldv, stV,
+                                              dT.data(), ldt, stT, dC.data(), ldc, stC, bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gemqrt_initData(const rocblas_handle handle,
+                     const rocblas_side side,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     const rocblas_int k,
+                     const rocblas_int nb,
+                     Td& dV,
+                     const rocblas_int ldv,
+                     Ud& dT,
+                     const rocblas_int ldt,
+                     Td& dC,
+                     const rocblas_int ldc,
+                     const rocblas_int bc,
+                     Th& hV,
+                     Uh& hIpiv,
+                     Uh& hT,
+                     Th& hC,
+                     std::vector<T>& hW,
+                     size_t size_W)
+{
+    if(CPU)
+    {
+        rocblas_int nq = (side == rocblas_side_left) ? m : n;
+
+        rocblas_init<T>(hV, true);
+        rocblas_init<T>(hC, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale to avoid singularities
+            for(rocblas_int i = 0; i < nq; ++i)
+            {
+                for(rocblas_int j = 0; j < k; ++j)
+                {
+                    if(i == j)
+                        hV[b][i + j * ldv] += 400;
+                    else
+                        hV[b][i + j * ldv] -= 4;
+                }
+            }
+
+            // compute QR factorization and the triangular factors of the block reflectors
+            cblas_geqrf<T>(nq, k, hV[b], ldv, hIpiv[b], hW.data(), size_W);
+            for(rocblas_int j = 0; j < k; j += nb)
+                cblas_larft<T>(rocblas_forward_direction, rocblas_column_wise, nq - j,
+                               min(nb, k - j), hV[b] + j + j * ldv, ldv, hIpiv[b] + j,
+                               hT[b] + j * ldt, ldt);
+        }
+    }
+
+    if(GPU)
+    {
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dV.transfer_from(hV));
+        CHECK_HIP_ERROR(dT.transfer_from(hT));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gemqrt_getError(const rocblas_handle handle,
+                     const rocblas_side side,
+                     const rocblas_operation trans,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     const rocblas_int k,
+                     const rocblas_int nb,
+                     Td& dV,
+                     const rocblas_int ldv,
+                     const rocblas_stride stV,
+                     Ud& dT,
+                     const rocblas_int ldt,
+                     const rocblas_stride stT,
+                     Td& dC,
+                     const rocblas_int ldc,
+                     const rocblas_stride stC,
+                     const rocblas_int bc,
+                     Th& hV,
+                     Uh& hIpiv,
+                     Uh& hT,
+                     Th& hC,
+                     Th& hCr,
+                     double* max_err)
+{
+    size_t size_W = max(max(m, n), k);
+    std::vector<T> hW(size_W);
+
+    // initialize data
+    gemqrt_initData<true, true, T>(handle, side, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc, bc, hV,
+                                   hIpiv, hT, hC, hW, size_W);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb, dV.data(), ldv,
+                                         stV, dT.data(), ldt, stT, dC.data(), ldc, stC, bc));
+    CHECK_HIP_ERROR(hCr.transfer_from(dC));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        cblas_ormqr_unmqr<T>(side, trans, m, n, k, hV[b], ldv, hIpiv[b], hC[b], ldc, hW.data(),
+                             size_W);
+
+    // error is ||hC - hCr|| / ||hC||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('F', m, n, ldc, hC[b], hCr[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gemqrt_getPerfData(const rocblas_handle handle,
+                        const rocblas_side side,
+                        const rocblas_operation trans,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int k,
+                        const rocblas_int nb,
+                        Td& dV,
+                        const rocblas_int ldv,
+                        const rocblas_stride stV,
+                        Ud& dT,
+                        const rocblas_int ldt,
+                        const rocblas_stride stT,
+                        Td& dC,
+                        const rocblas_int ldc,
+                        const rocblas_stride stC,
+                        const rocblas_int bc,
+                        Th& hV,
+                        Uh& hIpiv,
+                        Uh& hT,
+                        Th& hC,
+                        double* gpu_time_used,
+                        double* cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const int profile,
+                        const bool profile_kernels,
+                        const bool perf)
+{
+    size_t size_W = max(max(m, n), k);
+    std::vector<T> hW(size_W);
+
+    if(!perf)
+    {
+        gemqrt_initData<true, false, T>(handle, side, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc, bc,
+                                        hV, hIpiv, hT, hC, hW, size_W);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_ormqr_unmqr<T>(side, trans, m, n, k, hV[b], ldv, hIpiv[b], hC[b], ldc,
+                                 hW.data(), size_W);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gemqrt_initData<true, false, T>(handle, side, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc, bc, hV,
+                                    hIpiv, hT, hC, hW, size_W);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gemqrt_initData<false, true, T>(handle, side, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc, bc,
+                                        hV, hIpiv, hT, hC, hW, size_W);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb, dV.data(),
+                                             ldv, stV, dT.data(), ldt, stT, dC.data(), ldc, stC,
+                                             bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        gemqrt_initData<false, true, T>(handle, side, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc, bc,
+                                        hV, hIpiv, hT, hC, hW, size_W);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb, dV.data(), ldv, stV, dT.data(),
+                         ldt, stT, dC.data(), ldc, stC, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, bool COMPLEX = is_complex<T>>
+void testing_gemqrt(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char sideC = argus.get<char>("side");
+    char transC = argus.get<char>("trans");
+    rocblas_int m, n, k;
+    if(sideC == 'L')
+    {
+        m = argus.get<rocblas_int>("m");
+        n = argus.get<rocblas_int>("n", m);
+        k = argus.get<rocblas_int>("k", m);
+    }
+    else
+    {
+        n = argus.get<rocblas_int>("n");
+        m = argus.get<rocblas_int>("m", n);
+        k = argus.get<rocblas_int>("k", n);
+    }
+    rocblas_int nb = argus.get<rocblas_int>("nb", max(min(k, 32), 1));
+    rocblas_int ldv = argus.get<rocblas_int>("ldv", sideC == 'L' ? m : n);
+    rocblas_int ldt = argus.get<rocblas_int>("ldt", nb);
+    rocblas_int ldc = argus.get<rocblas_int>("ldc", m);
+    rocblas_stride stV = argus.get<rocblas_stride>("strideV", ldv * k);
+    rocblas_stride stT = argus.get<rocblas_stride>("strideT", ldt * k);
+    rocblas_stride stC = argus.get<rocblas_stride>("strideC", ldc * n);
+
+    rocblas_side side = char2rocblas_side(sideC);
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stCr = (argus.unit_check || argus.norm_check) ? stC : 0;
+
+    // check non-supported values
+    bool invalid_value
+        = (side == rocblas_side_both || (COMPLEX && trans == rocblas_operation_transpose)
+           || (!COMPLEX && trans == rocblas_operation_conjugate_transpose));
+    if(invalid_value)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb,
+                                                   (T* const*)nullptr, ldv, stV, (T*)nullptr, ldt,
+                                                   stT, (T* const*)nullptr, ldc, stC, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb,
+                                                   (T*)nullptr, ldv, stV, (T*)nullptr, ldt, stT,
+                                                   (T*)nullptr, ldc, stC, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    bool left = (side == rocblas_side_left);
+    size_t size_V = size_t(ldv) * k;
+    size_t size_P = size_t(k);
+    size_t size_T = size_t(ldt) * k;
+    size_t size_C = size_t(ldc) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_Cr = (argus.unit_check || argus.norm_check) ? size_C : 0;
+
+    // check invalid sizes
+    bool invalid_size = ((m < 0 || n < 0 || k < 0 || ldc < m || bc < 0)
+                         || (left && (ldv < m || k > m)) || (!left && (ldv < n || k > n))
+                         || (nb < 1 || (k && nb > k) || ldt < nb));
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb,
+                                                   (T* const*)nullptr, ldv, stV, (T*)nullptr, ldt,
+                                                   stT, (T* const*)nullptr, ldc, stC, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb,
+                                                   (T*)nullptr, ldv, stV, (T*)nullptr, ldt, stT,
+                                                   (T*)nullptr, ldc, stC, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb,
+                                               (T* const*)nullptr, ldv, stV, (T*)nullptr, ldt, stT,
+                                               (T* const*)nullptr, ldc, stC, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb,
+                                               (T*)nullptr, ldv, stV, (T*)nullptr, ldt, stT,
+                                               (T*)nullptr, ldc, stC, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hIpiv(size_P, 1, size_P, bc);
+    host_strided_batch_vector<T> hT(size_T, 1, stT, bc);
+    device_strided_batch_vector<T> dT(size_T, 1, stT, bc);
+    if(size_T)
+        CHECK_HIP_ERROR(dT.memcheck());
+
+    if(BATCHED)
+    {
+        host_batch_vector<T> hV(size_V, 1, bc);
+        host_batch_vector<T> hC(size_C, 1, bc);
+        host_batch_vector<T> hCr(size_Cr, 1, bc);
+        device_batch_vector<T> dV(size_V, 1, bc);
+        device_batch_vector<T> dC(size_C, 1, bc);
+        if(size_V)
+            CHECK_HIP_ERROR(dV.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+
+        // check quick return
+        if(n == 0 || m == 0 || k == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb,
+                                                   dV.data(), ldv, stV, dT.data(), ldt, stT,
+                                                   dC.data(), ldc, stC, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gemqrt_getError<STRIDED, T>(handle, side, trans, m, n, k, nb, dV, ldv, stV, dT, ldt,
+                                        stT, dC, ldc, stC, bc, hV, hIpiv, hT, hC, hCr, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gemqrt_getPerfData<STRIDED, T>(handle, side, trans, m, n, k, nb, dV, ldv, stV, dT, ldt,
+                                           stT, dC, ldc, stC, bc, hV, hIpiv, hT, hC,
+                                           &gpu_time_used, &cpu_time_used, hot_calls,
+                                           argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    else
+    {
+        host_strided_batch_vector<T> hV(size_V, 1, stV, bc);
+        host_strided_batch_vector<T> hC(size_C, 1, stC, bc);
+        host_strided_batch_vector<T> hCr(size_Cr, 1, stCr, bc);
+        device_strided_batch_vector<T> dV(size_V, 1, stV, bc);
+        device_strided_batch_vector<T> dC(size_C, 1, stC, bc);
+        if(size_V)
+            CHECK_HIP_ERROR(dV.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+
+        // check quick return
+        if(n == 0 || m == 0 || k == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(STRIDED, handle, side, trans, m, n, k, nb,
+                                                   dV.data(), ldv, stV, dT.data(), ldt, stT,
+                                                   dC.data(), ldc, stC, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gemqrt_getError<STRIDED, T>(handle, side, trans, m, n, k, nb, dV, ldv, stV, dT, ldt,
+                                        stT, dC, ldc, stC, bc, hV, hIpiv, hT, hC, hCr, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gemqrt_getPerfData<STRIDED, T>(handle, side, trans, m, n, k, nb, dV, ldv, stV, dT, ldt,
+                                           stT, dC, ldc, stC, bc, hV, hIpiv, hT, hC,
+                                           &gpu_time_used, &cpu_time_used, hot_calls,
+                                           argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using s * machine_precision as tolerance
+    rocblas_int s = left ? m : n;
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, s);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("side", "trans", "m", "n", "k", "nb", "ldv", "ldt",
+                                       "strideT", "ldc", "batch_c");
+                rocsolver_bench_output(sideC, transC, m, n, k, nb, ldv, ldt, stT, ldc, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("side", "trans", "m", "n", "k", "nb", "ldv", "strideV",
+                                       "ldt", "strideT", "ldc", "strideC", "batch_c");
+                rocsolver_bench_output(sideC, transC, m, n, k, nb, ldv, stV, ldt, stT, ldc, stC,
+                                       bc);
+            }
+            else
+            {
+                rocsolver_bench_output("side", "trans", "m", "n", "k", "nb", "ldv", "ldt", "ldc");
+                rocsolver_bench_output(sideC, transC, m, n, k, nb, ldv, ldt, ldc);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
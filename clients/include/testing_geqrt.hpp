@@ -0,0 +1,502 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void geqrt_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int nb,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        U dIpiv,
+                        const rocblas_stride stP,
+                        U dT,
+                        const rocblas_int ldt,
+                        const rocblas_stride stT,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqrt(STRIDED, nullptr, m, n, nb, dA, lda, stA, dIpiv, stP, dT, ldt, stT, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_geqrt(STRIDED, handle, m, n, nb, dA, lda, stA, dIpiv, stP, dT, ldt, stT, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(STRIDED, handle, m, n, nb, (T) nullptr, lda, stA, dIpiv,
+                                          stP, dT, ldt, stT, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(STRIDED, handle, m, n, nb, dA, lda, stA, (U) nullptr, stP,
+                                          dT, ldt, stT, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(STRIDED, handle, m, n, nb, dA, lda, stA, dIpiv, stP,
+                                          (U) nullptr, ldt, stT, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(STRIDED, handle, 0, n, nb, (T) nullptr, lda, stA,
+                                          (U) nullptr, stP, (U) nullptr, ldt, stT, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(STRIDED, handle, m, 0, nb, (T) nullptr, lda, stA,
+                                          (U) nullptr, stP, (U) nullptr, ldt, stT, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_geqrt(STRIDED, handle, m, n, nb, dA, lda, stA, dIpiv, stP, dT, ldt, stT, 0),
+            rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqrt_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int nb = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldt = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    rocblas_stride stT = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<T> dT(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dT.memcheck());
+
+        // check bad arguments
+        geqrt_checkBadArgs<STRIDED>(handle, m, n, nb, dA.data(), lda, stA, dIpiv.data(), stP,
+                                    dT.data(), ldt, stT, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<T> dT(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dT.memcheck());
+
+        // check bad arguments
+        geqrt_checkBadArgs<STRIDED>(handle, m, n, nb, dA.data(), lda, stA, dIpiv.data(), stP,
+                                    dT.data(), ldt, stT, bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th, typename Uh>
+void geqrt_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Uh& hT)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+        }
+
+        // the strictly lower part of the triangular factors is set to zero
+        // by the GPU routine
+        for(rocblas_int b = 0; b < bc; ++b)
+            memset(hT[b], 0, hT.n() * sizeof(T));
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void geqrt_getError(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int nb,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Ud& dIpiv,
+                    const rocblas_stride stP,
+                    Ud& dT,
+                    const rocblas_int ldt,
+                    const rocblas_stride stT,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hARes,
+                    Uh& hIpiv,
+                    Uh& hT,
+                    Uh& hTRes,
+                    double* max_err)
+{
+    rocblas_int dim = min(m, n);
+    std::vector<T> hW(n);
+
+    // input data initialization
+    geqrt_initData<true, true, T>(handle, m, n, dA, lda, stA, bc, hA, hT);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geqrt(STRIDED, handle, m, n, nb, dA.data(), lda, stA,
+                                        dIpiv.data(), stP, dT.data(), ldt, stT, bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hTRes.transfer_from(dT));
+
+    // CPU lapack
+    // (the triangular factors are computed from the reflectors of the CPU factorization)
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cblas_geqrf<T>(m, n, hA[b], lda, hIpiv[b], hW.data(), n);
+        for(rocblas_int j = 0; j < dim; j += nb)
+            cblas_larft<T>(rocblas_forward_direction, rocblas_column_wise, m - j, min(nb, dim - j),
+                           hA[b] + j + j * lda, lda, hIpiv[b] + j, hT[b] + j * ldt, ldt);
+    }
+
+    // error is max(||hA - hARes|| / ||hA||, ||hT - hTRes|| / ||hT||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('F', m, n, lda, hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+        err = norm_error('F', nb, dim, ldt, hT[b], hTRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void geqrt_getPerfData(const rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       const rocblas_int nb,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Ud& dIpiv,
+                       const rocblas_stride stP,
+                       Ud& dT,
+                       const rocblas_int ldt,
+                       const rocblas_stride stT,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Uh& hIpiv,
+                       Uh& hT,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    rocblas_int dim = min(m, n);
+    std::vector<T> hW(n);
+
+    if(!perf)
+    {
+        geqrt_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA, hT);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cblas_geqrf<T>(m, n, hA[b], lda, hIpiv[b], hW.data(), n);
+            for(rocblas_int j = 0; j < dim; j += nb)
+                cblas_larft<T>(rocblas_forward_direction, rocblas_column_wise, m - j,
+                               min(nb, dim - j), hA[b] + j + j * lda, lda, hIpiv[b] + j,
+                               hT[b] + j * ldt, ldt);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqrt_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA, hT);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geqrt_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA, hT);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_geqrt(STRIDED, handle, m, n, nb, dA.data(), lda, stA,
+                                            dIpiv.data(), stP, dT.data(), ldt, stT, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        geqrt_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA, hT);
+
+        start = get_time_us_sync(stream);
+        rocsolver_geqrt(STRIDED, handle, m, n, nb, dA.data(), lda, stA, dIpiv.data(), stP,
+                        dT.data(), ldt, stT, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqrt(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int nb = argus.get<rocblas_int>("nb", max(min(min(m, n), 32), 1));
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldt = argus.get<rocblas_int>("ldt", nb);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", min(m, n));
+    rocblas_stride stT = argus.get<rocblas_stride>("strideT", ldt * min(m, n));
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+    rocblas_stride stTRes = (argus.unit_check || argus.norm_check) ? stT : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(min(m, n));
+    size_t size_T = size_t(ldt) * min(m, n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_TRes = (argus.unit_check || argus.norm_check) ? size_T : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || nb < 1 || (m * n && nb > min(m, n))
+                         || ldt < nb || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(STRIDED, handle, m, n, nb, (T* const*)nullptr,
+                                                  lda, stA, (T*)nullptr, stP, (T*)nullptr, ldt,
+                                                  stT, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(STRIDED, handle, m, n, nb, (T*)nullptr, lda, stA,
+                                                  (T*)nullptr, stP, (T*)nullptr, ldt, stT, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_geqrt(STRIDED, handle, m, n, nb, (T* const*)nullptr, lda,
+                                              stA, (T*)nullptr, stP, (T*)nullptr, ldt, stT, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_geqrt(STRIDED, handle, m, n, nb, (T*)nullptr, lda, stA,
+                                              (T*)nullptr, stP, (T*)nullptr, ldt, stT, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<T> hT(size_T, 1, stT, bc);
+    host_strided_batch_vector<T> hTRes(size_TRes, 1, stTRes, bc);
+    device_strided_batch_vector<T> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<T> dT(size_T, 1, stT, bc);
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    if(size_T)
+        CHECK_HIP_ERROR(dT.memcheck());
+
+    if(BATCHED)
+    {
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(STRIDED, handle, m, n, nb, dA.data(), lda, stA,
+                                                  dIpiv.data(), stP, dT.data(), ldt, stT, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqrt_getError<STRIDED, T>(handle, m, n, nb, dA, lda, stA, dIpiv, stP, dT, ldt, stT,
+                                       bc, hA, hARes, hIpiv, hT, hTRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqrt_getPerfData<STRIDED, T>(handle, m, n, nb, dA, lda, stA, dIpiv, stP, dT, ldt, stT,
+                                          bc, hA, hIpiv, hT, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.profile, argus.profile_kernels,
+                                          argus.perf);
+    }
+
+    else
+    {
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(STRIDED, handle, m, n, nb, dA.data(), lda, stA,
+                                                  dIpiv.data(), stP, dT.data(), ldt, stT, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqrt_getError<STRIDED, T>(handle, m, n, nb, dA, lda, stA, dIpiv, stP, dT, ldt, stT,
+                                       bc, hA, hARes, hIpiv, hT, hTRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqrt_getPerfData<STRIDED, T>(handle, m, n, nb, dA, lda, stA, dIpiv, stP, dT, ldt, stT,
+                                          bc, hA, hIpiv, hT, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.profile, argus.profile_kernels,
+                                          argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "nb", "lda", "strideP", "ldt", "strideT",
+                                       "batch_c");
+                rocsolver_bench_output(m, n, nb, lda, stP, ldt, stT, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "nb", "lda", "strideA", "strideP", "ldt",
+                                       "strideT", "batch_c");
+                rocsolver_bench_output(m, n, nb, lda, stA, stP, ldt, stT, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "nb", "lda", "ldt");
+                rocsolver_bench_output(m, n, nb, lda, ldt);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -0,0 +1,806 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename TT, typename W, typename U>
+void gesvd_rowmajor_checkBadArgs(const rocblas_handle handle,
+                                 const rocblas_svect left_svect,
+                                 const rocblas_svect right_svect,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 W dA,
+                                 const rocblas_int lda,
+                                 const rocblas_stride stA,
+                                 TT dS,
+                                 const rocblas_stride stS,
+                                 T dU,
+                                 const rocblas_int ldu,
+                                 const rocblas_stride stU,
+                                 T dV,
+                                 const rocblas_int ldv,
+                                 const rocblas_stride stV,
+                                 TT dE,
+                                 const rocblas_stride stE,
+                                 const rocblas_workmode fa,
+                                 U dinfo,
+                                 const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, nullptr, left_svect, right_svect, m, n,
+                                                   dA, lda, stA, dS, stS, dU, ldu, stU, dV, ldv,
+                                                   stV, dE, stE, fa, dinfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, rocblas_svect(-1), right_svect,
+                                                   m, n, dA, lda, stA, dS, stS, dU, ldu, stU, dV,
+                                                   ldv, stV, dE, stE, fa, dinfo, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, rocblas_svect(-1),
+                                                   m, n, dA, lda, stA, dS, stS, dU, ldu, stU, dV,
+                                                   ldv, stV, dE, stE, fa, dinfo, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, rocblas_svect_overwrite,
+                                                   rocblas_svect_overwrite, m, n, dA, lda, stA, dS,
+                                                   stS, dU, ldu, stU, dV, ldv, stV, dE, stE, fa,
+                                                   dinfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, m,
+                                                       n, dA, lda, stA, dS, stS, dU, ldu, stU, dV,
+                                                       ldv, stV, dE, stE, fa, dinfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, m, n,
+                                                   (W) nullptr, lda, stA, dS, stS, dU, ldu, stU, dV,
+                                                   ldv, stV, dE, stE, fa, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, m, n,
+                                                   dA, lda, stA, (TT) nullptr, stS, dU, ldu, stU,
+                                                   dV, ldv, stV, dE, stE, fa, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, m, n,
+                                                   dA, lda, stA, dS, stS, (T) nullptr, ldu, stU, dV,
+                                                   ldv, stV, dE, stE, fa, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, m, n,
+                                                   dA, lda, stA, dS, stS, dU, ldu, stU, (T) nullptr,
+                                                   ldv, stV, dE, stE, fa, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, m, n,
+                                                   dA, lda, stA, dS, stS, dU, ldu, stU, dV, ldv,
+                                                   stV, (TT) nullptr, stE, fa, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, m, n,
+                                                   dA, lda, stA, dS, stS, dU, ldu, stU, dV, ldv,
+                                                   stV, dE, stE, fa, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, 0, n,
+                                                   (W) nullptr, lda, stA, (TT) nullptr, stS,
+                                                   (T) nullptr, ldu, stU, dV, ldv, stV,
+                                                   (TT) nullptr, stE, fa, dinfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, m, 0,
+                                                   (W) nullptr, lda, stA, (TT) nullptr, stS, dU,
+                                                   ldu, stU, (T) nullptr, ldv, stV, (TT) nullptr,
+                                                   stE, fa, dinfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, m,
+                                                       n, dA, lda, stA, dS, stS, dU, ldu, stU, dV,
+                                                       ldv, stV, dE, stE, fa, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gesvd_rowmajor_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_svect left_svect = rocblas_svect_all;
+    rocblas_svect right_svect = rocblas_svect_all;
+    rocblas_int m = 2;
+    rocblas_int n = 2;
+    rocblas_int lda = 2;
+    rocblas_int ldu = 2;
+    rocblas_int ldv = 2;
+    rocblas_stride stA = 2;
+    rocblas_stride stS = 2;
+    rocblas_stride stU = 2;
+    rocblas_stride stV = 2;
+    rocblas_stride stE = 2;
+    rocblas_int bc = 1;
+    rocblas_workmode fa = rocblas_outofplace;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<S> dS(1, 1, 1, 1);
+        device_strided_batch_vector<T> dU(1, 1, 1, 1);
+        device_strided_batch_vector<T> dV(1, 1, 1, 1);
+        device_strided_batch_vector<S> dE(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dS.memcheck());
+        CHECK_HIP_ERROR(dU.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        gesvd_rowmajor_checkBadArgs<STRIDED>(handle, left_svect, right_svect, m, n, dA.data(), lda,
+                                             stA, dS.data(), stS, dU.data(), ldu, stU, dV.data(),
+                                             ldv, stV, dE.data(), stE, fa, dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<S> dS(1, 1, 1, 1);
+        device_strided_batch_vector<T> dU(1, 1, 1, 1);
+        device_strided_batch_vector<T> dV(1, 1, 1, 1);
+        device_strided_batch_vector<S> dE(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dS.memcheck());
+        CHECK_HIP_ERROR(dU.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        gesvd_rowmajor_checkBadArgs<STRIDED>(handle, left_svect, right_svect, m, n, dA.data(), lda,
+                                             stA, dS.data(), stS, dU.data(), ldu, stU, dV.data(),
+                                             ldv, stV, dE.data(), stE, fa, dinfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gesvd_rowmajor_initData(const rocblas_handle handle,
+                             const rocblas_int m,
+                             const rocblas_int n,
+                             Td& dA,
+                             const rocblas_int lda,
+                             const rocblas_int bc,
+                             Th& hA,
+                             host_strided_batch_vector<T>& hACm)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            // (element (i,j) of the row-major matrix is hA[b][i * lda + j])
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i * lda + j] += 400;
+                    else
+                        hA[b][i * lda + j] -= 4;
+                }
+            }
+
+            // column-major copy for the CPU reference and to test the vectors
+            for(rocblas_int i = 0; i < m; i++)
+                for(rocblas_int j = 0; j < n; j++)
+                    hACm[b][i + j * m] = hA[b][i * lda + j];
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Wd, typename Td, typename Ud, typename Id, typename Wh, typename Th, typename Uh, typename Ih>
+void gesvd_rowmajor_getError(const rocblas_handle handle,
+                             const rocblas_svect left_svect,
+                             const rocblas_svect right_svect,
+                             const rocblas_int m,
+                             const rocblas_int n,
+                             Wd& dA,
+                             const rocblas_int lda,
+                             const rocblas_stride stA,
+                             Td& dS,
+                             const rocblas_stride stS,
+                             Ud& dU,
+                             const rocblas_int ldu,
+                             const rocblas_stride stU,
+                             Ud& dV,
+                             const rocblas_int ldv,
+                             const rocblas_stride stV,
+                             Td& dE,
+                             const rocblas_stride stE,
+                             const rocblas_workmode fa,
+                             Id& dinfo,
+                             const rocblas_int bc,
+                             Wh& hA,
+                             Th& hS,
+                             Th& hSres,
+                             Uh& Ures,
+                             Uh& Vres,
+                             Th& hE,
+                             Th& hEres,
+                             Ih& hinfo,
+                             Ih& hinfoRes,
+                             double* max_err,
+                             double* max_errv)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int mn = min(m, n);
+    rocblas_int lwork = 5 * max(m, n);
+    std::vector<T> hWork(lwork);
+    std::vector<T> hDummy(1);
+    size_t size_Cm = size_t(m) * n;
+    host_strided_batch_vector<T> hACm(size_Cm, 1, size_Cm, bc);
+    std::vector<T> A(size_Cm);
+    std::vector<T> Ucm(size_t(m) * mn);
+    std::vector<T> Vhcm(size_t(mn) * n);
+    bool leftv = (left_svect != rocblas_svect_none);
+    bool rightv = (right_svect != rocblas_svect_none);
+
+    // input data initialization
+    gesvd_rowmajor_initData<true, true, T>(handle, m, n, dA, lda, bc, hA, hACm);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, m, n,
+                                                 dA.data(), lda, stA, dS.data(), stS, dU.data(),
+                                                 ldu, stU, dV.data(), ldv, stV, dE.data(), stE, fa,
+                                                 dinfo.data(), bc));
+
+    CHECK_HIP_ERROR(hSres.transfer_from(dS));
+    CHECK_HIP_ERROR(hEres.transfer_from(dE));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+
+    if(left_svect == rocblas_svect_singular || left_svect == rocblas_svect_all)
+        CHECK_HIP_ERROR(Ures.transfer_from(dU));
+    if(right_svect == rocblas_svect_singular || right_svect == rocblas_svect_all)
+        CHECK_HIP_ERROR(Vres.transfer_from(dV));
+    if(left_svect == rocblas_svect_overwrite || right_svect == rocblas_svect_overwrite)
+        CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+    // CPU lapack
+    // (only the singular values are compared with LAPACK; the vectors are tested implicitly
+    // against the column-major copy of the original matrix, which is kept unchanged)
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(size_t k = 0; k < size_Cm; k++)
+            A[k] = hACm[b][k];
+        cblas_gesvd<T>(rocblas_svect_none, rocblas_svect_none, m, n, A.data(), m, hS[b],
+                       hDummy.data(), 1, hDummy.data(), 1, hWork.data(), lwork, hE[b], hinfo[b]);
+    }
+
+    // Check info for non-convergence
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+        if(hinfo[b][0] != hinfoRes[b][0])
+            *max_err += 1;
+
+    // (We expect the used input matrices to always converge. Testing
+    // implicitly the equivalent non-converged matrix is very complicated and it boils
+    // down to essentially run the algorithm again and until convergence is achieved).
+
+    double err;
+    *max_errv = 0;
+
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // error is ||hS - hSres||
+        err = norm_error('F', 1, mn, 1, hS[b], hSres[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        if(hinfo[b][0] != 0 || !(leftv || rightv))
+            continue;
+
+        // column-major copies of the first min(m,n) left singular vectors and of the first
+        // min(m,n) rows of V' (the row-major U and V' are read from A when overwritten)
+        for(rocblas_int i = 0; i < m && leftv; i++)
+        {
+            for(rocblas_int k = 0; k < mn; k++)
+                Ucm[i + k * m] = (left_svect == rocblas_svect_overwrite) ? hA[b][i * lda + k]
+                                                                         : Ures[b][i * ldu + k];
+        }
+        for(rocblas_int k = 0; k < mn && rightv; k++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+                Vhcm[k + j * mn] = (right_svect == rocblas_svect_overwrite) ? hA[b][k * lda + j]
+                                                                            : Vres[b][k * ldv + j];
+        }
+
+        T* Ab = hACm[b];
+        double nrmA = double(snorm('F', m, n, Ab, m));
+        std::vector<T> x(max(m, n));
+        err = 0;
+
+        if(leftv && rightv)
+        {
+            // check singular vectors implicitly (A*v_k = s_k*u_k)
+            for(rocblas_int k = 0; k < mn; ++k)
+            {
+                for(rocblas_int i = 0; i < m; ++i)
+                {
+                    T tmp = 0;
+                    for(rocblas_int j = 0; j < n; ++j)
+                        tmp += Ab[i + j * m] * sconj(Vhcm[k + j * mn]);
+                    tmp -= hSres[b][k] * Ucm[i + k * m];
+                    err += std::abs(tmp) * std::abs(tmp);
+                }
+            }
+            err = std::sqrt(err) / nrmA;
+        }
+        else
+        {
+            // only one side was computed; check that each vector is unitary and satisfies
+            // A*A'*u_k = s_k^2*u_k (or A'*A*v_k = s_k^2*v_k)
+            double errn = 0;
+            for(rocblas_int k = 0; k < mn; ++k)
+            {
+                S sk2 = hSres[b][k] * hSres[b][k];
+                S nrm = 0;
+                if(leftv)
+                {
+                    for(rocblas_int j = 0; j < n; ++j)
+                    {
+                        x[j] = 0;
+                        for(rocblas_int i = 0; i < m; ++i)
+                            x[j] += sconj(Ab[i + j * m]) * Ucm[i + k * m];
+                    }
+                    for(rocblas_int i = 0; i < m; ++i)
+                    {
+                        T tmp = 0;
+                        for(rocblas_int j = 0; j < n; ++j)
+                            tmp += Ab[i + j * m] * x[j];
+                        tmp -= sk2 * Ucm[i + k * m];
+                        err += std::abs(tmp) * std::abs(tmp);
+                        nrm += std::abs(Ucm[i + k * m]) * std::abs(Ucm[i + k * m]);
+                    }
+                }
+                else
+                {
+                    for(rocblas_int i = 0; i < m; ++i)
+                    {
+                        x[i] = 0;
+                        for(rocblas_int j = 0; j < n; ++j)
+                            x[i] += Ab[i + j * m] * sconj(Vhcm[k + j * mn]);
+                    }
+                    for(rocblas_int j = 0; j < n; ++j)
+                    {
+                        T tmp = 0;
+                        for(rocblas_int i = 0; i < m; ++i)
+                            tmp += sconj(Ab[i + j * m]) * x[i];
+                        tmp -= sk2 * sconj(Vhcm[k + j * mn]);
+                        err += std::abs(tmp) * std::abs(tmp);
+                        nrm += std::abs(Vhcm[k + j * mn]) * std::abs(Vhcm[k + j * mn]);
+                    }
+                }
+                errn += std::abs(double(nrm) - 1.0);
+            }
+            err = std::sqrt(err) / (nrmA * nrmA);
+            err = err > errn ? err : errn;
+        }
+
+        *max_errv = err > *max_errv ? err : *max_errv;
+    }
+}
+
+template <bool STRIDED, typename T, typename Wd, typename Td, typename Ud, typename Id, typename Wh, typename Th, typename Ih>
+void gesvd_rowmajor_getPerfData(const rocblas_handle handle,
+                                const rocblas_svect left_svect,
+                                const rocblas_svect right_svect,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                Wd& dA,
+                                const rocblas_int lda,
+                                const rocblas_stride stA,
+                                Td& dS,
+                                const rocblas_stride stS,
+                                Ud& dU,
+                                const rocblas_int ldu,
+                                const rocblas_stride stU,
+                                Ud& dV,
+                                const rocblas_int ldv,
+                                const rocblas_stride stV,
+                                Td& dE,
+                                const rocblas_stride stE,
+                                const rocblas_workmode fa,
+                                Id& dinfo,
+                                const rocblas_int bc,
+                                Wh& hA,
+                                Th& hS,
+                                Th& hE,
+                                Ih& hinfo,
+                                double* gpu_time_used,
+                                double* cpu_time_used,
+                                const rocblas_int hot_calls,
+                                const int profile,
+                                const bool profile_kernels,
+                                const bool perf)
+{
+    rocblas_int lwork = 5 * max(m, n);
+    std::vector<T> hWork(lwork);
+    size_t size_Cm = size_t(m) * n;
+    host_strided_batch_vector<T> hACm(size_Cm, 1, size_Cm, bc);
+
+    if(!perf)
+    {
+        gesvd_rowmajor_initData<true, false, T>(handle, m, n, dA, lda, bc, hA, hACm);
+
+        // the CPU reference works on the column-major copy of A
+        std::vector<T> hU(size_t(m) * m);
+        std::vector<T> hV(size_t(n) * n);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_gesvd<T>(left_svect, right_svect, m, n, hACm[b], m, hS[b], hU.data(), m,
+                           hV.data(), n, hWork.data(), lwork, hE[b], hinfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gesvd_rowmajor_initData<true, false, T>(handle, m, n, dA, lda, bc, hA, hACm);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesvd_rowmajor_initData<false, true, T>(handle, m, n, dA, lda, bc, hA, hACm);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gesvd_rowmajor(
+            STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, stA, dS.data(), stS,
+            dU.data(), ldu, stU, dV.data(), ldv, stV, dE.data(), stE, fa, dinfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gesvd_rowmajor_initData<false, true, T>(handle, m, n, dA, lda, bc, hA, hACm);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gesvd_rowmajor(STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda,
+                                 stA, dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv, stV,
+                                 dE.data(), stE, fa, dinfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gesvd_rowmajor(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char leftvC = argus.get<char>("left_svect");
+    char rightvC = argus.get<char>("right_svect");
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldu = argus.get<rocblas_int>("ldu", (leftvC == 'A' ? m : min(m, n)));
+    rocblas_int ldv = argus.get<rocblas_int>("ldv", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * m);
+    rocblas_stride stS = argus.get<rocblas_stride>("strideS", min(m, n));
+    rocblas_stride stU = argus.get<rocblas_stride>("strideU", ldu * m);
+    rocblas_stride stV = argus.get<rocblas_stride>("strideV", ldv * n);
+    rocblas_stride stE = argus.get<rocblas_stride>("strideE", min(m, n) - 1);
+    char faC = argus.get<char>("fast_alg");
+
+    rocblas_svect leftv = char2rocblas_svect(leftvC);
+    rocblas_svect rightv = char2rocblas_svect(rightvC);
+    rocblas_workmode fa = char2rocblas_workmode(faC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(rightv == rocblas_svect_overwrite && leftv == rocblas_svect_overwrite)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(
+                                      STRIDED, handle, leftv, rightv, m, n, (T* const*)nullptr, lda,
+                                      stA, (S*)nullptr, stS, (T*)nullptr, ldu, stU, (T*)nullptr,
+                                      ldv, stV, (S*)nullptr, stE, fa, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(
+                                      STRIDED, handle, leftv, rightv, m, n, (T*)nullptr, lda, stA,
+                                      (S*)nullptr, stS, (T*)nullptr, ldu, stU, (T*)nullptr, ldv,
+                                      stV, (S*)nullptr, stE, fa, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    /** TESTING OF SINGULAR VECTORS IS DONE IMPLICITLY, NOT EXPLICITLY COMPARING
+        WITH LAPACK. WHEN ONLY ONE SIDE IS COMPUTED, THE VECTORS ARE TESTED AS
+        EIGENVECTORS OF A*A' OR A'*A **/
+
+    bool svects = (leftv != rocblas_svect_none || rightv != rocblas_svect_none);
+
+    // determine sizes
+    size_t size_Sres = 0;
+    size_t size_Eres = 0;
+    size_t size_Ures = 0;
+    size_t size_Vres = 0;
+    size_t size_A = size_t(lda) * m;
+    size_t size_S = size_t(min(m, n));
+    size_t size_E = size_t(min(m, n) - 1);
+    size_t size_V = size_t(ldv) * n;
+    size_t size_U = size_t(ldu) * m;
+    if(argus.unit_check || argus.norm_check)
+    {
+        size_Sres = size_S;
+        size_Eres = size_E;
+        if(leftv == rocblas_svect_singular || leftv == rocblas_svect_all)
+            size_Ures = size_U;
+        if(rightv == rocblas_svect_singular || rightv == rocblas_svect_all)
+            size_Vres = size_V;
+    }
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, max_errorv = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || m < 0 || lda < n || ldu < 1 || ldv < 1 || bc < 0)
+        || ((leftv == rocblas_svect_all && ldu < m)
+            || (leftv == rocblas_svect_singular && ldu < min(m, n)))
+        || ((rightv == rocblas_svect_all || rightv == rocblas_svect_singular) && ldv < n);
+
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(
+                                      STRIDED, handle, leftv, rightv, m, n, (T* const*)nullptr, lda,
+                                      stA, (S*)nullptr, stS, (T*)nullptr, ldu, stU, (T*)nullptr,
+                                      ldv, stV, (S*)nullptr, stE, fa, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(
+                                      STRIDED, handle, leftv, rightv, m, n, (T*)nullptr, lda, stA,
+                                      (S*)nullptr, stS, (T*)nullptr, ldu, stU, (T*)nullptr, ldv,
+                                      stV, (S*)nullptr, stE, fa, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gesvd_rowmajor(
+                STRIDED, handle, leftv, rightv, m, n, (T* const*)nullptr, lda, stA, (S*)nullptr,
+                stS, (T*)nullptr, ldu, stU, (T*)nullptr, ldv, stV, (S*)nullptr, stE, fa,
+                (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gesvd_rowmajor(
+                STRIDED, handle, leftv, rightv, m, n, (T*)nullptr, lda, stA, (S*)nullptr, stS,
+                (T*)nullptr, ldu, stU, (T*)nullptr, ldv, stV, (S*)nullptr, stE, fa,
+                (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<S> hE(5 * max(m, n), 1, 5 * max(m, n), bc);
+    host_strided_batch_vector<S> hS(size_S, 1, stS, bc);
+    host_strided_batch_vector<rocblas_int> hinfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1, 1, 1, bc);
+    host_strided_batch_vector<S> hSres(size_Sres, 1, stS, bc);
+    host_strided_batch_vector<S> hEres(size_Eres, 1, stE, bc);
+    host_strided_batch_vector<T> Vres(size_Vres, 1, stV, bc);
+    host_strided_batch_vector<T> Ures(size_Ures, 1, stU, bc);
+    // device
+    device_strided_batch_vector<S> dE(size_E, 1, stE, bc);
+    device_strided_batch_vector<S> dS(size_S, 1, stS, bc);
+    device_strided_batch_vector<T> dV(size_V, 1, stV, bc);
+    device_strided_batch_vector<T> dU(size_U, 1, stU, bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, bc);
+    if(size_E)
+        CHECK_HIP_ERROR(dE.memcheck());
+    if(size_S)
+        CHECK_HIP_ERROR(dS.memcheck());
+    if(size_V)
+        CHECK_HIP_ERROR(dV.memcheck());
+    if(size_U)
+        CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || m == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, leftv, rightv, m, n,
+                                                           dA.data(), lda, stA, dS.data(), stS,
+                                                           dU.data(), ldu, stU, dV.data(), ldv, stV,
+                                                           dE.data(), stE, fa, dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+        {
+            gesvd_rowmajor_getError<STRIDED, T>(handle, leftv, rightv, m, n, dA, lda, stA, dS, stS,
+                                                dU, ldu, stU, dV, ldv, stV, dE, stE, fa, dinfo, bc,
+                                                hA, hS, hSres, Ures, Vres, hE, hEres, hinfo,
+                                                hinfoRes, &max_error, &max_errorv);
+        }
+
+        // collect performance data
+        if(argus.timing)
+        {
+            gesvd_rowmajor_getPerfData<STRIDED, T>(
+                handle, leftv, rightv, m, n, dA, lda, stA, dS, stS, dU, ldu, stU, dV, ldv, stV, dE,
+                stE, fa, dinfo, bc, hA, hS, hE, hinfo, &gpu_time_used, &cpu_time_used, hot_calls,
+                argus.profile, argus.profile_kernels, argus.perf);
+        }
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || m == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_rowmajor(STRIDED, handle, leftv, rightv, m, n,
+                                                           dA.data(), lda, stA, dS.data(), stS,
+                                                           dU.data(), ldu, stU, dV.data(), ldv, stV,
+                                                           dE.data(), stE, fa, dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+        {
+            gesvd_rowmajor_getError<STRIDED, T>(handle, leftv, rightv, m, n, dA, lda, stA, dS, stS,
+                                                dU, ldu, stU, dV, ldv, stV, dE, stE, fa, dinfo, bc,
+                                                hA, hS, hSres, Ures, Vres, hE, hEres, hinfo,
+                                                hinfoRes, &max_error, &max_errorv);
+        }
+
+        // collect performance data
+        if(argus.timing)
+        {
+            gesvd_rowmajor_getPerfData<STRIDED, T>(
+                handle, leftv, rightv, m, n, dA, lda, stA, dS, stS, dU, ldu, stU, dV, ldv, stV, dE,
+                stE, fa, dinfo, bc, hA, hS, hE, hinfo, &gpu_time_used, &cpu_time_used, hot_calls,
+                argus.profile, argus.profile_kernels, argus.perf);
+        }
+    }
+
+    // validate results for rocsolver-test
+    // using 2 * min(m, n) * machine_precision as tolerance
+    if(argus.unit_check)
+    {
+        ROCSOLVER_TEST_CHECK(T, max_error, 2 * min(m, n));
+        if(svects)
+            ROCSOLVER_TEST_CHECK(T, max_errorv, 2 * min(m, n));
+    }
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(svects)
+            max_error = (max_error >= max_errorv) ? max_error : max_errorv;
+
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("left_svect", "right_svect", "m", "n", "lda", "strideS",
+                                       "ldu", "strideU", "ldv", "strideV", "strideE", "batch_c");
+                rocsolver_bench_output(leftvC, rightvC, m, n, lda, stS, ldu, stU, ldv, stV, stE, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("left_svect", "right_svect", "m", "n", "lda", "strideA",
+                                       "strideS", "ldu", "strideU", "ldv", "strideV", "strideE",
+                                       "batch_c");
+                rocsolver_bench_output(leftvC, rightvC, m, n, lda, stA, stS, ldu, stU, ldv, stV,
+                                       stE, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("left_svect", "right_svect", "m", "n", "lda", "ldu", "ldv");
+                rocsolver_bench_output(leftvC, rightvC, m, n, lda, ldu, ldv);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -0,0 +1,598 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S, typename U>
+void gesvd_truncate_checkBadArgs(const rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 T dA,
+                                 const rocblas_int lda,
+                                 const rocblas_stride stA,
+                                 const rocblas_int k,
+                                 const S rtol,
+                                 T dC,
+                                 const rocblas_int ldc,
+                                 const rocblas_stride stC,
+                                 U drank,
+                                 U dinfo,
+                                 const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, nullptr, m, n, dA, lda, stA, k, rtol,
+                                                   dC, ldc, stC, drank, dinfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n, dA, lda, stA, k, S(-1),
+                                                   dC, ldc, stC, drank, dinfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n, dA, lda, stA, k, rtol,
+                                                       dC, ldc, stC, drank, dinfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n, (T) nullptr, lda, stA, k,
+                                                   rtol, dC, ldc, stC, drank, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n, dA, lda, stA, k, rtol,
+                                                   (T) nullptr, ldc, stC, drank, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n, dA, lda, stA, k, rtol,
+                                                   dC, ldc, stC, (U) nullptr, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n, dA, lda, stA, k, rtol,
+                                                   dC, ldc, stC, drank, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, 0, n, (T) nullptr, lda, stA, k,
+                                                   rtol, (T) nullptr, ldc, stC, drank, dinfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, 0, (T) nullptr, lda, stA, k,
+                                                   rtol, (T) nullptr, ldc, stC, drank, dinfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n, dA, lda, stA, k, rtol,
+                                                       dC, ldc, stC, (U) nullptr, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gesvd_truncate_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldc = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stC = 1;
+    rocblas_int k = 1;
+    S rtol = 0;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<rocblas_int> drank(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(drank.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dC(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+
+        // check bad arguments
+        gesvd_truncate_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, k, rtol, dC.data(),
+                                             ldc, stC, drank.data(), dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dC(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+
+        // check bad arguments
+        gesvd_truncate_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, k, rtol, dC.data(),
+                                             ldc, stC, drank.data(), dinfo.data(), bc);
+    }
+}
+
+/** The test matrices are well conditioned. Unless no singular value is expected to be discarded,
+    the rows from index gap on are scaled down, so that there is a large gap between the gap-th and
+    the (gap+1)-th singular values and the truncation is numerically well defined. **/
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gesvd_truncate_initData(const rocblas_handle handle,
+                             const rocblas_int m,
+                             const rocblas_int n,
+                             Td& dA,
+                             const rocblas_int lda,
+                             const rocblas_int gap,
+                             const rocblas_int bc,
+                             Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+
+                    if(i >= gap)
+                        hA[b][i + j * lda] *= T(1e-3);
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+/** Host reference: computes the truncated reconstruction from the SVD given by LAPACK **/
+template <typename T, typename S>
+void gesvd_truncate_reference(const rocblas_int m,
+                              const rocblas_int n,
+                              T* A,
+                              const rocblas_int lda,
+                              const rocblas_int k,
+                              const S rtol,
+                              T* C,
+                              const rocblas_int ldc,
+                              rocblas_int* rank,
+                              rocblas_int* info)
+{
+    rocblas_int mn = std::min(m, n);
+    rocblas_int lwork = 5 * std::max(m, n);
+
+    std::vector<T> work(lwork);
+    std::vector<S> hS(mn);
+    std::vector<S> hE(mn);
+    std::vector<T> hU(size_t(m) * mn);
+    std::vector<T> hV(size_t(mn) * n);
+
+    cblas_gesvd<T>(rocblas_svect_singular, rocblas_svect_singular, m, n, A, lda, hS.data(),
+                   hU.data(), m, hV.data(), mn, work.data(), lwork, hE.data(), info);
+
+    // retained singular values
+    rocblas_int r = 0;
+    while(r < std::min(k, mn) && hS[r] > rtol * hS[0])
+        r++;
+    *rank = r;
+
+    // C = U(:,1:r) * S(1:r) * V'(1:r,:)
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            T temp = 0;
+            for(rocblas_int l = 0; l < r; l++)
+                temp += hU[i + l * m] * T(hS[l]) * hV[l + j * mn];
+            C[i + j * ldc] = temp;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+void gesvd_truncate_getError(const rocblas_handle handle,
+                             const rocblas_int m,
+                             const rocblas_int n,
+                             Td& dA,
+                             const rocblas_int lda,
+                             const rocblas_stride stA,
+                             const rocblas_int k,
+                             const S rtol,
+                             Td& dC,
+                             const rocblas_int ldc,
+                             const rocblas_stride stC,
+                             Ud& drank,
+                             Ud& dinfo,
+                             const rocblas_int bc,
+                             const rocblas_int gap,
+                             Th& hA,
+                             Th& hC,
+                             Th& hCres,
+                             Uh& hrank,
+                             Uh& hrankRes,
+                             Uh& hinfo,
+                             Uh& hinfoRes,
+                             double* max_err)
+{
+    // input data initialization
+    gesvd_truncate_initData<true, true, T>(handle, m, n, dA, lda, gap, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gesvd_truncate(STRIDED, handle, m, n, dA.data(), lda, stA, k,
+                                                 rtol, dC.data(), ldc, stC, drank.data(),
+                                                 dinfo.data(), bc));
+    CHECK_HIP_ERROR(hCres.transfer_from(dC));
+    CHECK_HIP_ERROR(hrankRes.transfer_from(drank));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        gesvd_truncate_reference<T>(m, n, hA[b], lda, k, rtol, hC[b], ldc, hrank[b], hinfo[b]);
+
+    // check info and rank
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hinfo[b][0] != hinfoRes[b][0])
+            *max_err += 1;
+        if(hrank[b][0] != hrankRes[b][0])
+            *max_err += 1;
+    }
+
+    // error is ||hC - hCres|| / ||hC||
+    // using frobenius norm
+    double err;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hinfo[b][0] == 0)
+        {
+            err = norm_error('F', m, n, ldc, hC[b], hCres[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+void gesvd_truncate_getPerfData(const rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                Td& dA,
+                                const rocblas_int lda,
+                                const rocblas_stride stA,
+                                const rocblas_int k,
+                                const S rtol,
+                                Td& dC,
+                                const rocblas_int ldc,
+                                const rocblas_stride stC,
+                                Ud& drank,
+                                Ud& dinfo,
+                                const rocblas_int bc,
+                                const rocblas_int gap,
+                                Th& hA,
+                                Th& hC,
+                                Uh& hrank,
+                                Uh& hinfo,
+                                double* gpu_time_used,
+                                double* cpu_time_used,
+                                const rocblas_int hot_calls,
+                                const int profile,
+                                const bool profile_kernels,
+                                const bool perf)
+{
+    if(!perf)
+    {
+        gesvd_truncate_initData<true, false, T>(handle, m, n, dA, lda, gap, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            gesvd_truncate_reference<T>(m, n, hA[b], lda, k, rtol, hC[b], ldc, hrank[b], hinfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gesvd_truncate_initData<true, false, T>(handle, m, n, dA, lda, gap, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesvd_truncate_initData<false, true, T>(handle, m, n, dA, lda, gap, bc, hA);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gesvd_truncate(STRIDED, handle, m, n, dA.data(), lda, stA, k,
+                                                     rtol, dC.data(), ldc, stC, drank.data(),
+                                                     dinfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gesvd_truncate_initData<false, true, T>(handle, m, n, dA, lda, gap, bc, hA);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gesvd_truncate(STRIDED, handle, m, n, dA.data(), lda, stA, k, rtol, dC.data(),
+                                 ldc, stC, drank.data(), dinfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gesvd_truncate(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldc = argus.get<rocblas_int>("ldc", m);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stC = argus.get<rocblas_stride>("strideC", ldc * n);
+    rocblas_int k = argus.get<rocblas_int>("k", std::min(m, n));
+    S rtol = S(argus.get<double>("rtol", 0));
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(rtol < 0)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n,
+                                                           (T* const*)nullptr, lda, stA, k, rtol,
+                                                           (T* const*)nullptr, ldc, stC,
+                                                           (rocblas_int*)nullptr,
+                                                           (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n, (T*)nullptr, lda,
+                                                           stA, k, rtol, (T*)nullptr, ldc, stC,
+                                                           (rocblas_int*)nullptr,
+                                                           (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_C = size_t(ldc) * n;
+    size_t size_Cres = (argus.unit_check || argus.norm_check) ? size_C : 0;
+
+    // position of the gap in the singular values of the test matrices
+    rocblas_int mn = std::max(std::min(m, n), 0);
+    rocblas_int gap = (k < mn) ? k : (rtol > 0 ? mn / 2 : mn);
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || k < 0 || lda < m || ldc < m || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n,
+                                                           (T* const*)nullptr, lda, stA, k, rtol,
+                                                           (T* const*)nullptr, ldc, stC,
+                                                           (rocblas_int*)nullptr,
+                                                           (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n, (T*)nullptr, lda,
+                                                           stA, k, rtol, (T*)nullptr, ldc, stC,
+                                                           (rocblas_int*)nullptr,
+                                                           (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gesvd_truncate(STRIDED, handle, m, n, (T* const*)nullptr,
+                                                       lda, stA, k, rtol, (T* const*)nullptr, ldc,
+                                                       stC, (rocblas_int*)nullptr,
+                                                       (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gesvd_truncate(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                                       k, rtol, (T*)nullptr, ldc, stC,
+                                                       (rocblas_int*)nullptr,
+                                                       (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<rocblas_int> hrank(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hrankRes(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hinfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<rocblas_int> drank(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(drank.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hC(size_C, 1, bc);
+        host_batch_vector<T> hCres(size_Cres, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dC(size_C, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n, dA.data(), lda,
+                                                           stA, k, rtol, dC.data(), ldc, stC,
+                                                           drank.data(), dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gesvd_truncate_getError<STRIDED, T>(handle, m, n, dA, lda, stA, k, rtol, dC, ldc, stC,
+                                                drank, dinfo, bc, gap, hA, hC, hCres, hrank,
+                                                hrankRes, hinfo, hinfoRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gesvd_truncate_getPerfData<STRIDED, T>(
+                handle, m, n, dA, lda, stA, k, rtol, dC, ldc, stC, drank, dinfo, bc, gap, hA, hC,
+                hrank, hinfo, &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                argus.profile_kernels, argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hC(size_C, 1, stC, bc);
+        host_strided_batch_vector<T> hCres(size_Cres, 1, stC, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dC(size_C, 1, stC, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesvd_truncate(STRIDED, handle, m, n, dA.data(), lda,
+                                                           stA, k, rtol, dC.data(), ldc, stC,
+                                                           drank.data(), dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gesvd_truncate_getError<STRIDED, T>(handle, m, n, dA, lda, stA, k, rtol, dC, ldc, stC,
+                                                drank, dinfo, bc, gap, hA, hC, hCres, hrank,
+                                                hrankRes, hinfo, hinfoRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gesvd_truncate_getPerfData<STRIDED, T>(
+                handle, m, n, dA, lda, stA, k, rtol, dC, ldc, stC, drank, dinfo, bc, gap, hA, hC,
+                hrank, hinfo, &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using min(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::min(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "k", "rtol", "ldc", "batch_c");
+                rocsolver_bench_output(m, n, lda, k, rtol, ldc, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideA", "k", "rtol", "ldc", "strideC",
+                                       "batch_c");
+                rocsolver_bench_output(m, n, lda, stA, k, rtol, ldc, stC, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "lda", "k", "rtol", "ldc");
+                rocsolver_bench_output(m, n, lda, k, rtol, ldc);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
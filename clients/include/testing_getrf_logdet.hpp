@@ -0,0 +1,595 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, bool FUSED, typename T, typename S, typename U>
+void getrf_logdet_checkBadArgs(const rocblas_handle handle,
+                               const rocblas_int n,
+                               T dA,
+                               const rocblas_int lda,
+                               const rocblas_stride stA,
+                               rocblas_int* dIpiv,
+                               const rocblas_stride stP,
+                               U dSign,
+                               S dLogdet,
+                               rocblas_int* dInfo,
+                               const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, nullptr, n, dA, lda, stA, dIpiv,
+                                                 stP, dSign, dLogdet, dInfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, dA, lda, stA, dIpiv,
+                                                     stP, dSign, dLogdet, dInfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, (T) nullptr, lda, stA,
+                                                 dIpiv, stP, dSign, dLogdet, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, dA, lda, stA,
+                                                 (rocblas_int*)nullptr, stP, dSign, dLogdet, dInfo,
+                                                 bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, dA, lda, stA, dIpiv,
+                                                 stP, (U) nullptr, dLogdet, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, dA, lda, stA, dIpiv,
+                                                 stP, dSign, (S) nullptr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    if(FUSED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, dA, lda, stA, dIpiv,
+                                                     stP, dSign, dLogdet, (rocblas_int*)nullptr,
+                                                     bc),
+                              rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, 0, (T) nullptr, lda, stA,
+                                                 (rocblas_int*)nullptr, stP, dSign, dLogdet, dInfo,
+                                                 bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, dA, lda, stA, dIpiv,
+                                                     stP, (U) nullptr, (S) nullptr,
+                                                     (rocblas_int*)nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, bool FUSED, typename T>
+void testing_getrf_logdet_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<T> dSign(1, 1, 1, 1);
+    device_strided_batch_vector<S> dLogdet(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dSign.memcheck());
+    CHECK_HIP_ERROR(dLogdet.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        device_batch_vector<T> dA(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        getrf_logdet_checkBadArgs<STRIDED, FUSED>(handle, n, dA.data(), lda, stA, dIpiv.data(), stP,
+                                                  dSign.data(), dLogdet.data(), dInfo.data(), bc);
+    }
+    else
+    {
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        getrf_logdet_checkBadArgs<STRIDED, FUSED>(handle, n, dA.data(), lda, stA, dIpiv.data(), stP,
+                                                  dSign.data(), dLogdet.data(), dInfo.data(), bc);
+    }
+}
+
+template <bool CPU,
+          bool GPU,
+          bool STRIDED,
+          bool FUSED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Th>
+void getrf_logdet_initData(const rocblas_handle handle,
+                           const rocblas_int n,
+                           Td& dA,
+                           const rocblas_int lda,
+                           const rocblas_stride stA,
+                           Ud& dIpiv,
+                           const rocblas_stride stP,
+                           Ud& dInfo,
+                           const rocblas_int bc,
+                           Th& hA,
+                           const bool singular)
+{
+    if(CPU)
+    {
+        T tmp;
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // shuffle rows to test the parity of the pivoting
+            // always the same permuation for debugging purposes
+            for(rocblas_int i = 0; i < n / 2; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    tmp = hA[b][i + j * lda];
+                    hA[b][i + j * lda] = hA[b][n - 1 - i + j * lda];
+                    hA[b][n - 1 - i + j * lda] = tmp;
+                }
+            }
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // When required, add some singularities
+                // (always the same elements for debugging purposes).
+                rocblas_int j = n / 2 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < n; i++)
+                    hA[b][i + j * lda] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        // the standalone routine works with existing factors
+        if(!FUSED)
+            CHECK_ROCBLAS_ERROR(rocsolver_getf2_getrf(STRIDED, true, handle, n, n, dA.data(), lda,
+                                                      stA, dIpiv.data(), stP, dInfo.data(), bc));
+    }
+}
+
+template <typename T, typename S>
+void getrf_logdet_reference(const rocblas_int n,
+                            T* A,
+                            const rocblas_int lda,
+                            rocblas_int* ipiv,
+                            const rocblas_int info,
+                            T* sign,
+                            S* logdet)
+{
+    if(info > 0)
+    {
+        *sign = 0;
+        *logdet = -std::numeric_limits<S>::infinity();
+        return;
+    }
+
+    T phase = 1;
+    S sum = 0;
+    for(rocblas_int i = 0; i < n; i++)
+    {
+        T u = A[i + i * lda];
+        S a = std::abs(u);
+        sum += std::log(a);
+        phase *= u / T(a);
+        if(ipiv[i] != i + 1)
+            phase = -phase;
+    }
+    *sign = phase;
+    *logdet = sum;
+}
+
+template <bool STRIDED,
+          bool FUSED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Wd,
+          typename Th,
+          typename Uh,
+          typename Vh,
+          typename Wh>
+void getrf_logdet_getError(const rocblas_handle handle,
+                           const rocblas_int n,
+                           Td& dA,
+                           const rocblas_int lda,
+                           const rocblas_stride stA,
+                           Ud& dIpiv,
+                           const rocblas_stride stP,
+                           Vd& dSign,
+                           Wd& dLogdet,
+                           Ud& dInfo,
+                           const rocblas_int bc,
+                           Th& hA,
+                           Uh& hIpiv,
+                           Vh& hSignRes,
+                           Wh& hLogdetRes,
+                           Uh& hInfo,
+                           double* max_err,
+                           const bool singular)
+{
+    using S = decltype(std::real(T{}));
+    T sign;
+    S logdet;
+
+    // input data initialization
+    getrf_logdet_initData<true, true, STRIDED, FUSED, T>(handle, n, dA, lda, stA, dIpiv, stP, dInfo,
+                                                         bc, hA, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, dA.data(), lda, stA,
+                                               dIpiv.data(), stP, dSign.data(), dLogdet.data(),
+                                               dInfo.data(), bc));
+    CHECK_HIP_ERROR(hSignRes.transfer_from(dSign));
+    CHECK_HIP_ERROR(hLogdetRes.transfer_from(dLogdet));
+
+    // CPU lapack
+    // (there is no equivalent routine in LAPACK; the determinant is computed
+    // from the LU factorization on the host)
+    for(rocblas_int b = 0; b < bc; ++b)
+        cblas_getrf<T>(n, n, hA[b], lda, hIpiv[b], hInfo[b]);
+
+    // error is |logdet - logdet_res| / max(1, |logdet|) + |sign - sign_res|
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        getrf_logdet_reference<T>(n, hA[b], lda, hIpiv[b], hInfo[b][0], &sign, &logdet);
+
+        if(hInfo[b][0] > 0)
+        {
+            // singular matrices must have a zero determinant
+            err = (hSignRes[b][0] != T(0)) + (hLogdetRes[b][0] != logdet);
+        }
+        else
+        {
+            err = std::abs(logdet - hLogdetRes[b][0]) / std::max(S(1), std::abs(logdet));
+            err += std::abs(sign - hSignRes[b][0]);
+        }
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED,
+          bool FUSED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Wd,
+          typename Th,
+          typename Uh>
+void getrf_logdet_getPerfData(const rocblas_handle handle,
+                              const rocblas_int n,
+                              Td& dA,
+                              const rocblas_int lda,
+                              const rocblas_stride stA,
+                              Ud& dIpiv,
+                              const rocblas_stride stP,
+                              Vd& dSign,
+                              Wd& dLogdet,
+                              Ud& dInfo,
+                              const rocblas_int bc,
+                              Th& hA,
+                              Uh& hIpiv,
+                              Uh& hInfo,
+                              double* gpu_time_used,
+                              double* cpu_time_used,
+                              const rocblas_int hot_calls,
+                              const int profile,
+                              const bool profile_kernels,
+                              const bool perf,
+                              const bool singular)
+{
+    using S = decltype(std::real(T{}));
+    T sign;
+    S logdet;
+
+    if(!perf)
+    {
+        getrf_logdet_initData<true, false, STRIDED, FUSED, T>(handle, n, dA, lda, stA, dIpiv, stP,
+                                                              dInfo, bc, hA, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cblas_getrf<T>(n, n, hA[b], lda, hIpiv[b], hInfo[b]);
+            getrf_logdet_reference<T>(n, hA[b], lda, hIpiv[b], hInfo[b][0], &sign, &logdet);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getrf_logdet_initData<true, false, STRIDED, FUSED, T>(handle, n, dA, lda, stA, dIpiv, stP,
+                                                          dInfo, bc, hA, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrf_logdet_initData<false, true, STRIDED, FUSED, T>(handle, n, dA, lda, stA, dIpiv, stP,
+                                                              dInfo, bc, hA, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, dA.data(), lda, stA,
+                                                   dIpiv.data(), stP, dSign.data(), dLogdet.data(),
+                                                   dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        getrf_logdet_initData<false, true, STRIDED, FUSED, T>(handle, n, dA, lda, stA, dIpiv, stP,
+                                                              dInfo, bc, hA, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, dA.data(), lda, stA, dIpiv.data(), stP,
+                               dSign.data(), dLogdet.data(), dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, bool FUSED, typename T>
+void testing_getrf_logdet(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", n);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n,
+                                                         (T* const*)nullptr, lda, stA,
+                                                         (rocblas_int*)nullptr, stP, (T*)nullptr,
+                                                         (S*)nullptr, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, (T*)nullptr,
+                                                         lda, stA, (rocblas_int*)nullptr, stP,
+                                                         (T*)nullptr, (S*)nullptr,
+                                                         (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, (T* const*)nullptr,
+                                                     lda, stA, (rocblas_int*)nullptr, stP,
+                                                     (T*)nullptr, (S*)nullptr,
+                                                     (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, (T*)nullptr, lda,
+                                                     stA, (rocblas_int*)nullptr, stP, (T*)nullptr,
+                                                     (S*)nullptr, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (ipiv, sign, logdet and info are always strided)
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<T> hSignRes(1, 1, 1, bc);
+    host_strided_batch_vector<S> hLogdetRes(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<T> dSign(1, 1, 1, bc);
+    device_strided_batch_vector<S> dLogdet(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dSign.memcheck());
+    CHECK_HIP_ERROR(dLogdet.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, dA.data(), lda,
+                                                         stA, dIpiv.data(), stP, dSign.data(),
+                                                         dLogdet.data(), dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getrf_logdet_getError<STRIDED, FUSED, T>(handle, n, dA, lda, stA, dIpiv, stP, dSign,
+                                                     dLogdet, dInfo, bc, hA, hIpiv, hSignRes,
+                                                     hLogdetRes, hInfo, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            getrf_logdet_getPerfData<STRIDED, FUSED, T>(
+                handle, n, dA, lda, stA, dIpiv, stP, dSign, dLogdet, dInfo, bc, hA, hIpiv, hInfo,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels,
+                argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_getrf_logdet(STRIDED, FUSED, handle, n, dA.data(), lda,
+                                                         stA, dIpiv.data(), stP, dSign.data(),
+                                                         dLogdet.data(), dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getrf_logdet_getError<STRIDED, FUSED, T>(handle, n, dA, lda, stA, dIpiv, stP, dSign,
+                                                     dLogdet, dInfo, bc, hA, hIpiv, hSignRes,
+                                                     hLogdetRes, hInfo, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            getrf_logdet_getPerfData<STRIDED, FUSED, T>(
+                handle, n, dA, lda, stA, dIpiv, stP, dSign, dLogdet, dInfo, bc, hA, hIpiv, hInfo,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels,
+                argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("n", "lda", "strideP", "batch_c");
+                rocsolver_bench_output(n, lda, stP, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("n", "lda", "strideA", "strideP", "batch_c");
+                rocsolver_bench_output(n, lda, stA, stP, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "lda");
+                rocsolver_bench_output(n, lda);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
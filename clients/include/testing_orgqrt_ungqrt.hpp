@@ -0,0 +1,379 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <typename T>
+void orgqrt_ungqrt_checkBadArgs(const rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int k,
+                                const rocblas_int nb,
+                                T dA,
+                                const rocblas_int lda,
+                                T dIpiv,
+                                T dT,
+                                const rocblas_int ldt)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgqrt_ungqrt(nullptr, m, n, k, nb, dA, lda, dIpiv, dT, ldt),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_orgqrt_ungqrt(handle, m, n, k, nb, (T) nullptr, lda, dIpiv, dT, ldt),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_orgqrt_ungqrt(handle, m, n, k, nb, dA, lda, (T) nullptr, dT, ldt),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_orgqrt_ungqrt(handle, m, n, k, nb, dA, lda, dIpiv, (T) nullptr, ldt),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgqrt_ungqrt(handle, 0, 0, 0, nb, (T) nullptr, lda,
+                                                  (T) nullptr, (T) nullptr, ldt),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgqrt_ungqrt(handle, m, 0, 0, nb, (T) nullptr, lda,
+                                                  (T) nullptr, (T) nullptr, ldt),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_orgqrt_ungqrt_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int k = 1;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int nb = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldt = 1;
+
+    // memory allocation
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<T> dT(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dT.memcheck());
+
+    // check bad arguments
+    orgqrt_ungqrt_checkBadArgs(handle, m, n, k, nb, dA.data(), lda, dIpiv.data(), dT.data(), ldt);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void orgqrt_ungqrt_initData(const rocblas_handle handle,
+                            const rocblas_int m,
+                            const rocblas_int n,
+                            const rocblas_int k,
+                            const rocblas_int nb,
+                            Td& dA,
+                            const rocblas_int lda,
+                            Td& dIpiv,
+                            Td& dT,
+                            const rocblas_int ldt,
+                            Th& hA,
+                            Th& hIpiv,
+                            Th& hT,
+                            std::vector<T>& hW,
+                            size_t size_W)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hIpiv, true);
+        rocblas_init<T>(hT, true);
+
+        // scale to avoid singularities
+        for(int i = 0; i < m; ++i)
+        {
+            for(int j = 0; j < k; ++j)
+            {
+                if(i == j)
+                    hA[0][i + j * lda] += 400;
+                else
+                    hA[0][i + j * lda] -= 4;
+            }
+        }
+
+        // compute QR factorization and the triangular factors of the block reflectors
+        // (as GEQRT would do)
+        cblas_geqrf<T>(m, n, hA[0], lda, hIpiv[0], hW.data(), size_W);
+        for(rocblas_int j = 0; j < k; j += nb)
+            cblas_larft<T>(rocblas_forward_direction, rocblas_column_wise, m - j, min(nb, k - j),
+                           hA[0] + j + j * lda, lda, hIpiv[0] + j, hT[0] + j * ldt, ldt);
+    }
+
+    if(GPU)
+    {
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+        CHECK_HIP_ERROR(dT.transfer_from(hT));
+    }
+}
+
+template <typename T, typename Td, typename Th>
+void orgqrt_ungqrt_getError(const rocblas_handle handle,
+                            const rocblas_int m,
+                            const rocblas_int n,
+                            const rocblas_int k,
+                            const rocblas_int nb,
+                            Td& dA,
+                            const rocblas_int lda,
+                            Td& dIpiv,
+                            Td& dT,
+                            const rocblas_int ldt,
+                            Th& hA,
+                            Th& hAr,
+                            Th& hIpiv,
+                            Th& hT,
+                            double* max_err)
+{
+    size_t size_W = size_t(n);
+    std::vector<T> hW(size_W);
+
+    // initialize data
+    orgqrt_ungqrt_initData<true, true, T>(handle, m, n, k, nb, dA, lda, dIpiv, dT, ldt, hA, hIpiv,
+                                          hT, hW, size_W);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_orgqrt_ungqrt(handle, m, n, k, nb, dA.data(), lda, dIpiv.data(),
+                                                dT.data(), ldt));
+    CHECK_HIP_ERROR(hAr.transfer_from(dA));
+
+    // CPU lapack
+    cblas_orgqr_ungqr<T>(m, n, k, hA[0], lda, hIpiv[0], hW.data(), size_W);
+
+    // error is ||hA - hAr|| / ||hA||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    *max_err = norm_error('F', m, n, lda, hA[0], hAr[0]);
+}
+
+template <typename T, typename Td, typename Th>
+void orgqrt_ungqrt_getPerfData(const rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               const rocblas_int k,
+                               const rocblas_int nb,
+                               Td& dA,
+                               const rocblas_int lda,
+                               Td& dIpiv,
+                               Td& dT,
+                               const rocblas_int ldt,
+                               Th& hA,
+                               Th& hIpiv,
+                               Th& hT,
+                               double* gpu_time_used,
+                               double* cpu_time_used,
+                               const rocblas_int hot_calls,
+                               const int profile,
+                               const bool profile_kernels,
+                               const bool perf)
+{
+    size_t size_W = size_t(n);
+    std::vector<T> hW(size_W);
+
+    if(!perf)
+    {
+        orgqrt_ungqrt_initData<true, false, T>(handle, m, n, k, nb, dA, lda, dIpiv, dT, ldt, hA,
+                                               hIpiv, hT, hW, size_W);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_orgqr_ungqr<T>(m, n, k, hA[0], lda, hIpiv[0], hW.data(), size_W);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    orgqrt_ungqrt_initData<true, false, T>(handle, m, n, k, nb, dA, lda, dIpiv, dT, ldt, hA, hIpiv,
+                                           hT, hW, size_W);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        orgqrt_ungqrt_initData<false, true, T>(handle, m, n, k, nb, dA, lda, dIpiv, dT, ldt, hA,
+                                               hIpiv, hT, hW, size_W);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_orgqrt_ungqrt(handle, m, n, k, nb, dA.data(), lda,
+                                                    dIpiv.data(), dT.data(), ldt));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        orgqrt_ungqrt_initData<false, true, T>(handle, m, n, k, nb, dA, lda, dIpiv, dT, ldt, hA,
+                                               hIpiv, hT, hW, size_W);
+
+        start = get_time_us_sync(stream);
+        rocsolver_orgqrt_ungqrt(handle, m, n, k, nb, dA.data(), lda, dIpiv.data(), dT.data(), ldt);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_orgqrt_ungqrt(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int m = argus.get<rocblas_int>("m", n);
+    rocblas_int k = argus.get<rocblas_int>("k", n);
+    rocblas_int nb = argus.get<rocblas_int>("nb", max(min(k, 32), 1));
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldt = argus.get<rocblas_int>("ldt", nb);
+
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(n);
+    size_t size_T = size_t(ldt) * max(k, 1);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_Ar = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || k < 0 || lda < m || n > m || k > n)
+        || (nb < 1 || (k && nb > k) || ldt < nb);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_orgqrt_ungqrt(handle, m, n, k, nb, (T*)nullptr, lda,
+                                                      (T*)nullptr, (T*)nullptr, ldt),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_orgqrt_ungqrt(handle, m, n, k, nb, (T*)nullptr, lda,
+                                                  (T*)nullptr, (T*)nullptr, ldt));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hAr(size_Ar, 1, size_Ar, 1);
+    host_strided_batch_vector<T> hIpiv(size_P, 1, size_P, 1);
+    host_strided_batch_vector<T> hT(size_T, 1, size_T, 1);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T> dIpiv(size_P, 1, size_P, 1);
+    device_strided_batch_vector<T> dT(size_T, 1, size_T, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    if(size_T)
+        CHECK_HIP_ERROR(dT.memcheck());
+
+    // check quick return
+    if(n == 0 || m == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_orgqrt_ungqrt(handle, m, n, k, nb, dA.data(), lda,
+                                                      dIpiv.data(), dT.data(), ldt),
+                              rocblas_status_success);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        orgqrt_ungqrt_getError<T>(handle, m, n, k, nb, dA, lda, dIpiv, dT, ldt, hA, hAr, hIpiv, hT,
+                                  &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        orgqrt_ungqrt_getPerfData<T>(handle, m, n, k, nb, dA, lda, dIpiv, dT, ldt, hA, hIpiv, hT,
+                                     &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                     argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("m", "n", "k", "nb", "lda", "ldt");
+            rocsolver_bench_output(m, n, k, nb, lda, ldt);
+
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
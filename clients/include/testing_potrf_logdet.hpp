@@ -0,0 +1,537 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, bool FUSED, typename T, typename S>
+void potrf_logdet_checkBadArgs(const rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               T dA,
+                               const rocblas_int lda,
+                               const rocblas_stride stA,
+                               S dLogdet,
+                               rocblas_int* dInfo,
+                               const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, nullptr, uplo, n, dA, lda, stA,
+                                                 dLogdet, dInfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    if(FUSED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, rocblas_fill_full, n,
+                                                     dA, lda, stA, dLogdet, dInfo, bc),
+                              rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n, dA, lda, stA,
+                                                     dLogdet, dInfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n, (T) nullptr, lda,
+                                                 stA, dLogdet, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n, dA, lda, stA,
+                                                 (S) nullptr, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    if(FUSED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n, dA, lda, stA,
+                                                     dLogdet, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, 0, (T) nullptr, lda,
+                                                 stA, dLogdet, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n, dA, lda, stA,
+                                                     (S) nullptr, (rocblas_int*)nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, bool FUSED, typename T>
+void testing_potrf_logdet_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<S> dLogdet(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dLogdet.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        device_batch_vector<T> dA(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        potrf_logdet_checkBadArgs<STRIDED, FUSED>(handle, uplo, n, dA.data(), lda, stA,
+                                                  dLogdet.data(), dInfo.data(), bc);
+    }
+    else
+    {
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        potrf_logdet_checkBadArgs<STRIDED, FUSED>(handle, uplo, n, dA.data(), lda, stA,
+                                                  dLogdet.data(), dInfo.data(), bc);
+    }
+}
+
+template <bool CPU,
+          bool GPU,
+          bool STRIDED,
+          bool FUSED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Th>
+void potrf_logdet_initData(const rocblas_handle handle,
+                           const rocblas_fill uplo,
+                           const rocblas_int n,
+                           Td& dA,
+                           const rocblas_int lda,
+                           const rocblas_stride stA,
+                           Ud& dInfo,
+                           const rocblas_int bc,
+                           Th& hA,
+                           const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale to ensure positive definiteness
+            for(rocblas_int i = 0; i < n; i++)
+                hA[b][i + i * lda] = hA[b][i + i * lda] * sconj(hA[b][i + i * lda]) * 400;
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // make some matrices not positive definite
+                // always the same elements for debugging purposes
+                rocblas_int i = n / 2 + b;
+                i -= (i / n) * n;
+                hA[b][i + i * lda] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        // the standalone routine works with an existing factor
+        if(!FUSED)
+            CHECK_ROCBLAS_ERROR(rocsolver_potf2_potrf(STRIDED, true, handle, uplo, n, dA.data(),
+                                                      lda, stA, dInfo.data(), bc));
+    }
+}
+
+template <typename T, typename S>
+void potrf_logdet_reference(const rocblas_int n,
+                            T* A,
+                            const rocblas_int lda,
+                            const rocblas_int info,
+                            S* logdet)
+{
+    if(info > 0)
+    {
+        *logdet = std::numeric_limits<S>::quiet_NaN();
+        return;
+    }
+
+    S sum = 0;
+    for(rocblas_int i = 0; i < n; i++)
+        sum += std::log(std::real(A[i + i * lda]));
+    *logdet = 2 * sum;
+}
+
+template <bool STRIDED,
+          bool FUSED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
+void potrf_logdet_getError(const rocblas_handle handle,
+                           const rocblas_fill uplo,
+                           const rocblas_int n,
+                           Td& dA,
+                           const rocblas_int lda,
+                           const rocblas_stride stA,
+                           Vd& dLogdet,
+                           Ud& dInfo,
+                           const rocblas_int bc,
+                           Th& hA,
+                           Vh& hLogdetRes,
+                           Uh& hInfo,
+                           double* max_err,
+                           const bool singular)
+{
+    using S = decltype(std::real(T{}));
+    S logdet;
+
+    // input data initialization
+    potrf_logdet_initData<true, true, STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dInfo, bc,
+                                                         hA, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n, dA.data(), lda, stA,
+                                               dLogdet.data(), dInfo.data(), bc));
+    CHECK_HIP_ERROR(hLogdetRes.transfer_from(dLogdet));
+
+    // CPU lapack
+    // (there is no equivalent routine in LAPACK; the determinant is computed
+    // from the Cholesky factorization on the host)
+    for(rocblas_int b = 0; b < bc; ++b)
+        cblas_potrf<T>(uplo, n, hA[b], lda, hInfo[b]);
+
+    // error is |logdet - logdet_res| / max(1, |logdet|)
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        potrf_logdet_reference<T>(n, hA[b], lda, hInfo[b][0], &logdet);
+
+        if(hInfo[b][0] > 0)
+        {
+            // the fused routine reports matrices that are not positive definite with NaN
+            // (the standalone routine receives an incomplete factor and its result is not defined)
+            err = (FUSED && !std::isnan(hLogdetRes[b][0])) ? 1 : 0;
+        }
+        else
+            err = std::abs(logdet - hLogdetRes[b][0]) / std::max(S(1), std::abs(logdet));
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED,
+          bool FUSED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void potrf_logdet_getPerfData(const rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              Td& dA,
+                              const rocblas_int lda,
+                              const rocblas_stride stA,
+                              Vd& dLogdet,
+                              Ud& dInfo,
+                              const rocblas_int bc,
+                              Th& hA,
+                              Uh& hInfo,
+                              double* gpu_time_used,
+                              double* cpu_time_used,
+                              const rocblas_int hot_calls,
+                              const int profile,
+                              const bool profile_kernels,
+                              const bool perf,
+                              const bool singular)
+{
+    using S = decltype(std::real(T{}));
+    S logdet;
+
+    if(!perf)
+    {
+        potrf_logdet_initData<true, false, STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dInfo,
+                                                              bc, hA, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cblas_potrf<T>(uplo, n, hA[b], lda, hInfo[b]);
+            potrf_logdet_reference<T>(n, hA[b], lda, hInfo[b][0], &logdet);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    potrf_logdet_initData<true, false, STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dInfo, bc,
+                                                          hA, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        potrf_logdet_initData<false, true, STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dInfo,
+                                                              bc, hA, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n, dA.data(), lda,
+                                                   stA, dLogdet.data(), dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        potrf_logdet_initData<false, true, STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dInfo,
+                                                              bc, hA, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n, dA.data(), lda, stA, dLogdet.data(),
+                               dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, bool FUSED, typename T>
+void testing_potrf_logdet(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(FUSED && uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n,
+                                                         (T* const*)nullptr, lda, stA, (S*)nullptr,
+                                                         (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n,
+                                                         (T*)nullptr, lda, stA, (S*)nullptr,
+                                                         (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n,
+                                                         (T* const*)nullptr, lda, stA, (S*)nullptr,
+                                                         (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n,
+                                                         (T*)nullptr, lda, stA, (S*)nullptr,
+                                                         (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n,
+                                                     (T* const*)nullptr, lda, stA, (S*)nullptr,
+                                                     (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n, (T*)nullptr,
+                                                     lda, stA, (S*)nullptr, (rocblas_int*)nullptr,
+                                                     bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (logdet and info are always strided)
+    host_strided_batch_vector<S> hLogdetRes(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    device_strided_batch_vector<S> dLogdet(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dLogdet.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n, dA.data(),
+                                                         lda, stA, dLogdet.data(), dInfo.data(),
+                                                         bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            potrf_logdet_getError<STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dLogdet, dInfo,
+                                                     bc, hA, hLogdetRes, hInfo, &max_error,
+                                                     argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            potrf_logdet_getPerfData<STRIDED, FUSED, T>(
+                handle, uplo, n, dA, lda, stA, dLogdet, dInfo, bc, hA, hInfo, &gpu_time_used,
+                &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels, argus.perf,
+                argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_potrf_logdet(STRIDED, FUSED, handle, uplo, n, dA.data(),
+                                                         lda, stA, dLogdet.data(), dInfo.data(),
+                                                         bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            potrf_logdet_getError<STRIDED, FUSED, T>(handle, uplo, n, dA, lda, stA, dLogdet, dInfo,
+                                                     bc, hA, hLogdetRes, hInfo, &max_error,
+                                                     argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            potrf_logdet_getPerfData<STRIDED, FUSED, T>(
+                handle, uplo, n, dA, lda, stA, dLogdet, dInfo, bc, hA, hInfo, &gpu_time_used,
+                &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels, argus.perf,
+                argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "strideA", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, stA, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "lda");
+                rocsolver_bench_output(uploC, n, lda);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
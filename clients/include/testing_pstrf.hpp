@@ -0,0 +1,565 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void pstrf_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        U dPiv,
+                        const rocblas_stride stP,
+                        U dRank,
+                        U dInfo,
+                        const rocblas_int bc)
+{
+    using S = decltype(std::real(std::remove_pointer_t<std::remove_pointer_t<T>>{}));
+    const S tol = -1;
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_pstrf(STRIDED, nullptr, uplo, n, dA, lda, stA, dPiv, stP, dRank, tol, dInfo, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, rocblas_fill_full, n, dA, lda, stA, dPiv,
+                                          stP, dRank, tol, dInfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA, lda, stA, dPiv, stP,
+                                              dRank, tol, dInfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, (T) nullptr, lda, stA, dPiv,
+                                          stP, dRank, tol, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA, lda, stA, (U) nullptr, stP,
+                                          dRank, tol, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA, lda, stA, dPiv, stP,
+                                          (U) nullptr, tol, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA, lda, stA, dPiv, stP, dRank,
+                                          tol, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, 0, (T) nullptr, lda, stA,
+                                          (U) nullptr, stP, dRank, tol, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA, lda, stA, dPiv, stP,
+                                              (U) nullptr, tol, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_pstrf_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<rocblas_int> dPiv(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dRank(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dPiv.memcheck());
+    CHECK_HIP_ERROR(dRank.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        pstrf_checkBadArgs<STRIDED>(handle, uplo, n, dA.data(), lda, stA, dPiv.data(), stP,
+                                    dRank.data(), dInfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        pstrf_checkBadArgs<STRIDED>(handle, uplo, n, dA.data(), lda, stA, dPiv.data(), stP,
+                                    dRank.data(), dInfo.data(), bc);
+    }
+}
+
+/** The test matrices are of the form A = GG', where G is n-by-r. If singular is true,
+    r = n/2 and A is positive semidefinite with rank r. Otherwise, r = n and G is
+    diagonally dominant, so that A is positive definite. **/
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void pstrf_initData(const rocblas_handle handle,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_int bc,
+                    Th& hA,
+                    const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        rocblas_int r = singular ? std::max(n / 2, 1) : n;
+        std::vector<T> G(size_t(n) * r);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int k = 0; k < r; k++)
+            {
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    G[i + k * n] = hA[b][i + k * lda];
+                    if(!singular && i == k)
+                        G[i + k * n] += 400;
+                }
+            }
+
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    T sum = 0;
+                    for(rocblas_int k = 0; k < r; k++)
+                        sum += G[i + k * n] * sconj(G[j + k * n]);
+                    hA[b][i + j * lda] = sum;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+void pstrf_getError(const rocblas_handle handle,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Ud& dPiv,
+                    const rocblas_stride stP,
+                    Ud& dRank,
+                    const S tol,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hARes,
+                    Uh& hPiv,
+                    Uh& hPivRes,
+                    Uh& hRank,
+                    Uh& hRankRes,
+                    Uh& hInfo,
+                    Uh& hInfoRes,
+                    double* max_err,
+                    const bool singular)
+{
+    std::vector<S> work(2 * n);
+    std::vector<T> hPAP(size_t(n) * n);
+    std::vector<T> hLL(size_t(n) * n);
+
+    // input data initialization
+    pstrf_initData<true, true, T>(handle, n, dA, lda, bc, hA, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_pstrf(STRIDED, handle, uplo, n, dA.data(), lda, stA, dPiv.data(),
+                                        stP, dRank.data(), tol, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hPivRes.transfer_from(dPiv));
+    CHECK_HIP_ERROR(hRankRes.transfer_from(dRank));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // error is ||P'AP - LL'|| / ||A|| (or ||P'AP - U'U|| / ||A||), where only the first
+    // rank columns of L (rows of U) are used. As the pivots are not unique when there are
+    // ties, the factor is not compared against the CPU result directly.
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        rocblas_int r = hRankRes[b][0];
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                T sum = 0;
+                for(rocblas_int k = 0; k < std::min({i + 1, j + 1, r}); k++)
+                {
+                    if(uplo == rocblas_fill_lower)
+                        sum += hARes[b][i + k * lda] * sconj(hARes[b][j + k * lda]);
+                    else
+                        sum += sconj(hARes[b][k + i * lda]) * hARes[b][k + j * lda];
+                }
+                hLL[i + j * n] = sum;
+
+                rocblas_int pi = hPivRes[b][i] - 1;
+                rocblas_int pj = hPivRes[b][j] - 1;
+                hPAP[i + j * n] = hA[b][pi + pj * lda];
+            }
+        }
+        err = norm_error('F', n, n, n, hPAP.data(), hLL.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        cblas_pstrf<T>(uplo, n, hA[b], lda, hPiv[b], hRank[b], tol, work.data(), hInfo[b]);
+
+    // also check rank and info
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hRank[b][0] != hRankRes[b][0])
+            err++;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+void pstrf_getPerfData(const rocblas_handle handle,
+                       const rocblas_fill uplo,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Ud& dPiv,
+                       const rocblas_stride stP,
+                       Ud& dRank,
+                       const S tol,
+                       Ud& dInfo,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Uh& hPiv,
+                       Uh& hRank,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf,
+                       const bool singular)
+{
+    std::vector<S> work(2 * n);
+
+    if(!perf)
+    {
+        pstrf_initData<true, false, T>(handle, n, dA, lda, bc, hA, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_pstrf<T>(uplo, n, hA[b], lda, hPiv[b], hRank[b], tol, work.data(), hInfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    pstrf_initData<true, false, T>(handle, n, dA, lda, bc, hA, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        pstrf_initData<false, true, T>(handle, n, dA, lda, bc, hA, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_pstrf(STRIDED, handle, uplo, n, dA.data(), lda, stA,
+                                            dPiv.data(), stP, dRank.data(), tol, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        pstrf_initData<false, true, T>(handle, n, dA, lda, bc, hA, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_pstrf(STRIDED, handle, uplo, n, dA.data(), lda, stA, dPiv.data(), stP,
+                        dRank.data(), tol, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_pstrf(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", n);
+    S tol = S(argus.get<double>("tol", -1));
+
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+    rocblas_stride stPRes = (argus.unit_check || argus.norm_check) ? stP : 0;
+
+    // check non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, (T* const*)nullptr,
+                                                  lda, stA, (rocblas_int*)nullptr, stP,
+                                                  (rocblas_int*)nullptr, tol,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, (T*)nullptr, lda, stA,
+                                                  (rocblas_int*)nullptr, stP, (rocblas_int*)nullptr,
+                                                  tol, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, (T* const*)nullptr,
+                                                  lda, stA, (rocblas_int*)nullptr, stP,
+                                                  (rocblas_int*)nullptr, tol,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, (T*)nullptr, lda, stA,
+                                                  (rocblas_int*)nullptr, stP, (rocblas_int*)nullptr,
+                                                  tol, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_pstrf(STRIDED, handle, uplo, n, (T* const*)nullptr, lda,
+                                              stA, (rocblas_int*)nullptr, stP,
+                                              (rocblas_int*)nullptr, tol, (rocblas_int*)nullptr,
+                                              bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_pstrf(STRIDED, handle, uplo, n, (T*)nullptr, lda, stA,
+                                              (rocblas_int*)nullptr, stP, (rocblas_int*)nullptr,
+                                              tol, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<rocblas_int> hPiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hPivRes(size_PRes, 1, stPRes, bc);
+    host_strided_batch_vector<rocblas_int> hRank(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hRankRes(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<rocblas_int> dPiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dRank(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_P)
+        CHECK_HIP_ERROR(dPiv.memcheck());
+    CHECK_HIP_ERROR(dRank.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA.data(), lda, stA,
+                                                  dPiv.data(), stP, dRank.data(), tol,
+                                                  dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            pstrf_getError<STRIDED, T>(handle, uplo, n, dA, lda, stA, dPiv, stP, dRank, tol, dInfo,
+                                       bc, hA, hARes, hPiv, hPivRes, hRank, hRankRes, hInfo,
+                                       hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            pstrf_getPerfData<STRIDED, T>(handle, uplo, n, dA, lda, stA, dPiv, stP, dRank, tol,
+                                          dInfo, bc, hA, hPiv, hRank, hInfo, &gpu_time_used,
+                                          &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_pstrf(STRIDED, handle, uplo, n, dA.data(), lda, stA,
+                                                  dPiv.data(), stP, dRank.data(), tol,
+                                                  dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            pstrf_getError<STRIDED, T>(handle, uplo, n, dA, lda, stA, dPiv, stP, dRank, tol, dInfo,
+                                       bc, hA, hARes, hPiv, hPivRes, hRank, hRankRes, hInfo,
+                                       hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            pstrf_getPerfData<STRIDED, T>(handle, uplo, n, dA, lda, stA, dPiv, stP, dRank, tol,
+                                          dInfo, bc, hA, hPiv, hRank, hInfo, &gpu_time_used,
+                                          &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "strideP", "tol", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, stP, tol, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "strideA", "strideP", "tol", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, stA, stP, tol, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "tol");
+                rocsolver_bench_output(uploC, n, lda, tol);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
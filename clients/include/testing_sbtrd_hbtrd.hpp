@@ -0,0 +1,658 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S>
+void sbtrd_hbtrd_checkBadArgs(const rocblas_handle handle,
+                              const rocblas_evect evect,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              const rocblas_int kd,
+                              T dA,
+                              const rocblas_int lda,
+                              const rocblas_stride stA,
+                              S dD,
+                              const rocblas_stride stD,
+                              S dE,
+                              const rocblas_stride stE,
+                              T dQ,
+                              const rocblas_int ldq,
+                              const rocblas_stride stQ,
+                              const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, nullptr, evect, uplo, n, kd, dA, lda, stA,
+                                                dD, stD, dE, stE, dQ, ldq, stQ, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, rocblas_evect(-1), uplo, n, kd, dA,
+                                                lda, stA, dD, stD, dE, stE, dQ, ldq, stQ, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, rocblas_fill_full, n, kd,
+                                                dA, lda, stA, dD, stD, dE, stE, dQ, ldq, stQ, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd, dA, lda,
+                                                    stA, dD, stD, dE, stE, dQ, ldq, stQ, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd, (T) nullptr,
+                                                lda, stA, dD, stD, dE, stE, dQ, ldq, stQ, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd, dA, lda, stA,
+                                                (S) nullptr, stD, dE, stE, dQ, ldq, stQ, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd, dA, lda, stA,
+                                                dD, stD, (S) nullptr, stE, dQ, ldq, stQ, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd, dA, lda, stA,
+                                                dD, stD, dE, stE, (T) nullptr, ldq, stQ, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, 0, kd, (T) nullptr,
+                                                lda, stA, (S) nullptr, stD, (S) nullptr, stE,
+                                                (T) nullptr, ldq, stQ, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd, dA, lda,
+                                                    stA, dD, stD, dE, stE, dQ, ldq, stQ, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_sbtrd_hbtrd_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_evect evect = rocblas_evect_original;
+    rocblas_fill uplo = rocblas_fill_lower;
+    rocblas_int n = 2;
+    rocblas_int kd = 1;
+    rocblas_int lda = 2;
+    rocblas_int ldq = 2;
+    rocblas_stride stA = 1;
+    rocblas_stride stD = 1;
+    rocblas_stride stE = 1;
+    rocblas_stride stQ = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<S> dD(1, 1, 1, 1);
+        device_strided_batch_vector<S> dE(1, 1, 1, 1);
+        device_batch_vector<T> dQ(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dQ.memcheck());
+
+        // check bad arguments
+        sbtrd_hbtrd_checkBadArgs<STRIDED>(handle, evect, uplo, n, kd, dA.data(), lda, stA,
+                                          dD.data(), stD, dE.data(), stE, dQ.data(), ldq, stQ, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<S> dD(1, 1, 1, 1);
+        device_strided_batch_vector<S> dE(1, 1, 1, 1);
+        device_strided_batch_vector<T> dQ(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dQ.memcheck());
+
+        // check bad arguments
+        sbtrd_hbtrd_checkBadArgs<STRIDED>(handle, evect, uplo, n, kd, dA.data(), lda, stA,
+                                          dD.data(), stD, dE.data(), stE, dQ.data(), ldq, stQ, bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void sbtrd_hbtrd_initData(const rocblas_handle handle,
+                          const rocblas_evect evect,
+                          const rocblas_fill uplo,
+                          const rocblas_int n,
+                          const rocblas_int kd,
+                          Td& dA,
+                          const rocblas_int lda,
+                          Td& dQ,
+                          const rocblas_int ldq,
+                          const rocblas_int bc,
+                          Th& hA,
+                          Th& hQ,
+                          std::vector<T>& A,
+                          bool test = true)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_int diag = (uplo == rocblas_fill_upper ? kd : 0);
+
+        // scale A to avoid singularities
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i <= kd; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == diag)
+                        hA[b][i + j * lda] = std::real(hA[b][i + j * lda]) + 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // make a full (dense) copy of original data to test the reduction if required
+            if(test && evect != rocblas_evect_none)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    for(rocblas_int i = 0; i < n; i++)
+                    {
+                        T a = 0;
+                        if(i >= j && i - j <= kd)
+                            a = (uplo == rocblas_fill_upper ? sconj(hA[b][kd + j - i + i * lda])
+                                                            : hA[b][i - j + j * lda]);
+                        else if(j > i && j - i <= kd)
+                            a = (uplo == rocblas_fill_upper ? hA[b][kd + i - j + j * lda]
+                                                            : sconj(hA[b][j - i + i * lda]));
+                        A[b * n * n + i + j * n] = a;
+                    }
+                }
+            }
+        }
+
+        // random initial matrix X to be updated with the orthogonal/unitary matrix
+        if(evect == rocblas_evect_original)
+            rocblas_init<T>(hQ, true);
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        if(evect == rocblas_evect_original)
+            CHECK_HIP_ERROR(dQ.transfer_from(hQ));
+    }
+}
+
+template <bool STRIDED, typename T, typename Sd, typename Td, typename Sh, typename Th>
+void sbtrd_hbtrd_getError(const rocblas_handle handle,
+                          const rocblas_evect evect,
+                          const rocblas_fill uplo,
+                          const rocblas_int n,
+                          const rocblas_int kd,
+                          Td& dA,
+                          const rocblas_int lda,
+                          const rocblas_stride stA,
+                          Sd& dD,
+                          const rocblas_stride stD,
+                          Sd& dE,
+                          const rocblas_stride stE,
+                          Td& dQ,
+                          const rocblas_int ldq,
+                          const rocblas_stride stQ,
+                          const rocblas_int bc,
+                          Th& hA,
+                          Sh& hD,
+                          Sh& hDres,
+                          Sh& hE,
+                          Sh& hEres,
+                          Th& hQ,
+                          Th& hQres,
+                          double* max_err)
+{
+    using S = decltype(std::real(T{}));
+
+    std::vector<T> work(n);
+    std::vector<T> A(n * n * bc);
+    std::vector<T> M(n * n);
+    std::vector<T> TQ(n * n);
+    std::vector<T> QTQ(n * n);
+
+    // input data initialization
+    sbtrd_hbtrd_initData<true, true, T>(handle, evect, uplo, n, kd, dA, lda, dQ, ldq, bc, hA, hQ,
+                                        A);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd, dA.data(), lda,
+                                              stA, dD.data(), stD, dE.data(), stE, dQ.data(), ldq,
+                                              stQ, bc));
+    CHECK_HIP_ERROR(hDres.transfer_from(dD));
+    CHECK_HIP_ERROR(hEres.transfer_from(dE));
+    if(evect != rocblas_evect_none)
+        CHECK_HIP_ERROR(hQres.transfer_from(dQ));
+
+    // CPU lapack
+    // (the initial matrix X in hQ is kept for the implicit test below)
+    for(rocblas_int b = 0; b < bc; ++b)
+        cblas_sbtrd_hbtrd<T>(rocblas_evect_none, uplo, n, kd, hA[b], lda, hD[b], hE[b], hQ[b],
+                             ldq, work.data());
+
+    // the tridiagonal form is not unique (the signs or phases of the off-diagonal elements
+    // may differ), so the eigenvalues of both tridiagonal matrices are compared instead
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // the tridiagonal form T is kept in TQ to test the orthogonal/unitary matrix below
+        if(evect != rocblas_evect_none)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    if(i == j)
+                        M[i + j * n] = hDres[b][i];
+                    else if(i == j + 1)
+                        M[i + j * n] = hEres[b][j];
+                    else if(j == i + 1)
+                        M[i + j * n] = hEres[b][i];
+                    else
+                        M[i + j * n] = 0;
+                }
+            }
+        }
+
+        cblas_sterf<S>(n, hD[b], hE[b]);
+        cblas_sterf<S>(n, hDres[b], hEres[b]);
+
+        // error is ||hD - hDRes|| / ||hD||
+        // using frobenius norm
+        err = norm_error('F', 1, n, 1, hD[b], hDres[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        if(evect != rocblas_evect_none)
+        {
+            // compute Qres * T * Qres' and compare with X * A * X'
+            // (X is the identity when evect is tridiagonal)
+            cblas_gemm<T>(rocblas_operation_none, rocblas_operation_none, n, n, n, T(1), hQres[b],
+                          ldq, M.data(), n, T(0), TQ.data(), n);
+            cblas_gemm<T>(rocblas_operation_none, rocblas_operation_conjugate_transpose, n, n, n,
+                          T(1), TQ.data(), n, hQres[b], ldq, T(0), QTQ.data(), n);
+
+            T* XAX = A.data() + b * n * n;
+            if(evect == rocblas_evect_original)
+            {
+                cblas_gemm<T>(rocblas_operation_none, rocblas_operation_none, n, n, n, T(1),
+                              hQ[b], ldq, XAX, n, T(0), TQ.data(), n);
+                cblas_gemm<T>(rocblas_operation_none, rocblas_operation_conjugate_transpose, n, n,
+                              n, T(1), TQ.data(), n, hQ[b], ldq, T(0), XAX, n);
+            }
+
+            // error is ||XAX' - QTQ'|| / ||XAX'||
+            // using frobenius norm
+            err = norm_error('F', n, n, n, XAX, QTQ.data());
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename Sd, typename Td, typename Sh, typename Th>
+void sbtrd_hbtrd_getPerfData(const rocblas_handle handle,
+                             const rocblas_evect evect,
+                             const rocblas_fill uplo,
+                             const rocblas_int n,
+                             const rocblas_int kd,
+                             Td& dA,
+                             const rocblas_int lda,
+                             const rocblas_stride stA,
+                             Sd& dD,
+                             const rocblas_stride stD,
+                             Sd& dE,
+                             const rocblas_stride stE,
+                             Td& dQ,
+                             const rocblas_int ldq,
+                             const rocblas_stride stQ,
+                             const rocblas_int bc,
+                             Th& hA,
+                             Sh& hD,
+                             Sh& hE,
+                             Th& hQ,
+                             double* gpu_time_used,
+                             double* cpu_time_used,
+                             const rocblas_int hot_calls,
+                             const int profile,
+                             const bool profile_kernels,
+                             const bool perf)
+{
+    std::vector<T> work(n);
+    std::vector<T> A;
+
+    if(!perf)
+    {
+        sbtrd_hbtrd_initData<true, false, T>(handle, evect, uplo, n, kd, dA, lda, dQ, ldq, bc, hA,
+                                             hQ, A, 0);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cblas_sbtrd_hbtrd<T>(evect, uplo, n, kd, hA[b], lda, hD[b], hE[b], hQ[b], ldq,
+                                 work.data());
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    sbtrd_hbtrd_initData<true, false, T>(handle, evect, uplo, n, kd, dA, lda, dQ, ldq, bc, hA, hQ,
+                                         A, 0);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        sbtrd_hbtrd_initData<false, true, T>(handle, evect, uplo, n, kd, dA, lda, dQ, ldq, bc, hA,
+                                             hQ, A, 0);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd, dA.data(),
+                                                  lda, stA, dD.data(), stD, dE.data(), stE,
+                                                  dQ.data(), ldq, stQ, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        sbtrd_hbtrd_initData<false, true, T>(handle, evect, uplo, n, kd, dA, lda, dQ, ldq, bc, hA,
+                                             hQ, A, 0);
+
+        start = get_time_us_sync(stream);
+        rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd, dA.data(), lda, stA, dD.data(),
+                              stD, dE.data(), stE, dQ.data(), ldq, stQ, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_sbtrd_hbtrd(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char evectC = argus.get<char>("evect");
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int kd = argus.get<rocblas_int>("kd");
+    rocblas_int lda = argus.get<rocblas_int>("lda", kd + 1);
+    rocblas_int ldq = argus.get<rocblas_int>("ldq", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stD = argus.get<rocblas_stride>("strideD", n);
+    rocblas_stride stE = argus.get<rocblas_stride>("strideE", n - 1);
+    rocblas_stride stQ = argus.get<rocblas_stride>("strideQ", ldq * n);
+
+    rocblas_evect evect = char2rocblas_evect(evectC);
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo == rocblas_fill_full)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd,
+                                                        (T* const*)nullptr, lda, stA, (S*)nullptr,
+                                                        stD, (S*)nullptr, stE, (T* const*)nullptr,
+                                                        ldq, stQ, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd,
+                                                        (T*)nullptr, lda, stA, (S*)nullptr, stD,
+                                                        (S*)nullptr, stE, (T*)nullptr, ldq, stQ,
+                                                        bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_D = n;
+    size_t size_E = n - 1;
+    size_t size_Q = size_t(ldq) * n;
+    size_t size_Dres = (argus.unit_check || argus.norm_check) ? size_D : 0;
+    size_t size_Eres = (argus.unit_check || argus.norm_check) ? size_E : 0;
+    size_t size_Qres = (argus.unit_check || argus.norm_check) ? size_Q : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || kd < 0 || lda < kd + 1
+                         || (evect != rocblas_evect_none && ldq < n) || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd,
+                                                        (T* const*)nullptr, lda, stA, (S*)nullptr,
+                                                        stD, (S*)nullptr, stE, (T* const*)nullptr,
+                                                        ldq, stQ, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd,
+                                                        (T*)nullptr, lda, stA, (S*)nullptr, stD,
+                                                        (S*)nullptr, stE, (T*)nullptr, ldq, stQ,
+                                                        bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd,
+                                                    (T* const*)nullptr, lda, stA, (S*)nullptr, stD,
+                                                    (S*)nullptr, stE, (T* const*)nullptr, ldq, stQ,
+                                                    bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd,
+                                                    (T*)nullptr, lda, stA, (S*)nullptr, stD,
+                                                    (S*)nullptr, stE, (T*)nullptr, ldq, stQ, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<S> hD(size_D, 1, stD, bc);
+    host_strided_batch_vector<S> hE(size_E, 1, stE, bc);
+    host_strided_batch_vector<S> hDres(size_Dres, 1, stD, bc);
+    host_strided_batch_vector<S> hEres(size_Eres, 1, stE, bc);
+    // device
+    device_strided_batch_vector<S> dD(size_D, 1, stD, bc);
+    device_strided_batch_vector<S> dE(size_E, 1, stE, bc);
+    if(size_D)
+        CHECK_HIP_ERROR(dD.memcheck());
+    if(size_E)
+        CHECK_HIP_ERROR(dE.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hQ(size_Q, 1, bc);
+        host_batch_vector<T> hQres(size_Qres, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dQ(size_Q, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_Q)
+            CHECK_HIP_ERROR(dQ.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd,
+                                                        dA.data(), lda, stA, dD.data(), stD,
+                                                        dE.data(), stE, dQ.data(), ldq, stQ, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+        {
+            sbtrd_hbtrd_getError<STRIDED, T>(handle, evect, uplo, n, kd, dA, lda, stA, dD, stD, dE,
+                                             stE, dQ, ldq, stQ, bc, hA, hD, hDres, hE, hEres, hQ,
+                                             hQres, &max_error);
+        }
+
+        // collect performance data
+        if(argus.timing)
+        {
+            sbtrd_hbtrd_getPerfData<STRIDED, T>(handle, evect, uplo, n, kd, dA, lda, stA, dD, stD,
+                                                dE, stE, dQ, ldq, stQ, bc, hA, hD, hE, hQ,
+                                                &gpu_time_used, &cpu_time_used, hot_calls,
+                                                argus.profile, argus.profile_kernels, argus.perf);
+        }
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hQ(size_Q, 1, stQ, bc);
+        host_strided_batch_vector<T> hQres(size_Qres, 1, stQ, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dQ(size_Q, 1, stQ, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_Q)
+            CHECK_HIP_ERROR(dQ.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_sbtrd_hbtrd(STRIDED, handle, evect, uplo, n, kd,
+                                                        dA.data(), lda, stA, dD.data(), stD,
+                                                        dE.data(), stE, dQ.data(), ldq, stQ, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+        {
+            sbtrd_hbtrd_getError<STRIDED, T>(handle, evect, uplo, n, kd, dA, lda, stA, dD, stD, dE,
+                                             stE, dQ, ldq, stQ, bc, hA, hD, hDres, hE, hEres, hQ,
+                                             hQres, &max_error);
+        }
+
+        // collect performance data
+        if(argus.timing)
+        {
+            sbtrd_hbtrd_getPerfData<STRIDED, T>(handle, evect, uplo, n, kd, dA, lda, stA, dD, stD,
+                                                dE, stE, dQ, ldq, stQ, bc, hA, hD, hE, hQ,
+                                                &gpu_time_used, &cpu_time_used, hot_calls,
+                                                argus.profile, argus.profile_kernels, argus.perf);
+        }
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("evect", "uplo", "n", "kd", "lda", "strideD", "strideE",
+                                       "ldq", "batch_c");
+                rocsolver_bench_output(evectC, uploC, n, kd, lda, stD, stE, ldq, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("evect", "uplo", "n", "kd", "lda", "strideA", "strideD",
+                                       "strideE", "ldq", "strideQ", "batch_c");
+                rocsolver_bench_output(evectC, uploC, n, kd, lda, stA, stD, stE, ldq, stQ, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("evect", "uplo", "n", "kd", "lda", "ldq");
+                rocsolver_bench_output(evectC, uploC, n, kd, lda, ldq);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
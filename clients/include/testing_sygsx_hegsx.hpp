@@ -238,6 +238,7 @@ void sygsx_hegsx_getError(const rocblas_handle handle,
                                                   lda, stA, dB.data(), ldb, stB, bc));
         CHECK_HIP_ERROR(hARes.transfer_from(dA));
     }
+    else
     {
         // CPU lapack
         for(rocblas_int b = 0; b < bc; ++b)
@@ -248,10 +249,25 @@ void sygsx_hegsx_getError(const rocblas_handle handle,
         }
     }
 
+    // the triangular part of A not given by uplo is not referenced and must be left unchanged
+    bool unchanged = true;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                bool opposite = (uplo == rocblas_fill_upper) ? (i > j) : (i < j);
+                if(opposite && hARes[b][i + j * lda] != hA[b][i + j * lda])
+                    unchanged = false;
+            }
+        }
+    }
+
     // error is ||M - hARes|| / ||M||
     // using frobenius norm
     double err;
-    *max_err = 0;
+    *max_err = unchanged ? 0 : 1;
     for(rocblas_int b = 0; b < bc; ++b)
     {
         if(uplo == rocblas_fill_upper)
@@ -0,0 +1,553 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S, typename U>
+void symatfunc_hematfunc_checkBadArgs(const rocblas_handle handle,
+                                      const rocblas_matfunc func,
+                                      const rocblas_fill uplo,
+                                      const rocblas_int n,
+                                      T dA,
+                                      const rocblas_int lda,
+                                      const rocblas_stride stA,
+                                      const S clamp,
+                                      U dinfo,
+                                      const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, nullptr, func, uplo, n, dA, lda,
+                                                        stA, clamp, dinfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, rocblas_matfunc(-1), uplo,
+                                                        n, dA, lda, stA, clamp, dinfo, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, rocblas_fill_full, n,
+                                                        dA, lda, stA, clamp, dinfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n, dA, lda,
+                                                            stA, clamp, dinfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n, (T) nullptr,
+                                                        lda, stA, clamp, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n, dA, lda,
+                                                        stA, clamp, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, 0, (T) nullptr,
+                                                        lda, stA, clamp, dinfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n, dA, lda,
+                                                            stA, clamp, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_symatfunc_hematfunc_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_matfunc func = rocblas_matfunc_sqrt;
+    rocblas_fill uplo = rocblas_fill_lower;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    S clamp = 0;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        symatfunc_hematfunc_checkBadArgs<STRIDED>(handle, func, uplo, n, dA.data(), lda, stA, clamp,
+                                                  dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        symatfunc_hematfunc_checkBadArgs<STRIDED>(handle, func, uplo, n, dA.data(), lda, stA, clamp,
+                                                  dinfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void symatfunc_hematfunc_initData(const rocblas_handle handle,
+                                  const rocblas_int n,
+                                  Td& dA,
+                                  const rocblas_int lda,
+                                  const rocblas_int bc,
+                                  Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // make A Hermitian and diagonally dominant, so that all the eigenvalues are
+        // positive and well separated from zero
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < i; j++)
+                {
+                    hA[b][i + j * lda] = (hA[b][i + j * lda] - T(5)) / T(n);
+                    hA[b][j + i * lda] = sconj(hA[b][i + j * lda]);
+                }
+                hA[b][i + i * lda] = std::real(hA[b][i + i * lda]) + 10;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+/** Host reference: computes f(A) from the eigendecomposition given by LAPACK, and returns in
+    info the value expected from rocSOLVER **/
+template <typename T, typename S>
+void symatfunc_hematfunc_reference(const rocblas_matfunc func,
+                                   const rocblas_fill uplo,
+                                   const rocblas_int n,
+                                   T* A,
+                                   const rocblas_int lda,
+                                   const S clamp,
+                                   rocblas_int* info)
+{
+    constexpr bool COMPLEX = is_complex<T>;
+
+    int sizeE = (!COMPLEX ? 1 + 6 * n + 2 * n * n : 1 + 5 * n + 2 * n * n);
+    int lwork = (!COMPLEX ? 0 : 2 * n + n * n);
+    int liwork = 3 + 5 * n;
+
+    std::vector<T> work(lwork);
+    std::vector<S> hE(sizeE);
+    std::vector<int> iwork(liwork);
+    std::vector<S> D(n);
+    std::vector<T> V(size_t(lda) * n);
+
+    for(rocblas_int j = 0; j < n; j++)
+        for(rocblas_int i = 0; i < n; i++)
+            V[i + j * lda] = A[i + j * lda];
+
+    cblas_syevd_heevd<T>(rocblas_evect_original, uplo, n, V.data(), lda, D.data(), work.data(),
+                         lwork, hE.data(), sizeE, iwork.data(), liwork, info);
+    if(*info != 0)
+        return;
+
+    // evaluate the function on the eigenvalues
+    rocblas_int nbad = 0;
+    for(rocblas_int k = 0; k < n; k++)
+    {
+        S x = std::max(D[k], clamp);
+        bool valid = true;
+        switch(func)
+        {
+        case rocblas_matfunc_sqrt:
+            valid = (x >= 0);
+            x = valid ? std::sqrt(x) : 0;
+            break;
+        case rocblas_matfunc_invsqrt:
+            valid = (x > 0);
+            x = valid ? 1 / std::sqrt(x) : 0;
+            break;
+        case rocblas_matfunc_exp: x = std::exp(x); break;
+        case rocblas_matfunc_log:
+            valid = (x > 0);
+            x = valid ? std::log(x) : 0;
+            break;
+        }
+        nbad += (valid ? 0 : 1);
+        D[k] = x;
+    }
+    if(nbad > 0)
+        *info = n + nbad;
+
+    // f(A) = V * f(D) * V'
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            T temp = 0;
+            for(rocblas_int k = 0; k < n; k++)
+                temp += V[i + k * lda] * T(D[k]) * sconj(V[j + k * lda]);
+            A[i + j * lda] = temp;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+void symatfunc_hematfunc_getError(const rocblas_handle handle,
+                                  const rocblas_matfunc func,
+                                  const rocblas_fill uplo,
+                                  const rocblas_int n,
+                                  Td& dA,
+                                  const rocblas_int lda,
+                                  const rocblas_stride stA,
+                                  const S clamp,
+                                  Ud& dinfo,
+                                  const rocblas_int bc,
+                                  Th& hA,
+                                  Th& hAres,
+                                  Uh& hinfo,
+                                  Uh& hinfoRes,
+                                  double* max_err)
+{
+    // input data initialization
+    symatfunc_hematfunc_initData<true, true, T>(handle, n, dA, lda, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n, dA.data(),
+                                                      lda, stA, clamp, dinfo.data(), bc));
+    CHECK_HIP_ERROR(hAres.transfer_from(dA));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        symatfunc_hematfunc_reference<T>(func, uplo, n, hA[b], lda, clamp, hinfo[b]);
+
+    // check info
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+        if(hinfo[b][0] != hinfoRes[b][0])
+            *max_err += 1;
+
+    // error is ||hA - hAres|| / ||hA||
+    // (the whole matrix is compared as both triangles are written)
+    // using frobenius norm
+    double err;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hinfo[b][0] == 0 || hinfo[b][0] > n)
+        {
+            err = norm_error('F', n, n, lda, hA[b], hAres[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename S, typename Td, typename Ud, typename Th, typename Uh>
+void symatfunc_hematfunc_getPerfData(const rocblas_handle handle,
+                                     const rocblas_matfunc func,
+                                     const rocblas_fill uplo,
+                                     const rocblas_int n,
+                                     Td& dA,
+                                     const rocblas_int lda,
+                                     const rocblas_stride stA,
+                                     const S clamp,
+                                     Ud& dinfo,
+                                     const rocblas_int bc,
+                                     Th& hA,
+                                     Uh& hinfo,
+                                     double* gpu_time_used,
+                                     double* cpu_time_used,
+                                     const rocblas_int hot_calls,
+                                     const int profile,
+                                     const bool profile_kernels,
+                                     const bool perf)
+{
+    if(!perf)
+    {
+        symatfunc_hematfunc_initData<true, false, T>(handle, n, dA, lda, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            symatfunc_hematfunc_reference<T>(func, uplo, n, hA[b], lda, clamp, hinfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    symatfunc_hematfunc_initData<true, false, T>(handle, n, dA, lda, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        symatfunc_hematfunc_initData<false, true, T>(handle, n, dA, lda, bc, hA);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n, dA.data(),
+                                                          lda, stA, clamp, dinfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        symatfunc_hematfunc_initData<false, true, T>(handle, n, dA, lda, bc, hA);
+
+        start = get_time_us_sync(stream);
+        rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n, dA.data(), lda, stA, clamp,
+                                      dinfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_symatfunc_hematfunc(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char funcC = argus.get<char>("matfunc");
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    S clamp = S(argus.get<double>("clamp", 0));
+
+    rocblas_matfunc func = char2rocblas_matfunc(funcC);
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo == rocblas_fill_full)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n,
+                                                                (T* const*)nullptr, lda, stA, clamp,
+                                                                (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n,
+                                                                (T*)nullptr, lda, stA, clamp,
+                                                                (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_Ares = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n,
+                                                                (T* const*)nullptr, lda, stA, clamp,
+                                                                (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n,
+                                                                (T*)nullptr, lda, stA, clamp,
+                                                                (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n,
+                                                            (T* const*)nullptr, lda, stA, clamp,
+                                                            (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n,
+                                                            (T*)nullptr, lda, stA, clamp,
+                                                            (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<rocblas_int> hinfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hAres(size_Ares, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n,
+                                                                dA.data(), lda, stA, clamp,
+                                                                dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            symatfunc_hematfunc_getError<STRIDED, T>(handle, func, uplo, n, dA, lda, stA, clamp,
+                                                     dinfo, bc, hA, hAres, hinfo, hinfoRes,
+                                                     &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            symatfunc_hematfunc_getPerfData<STRIDED, T>(
+                handle, func, uplo, n, dA, lda, stA, clamp, dinfo, bc, hA, hinfo, &gpu_time_used,
+                &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hAres(size_Ares, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_symatfunc_hematfunc(STRIDED, handle, func, uplo, n,
+                                                                dA.data(), lda, stA, clamp,
+                                                                dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            symatfunc_hematfunc_getError<STRIDED, T>(handle, func, uplo, n, dA, lda, stA, clamp,
+                                                     dinfo, bc, hA, hAres, hinfo, hinfoRes,
+                                                     &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            symatfunc_hematfunc_getPerfData<STRIDED, T>(
+                handle, func, uplo, n, dA, lda, stA, clamp, dinfo, bc, hA, hinfo, &gpu_time_used,
+                &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("matfunc", "uplo", "n", "lda", "clamp", "batch_c");
+                rocsolver_bench_output(funcC, uploC, n, lda, clamp, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("matfunc", "uplo", "n", "lda", "strideA", "clamp",
+                                       "batch_c");
+                rocsolver_bench_output(funcC, uploC, n, lda, stA, clamp, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("matfunc", "uplo", "n", "lda", "clamp");
+                rocsolver_bench_output(funcC, uploC, n, lda, clamp);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
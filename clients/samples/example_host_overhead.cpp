@@ -0,0 +1,72 @@
+#include <rocsolver/rocsolver.h> // for all the rocsolver C interfaces and type declarations
+#include <stdio.h>   // for printf
+
+// Example: Measure the host-side overhead of the rocSOLVER API without touching the GPU
+
+// Prints the number of calls, mean time and histogram recorded for a phase of func_name
+void print_phase(const char* func_name, rocblas_log_phase phase, const char* phase_name) {
+  const rocblas_int hist_size = 8;
+  rocblas_int calls;
+  double total_time;
+  rocblas_int histogram[hist_size];
+  rocsolver_log_get_phase_stats(func_name, phase, &calls, &total_time, histogram, hist_size);
+
+  if (calls == 0)
+    return;
+
+  printf("  %-13s calls: %6d, mean: %8.3f us, histogram:", phase_name, calls,
+         total_time / calls);
+  // bin i counts the calls that took less than 2^i us (the last bin, the rest)
+  for (rocblas_int i = 0; i < hist_size; ++i)
+    printf(" %d", histogram[i]);
+  printf("\n");
+}
+
+// We call rocsolver_dgetrf and rocsolver_dpotrf repeatedly in device memory size query
+// mode, which checks the arguments and computes the workspace size on the host and returns
+// without launching any work, so that only the host-side phases are exercised.
+// See https://rocsolver.readthedocs.io/en/latest/userguide_logging.html
+// and https://rocsolver.readthedocs.io/en/latest/userguide_memory.html
+int main() {
+  const rocblas_int N = 64;       // size of the (never allocated) matrix
+  const rocblas_int lda = N;      // leading dimension
+  const int iterations = 10000;   // number of calls to each function
+
+  // initialization
+  rocblas_handle handle;
+  rocblas_create_handle(&handle);
+  rocsolver_log_begin();
+
+  // time the host-side phases of the API calls
+  rocsolver_log_set_layer_mode(rocblas_layer_mode_ex_log_phases);
+
+  // in device memory size query mode the pointers are not referenced
+  size_t size;
+  rocblas_start_device_memory_size_query(handle);
+  for (int i = 0; i < iterations; ++i) {
+    rocsolver_dgetrf(handle, N, N, nullptr, lda, nullptr, nullptr);
+    rocsolver_dpotrf(handle, rocblas_fill_lower, N, nullptr, lda, nullptr);
+  }
+  rocblas_stop_device_memory_size_query(handle, &size);
+
+  // calls with invalid arguments stop after the argument checking
+  for (int i = 0; i < iterations; ++i)
+    rocsolver_dgetrf(handle, N, N, nullptr, lda - 1, nullptr, nullptr);
+
+  // print the statistics
+  const char* names[] = {"rocsolver_dgetrf", "rocsolver_dpotrf"};
+  for (const char* name : names) {
+    printf("%s:\n", name);
+    print_phase(name, rocblas_log_phase_arg_check, "arg_check");
+    print_phase(name, rocblas_log_phase_memory_size, "memory_size");
+    print_phase(name, rocblas_log_phase_device_malloc, "device_malloc");
+    print_phase(name, rocblas_log_phase_init_scalars, "init_scalars");
+    print_phase(name, rocblas_log_phase_execution, "execution");
+    print_phase(name, rocblas_log_phase_pointer_mode, "pointer_mode");
+  }
+  printf("workspace size: %zu bytes\n", size);
+
+  // clean up (rocsolver_log_end also prints the phase records to the profile log)
+  rocsolver_log_end();
+  rocblas_destroy_handle(handle);
+}
@@ -159,6 +159,18 @@ constexpr auto rocblas2char_eorder(rocblas_eorder value)
     return '\0';
 }
 
+constexpr auto rocblas2char_matfunc(rocblas_matfunc value)
+{
+    switch(value)
+    {
+    case rocblas_matfunc_sqrt: return 'S';
+    case rocblas_matfunc_invsqrt: return 'I';
+    case rocblas_matfunc_exp: return 'E';
+    case rocblas_matfunc_log: return 'L';
+    }
+    return '\0';
+}
+
 // return precision string for rocblas_datatype
 constexpr auto rocblas2string_datatype(rocblas_datatype type)
 {
@@ -334,6 +346,18 @@ constexpr rocblas_eorder char2rocblas_eorder(char value)
     }
 }
 
+constexpr rocblas_matfunc char2rocblas_matfunc(char value)
+{
+    switch(value)
+    {
+    case 'S': return rocblas_matfunc_sqrt;
+    case 'I': return rocblas_matfunc_invsqrt;
+    case 'E': return rocblas_matfunc_exp;
+    case 'L': return rocblas_matfunc_log;
+    default: return static_cast<rocblas_matfunc>(-1);
+    }
+}
+
 // clang-format off
 inline rocblas_initialization string2rocblas_initialization(const std::string& value)
 {
@@ -0,0 +1,76 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    workspace_planner computes the layout of the device workspace of a
+ *    routine that executes a sequence of phases (typically, calls to other
+ *    internal routines). Every buffer is declared with the range of phases
+ *    during which its contents must be preserved, and buffers that are never
+ *    live at the same time are assigned overlapping addresses. The placement is
+ *    a greedy first-fit, so the total size is never larger than the sum of all
+ *    the buffers and never smaller than the peak of live memory, but it is not
+ *    guaranteed to attain that peak. The planner only works on the host; it
+ *    does not allocate memory.
+ * ===========================================================================
+ */
+
+class workspace_planner
+{
+public:
+    /*! \brief Alignment (in bytes) of the offset of every buffer in the workspace */
+    static constexpr size_t alignment = 256;
+
+    /*! \brief Declares a buffer of the given size (in bytes) that is live from phase
+        first to phase last (both included). Returns the id of the buffer. */
+    int add(size_t size, int first, int last);
+
+    /*! \brief Declares a buffer that is only live during the given phase. */
+    int add(size_t size, int phase)
+    {
+        return add(size, phase, phase);
+    }
+
+    /*! \brief Computes the offsets of all the declared buffers.
+        It is called implicitly by the query functions below. */
+    void plan();
+
+    /*! \brief Total size of the workspace (in bytes), including alignment padding. */
+    size_t size();
+
+    /*! \brief Size that the workspace would have if no buffer was aliased. */
+    size_t size_unaliased() const;
+
+    /*! \brief Maximum over all phases of the size of the live buffers.
+        It is a lower bound of size(). */
+    size_t size_peak() const;
+
+    /*! \brief Offset (in bytes) of the given buffer from the start of the workspace. */
+    size_t offset(int id);
+
+    /*! \brief Returns the address of the given buffer inside the workspace. */
+    template <typename P>
+    P pointer(void* work, int id)
+    {
+        return (P)((char*)work + offset(id));
+    }
+
+private:
+    struct buffer
+    {
+        size_t size;
+        int first;
+        int last;
+        size_t offset;
+    };
+
+    std::vector<buffer> buffers;
+    size_t total = 0;
+    bool planned = false;
+};
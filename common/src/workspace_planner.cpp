@@ -0,0 +1,113 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <numeric>
+
+#include "workspace_planner.hpp"
+
+static size_t align_up(size_t size)
+{
+    return (size + workspace_planner::alignment - 1) / workspace_planner::alignment
+        * workspace_planner::alignment;
+}
+
+int workspace_planner::add(size_t size, int first, int last)
+{
+    buffers.push_back({align_up(size), std::min(first, last), std::max(first, last), 0});
+    planned = false;
+    return int(buffers.size()) - 1;
+}
+
+/* Greedy placement by decreasing size: every buffer is put at the lowest offset that
+   does not overlap any of the already placed buffers with an intersecting lifetime.
+   Ties are broken by declaration order so that the layout is deterministic, as the
+   same plan is computed when querying the workspace size and when executing.
+   (This is a heuristic: fragmentation can leave the total above size_peak.) */
+void workspace_planner::plan()
+{
+    if(planned)
+        return;
+
+    const int count = buffers.size();
+    std::vector<int> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int a, int b) { return buffers[a].size > buffers[b].size; });
+
+    std::vector<int> placed, conflicts;
+    placed.reserve(count);
+    conflicts.reserve(count);
+    total = 0;
+
+    for(int id : order)
+    {
+        buffer& buf = buffers[id];
+        buf.offset = 0;
+        if(buf.size == 0)
+            continue;
+
+        // already placed buffers that are live at the same time
+        conflicts.clear();
+        for(int j : placed)
+        {
+            if(buffers[j].first <= buf.last && buf.first <= buffers[j].last)
+                conflicts.push_back(j);
+        }
+        std::sort(conflicts.begin(), conflicts.end(),
+                  [&](int a, int b) { return buffers[a].offset < buffers[b].offset; });
+
+        // first gap big enough to hold the buffer
+        size_t candidate = 0;
+        for(int j : conflicts)
+        {
+            if(buffers[j].offset >= candidate + buf.size)
+                break;
+            candidate = std::max(candidate, buffers[j].offset + buffers[j].size);
+        }
+
+        buf.offset = candidate;
+        total = std::max(total, candidate + buf.size);
+        placed.push_back(id);
+    }
+
+    planned = true;
+}
+
+size_t workspace_planner::size()
+{
+    plan();
+    return total;
+}
+
+size_t workspace_planner::size_unaliased() const
+{
+    size_t s = 0;
+    for(const buffer& buf : buffers)
+        s += buf.size;
+    return s;
+}
+
+size_t workspace_planner::size_peak() const
+{
+    // the live memory can only increase at the first phase of a buffer
+    size_t peak = 0;
+    for(const buffer& start : buffers)
+    {
+        size_t live = 0;
+        for(const buffer& buf : buffers)
+        {
+            if(buf.first <= start.first && start.first <= buf.last)
+                live += buf.size;
+        }
+        peak = std::max(peak, live);
+    }
+    return peak;
+}
+
+size_t workspace_planner::offset(int id)
+{
+    plan();
+    return buffers[id].offset;
+}
@@ -17,8 +17,27 @@ typedef uint32_t rocblas_layer_mode_flags;
 typedef enum rocblas_layer_mode_ex_
 {
     rocblas_layer_mode_ex_log_kernel = 0x10, /**< Enable logging for kernel calls. */
+    rocblas_layer_mode_ex_log_phases = 0x20, /**< Enable timing of the host-side phases of the
+                                                  API calls. */
 } rocblas_layer_mode_ex;
 
+/*! \brief Used to identify the host-side phases of an API call that are timed when the
+ *rocblas_layer_mode_ex_log_phases logging mode is enabled.
+ ********************************************************************************/
+typedef enum rocblas_log_phase_
+{
+    rocblas_log_phase_arg_check = 0, /**< Validation of the arguments. */
+    rocblas_log_phase_memory_size = 1, /**< Computation of the workspace sizes (and answer to
+                                            device memory size queries). */
+    rocblas_log_phase_device_malloc = 2, /**< Allocation of the workspace from the handle. */
+    rocblas_log_phase_init_scalars = 3, /**< Initialization of the constants used in rocBLAS
+                                             calls. */
+    rocblas_log_phase_execution = 4, /**< Enqueueing of the computations, including rocBLAS
+                                          calls. */
+    rocblas_log_phase_pointer_mode = 5, /**< Switching of the pointer mode of the handle (and
+                                             restoring of the original mode). */
+} rocblas_log_phase;
+
 /*! \brief Used to specify the order in which multiple Householder matrices are
  *applied together
  ********************************************************************************/
@@ -101,4 +120,14 @@ typedef enum rocblas_eorder_
                                       ordered from smallest to largest. */
 } rocblas_eorder;
 
+/*! \brief Used to specify the function of a symmetric/Hermitian matrix that is computed.
+ ********************************************************************************/
+typedef enum rocblas_matfunc_
+{
+    rocblas_matfunc_sqrt = 251, /**< Principal square root, \f$A^{1/2}\f$. */
+    rocblas_matfunc_invsqrt = 252, /**< Inverse of the principal square root, \f$A^{-1/2}\f$. */
+    rocblas_matfunc_exp = 253, /**< Matrix exponential, \f$\exp(A)\f$. */
+    rocblas_matfunc_log = 254, /**< Principal matrix logarithm, \f$\log(A)\f$. */
+} rocblas_matfunc;
+
 #endif /* ROCSOLVER_EXTRAS_H_ */
@@ -33,6 +33,8 @@ rocblas_status rocsolver_bdsqr_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftV = 0;
     rocblas_int shiftU = 0;
@@ -54,12 +56,16 @@ rocblas_status rocsolver_bdsqr_impl(rocblas_handle handle,
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_work);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void* work;
     rocblas_device_malloc mem(handle, size_work);
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     work = mem[0];
 
     // execution
@@ -11,6 +11,7 @@
 
 #include "../auxiliary/rocauxiliary_lacgv.hpp"
 #include "../auxiliary/rocauxiliary_larfg.hpp"
+#include "lapack_host_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
@@ -130,9 +131,11 @@ rocblas_status rocsolver_labrd_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // everything must be executed with scalars on the device
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     if(m >= n)
     {
@@ -140,19 +143,12 @@ rocblas_status rocsolver_labrd_template(rocblas_handle handle,
         for(rocblas_int j = 0; j < k; ++j)
         {
             // update column j of A
-            if(COMPLEX)
-                rocsolver_lacgv_template<T>(handle, j, Y, shiftY + idx2D(j, 0, ldy), ldy, strideY,
-                                            batch_count);
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_none, m - j, j,
-                                cast2constType<T>(scalars), 0, A, shiftA + idx2D(j, 0, lda), lda,
-                                strideA, Y, shiftY + idx2D(j, 0, ldy), ldy, strideY,
-                                cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j, j, lda), 1,
-                                strideA, batch_count, (T**)work_workArr);
+            rocsolver_gemv<T>(handle, rocblas_operation_none, COMPLEX, m - j, j,
+                              cast2constType<T>(scalars), 0, A, shiftA + idx2D(j, 0, lda), lda,
+                              strideA, Y, shiftY + idx2D(j, 0, ldy), ldy, strideY,
+                              cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j, j, lda), 1,
+                              strideA, batch_count, (T**)work_workArr);
 
-            if(COMPLEX)
-                rocsolver_lacgv_template<T>(handle, j, Y, shiftY + idx2D(j, 0, ldy), ldy, strideY,
-                                            batch_count);
             rocblasCall_gemv<T>(handle, rocblas_operation_none, m - j, j,
                                 cast2constType<T>(scalars), 0, X, shiftX + idx2D(j, 0, lda), ldx,
                                 strideX, A, shiftA + idx2D(0, j, lda), 1, strideA,
@@ -205,31 +201,22 @@ rocblas_status rocsolver_labrd_template(rocblas_handle handle,
 
                 // update row j of A
                 if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, n, A, shiftA + idx2D(j, 0, lda), lda,
-                                                strideA, batch_count);
-                rocblasCall_gemv<T>(
-                    handle, rocblas_operation_none, n - j - 1, j + 1, cast2constType<T>(scalars), 0,
-                    Y, shiftY + idx2D(j + 1, 0, ldy), ldy, strideY, A, shiftA + idx2D(j, 0, lda),
-                    lda, strideA, cast2constType<T>(scalars + 2), 0, A,
-                    shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count, (T**)work_workArr);
-
-                if(COMPLEX)
-                {
-                    rocsolver_lacgv_template<T>(handle, j + 1, A, shiftA + idx2D(j, 0, lda), lda,
-                                                strideA, batch_count);
-                    rocsolver_lacgv_template<T>(handle, j, X, shiftX + idx2D(j, 0, ldx), ldx,
-                                                strideX, batch_count);
-                }
-
-                rocblasCall_gemv<T>(
-                    handle, rocblas_operation_conjugate_transpose, j, n - j - 1,
-                    cast2constType<T>(scalars), 0, A, shiftA + idx2D(0, j + 1, lda), lda, strideA,
-                    X, shiftX + idx2D(j, 0, ldx), ldx, strideX, cast2constType<T>(scalars + 2), 0,
-                    A, shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count, (T**)work_workArr);
-
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, j, X, shiftX + idx2D(j, 0, ldx), ldx,
-                                                strideX, batch_count);
+                    rocsolver_lacgv_template<T>(handle, n - j - 1, A, shiftA + idx2D(j, j + 1, lda),
+                                                lda, strideA, batch_count);
+                rocsolver_gemv<T>(handle, rocblas_operation_none, COMPLEX, n - j - 1, j + 1,
+                                  cast2constType<T>(scalars), 0, Y, shiftY + idx2D(j + 1, 0, ldy),
+                                  ldy, strideY, A, shiftA + idx2D(j, 0, lda), lda, strideA,
+                                  cast2constType<T>(scalars + 2), 0, A,
+                                  shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count,
+                                  (T**)work_workArr);
+
+                rocsolver_gemv<T>(handle, rocblas_operation_conjugate_transpose, COMPLEX, j,
+                                  n - j - 1, cast2constType<T>(scalars), 0, A,
+                                  shiftA + idx2D(0, j + 1, lda), lda, strideA, X,
+                                  shiftX + idx2D(j, 0, ldx), ldx, strideX,
+                                  cast2constType<T>(scalars + 2), 0, A,
+                                  shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count,
+                                  (T**)work_workArr);
 
                 // generate Householder reflector to work on row j
                 rocsolver_larfg_template(
@@ -290,31 +277,20 @@ rocblas_status rocsolver_labrd_template(rocblas_handle handle,
         {
             // update row j of A
             if(COMPLEX)
-                rocsolver_lacgv_template<T>(handle, n, A, shiftA + idx2D(j, 0, lda), lda, strideA,
-                                            batch_count);
+                rocsolver_lacgv_template<T>(handle, n - j, A, shiftA + idx2D(j, j, lda), lda,
+                                            strideA, batch_count);
 
-            rocblasCall_gemv<T>(handle, rocblas_operation_none, n - j, j,
-                                cast2constType<T>(scalars), 0, Y, shiftY + idx2D(j, 0, ldy), ldy,
-                                strideY, A, shiftA + idx2D(j, 0, lda), lda, strideA,
-                                cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j, j, lda),
-                                lda, strideA, batch_count, (T**)work_workArr);
-
-            if(COMPLEX)
-            {
-                rocsolver_lacgv_template<T>(handle, j, A, shiftA + idx2D(j, 0, lda), lda, strideA,
-                                            batch_count);
-                rocsolver_lacgv_template<T>(handle, j, X, shiftX + idx2D(j, 0, ldx), ldx, strideX,
-                                            batch_count);
-            }
-            rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, j, n - j,
-                                cast2constType<T>(scalars), 0, A, shiftA + idx2D(0, j, lda), lda,
-                                strideA, X, shiftX + idx2D(j, 0, ldx), ldx, strideX,
-                                cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j, j, lda),
-                                lda, strideA, batch_count, (T**)work_workArr);
+            rocsolver_gemv<T>(handle, rocblas_operation_none, COMPLEX, n - j, j,
+                              cast2constType<T>(scalars), 0, Y, shiftY + idx2D(j, 0, ldy), ldy,
+                              strideY, A, shiftA + idx2D(j, 0, lda), lda, strideA,
+                              cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j, j, lda), lda,
+                              strideA, batch_count, (T**)work_workArr);
 
-            if(COMPLEX)
-                rocsolver_lacgv_template<T>(handle, j, X, shiftX + idx2D(j, 0, ldx), ldx, strideX,
-                                            batch_count);
+            rocsolver_gemv<T>(handle, rocblas_operation_conjugate_transpose, COMPLEX, j, n - j,
+                              cast2constType<T>(scalars), 0, A, shiftA + idx2D(0, j, lda), lda,
+                              strideA, X, shiftX + idx2D(j, 0, ldx), ldx, strideX,
+                              cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j, j, lda), lda,
+                              strideA, batch_count, (T**)work_workArr);
 
             // generate Householder reflector to work on row j
             rocsolver_larfg_template(handle,
@@ -361,23 +337,16 @@ rocblas_status rocsolver_labrd_template(rocblas_handle handle,
                                     shiftX + idx2D(j + 1, j, ldx), 1, strideX, batch_count);
 
                 if(COMPLEX)
-                {
                     rocsolver_lacgv_template<T>(handle, n - j, A, shiftA + idx2D(j, j, lda), lda,
                                                 strideA, batch_count);
-                    // update column j of A
-                    rocsolver_lacgv_template<T>(handle, j, Y, shiftY + idx2D(j, 0, ldy), ldy,
-                                                strideY, batch_count);
-                }
 
-                rocblasCall_gemv<T>(
-                    handle, rocblas_operation_none, m - j - 1, j, cast2constType<T>(scalars), 0, A,
-                    shiftA + idx2D(j + 1, 0, lda), lda, strideA, Y, shiftY + idx2D(j, 0, ldy), ldy,
-                    strideY, cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j + 1, j, lda), 1,
-                    strideA, batch_count, (T**)work_workArr);
-
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, j, Y, shiftY + idx2D(j, 0, ldy), ldy,
-                                                strideY, batch_count);
+                // update column j of A
+                rocsolver_gemv<T>(handle, rocblas_operation_none, COMPLEX, m - j - 1, j,
+                                  cast2constType<T>(scalars), 0, A, shiftA + idx2D(j + 1, 0, lda),
+                                  lda, strideA, Y, shiftY + idx2D(j, 0, ldy), ldy, strideY,
+                                  cast2constType<T>(scalars + 2), 0, A,
+                                  shiftA + idx2D(j + 1, j, lda), 1, strideA, batch_count,
+                                  (T**)work_workArr);
 
                 rocblasCall_gemv<T>(
                     handle, rocblas_operation_none, m - j - 1, j + 1, cast2constType<T>(scalars), 0,
@@ -440,6 +409,8 @@ rocblas_status rocsolver_labrd_template(rocblas_handle handle,
         }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
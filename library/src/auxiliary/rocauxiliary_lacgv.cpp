@@ -18,6 +18,8 @@ rocblas_status
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftx = 0;
 
@@ -29,6 +31,8 @@ rocblas_status
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_status_size_unchanged;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_lacgv_template<T>(handle, n, x, shiftx, incx, stridex, batch_count);
 }
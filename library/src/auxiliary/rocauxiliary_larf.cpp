@@ -25,6 +25,8 @@ rocblas_status rocsolver_larf_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftx = 0;
@@ -48,18 +50,24 @@ rocblas_status rocsolver_larf_impl(rocblas_handle handle,
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_Abyx, size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *Abyx, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_Abyx, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     Abyx = mem[1];
     workArr = mem[2];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_larf_template<T>(handle, side, m, n, x, shiftx, incx, stridex, alpha, stridep,
                                       A, shiftA, lda, stridea, batch_count, (T*)scalars, (T*)Abyx,
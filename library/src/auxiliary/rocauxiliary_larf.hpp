@@ -113,9 +113,11 @@ rocblas_status rocsolver_larf_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // everything must be executed with scalars on the device
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // determine side and order of H
     bool leftside = (side == rocblas_side_left);
@@ -149,6 +151,8 @@ rocblas_status rocsolver_larf_template(rocblas_handle handle,
                                     incx, stridex, A, shiftA, lda, stridea, batch_count, workArr);
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
@@ -32,6 +32,8 @@ rocblas_status rocsolver_larfb_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftV = 0;
     rocblas_int shiftA = 0;
@@ -54,12 +56,16 @@ rocblas_status rocsolver_larfb_impl(rocblas_handle handle,
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_tmptr, size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *tmptr, *workArr;
     rocblas_device_malloc mem(handle, size_tmptr, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     tmptr = mem[0];
     workArr = mem[1];
 
@@ -184,9 +184,11 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
     T *Vp, *Fp;
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // constants to use when calling rocablas functions
     T minone = -1;
@@ -352,6 +354,8 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
     ROCSOLVER_LAUNCH_KERNEL(addmatA1, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0, stream,
                             ldw, order, A, offsetA1, lda, strideA, tmptr);
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
@@ -23,6 +23,8 @@ rocblas_status rocsolver_larfg_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shifta = 0;
     rocblas_int shiftx = 0;
@@ -42,12 +44,16 @@ rocblas_status rocsolver_larfg_impl(rocblas_handle handle,
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_work, size_norms);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *work, *norms;
     rocblas_device_malloc mem(handle, size_work, size_norms);
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     work = mem[0];
     norms = mem[1];
 
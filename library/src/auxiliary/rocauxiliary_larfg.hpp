@@ -181,9 +181,11 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle,
     }
 
     // everything must be executed with scalars on the device
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // compute squared norm of x
     rocblasCall_dot<COMPLEX, T>(handle, n - 1, x, shiftx, incx, stridex, x, shiftx, incx, stridex,
@@ -197,6 +199,8 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle,
     // compute vector v=x*norms
     rocblasCall_scal<T>(handle, n - 1, norms, 1, x, shiftx, incx, stridex, batch_count);
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
@@ -27,6 +27,8 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftV = 0;
 
@@ -49,18 +51,24 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle,
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_work, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work = mem[1];
     workArr = mem[2];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_larft_template<T>(handle, direct, storev, n, k, V, shiftV, ldv, stridev, tau,
                                        stridet, F, ldf, stridef, batch_count, (T*)scalars, (T*)work,
@@ -9,7 +9,7 @@
 
 #pragma once
 
-#include "rocauxiliary_lacgv.hpp"
+#include "lapack_host_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
@@ -235,9 +235,11 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // everything must be executed with scalars on the device
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     rocblas_stride stridew = rocblas_stride(k);
     rocblas_diagonal diag = rocblas_diagonal_non_unit;
@@ -276,19 +278,11 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
             }
             else
             {
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, n - i - 1, V, shiftV + idx2D(i, i + 1, ldv),
-                                                ldv, strideV, batch_count);
-
                 trans = rocblas_operation_none;
-                rocblasCall_gemv<T>(handle, trans, i, n - 1 - i, tau + i, strideT, V,
-                                    shiftV + idx2D(0, i + 1, ldv), ldv, strideV, V,
-                                    shiftV + idx2D(i, i + 1, ldv), ldv, strideV, scalars + 2, 0, F,
-                                    idx2D(0, i, ldf), 1, strideF, batch_count, workArr);
-
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, n - i - 1, V, shiftV + idx2D(i, i + 1, ldv),
-                                                ldv, strideV, batch_count);
+                rocsolver_gemv<T>(handle, trans, COMPLEX, i, n - 1 - i, tau + i, strideT, V,
+                                  shiftV + idx2D(0, i + 1, ldv), ldv, strideV, V,
+                                  shiftV + idx2D(i, i + 1, ldv), ldv, strideV, scalars + 2, 0, F,
+                                  idx2D(0, i, ldf), 1, strideF, batch_count, workArr);
             }
 
             // multiply by the previous triangular factor
@@ -319,19 +313,11 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
             }
             else
             {
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, n - k + i, V, shiftV + idx2D(i, 0, ldv),
-                                                ldv, strideV, batch_count);
-
                 trans = rocblas_operation_none;
-                rocblasCall_gemv<T>(handle, trans, k - i - 1, n - k + i, tau + i, strideT, V,
-                                    shiftV + idx2D(i + 1, 0, ldv), ldv, strideV, V,
-                                    shiftV + idx2D(i, 0, ldv), ldv, strideV, scalars + 2, 0, F,
-                                    idx2D(i + 1, i, ldf), 1, strideF, batch_count, workArr);
-
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, n - k + i, V, shiftV + idx2D(i, 0, ldv),
-                                                ldv, strideV, batch_count);
+                rocsolver_gemv<T>(handle, trans, COMPLEX, k - i - 1, n - k + i, tau + i, strideT, V,
+                                  shiftV + idx2D(i + 1, 0, ldv), ldv, strideV, V,
+                                  shiftV + idx2D(i, 0, ldv), ldv, strideV, scalars + 2, 0, F,
+                                  idx2D(i + 1, i, ldf), 1, strideF, batch_count, workArr);
             }
 
             // multiply by the previous triangular factor
@@ -346,6 +332,8 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
     ROCSOLVER_LAUNCH_KERNEL(set_tau, dim3(blocks, batch_count), dim3(32, 1), 0, stream, k, tau,
                             strideT);
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
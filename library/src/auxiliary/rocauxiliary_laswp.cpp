@@ -24,6 +24,8 @@ rocblas_status rocsolver_laswp_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftP = 0;
@@ -37,6 +39,8 @@ rocblas_status rocsolver_laswp_impl(rocblas_handle handle,
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_status_size_unchanged;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_laswp_template<T>(handle, n, A, shiftA, lda, strideA, k1, k2, ipiv, shiftP,
                                        strideP, incx, batch_count);
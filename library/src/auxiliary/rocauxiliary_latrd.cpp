@@ -26,6 +26,8 @@ rocblas_status rocsolver_latrd_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftW = 0;
@@ -51,6 +53,8 @@ rocblas_status rocsolver_latrd_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_norms,
                                                       size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work, *norms, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_work, size_norms, size_workArr);
@@ -58,6 +62,8 @@ rocblas_status rocsolver_latrd_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work = mem[1];
     norms = mem[2];
@@ -65,6 +71,8 @@ rocblas_status rocsolver_latrd_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_latrd_template<T>(handle, uplo, n, k, A, shiftA, lda, strideA, E, strideE, tau,
                                        strideP, W, shiftW, ldw, strideW, batch_count, (T*)scalars,
@@ -9,8 +9,8 @@
 
 #pragma once
 
-#include "../auxiliary/rocauxiliary_lacgv.hpp"
 #include "../auxiliary/rocauxiliary_larfg.hpp"
+#include "lapack_host_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
@@ -120,9 +120,11 @@ rocblas_status rocsolver_latrd_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // everything must be executed with scalars on the device
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // configure kernels
     rocblas_int blocks = (batch_count - 1) / BS1 + 1;
@@ -138,33 +140,17 @@ rocblas_status rocsolver_latrd_template(rocblas_handle handle,
         for(rocblas_int j = 0; j < k; ++j)
         {
             // update column j of A with reflector computed in step j-1
-            if(COMPLEX)
-                rocsolver_lacgv_template<T>(handle, j, W, shiftW + idx2D(j, 0, ldw), ldw, strideW,
-                                            batch_count);
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_none, n - j, j,
-                                cast2constType<T>(scalars), 0, A, shiftA + idx2D(j, 0, lda), lda,
-                                strideA, W, shiftW + idx2D(j, 0, ldw), ldw, strideW,
-                                cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j, j, lda), 1,
-                                strideA, batch_count, workArr);
-
-            if(COMPLEX)
-            {
-                rocsolver_lacgv_template<T>(handle, j, W, shiftW + idx2D(j, 0, ldw), ldw, strideW,
-                                            batch_count);
-                rocsolver_lacgv_template<T>(handle, j, A, shiftA + idx2D(j, 0, lda), lda, strideA,
-                                            batch_count);
-            }
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_none, n - j, j,
-                                cast2constType<T>(scalars), 0, W, shiftW + idx2D(j, 0, ldw), ldw,
-                                strideW, A, shiftA + idx2D(j, 0, lda), lda, strideA,
-                                cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j, j, lda), 1,
-                                strideA, batch_count, workArr);
-
-            if(COMPLEX)
-                rocsolver_lacgv_template<T>(handle, j, A, shiftA + idx2D(j, 0, lda), lda, strideA,
-                                            batch_count);
+            rocsolver_gemv<T>(handle, rocblas_operation_none, COMPLEX, n - j, j,
+                              cast2constType<T>(scalars), 0, A, shiftA + idx2D(j, 0, lda), lda,
+                              strideA, W, shiftW + idx2D(j, 0, ldw), ldw, strideW,
+                              cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j, j, lda), 1,
+                              strideA, batch_count, workArr);
+
+            rocsolver_gemv<T>(handle, rocblas_operation_none, COMPLEX, n - j, j,
+                              cast2constType<T>(scalars), 0, W, shiftW + idx2D(j, 0, ldw), ldw,
+                              strideW, A, shiftA + idx2D(j, 0, lda), lda, strideA,
+                              cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j, j, lda), 1,
+                              strideA, batch_count, workArr);
 
             // generate Householder reflector to work on column j
             rocsolver_larfg_template(handle, n - j - 1, A, shiftA + idx2D(j + 1, j, lda), A,
@@ -230,33 +216,17 @@ rocblas_status rocsolver_latrd_template(rocblas_handle handle,
         {
             jw = j - n + k;
             // update column j of A with reflector computed in step j-1
-            if(COMPLEX)
-                rocsolver_lacgv_template<T>(handle, n - 1 - j, W, shiftW + idx2D(j, jw + 1, ldw),
-                                            ldw, strideW, batch_count);
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_none, j + 1, n - 1 - j,
-                                cast2constType<T>(scalars), 0, A, shiftA + idx2D(0, j + 1, lda),
-                                lda, strideA, W, shiftW + idx2D(j, jw + 1, ldw), ldw, strideW,
-                                cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(0, j, lda), 1,
-                                strideA, batch_count, workArr);
-
-            if(COMPLEX)
-            {
-                rocsolver_lacgv_template<T>(handle, n - 1 - j, W, shiftW + idx2D(j, jw + 1, ldw),
-                                            ldw, strideW, batch_count);
-                rocsolver_lacgv_template<T>(handle, n - 1 - j, A, shiftA + idx2D(j, j + 1, lda),
-                                            lda, strideA, batch_count);
-            }
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_none, j + 1, n - 1 - j,
-                                cast2constType<T>(scalars), 0, W, shiftW + idx2D(0, jw + 1, ldw),
-                                ldw, strideW, A, shiftA + idx2D(j, j + 1, lda), lda, strideA,
-                                cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(0, j, lda), 1,
-                                strideA, batch_count, workArr);
-
-            if(COMPLEX)
-                rocsolver_lacgv_template<T>(handle, n - 1 - j, A, shiftA + idx2D(j, j + 1, lda),
-                                            lda, strideA, batch_count);
+            rocsolver_gemv<T>(handle, rocblas_operation_none, COMPLEX, j + 1, n - 1 - j,
+                              cast2constType<T>(scalars), 0, A, shiftA + idx2D(0, j + 1, lda), lda,
+                              strideA, W, shiftW + idx2D(j, jw + 1, ldw), ldw, strideW,
+                              cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(0, j, lda), 1,
+                              strideA, batch_count, workArr);
+
+            rocsolver_gemv<T>(handle, rocblas_operation_none, COMPLEX, j + 1, n - 1 - j,
+                              cast2constType<T>(scalars), 0, W, shiftW + idx2D(0, jw + 1, ldw), ldw,
+                              strideW, A, shiftA + idx2D(j, j + 1, lda), lda, strideA,
+                              cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(0, j, lda), 1,
+                              strideA, batch_count, workArr);
 
             // generate Householder reflector to work on column j
             rocsolver_larfg_template(handle, j, A, shiftA + idx2D(j - 1, j, lda), A,
@@ -313,6 +283,8 @@ rocblas_status rocsolver_latrd_template(rocblas_handle handle,
         }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
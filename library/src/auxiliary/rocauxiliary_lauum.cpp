@@ -0,0 +1,88 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocauxiliary_lauum.hpp"
+
+template <typename T>
+rocblas_status rocsolver_lauum_impl(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    T* A,
+                                    const rocblas_int lda)
+{
+    ROCSOLVER_ENTER_TOP("lauum", "--uplo", uplo, "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_lauum_argCheck(handle, uplo, n, lda, A);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not requiere memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_lauum_template<false, false, T>(handle, uplo, n, A, shiftA, lda, strideA,
+                                                     batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_slauum(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda)
+{
+    return rocsolver_lauum_impl<float>(handle, uplo, n, A, lda);
+}
+
+rocblas_status rocsolver_dlauum(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda)
+{
+    return rocsolver_lauum_impl<double>(handle, uplo, n, A, lda);
+}
+
+rocblas_status rocsolver_clauum(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda)
+{
+    return rocsolver_lauum_impl<rocblas_float_complex>(handle, uplo, n, A, lda);
+}
+
+rocblas_status rocsolver_zlauum(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda)
+{
+    return rocsolver_lauum_impl<rocblas_double_complex>(handle, uplo, n, A, lda);
+}
+
+} // extern C
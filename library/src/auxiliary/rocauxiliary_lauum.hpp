@@ -0,0 +1,203 @@
+/* ************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** LAUU2_KERNEL computes the product U * U' or L' * L of a triangular block
+    of at most LAUUM_LAUU2_SWITCHSIZE columns. The block is read into shared memory
+    (with zeros in the opposite triangle) so that the result can overwrite the
+    factor in global memory. Each thread computes one element of the resulting
+    triangle. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(LAUUM_LAUU2_SWITCHSIZE * LAUUM_LAUU2_SWITCHSIZE)
+    lauu2_kernel(const rocblas_fill uplo,
+                 const rocblas_int n,
+                 U AA,
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA)
+{
+    const int bid = hipBlockIdx_z;
+    const int i = hipThreadIdx_x;
+    const int j = hipThreadIdx_y;
+    const int ld = LAUUM_LAUU2_SWITCHSIZE;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+    // shared memory setup
+    __shared__ T sA[LAUUM_LAUU2_SWITCHSIZE * LAUUM_LAUU2_SWITCHSIZE];
+
+    const bool lower = (uplo == rocblas_fill_lower);
+    const bool intri = (i < n && j < n && (lower ? i >= j : i <= j));
+
+    sA[i + j * ld] = intri ? A[i + j * lda] : T(0);
+    __syncthreads();
+
+    if(intri)
+    {
+        T temp = 0;
+
+        if(lower)
+        {
+            // (L' * L)_ij = sum_{k >= i} conj(L_ki) * L_kj
+            for(rocblas_int k = i; k < n; k++)
+                temp += conj(sA[k + i * ld]) * sA[k + j * ld];
+        }
+        else
+        {
+            // (U * U')_ij = sum_{k >= j} U_ik * conj(U_jk)
+            for(rocblas_int k = j; k < n; k++)
+                temp += sA[i + k * ld] * conj(sA[j + k * ld]);
+        }
+
+        A[i + j * lda] = temp;
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_lauum_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(n && !A)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** LAUUM_RECURSIVE overwrites the triangular factor with U * U' or L' * L.
+    With A11 the leading n1-by-n1 block and A22 the trailing block, the
+    lower case is computed in place as
+
+        A11 <- lauum(A11) + A21' * A21     (LAUUM, HERK)
+        A21 <- A22' * A21                  (TRMM)
+        A22 <- lauum(A22)                  (LAUUM)
+
+    (and analogously for the upper case), so that all the work outside the
+    small diagonal blocks is done by BLAS-3 calls with no workspace. **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void rocsolver_lauum_recursive(rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               U A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // if small size, use the unblocked kernel
+    if(n <= LAUUM_LAUU2_SWITCHSIZE)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(lauu2_kernel<T>, dim3(1, 1, batch_count),
+                                dim3(LAUUM_LAUU2_SWITCHSIZE, LAUUM_LAUU2_SWITCHSIZE, 1), 0, stream,
+                                uplo, n, A, shiftA, lda, strideA);
+        return;
+    }
+
+    // constants in host memory
+    T one = 1;
+    S s_one = 1;
+
+    // size of the leading block
+    rocblas_int n1 = ((n / 2 - 1) / LAUUM_LAUU2_SWITCHSIZE + 1) * LAUUM_LAUU2_SWITCHSIZE;
+    rocblas_int n2 = n - n1;
+
+    rocsolver_lauum_recursive<BATCHED, STRIDED, T>(handle, uplo, n1, A, shiftA, lda, strideA,
+                                                   batch_count);
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // A11 <- A11 + A12 * A12'
+        rocblasCall_syrk_herk<T>(handle, uplo, rocblas_operation_none, n1, n2, &s_one, A,
+                                 shiftA + idx2D(0, n1, lda), lda, strideA, &s_one, A, shiftA, lda,
+                                 strideA, batch_count);
+
+        // A12 <- A12 * A22'
+        rocblasCall_trmm<BATCHED, STRIDED, T>(
+            handle, rocblas_side_right, uplo, rocblas_operation_conjugate_transpose,
+            rocblas_diagonal_non_unit, n1, n2, &one, 0, A, shiftA + idx2D(n1, n1, lda), lda,
+            strideA, A, shiftA + idx2D(0, n1, lda), lda, strideA, batch_count);
+    }
+    else
+    {
+        // A11 <- A11 + A21' * A21
+        rocblasCall_syrk_herk<T>(handle, uplo, rocblas_operation_conjugate_transpose, n1, n2,
+                                 &s_one, A, shiftA + idx2D(n1, 0, lda), lda, strideA, &s_one, A,
+                                 shiftA, lda, strideA, batch_count);
+
+        // A21 <- A22' * A21
+        rocblasCall_trmm<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, uplo, rocblas_operation_conjugate_transpose,
+            rocblas_diagonal_non_unit, n2, n1, &one, 0, A, shiftA + idx2D(n1, n1, lda), lda,
+            strideA, A, shiftA + idx2D(n1, 0, lda), lda, strideA, batch_count);
+    }
+
+    rocsolver_lauum_recursive<BATCHED, STRIDED, T>(handle, uplo, n2, A, shiftA + idx2D(n1, n1, lda),
+                                                   lda, strideA, batch_count);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_lauum_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("lauum", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    rocsolver_lauum_recursive<BATCHED, STRIDED, T>(handle, uplo, n, A, shiftA, lda, strideA,
+                                                   batch_count);
+
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    return rocblas_status_success;
+}
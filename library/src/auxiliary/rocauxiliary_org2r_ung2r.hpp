@@ -122,9 +122,11 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // everything must be executed with scalars on the device
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // Initialize identity matrix (non used columns)
     rocblas_int blocksx = (m - 1) / 32 + 1;
@@ -161,6 +163,8 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
                                 ipiv, strideP);
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
@@ -24,6 +24,8 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -50,6 +52,8 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work,
                                                       size_Abyx_tmptr, size_trfact, size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work, *Abyx_tmptr, *trfact, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_work, size_Abyx_tmptr, size_trfact,
@@ -57,6 +61,8 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work = mem[1];
     Abyx_tmptr = mem[2];
@@ -65,6 +71,8 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_orglq_unglq_template<false, false, T>(
         handle, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, batch_count, (T*)scalars, (T*)work,
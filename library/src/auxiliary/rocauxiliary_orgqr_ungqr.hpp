@@ -82,7 +82,11 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
                                               T* work,
                                               T* Abyx_tmptr,
                                               T* trfact,
-                                              T** workArr)
+                                              T** workArr,
+                                              T* Tstored = nullptr,
+                                              const rocblas_int nb = 0,
+                                              const rocblas_int ldt = 0,
+                                              const rocblas_stride strideT = 0)
 {
     ROCSOLVER_ENTER("orgqr_ungqr", "m:", m, "n:", n, "k:", k, "shiftA:", shiftA, "lda:", lda,
                     "bc:", batch_count);
@@ -95,16 +99,22 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // if the matrix is small, use the unblocked variant of the algorithm
-    if(k <= xxGQx_xxGQx2_SWITCHSIZE)
+    // (when the triangular factors are provided, always use the blocked variant)
+    if(Tstored ? k == 0 : k <= xxGQx_xxGQx2_SWITCHSIZE)
         return rocsolver_org2r_ung2r_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv,
                                                  strideP, batch_count, scalars, Abyx_tmptr, workArr);
 
-    rocblas_int ldw = xxGQx_BLOCKSIZE;
-    rocblas_stride strideW = rocblas_stride(ldw) * ldw;
+    // if the triangular factors are provided (as computed by GEQRT), the block size
+    // is given by the factorization, all the reflectors are applied by blocks,
+    // and no factor needs to be re-generated
+    rocblas_int ldw = Tstored ? nb : xxGQx_BLOCKSIZE;
+    rocblas_int ldf = Tstored ? ldt : ldw;
+    rocblas_stride strideF = Tstored ? strideT : rocblas_stride(ldw) * ldw;
 
     // start of first blocked block
     rocblas_int jb = ldw;
-    rocblas_int j = ((k - xxGQx_xxGQx2_SWITCHSIZE - 1) / jb) * jb;
+    rocblas_int j = Tstored ? (k - 1) / jb : (k - xxGQx_xxGQx2_SWITCHSIZE - 1) / jb;
+    j *= jb;
 
     // start of the unblocked block
     rocblas_int kk = min(k, j + jb);
@@ -128,19 +138,32 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
     // compute the blocked part
     while(j >= 0)
     {
+        // (only the last block may be smaller, when the factors are provided)
+        rocblas_int ib = min(jb, k - j);
+
         // first update the already computed part
         // applying the current block reflector using larft + larfb
-        if(j + jb < n)
+        // (or the stored triangular factor + larfb)
+        if(j + ib < n)
         {
-            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise,
-                                        m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                        (ipiv + j), strideP, trfact, ldw, strideW, batch_count,
-                                        scalars, work, workArr);
+            T* F = trfact;
+            rocblas_int shiftF = 0;
+            if(Tstored)
+            {
+                F = Tstored;
+                shiftF = idx2D(0, j, ldt);
+            }
+            else
+                rocsolver_larft_template<T>(handle, rocblas_forward_direction,
+                                            rocblas_column_wise, m - j, ib, A,
+                                            shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j),
+                                            strideP, trfact, ldw, strideF, batch_count, scalars,
+                                            work, workArr);
 
             rocsolver_larfb_template<BATCHED, STRIDED, T>(
                 handle, rocblas_side_left, rocblas_operation_none, rocblas_forward_direction,
-                rocblas_column_wise, m - j, n - j - jb, jb, A, shiftA + idx2D(j, j, lda), lda,
-                strideA, trfact, 0, ldw, strideW, A, shiftA + idx2D(j, j + jb, lda), lda, strideA,
+                rocblas_column_wise, m - j, n - j - ib, ib, A, shiftA + idx2D(j, j, lda), lda,
+                strideA, F, shiftF, ldf, strideF, A, shiftA + idx2D(j, j + ib, lda), lda, strideA,
                 batch_count, Abyx_tmptr, workArr);
         }
 
@@ -149,11 +172,11 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
         if(j > 0)
         {
             blocksx = (j - 1) / 32 + 1;
-            blocksy = (jb - 1) / 32 + 1;
+            blocksy = (ib - 1) / 32 + 1;
             ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
-                                    0, stream, j, jb, A, shiftA + idx2D(0, j, lda), lda, strideA);
+                                    0, stream, j, ib, A, shiftA + idx2D(0, j, lda), lda, strideA);
         }
-        rocsolver_org2r_ung2r_template<T>(handle, m - j, jb, jb, A, shiftA + idx2D(j, j, lda), lda,
+        rocsolver_org2r_ung2r_template<T>(handle, m - j, ib, ib, A, shiftA + idx2D(j, j, lda), lda,
                                           strideA, (ipiv + j), strideP, batch_count, scalars,
                                           Abyx_tmptr, workArr);
 
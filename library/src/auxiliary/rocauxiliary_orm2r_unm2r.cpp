@@ -30,6 +30,8 @@ rocblas_status rocsolver_orm2r_unm2r_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftC = 0;
@@ -56,12 +58,16 @@ rocblas_status rocsolver_orm2r_unm2r_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_Abyx, size_diag,
                                                       size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *Abyx, *diag, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_Abyx, size_diag, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     Abyx = mem[1];
     diag = mem[2];
@@ -69,6 +75,8 @@ rocblas_status rocsolver_orm2r_unm2r_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_orm2r_unm2r_template<T>(handle, side, trans, m, n, k, A, shiftA, lda, strideA,
                                              ipiv, strideP, C, shiftC, ldc, strideC, batch_count,
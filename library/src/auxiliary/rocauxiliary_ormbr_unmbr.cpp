@@ -31,6 +31,8 @@ rocblas_status rocsolver_ormbr_unmbr_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftC = 0;
@@ -55,6 +57,8 @@ rocblas_status rocsolver_ormbr_unmbr_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_AbyxORwork,
                                                       size_diagORtmptr, size_trfact, size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *AbyxORwork, *diagORtmptr, *trfact, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_AbyxORwork, size_diagORtmptr, size_trfact,
@@ -62,6 +66,8 @@ rocblas_status rocsolver_ormbr_unmbr_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     AbyxORwork = mem[1];
     diagORtmptr = mem[2];
@@ -70,6 +76,8 @@ rocblas_status rocsolver_ormbr_unmbr_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_ormbr_unmbr_template<false, false, T>(
         handle, storev, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc,
@@ -30,6 +30,8 @@ rocblas_status rocsolver_ormlq_unmlq_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftC = 0;
@@ -57,6 +59,8 @@ rocblas_status rocsolver_ormlq_unmlq_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_AbyxORwork,
                                                       size_diagORtmptr, size_trfact, size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *AbyxORwork, *diagORtmptr, *trfact, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_AbyxORwork, size_diagORtmptr, size_trfact,
@@ -64,6 +68,8 @@ rocblas_status rocsolver_ormlq_unmlq_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     AbyxORwork = mem[1];
     diagORtmptr = mem[2];
@@ -72,6 +78,8 @@ rocblas_status rocsolver_ormlq_unmlq_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_ormlq_unmlq_template<false, false, T>(
         handle, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc,
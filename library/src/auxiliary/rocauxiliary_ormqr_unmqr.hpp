@@ -83,7 +83,11 @@ rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle,
                                               T* AbyxORwork,
                                               T* diagORtmptr,
                                               T* trfact,
-                                              T** workArr)
+                                              T** workArr,
+                                              T* Tstored = nullptr,
+                                              const rocblas_int nb = 0,
+                                              const rocblas_int ldt = 0,
+                                              const rocblas_stride strideT = 0)
 {
     ROCSOLVER_ENTER("ormqr_unmqr", "side:", side, "trans:", trans, "m:", m, "n:", n, "k:", k,
                     "shiftA:", shiftA, "lda:", lda, "shiftC:", shiftC, "ldc:", ldc,
@@ -97,13 +101,17 @@ rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // if the matrix is small, use the unblocked variant of the algorithm
-    if(k <= xxMQx_BLOCKSIZE)
+    // (when the triangular factors are provided, always use the blocked variant)
+    if(!Tstored && k <= xxMQx_BLOCKSIZE)
         return rocsolver_orm2r_unm2r_template<T>(
             handle, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc,
             strideC, batch_count, scalars, AbyxORwork, diagORtmptr, workArr);
 
-    rocblas_int ldw = xxMQx_BLOCKSIZE;
-    rocblas_stride strideW = rocblas_stride(ldw) * ldw;
+    // if the triangular factors are provided (as computed by GEQRT), the block size
+    // is given by the factorization and no factor needs to be re-generated
+    rocblas_int ldw = Tstored ? nb : xxMQx_BLOCKSIZE;
+    rocblas_int ldf = Tstored ? ldt : ldw;
+    rocblas_stride strideF = Tstored ? strideT : rocblas_stride(ldw) * ldw;
 
     // determine limits and indices
     bool left = (side == rocblas_side_left);
@@ -159,14 +167,24 @@ rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle,
         }
 
         // generate triangular factor of current block reflector
-        rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise, nq - i,
-                                    ib, A, shiftA + idx2D(i, i, lda), lda, strideA, ipiv + i, strideP,
-                                    trfact, ldw, strideW, batch_count, scalars, AbyxORwork, workArr);
+        // (or use the stored one)
+        T* F = trfact;
+        rocblas_int shiftF = 0;
+        if(Tstored)
+        {
+            F = Tstored;
+            shiftF = idx2D(0, i, ldt);
+        }
+        else
+            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise,
+                                        nq - i, ib, A, shiftA + idx2D(i, i, lda), lda, strideA,
+                                        ipiv + i, strideP, trfact, ldw, strideF, batch_count,
+                                        scalars, AbyxORwork, workArr);
 
         // apply current block reflector
         rocsolver_larfb_template<BATCHED, STRIDED, T>(
             handle, side, trans, rocblas_forward_direction, rocblas_column_wise, nrow, ncol, ib, A,
-            shiftA + idx2D(i, i, lda), lda, strideA, trfact, 0, ldw, strideW, C,
+            shiftA + idx2D(i, i, lda), lda, strideA, F, shiftF, ldf, strideF, C,
             shiftC + idx2D(ic, jc, ldc), ldc, strideC, batch_count, diagORtmptr, workArr);
     }
 
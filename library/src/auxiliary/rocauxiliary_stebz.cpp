@@ -35,6 +35,8 @@ rocblas_status rocsolver_stebz_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftD = 0;
     rocblas_int shiftE = 0;
@@ -56,6 +58,8 @@ rocblas_status rocsolver_stebz_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_work, size_pivmin, size_Esqr,
                                                       size_bounds, size_inter, size_ninter);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *work, *pivmin, *Esqr, *bounds, *inter, *ninter;
     rocblas_device_malloc mem(handle, size_work, size_pivmin, size_Esqr, size_bounds, size_inter,
@@ -63,6 +67,8 @@ rocblas_status rocsolver_stebz_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     work = mem[0];
     pivmin = mem[1];
     Esqr = mem[2];
@@ -24,6 +24,8 @@ rocblas_status rocsolver_stedc_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftD = 0;
     rocblas_int shiftE = 0;
@@ -49,12 +51,16 @@ rocblas_status rocsolver_stedc_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_work_stack, size_tempvect,
                                                       size_tempgemm, size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *work_stack, *tempvect, *tempgemm, *workArr;
     rocblas_device_malloc mem(handle, size_work_stack, size_tempvect, size_tempgemm, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     work_stack = mem[0];
     tempvect = mem[1];
     tempgemm = mem[2];
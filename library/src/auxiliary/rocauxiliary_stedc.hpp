@@ -115,8 +115,8 @@ ROCSOLVER_KERNEL void stedc_kernel(const rocblas_int n,
     }
 }
 
-/** This local gemm adapts rocblas_gemm to multiply complex*real, and
-    overwrite result: A = A*B **/
+/** This local gemm multiplies A by the real matrix B and overwrites the
+    result: A = A*B **/
 template <bool BATCHED, bool STRIDED, typename T, typename S, typename U, std::enable_if_t<!is_complex<T>, int> = 0>
 void local_gemm(rocblas_handle handle,
                 const rocblas_int n,
@@ -126,7 +126,6 @@ void local_gemm(rocblas_handle handle,
                 const rocblas_stride strideA,
                 S* B,
                 S* temp,
-                S* work,
                 const rocblas_int shiftT,
                 const rocblas_int ldt,
                 const rocblas_stride strideT,
@@ -136,9 +135,11 @@ void local_gemm(rocblas_handle handle,
     // Execute A*B -> temp -> A
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
     S one = 1.0;
     S zero = 0.0;
 
@@ -154,9 +155,17 @@ void local_gemm(rocblas_handle handle,
     ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0, stream,
                             copymat_from_buffer, n, n, A, shiftA, lda, strideA, temp);
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
 }
 
+/** This local gemm adapts rocblas_gemm to multiply complex*real, and
+    overwrite result: A = A*B.
+    The complex matrix A is read as a real matrix with twice as many rows (the real and
+    imaginary parts of each element in consecutive rows), so that a single real gemm
+    computes the real and imaginary parts of the product at once. temp must hold n-by-n
+    complex elements per instance **/
 template <bool BATCHED, bool STRIDED, typename T, typename S, typename U, std::enable_if_t<is_complex<T>, int> = 0>
 void local_gemm(rocblas_handle handle,
                 const rocblas_int n,
@@ -166,56 +175,39 @@ void local_gemm(rocblas_handle handle,
                 const rocblas_stride strideA,
                 S* B,
                 S* temp,
-                S* work,
                 const rocblas_int shiftT,
                 const rocblas_int ldt,
                 const rocblas_stride strideT,
                 const rocblas_int batch_count,
                 S** workArr)
 {
-    // Execute A -> work; work*B -> temp -> A
+    // Execute A*B -> temp -> A
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
     S one = 1.0;
     S zero = 0.0;
 
-    // work = real(A)
+    // temp = A*B, with A and temp seen as real 2n-by-n matrices
+    rocblasCall_gemm<BATCHED, STRIDED, S>(
+        handle, rocblas_operation_none, rocblas_operation_none, 2 * n, n, n, &one,
+        cast2realType<S>(A), 2 * shiftA, 2 * lda, 2 * strideA, B, shiftT, ldt, strideT, &zero,
+        temp, 2 * shiftT, 2 * ldt, 2 * strideT, batch_count, workArr);
+
+    // A = temp
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
     rocblas_int blocks = (n - 1) / 32 + 1;
-    ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, S, true>), dim3(blocks, blocks, batch_count), dim3(32, 32),
-                            0, stream, copymat_to_buffer, n, n, A, shiftA, lda, strideA, work,
-                            rocblas_fill_full);
-
-    // temp = work*B
-    rocblasCall_gemm<BATCHED, STRIDED, S>(
-        handle, rocblas_operation_none, rocblas_operation_none, n, n, n, &one, work, shiftT, ldt,
-        strideT, B, shiftT, ldt, strideT, &zero, temp, shiftT, ldt, strideT, batch_count, workArr);
-
-    // real(A) = temp
-    ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, S, true>), dim3(blocks, blocks, batch_count), dim3(32, 32),
-                            0, stream, copymat_from_buffer, n, n, A, shiftA, lda, strideA, temp,
-                            rocblas_fill_full);
-
-    // work = imag(A)
-    ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, S, false>), dim3(blocks, blocks, batch_count),
-                            dim3(32, 32), 0, stream, copymat_to_buffer, n, n, A, shiftA, lda,
-                            strideA, work, rocblas_fill_full);
-
-    // temp = work*B
-    rocblasCall_gemm<BATCHED, STRIDED, S>(
-        handle, rocblas_operation_none, rocblas_operation_none, n, n, n, &one, work, shiftT, ldt,
-        strideT, B, shiftT, ldt, strideT, &zero, temp, shiftT, ldt, strideT, batch_count, workArr);
-
-    // imag(A) = temp
-    ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, S, false>), dim3(blocks, blocks, batch_count),
-                            dim3(32, 32), 0, stream, copymat_from_buffer, n, n, A, shiftA, lda,
-                            strideA, temp, rocblas_fill_full);
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0, stream,
+                            copymat_from_buffer, n, n, A, shiftA, lda, strideA, (T*)temp);
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
 }
 
 template <bool BATCHED, typename T, typename S>
@@ -227,8 +219,6 @@ void rocsolver_stedc_getMemorySize(const rocblas_evect evect,
                                    size_t* size_tempgemm,
                                    size_t* size_workArr)
 {
-    constexpr bool COMPLEX = is_complex<T>;
-
     // if quick return no workspace needed
     if(n <= 1 || !batch_count)
     {
@@ -260,23 +250,20 @@ void rocsolver_stedc_getMemorySize(const rocblas_evect evect,
     // otherwise use divide and conquer algorithm:
     else
     {
-        size_t s1, s2;
-
         // requirements for steqr of small independent blocks
         // (TODO: Size should be STEDC_MIN_DC_SIZE when DC method is implemented)
-        rocsolver_steqr_getMemorySize<T, S>(evect, n, batch_count, &s1);
+        rocsolver_steqr_getMemorySize<T, S>(evect, n, batch_count, size_work_stack);
 
         // extra requirements for original eigenvectors of small independent blocks
+        // (the product with the eigenvectors is stored in tempgemm with the type of the
+        // original matrix; in the batched case, gemm needs arrays of pointers to tempvect
+        // and tempgemm)
         if(evect != rocblas_evect_tridiagonal)
         {
             *size_tempvect = n * n * batch_count * sizeof(S);
-            *size_tempgemm = n * n * batch_count * sizeof(S);
-            if(COMPLEX)
-                s2 = n * n * batch_count * sizeof(S);
-            else
-                s2 = 0;
-            if(BATCHED && !COMPLEX)
-                *size_workArr = sizeof(S*) * batch_count;
+            *size_tempgemm = n * n * batch_count * sizeof(T);
+            if(BATCHED)
+                *size_workArr = 2 * sizeof(S*) * batch_count;
             else
                 *size_workArr = 0;
         }
@@ -285,10 +272,7 @@ void rocsolver_stedc_getMemorySize(const rocblas_evect evect,
             *size_tempvect = 0;
             *size_tempgemm = 0;
             *size_workArr = 0;
-            s2 = 0;
         }
-
-        *size_work_stack = max(s1, s2);
     }
 }
 
@@ -427,7 +411,7 @@ rocblas_status rocsolver_stedc_template(rocblas_handle handle,
 
             // update eigenvectors C <- C*tempvect
             local_gemm<BATCHED, STRIDED, T>(handle, n, C, shiftC, ldc, strideC, tempvect, tempgemm,
-                                            (S*)work_stack, 0, ldt, strideT, batch_count, workArr);
+                                            0, ldt, strideT, batch_count, workArr);
         }
     }
 
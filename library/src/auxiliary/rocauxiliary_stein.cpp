@@ -29,6 +29,8 @@ rocblas_status rocsolver_stein_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftD = 0;
     rocblas_int shiftE = 0;
@@ -53,12 +55,16 @@ rocblas_status rocsolver_stein_impl(rocblas_handle handle,
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_work, size_iwork);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *work, *iwork;
     rocblas_device_malloc mem(handle, size_work, size_iwork);
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     work = mem[0];
     iwork = mem[1];
 
@@ -24,6 +24,8 @@ rocblas_status rocsolver_steqr_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftD = 0;
     rocblas_int shiftE = 0;
@@ -43,12 +45,16 @@ rocblas_status rocsolver_steqr_impl(rocblas_handle handle,
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_work_stack);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void* work_stack;
     rocblas_device_malloc mem(handle, size_work_stack);
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     work_stack = mem[0];
 
     // execution
@@ -313,6 +313,65 @@ ROCSOLVER_KERNEL void steqr_kernel(const rocblas_int n,
     run_steqr(n, D, E, C, ldc, info, work, max_iters, eps, ssfmin, ssfmax);
 }
 
+/** STEQR_PACKED_KERNEL is a version of STEQR_KERNEL for large batches of small matrices,
+    where each thread works on a different instance of the batch with its copy of D and E,
+    and the rotation workspace, staged in shared memory. C is updated in global memory.
+    Call this kernel with STERF_PACKED_THREADS threads per group and enough groups to cover
+    the batch. Size of shared memory must be STERF_PACKED_THREADS * (4n - 3) * sizeof(S) **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(STERF_PACKED_THREADS)
+    steqr_packed_kernel(const rocblas_int n,
+                        S* DD,
+                        const rocblas_stride strideD,
+                        S* EE,
+                        const rocblas_stride strideE,
+                        U CC,
+                        const rocblas_int shiftC,
+                        const rocblas_int ldc,
+                        const rocblas_stride strideC,
+                        rocblas_int* iinfo,
+                        const rocblas_int batch_count,
+                        const rocblas_int max_iters,
+                        const S eps,
+                        const S ssfmin,
+                        const S ssfmax)
+{
+    // select batch instance
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + tid;
+
+    if(bid >= batch_count)
+        return;
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+    rocblas_int* info = iinfo + bid;
+
+    // shared memory
+    extern __shared__ double lmem[];
+    S* sD = reinterpret_cast<S*>(lmem) + tid * (4 * n - 3);
+    S* sE = sD + n;
+    S* work = sE + n - 1;
+
+    for(rocblas_int i = 0; i < n - 1; i++)
+    {
+        sD[i] = D[i];
+        sE[i] = E[i];
+    }
+    sD[n - 1] = D[n - 1];
+
+    // execute
+    run_steqr(n, sD, sE, C, ldc, info, work, max_iters, eps, ssfmin, ssfmax);
+
+    for(rocblas_int i = 0; i < n - 1; i++)
+    {
+        D[i] = sD[i];
+        E[i] = sE[i];
+    }
+    D[n - 1] = sD[n - 1];
+}
+
 template <typename T, typename S>
 void rocsolver_steqr_getMemorySize(const rocblas_evect evect,
                                    const rocblas_int n,
@@ -423,7 +482,28 @@ rocblas_status rocsolver_steqr_template(rocblas_handle handle,
     ssfmin = sqrt(ssfmin) / (eps * eps);
     ssfmax = sqrt(ssfmax) / S(3.0);
 
-    if(evect == rocblas_evect_none)
+    if(sterf_use_packed(n, batch_count))
+    {
+        // one instance of the batch per thread
+        rocblas_int blocks = (batch_count - 1) / STERF_PACKED_THREADS + 1;
+        if(evect == rocblas_evect_none)
+        {
+            size_t lmemsize = sizeof(S) * STERF_PACKED_THREADS * (2 * n - 1);
+            ROCSOLVER_LAUNCH_KERNEL(sterf_packed_kernel<S>, dim3(blocks),
+                                    dim3(STERF_PACKED_THREADS), lmemsize, stream, n, D + shiftD,
+                                    strideD, E + shiftE, strideE, info, batch_count, 30 * n, eps,
+                                    ssfmin, ssfmax);
+        }
+        else
+        {
+            size_t lmemsize = sizeof(S) * STERF_PACKED_THREADS * (4 * n - 3);
+            ROCSOLVER_LAUNCH_KERNEL((steqr_packed_kernel<T>), dim3(blocks),
+                                    dim3(STERF_PACKED_THREADS), lmemsize, stream, n, D + shiftD,
+                                    strideD, E + shiftE, strideE, C, shiftC, ldc, strideC, info,
+                                    batch_count, 30 * n, eps, ssfmin, ssfmax);
+        }
+    }
+    else if(evect == rocblas_evect_none)
         ROCSOLVER_LAUNCH_KERNEL(sterf_kernel<S>, dim3(batch_count), dim3(1), 0, stream, n,
                                 D + shiftD, strideD, E + shiftE, strideE, info,
                                 (rocblas_int*)work_stack, 30 * n, eps, ssfmin, ssfmax);
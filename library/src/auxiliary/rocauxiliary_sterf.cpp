@@ -18,6 +18,8 @@ rocblas_status
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftD = 0;
     rocblas_int shiftE = 0;
@@ -35,12 +37,16 @@ rocblas_status
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_stack);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void* stack;
     rocblas_device_malloc mem(handle, size_stack);
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     stack = mem[0];
 
     // execution
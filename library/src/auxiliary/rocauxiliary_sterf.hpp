@@ -19,6 +19,13 @@
   BATCH).)
 ***************************************************************************/
 
+/** Returns true if the instances of the batch should be distributed one per thread
+    instead of one per group (see STERF_PACKED_MAX_N) **/
+inline bool sterf_use_packed(const rocblas_int n, const rocblas_int batch_count)
+{
+    return (n <= STERF_PACKED_MAX_N && batch_count >= STERF_PACKED_MIN_BATCH);
+}
+
 /** STERF_SQ_E squares the elements of E **/
 template <typename T>
 __device__ void sterf_sq_e(const rocblas_int start, const rocblas_int end, T* E)
@@ -27,27 +34,19 @@ __device__ void sterf_sq_e(const rocblas_int start, const rocblas_int end, T* E)
         E[i] = E[i] * E[i];
 }
 
-/** STERF_KERNEL implements the main loop of the sterf algorithm
+/** STERF_KERNEL/RUN_STERF implements the main loop of the sterf algorithm
     to compute the eigenvalues of a symmetric tridiagonal matrix given by D
     and E **/
 template <typename T>
-ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
-                                   T* DD,
-                                   const rocblas_stride strideD,
-                                   T* EE,
-                                   const rocblas_stride strideE,
-                                   rocblas_int* info,
-                                   rocblas_int* stack,
-                                   const rocblas_int max_iters,
-                                   const T eps,
-                                   const T ssfmin,
-                                   const T ssfmax)
+__device__ void run_sterf(const rocblas_int n,
+                          T* D,
+                          T* E,
+                          rocblas_int* info,
+                          const rocblas_int max_iters,
+                          const T eps,
+                          const T ssfmin,
+                          const T ssfmax)
 {
-    rocblas_int bid = hipBlockIdx_x;
-
-    T* D = DD + (bid * strideD);
-    T* E = EE + (bid * strideE);
-
     rocblas_int m, l, lsv, lend, lendsv;
     rocblas_int l1 = 0;
     rocblas_int iters = 0;
@@ -252,14 +251,14 @@ ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
     // Check for convergence
     for(int i = 0; i < n - 1; i++)
         if(E[i] != 0)
-            info[bid]++;
+            info[0]++;
 
     // Sort eigenvalues
     /** (TODO: the quick-sort method implemented in lasrt_increasing fails for some cases.
         Substituting it here with a simple sorting algorithm. If more performance is required in
         the future, lasrt_increasing should be debugged or another quick-sort method
         could be implemented) **/
-    //lasrt_increasing(n, D, stack + bid * (2 * 32));
+    //lasrt_increasing(n, D, stack);
 
     for(int ii = 1; ii < n; ii++)
     {
@@ -282,6 +281,81 @@ ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
     }
 }
 
+template <typename T>
+ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
+                                   T* DD,
+                                   const rocblas_stride strideD,
+                                   T* EE,
+                                   const rocblas_stride strideE,
+                                   rocblas_int* info,
+                                   rocblas_int* stack,
+                                   const rocblas_int max_iters,
+                                   const T eps,
+                                   const T ssfmin,
+                                   const T ssfmax)
+{
+    // select batch instance
+    rocblas_int bid = hipBlockIdx_x;
+
+    T* D = DD + (bid * strideD);
+    T* E = EE + (bid * strideE);
+
+    // execute
+    run_sterf(n, D, E, info + bid, max_iters, eps, ssfmin, ssfmax);
+}
+
+/** STERF_PACKED_KERNEL is a version of STERF_KERNEL for large batches of small matrices,
+    where each thread works on a different instance of the batch with its copy of D and E
+    staged in shared memory.
+    Call this kernel with STERF_PACKED_THREADS threads per group and enough groups to cover
+    the batch. Size of shared memory must be STERF_PACKED_THREADS * (2n - 1) * sizeof(T) **/
+template <typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(STERF_PACKED_THREADS)
+    sterf_packed_kernel(const rocblas_int n,
+                        T* DD,
+                        const rocblas_stride strideD,
+                        T* EE,
+                        const rocblas_stride strideE,
+                        rocblas_int* info,
+                        const rocblas_int batch_count,
+                        const rocblas_int max_iters,
+                        const T eps,
+                        const T ssfmin,
+                        const T ssfmax)
+{
+    // select batch instance
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + tid;
+
+    if(bid >= batch_count)
+        return;
+
+    T* D = DD + (bid * strideD);
+    T* E = EE + (bid * strideE);
+
+    // shared memory
+    extern __shared__ double lmem[];
+    T* sD = reinterpret_cast<T*>(lmem) + tid * (2 * n - 1);
+    T* sE = sD + n;
+
+    for(rocblas_int i = 0; i < n - 1; i++)
+    {
+        sD[i] = D[i];
+        sE[i] = E[i];
+    }
+    sD[n - 1] = D[n - 1];
+
+    // execute
+    run_sterf(n, sD, sE, info + bid, max_iters, eps, ssfmin, ssfmax);
+
+    for(rocblas_int i = 0; i < n - 1; i++)
+    {
+        D[i] = sD[i];
+        E[i] = sE[i];
+    }
+    D[n - 1] = sD[n - 1];
+}
+
 template <typename T>
 void rocsolver_sterf_getMemorySize(const rocblas_int n,
                                    const rocblas_int batch_count,
@@ -360,8 +434,19 @@ rocblas_status rocsolver_sterf_template(rocblas_handle handle,
     ssfmin = sqrt(ssfmin) / (eps * eps);
     ssfmax = sqrt(ssfmax) / T(3.0);
 
-    ROCSOLVER_LAUNCH_KERNEL(sterf_kernel<T>, dim3(batch_count), dim3(1), 0, stream, n, D + shiftD,
-                            strideD, E + shiftE, strideE, info, stack, 30 * n, eps, ssfmin, ssfmax);
+    if(sterf_use_packed(n, batch_count))
+    {
+        // one instance of the batch per thread
+        rocblas_int blocks = (batch_count - 1) / STERF_PACKED_THREADS + 1;
+        size_t lmemsize = sizeof(T) * STERF_PACKED_THREADS * (2 * n - 1);
+        ROCSOLVER_LAUNCH_KERNEL(sterf_packed_kernel<T>, dim3(blocks), dim3(STERF_PACKED_THREADS),
+                                lmemsize, stream, n, D + shiftD, strideD, E + shiftE, strideE, info,
+                                batch_count, 30 * n, eps, ssfmin, ssfmax);
+    }
+    else
+        ROCSOLVER_LAUNCH_KERNEL(sterf_kernel<T>, dim3(batch_count), dim3(1), 0, stream, n,
+                                D + shiftD, strideD, E + shiftE, strideE, info, stack, 30 * n, eps,
+                                ssfmin, ssfmax);
 
     return rocblas_status_success;
 }
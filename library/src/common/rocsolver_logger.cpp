@@ -2,6 +2,7 @@
  * Copyright (c) 2021-2022 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
+#include <algorithm>
 #include <cerrno>
 #include <climits>
 #include <cstdlib>
@@ -17,6 +18,7 @@
 // initialize the static variable
 rocsolver_logger* rocsolver_logger::_instance = nullptr;
 std::mutex rocsolver_logger::_mutex;
+thread_local rocsolver_logger::phase_timer* rocsolver_logger::_current_phase = nullptr;
 
 static std::string rocblas_version()
 {
@@ -138,6 +140,58 @@ void rocsolver_logger::append_profile(std::string& str,
     }
 }
 
+/***************************************************************************
+ * Phase log printing
+ ***************************************************************************/
+
+static const char* phase_names[rocsolver_num_phases] = {
+    "arg_check", "memory_size", "device_malloc", "init_scalars", "execution", "pointer_mode"};
+
+void rocsolver_logger::append_phases(std::string& str)
+{
+    for(const auto& it : phases)
+    {
+        const rocsolver_phase_entry& entry = it.second;
+
+        str += fmt::format("{}: Calls: {}\n", it.first, entry.calls);
+        for(int p = 0; p < rocsolver_num_phases; p++)
+        {
+            if(!entry.phase_calls[p])
+                continue;
+
+            str += fmt::format("    {}: Calls: {}, Total Time: {:.3f} ms, Histogram:",
+                               phase_names[p], entry.phase_calls[p], entry.phase_time[p] * 1e-3);
+
+            // print the non-empty bins of the histogram
+            for(int bin = 0; bin < rocsolver_phase_bins; bin++)
+            {
+                int count = entry.histogram[p][bin];
+                if(!count)
+                    continue;
+
+                if(bin == 0)
+                    str += fmt::format(" [<1 us: {}]", count);
+                else if(bin == rocsolver_phase_bins - 1)
+                    str += fmt::format(" [>={} us: {}]", 1LL << (bin - 1), count);
+                else
+                    str += fmt::format(" [{}-{} us: {}]", 1LL << (bin - 1), 1LL << bin, count);
+            }
+            str += '\n';
+        }
+    }
+}
+
+void rocsolver_logger::write_phases()
+{
+    if(layer_mode & rocblas_layer_mode_ex_log_phases && !phases.empty())
+    {
+        std::string phases_str;
+        append_phases(phases_str);
+        fmt::print(*profile_os, "------- HOST PHASES -------\n{}\n", phases_str);
+        profile_os->flush();
+    }
+}
+
 rocblas_status rocsolver_log_write_profile(void)
 {
     const std::lock_guard<std::mutex> lock(rocsolver_logger::_mutex);
@@ -156,6 +210,9 @@ rocblas_status rocsolver_log_write_profile(void)
         fmt::print(*logger->profile_os, "------- PROFILE -------\n{}\n", profile_str);
         logger->profile_os->flush();
     }
+
+    // print phase logging results
+    logger->write_phases();
     return rocblas_status_success;
 }
 
@@ -179,6 +236,10 @@ rocblas_status rocsolver_log_flush_profile(void)
 
         logger->profile.clear();
     }
+
+    // print and clear phase logging results
+    logger->write_phases();
+    logger->phases.clear();
     return rocblas_status_success;
 }
 
@@ -263,6 +324,9 @@ try
         logger->profile_os->flush();
     }
 
+    // print phase logging results
+    logger->write_phases();
+
     // delete the logger
     delete rocsolver_logger::_instance;
     rocsolver_logger::_instance = nullptr;
@@ -341,4 +405,49 @@ catch(...)
 {
     return exception_to_rocblas_status();
 }
+
+rocblas_status rocsolver_log_get_phase_stats(const char* func_name,
+                                             const rocblas_log_phase phase,
+                                             rocblas_int* calls,
+                                             double* total_time,
+                                             rocblas_int* histogram,
+                                             const rocblas_int hist_size)
+try
+{
+    const std::lock_guard<std::mutex> lock(rocsolver_logger::_mutex);
+
+    // if there is an active logger:
+    if(rocsolver_logger::_instance == nullptr)
+        return rocblas_status_internal_error;
+    if(phase < rocblas_log_phase_arg_check || phase > rocblas_log_phase_pointer_mode)
+        return rocblas_status_invalid_value;
+    if(hist_size < 0)
+        return rocblas_status_invalid_size;
+    if(!func_name || !calls || !total_time || (hist_size && !histogram))
+        return rocblas_status_invalid_pointer;
+
+    auto logger = rocsolver_logger::_instance;
+
+    *calls = 0;
+    *total_time = 0;
+    for(rocblas_int i = 0; i < hist_size; i++)
+        histogram[i] = 0;
+
+    auto it = logger->phases.find(func_name);
+    if(it == logger->phases.end())
+        return rocblas_status_success;
+
+    // the bins that do not fit in the given histogram are accumulated in the last element
+    const rocsolver_phase_entry& entry = it->second;
+    *calls = entry.phase_calls[phase];
+    *total_time = entry.phase_time[phase];
+    for(int bin = 0; bin < rocsolver_phase_bins && hist_size > 0; bin++)
+        histogram[std::min(bin, hist_size - 1)] += entry.histogram[phase][bin];
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
 }
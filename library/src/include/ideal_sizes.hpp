@@ -114,6 +114,29 @@
     n >= THIN_SVD_SWITCH*m, then the thin SVD is computed.*/
 #define THIN_SVD_SWITCH 1.6
 
+/*! \brief Determines the size at which rocSOLVER switches from generating the lead-dimension
+    singular vectors explicitly to back-transforming them when executing GESVD. It also applies to the
+    corresponding batched and strided-batched routines.
+
+    \details When the thin SVD is not computed and max(m,n) >= GESVD_BACKTRANSFORM_SWITCHSIZE,
+    BDSQR will apply the Givens rotations to the k-by-k (k = min(m,n)) singular vectors of the bidiagonal
+    form only, and these will be multiplied afterwards by the orthonormal/unitary matrix of the
+    bidiagonalization with ORMBR/UNMBR. Otherwise, the matrix is generated explicitly
+    with ORGBR/UNGBR and BDSQR applies the rotations to all of its rows or columns.*/
+#define GESVD_BACKTRANSFORM_SWITCHSIZE 256
+
+/******************************* heev *****************************************
+*******************************************************************************/
+/*! \brief Determines the size at which rocSOLVER switches from generating the unitary matrix of the
+    tridiagonalization explicitly to back-transforming the eigenvectors when executing HEEV. It also applies to the
+    corresponding batched and strided-batched routines.
+
+    \details When n >= HEEV_BACKTRANSFORM_SWITCHSIZE, STEQR will compute the eigenvectors of the
+    tridiagonal form as a real matrix, and these will be multiplied afterwards by the unitary matrix of the
+    tridiagonalization with UNMTR. Otherwise, the unitary matrix is generated explicitly
+    with UNGTR and STEQR applies the rotations to it directly. (Real SYEV always uses the latter.)*/
+#define HEEV_BACKTRANSFORM_SWITCHSIZE 256
+
 /******************* sytd2/sytrd and hetd2/hetrd *******************************
 *******************************************************************************/
 /*! \brief Determines the size of the leading block that is reduced to tridiagonal form at each step
@@ -141,6 +164,44 @@
     multiple of xxGST_BLOCKSIZE, the last block reduced in the blocked process is allowed to be smaller than xxGST_BLOCKSIZE.*/
 #define xxGST_BLOCKSIZE 64
 
+/*! \brief Determines the size at which rocSOLVER switches from the blocked algorithm to the
+    inversion-based algorithm when executing SYGST/HEGST with itype = rocblas_eform_ax.
+    It also applies to the corresponding batched and strided-batched routines.
+
+    \details If n >= xxGST_INVERSE_SWITCHSIZE, SYGST/HEGST will explicitly invert the
+    triangular factor of B with TRTRI and apply it to both sides of A with two triangular
+    matrix products (TRMM), instead of alternating SYGS2/HEGS2, TRSM, SYMM/HEMM and SYR2K/HER2K
+    over blocks of xxGST_BLOCKSIZE columns. This requires n*n extra elements of workspace
+    per problem in the batch.
+
+    The current value is a placeholder that has not been tuned with measurements; it only keeps
+    the inversion-based algorithm away from the small and medium sizes where the blocked
+    algorithm is known to perform well.*/
+#define xxGST_INVERSE_SWITCHSIZE 1024
+
+/************************** sterf and steqr ***********************************
+*******************************************************************************/
+/*! \brief Determines the maximum size of the tridiagonal matrices for which the iterative
+    algorithms (STERF and STEQR) can work on several instances of the batch per group.
+
+    \details By default, a group of threads is launched per instance of the batch. If
+    n <= STERF_PACKED_MAX_N and batch_count >= STERF_PACKED_MIN_BATCH, each thread works instead
+    on a different instance, with D, E (and the workspace of STEQR) kept in shared memory.
+    This also applies to the eigensolvers that call STERF and STEQR (e.g. SYEV/HEEV and, for
+    small sizes, STEDC and SYEVD/HEEVD).*/
+#define STERF_PACKED_MAX_N 32
+
+/*! \brief Determines the minimum number of instances in the batch required to launch
+    one thread per instance when executing STERF and STEQR (see STERF_PACKED_MAX_N).*/
+#define STERF_PACKED_MIN_BATCH 64
+
+/*! \brief Determines the number of threads, and so the number of instances of the batch,
+    in each group launched by STERF and STEQR when working with one thread per instance.
+
+    \details The size of shared memory needed by STEQR is STERF_PACKED_THREADS * (4n - 3)
+    elements per group, which must fit in the available shared memory for n = STERF_PACKED_MAX_N.*/
+#define STERF_PACKED_THREADS 32
+
 /****************************** stedc *****************************************
 *******************************************************************************/
 /*! \brief Determines the minimum size required for the eigenvectors of an independent block of
@@ -166,6 +227,14 @@
     if any, will be factorized with the unblocked algorithm (POTF2).*/
 #define POTRF_POTF2_SWITCHSIZE 128
 
+/******************************** pstrf ***************************************
+*******************************************************************************/
+/*! \brief Determines the number of columns that are factorized at each step
+    of the blocked pivoted Cholesky factorization (PSTRF) before the trailing
+    submatrix is updated with a single SYRK/HERK. It also applies to the
+    corresponding batched and strided-batched routines.*/
+#define PSTRF_BLOCKSIZE 64
+
 /*************************** sytf2/sytrf **************************************
 *******************************************************************************/
 /*! \brief Determines the maximum size of the partial factorization executed at each step
@@ -182,12 +251,26 @@
     if any, will be factorized with the unblocked algorithm (SYTF2).*/
 #define SYTRF_SYTF2_SWITCHSIZE 128
 
+/*! \brief Determines the maximum size for which SYTF2 and SYTRF factorize the matrix with a
+    single kernel that keeps one row per thread in registers (only with OPTIMAL). */
+#define SYTF2_MAX_COLS 64 //always <= 64 and <= SYTRF_SYTF2_SWITCHSIZE
+
+/*! \brief Determines the maximum size for which SYTF2 and SYTRF use the single-kernel
+    factorization with complex types.
+
+    \details A complex row takes twice the registers of a real row, so it has a lower limit
+    than SYTF2_MAX_COLS to avoid spilling the row to scratch memory. */
+#define SYTF2_MAX_COLS_COMPLEX 32 //always <= SYTF2_MAX_COLS
+
 /**************************** getf2/getfr *************************************
 *******************************************************************************/
 #define GETF2_SPKER_MAX_M 1024 //always <= 1024
 #define GETF2_SPKER_MAX_N 256 //always <= 256
 #define GETF2_SSKER_MAX_M 512 //always <= 512 and <= GETF2_SPKER_MAX_M
-#define GETF2_SSKER_MAX_N 64 //always <= wavefront and <= GETF2_SPKER_MAX_N
+#define GETF2_SSKER_MAX_N 64 //always <= 64 and <= GETF2_SPKER_MAX_N
+#define GETF2_COOP_THDS 256 //always a power of 2 and <= 1024
+#define GETF2_COOP_MAX_N 256 //always <= 256
+#define GETF2_COOP_MAX_BLOCKS 64 //always <= GETF2_COOP_THDS
 #define GETF2_OPTIM_NGRP \
     16, 15, 8, 8, 8, 8, 8, 8, 6, 6, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
 #define GETRF_NUM_INTERVALS_REAL 4
@@ -218,22 +301,63 @@
 
 /****************************** getri *****************************************
 *******************************************************************************/
-#define GETRI_MAX_COLS 64 //always <= wavefront size
+#define GETRI_MAX_COLS 64 //always <= 64
 #define GETRI_TINY_SIZE 43
 #define GETRI_NUM_INTERVALS 1
 #define GETRI_INTERVALS 1185
 #define GETRI_BLKSIZES 0, 256
 #define GETRI_BATCH_TINY_SIZE 35
 #define GETRI_BATCH_NUM_INTERVALS 2
-#define GETRI_BATCH_INTERVALS 505, 2049
-#define GETRI_BATCH_BLKSIZES 32, 0, 256
+#define GETRI_BATCH_INTERVALS 512, 2049
+#define GETRI_BATCH_BLKSIZES -32, 0, 256
+#define GETRI_GJ_MAX_COLS 512 //max size for the Gauss-Jordan kernel (negative block sizes)
+
+/*! \brief Tuning tables for GETRI on devices with 32-wide wavefronts.
+
+    \details The tiny-size kernel keeps one row per thread and needs a barrier after every
+    column once the matrix has more rows than a wavefront, so on wave32 devices it is only
+    used while a single wavefront holds the whole matrix.
+
+    The batched interval and block-size tables, which select the Gauss-Jordan kernel, have
+    not been tuned for wave32 devices. They are placeholders that inherit the wave64 tables
+    until wave32 measurements are available. */
+#define GETRI_TINY_SIZE_WAVE32 32 //always <= 32
+#define GETRI_BATCH_TINY_SIZE_WAVE32 32 //always <= 32
+#define GETRI_BATCH_NUM_INTERVALS_WAVE32 GETRI_BATCH_NUM_INTERVALS //placeholder (not tuned)
+#define GETRI_BATCH_INTERVALS_WAVE32 GETRI_BATCH_INTERVALS //placeholder (not tuned)
+#define GETRI_BATCH_BLKSIZES_WAVE32 GETRI_BATCH_BLKSIZES //placeholder (not tuned)
 
 /***************************** trtri ******************************************
 *******************************************************************************/
-#define TRTRI_MAX_COLS 64 //always <= wavefront size
+#define TRTRI_MAX_COLS 64 //always <= 64
 #define TRTRI_NUM_INTERVALS 1
 #define TRTRI_INTERVALS 0
 #define TRTRI_BLKSIZES 0, 0
 #define TRTRI_BATCH_NUM_INTERVALS 3
 #define TRTRI_BATCH_INTERVALS 32, 245, 1009
 #define TRTRI_BATCH_BLKSIZES 0, 16, 32, 0
+
+/***************************** lauum ******************************************
+*******************************************************************************/
+/*! \brief Determines the size at which rocSOLVER switches from
+    the recursive to the unblocked algorithm when executing LAUUM.
+
+    \details LAUUM splits the triangular matrix recursively in two halves (with the size
+    of the leading half rounded to a multiple of LAUUM_LAUU2_SWITCHSIZE) until the diagonal
+    blocks have no more than LAUUM_LAUU2_SWITCHSIZE columns; these blocks are computed by a
+    single kernel that keeps the block in shared memory. */
+#define LAUUM_LAUU2_SWITCHSIZE 32 //always <= 32
+
+/***************************** potri ******************************************
+*******************************************************************************/
+/*! \brief Determines the maximum size for which POTRI computes the inverse of the
+    triangular factor and its product with a single fused kernel (only with OPTIMAL). */
+#define POTRI_MAX_COLS 64 //always <= 64
+
+/*************************** symatfunc ****************************************
+*******************************************************************************/
+/*! \brief Determines the maximum size for which SYMATFUNC/HEMATFUNC computes the
+    eigendecomposition, the function of the eigenvalues and the reconstruction with a
+    single kernel (parallel two-sided Jacobi in shared memory). Larger sizes use SYEVD/HEEVD
+    followed by a scaled GEMM. */
+#define SYMATFUNC_JACOBI_MAX_N 32 //always <= 32
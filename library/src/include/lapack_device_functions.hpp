@@ -1033,6 +1033,150 @@ ROCSOLVER_KERNEL void axpy_kernel(const rocblas_int n,
     }
 }
 
+/** GEMV_CONJX computes y = alpha * A * conj(x) + beta * y, conjugating
+    the entries of x as they are loaded (x is not modified).
+
+    Call this kernel with 'batch_count' groups in x, and enough groups in y to
+    cover the m rows of A. Each thread in y handles a row of A, and the threads in z
+    split the columns; the size of shared memory should be
+    lmemsize = hipBlockDim_y * hipBlockDim_z * sizeof(T). Negative increments follow
+    the BLAS convention. Scalars alpha and beta are in device memory. **/
+template <typename T, typename UA, typename UX, typename UY>
+ROCSOLVER_KERNEL void gemv_conjx_kernel(const rocblas_int m,
+                                        const rocblas_int n,
+                                        const T* alpha,
+                                        const rocblas_stride stride_alpha,
+                                        UA AA,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        UX XX,
+                                        const rocblas_int shiftX,
+                                        const rocblas_int incx,
+                                        const rocblas_stride strideX,
+                                        const T* beta,
+                                        const rocblas_stride stride_beta,
+                                        UY YY,
+                                        const rocblas_int shiftY,
+                                        const rocblas_int incy,
+                                        const rocblas_stride strideY)
+{
+    rocblas_int b = hipBlockIdx_x;
+    rocblas_int ty = hipThreadIdx_y;
+    rocblas_int tz = hipThreadIdx_z;
+    rocblas_int bdy = hipBlockDim_y;
+    rocblas_int bdz = hipBlockDim_z;
+    rocblas_int i = hipBlockIdx_y * bdy + ty;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* x = load_ptr_batch<T>(XX, b, shiftX, strideX);
+    T* y = load_ptr_batch<T>(YY, b, shiftY, strideY);
+
+    // with negative increments, the first element is at the end of the vector
+    if(incx < 0)
+        x += (1 - n) * rocblas_stride(incx);
+    if(incy < 0)
+        y += (1 - m) * rocblas_stride(incy);
+
+    // shared mem for the reduction
+    extern __shared__ double lmem[];
+    T* sval = reinterpret_cast<T*>(lmem);
+
+    // each thread reduces a subset of the columns of A in row i
+    T temp = 0;
+    if(i < m)
+    {
+        for(rocblas_int j = tz; j < n; j += bdz)
+            temp += A[i + j * lda] * conj(x[j * incx]);
+    }
+    sval[ty + tz * bdy] = temp;
+    __syncthreads();
+
+    if(tz == 0 && i < m)
+    {
+        for(rocblas_int k = 1; k < bdz; k++)
+            temp += sval[ty + k * bdy];
+
+        T a = alpha[b * stride_alpha];
+        T c = beta[b * stride_beta];
+
+        // (if beta is zero, y is not read)
+        y[i * incy] = (c == 0) ? a * temp : a * temp + c * y[i * incy];
+    }
+}
+
+/** GEMV_CONJX_TRANS computes y = alpha * op(A) * conj(x) + beta * y, where
+    op(A) = A' (or A**H if conjA is true), conjugating the entries of x as they
+    are loaded (x is not modified).
+
+    Call this kernel with 'batch_count' groups in x, and n groups in y (one group
+    per entry of y). The group size must be a power of 2, and the size of shared
+    memory should be lmemsize = hipBlockDim_y * sizeof(T). Negative increments follow
+    the BLAS convention. Scalars alpha and beta are in device memory. **/
+template <typename T, typename UA, typename UX, typename UY>
+ROCSOLVER_KERNEL void gemv_conjx_trans_kernel(const bool conjA,
+                                              const rocblas_int m,
+                                              const rocblas_int n,
+                                              const T* alpha,
+                                              const rocblas_stride stride_alpha,
+                                              UA AA,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              UX XX,
+                                              const rocblas_int shiftX,
+                                              const rocblas_int incx,
+                                              const rocblas_stride strideX,
+                                              const T* beta,
+                                              const rocblas_stride stride_beta,
+                                              UY YY,
+                                              const rocblas_int shiftY,
+                                              const rocblas_int incy,
+                                              const rocblas_stride strideY)
+{
+    rocblas_int b = hipBlockIdx_x;
+    rocblas_int j = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_y;
+    rocblas_int bdy = hipBlockDim_y;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* x = load_ptr_batch<T>(XX, b, shiftX, strideX);
+    T* y = load_ptr_batch<T>(YY, b, shiftY, strideY);
+
+    // with negative increments, the first element is at the end of the vector
+    if(incx < 0)
+        x += (1 - m) * rocblas_stride(incx);
+    if(incy < 0)
+        y += (1 - n) * rocblas_stride(incy);
+
+    // shared mem for the reduction
+    extern __shared__ double lmem[];
+    T* sval = reinterpret_cast<T*>(lmem);
+
+    // each thread reduces as many elements as needed to cover column j of A
+    T temp = 0;
+    for(rocblas_int i = tid; i < m; i += bdy)
+        temp += (conjA ? conj(A[i + j * lda]) : A[i + j * lda]) * conj(x[i * incx]);
+    sval[tid] = temp;
+    __syncthreads();
+
+    for(rocblas_int r = bdy / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] += sval[tid + r];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        T a = alpha[b * stride_alpha];
+        T c = beta[b * stride_beta];
+
+        // (if beta is zero, y is not read)
+        y[j * incy] = (c == 0) ? a * sval[0] : a * sval[0] + c * y[j * incy];
+    }
+}
+
 /** Optimized kernel that executes a simple gemm A = BC
     where A, B and C are sub blocks of the same matrix MM with
     leading dimension ldim and stride. A, B and C are
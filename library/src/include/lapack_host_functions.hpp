@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstdlib>
+
 #include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver.h"
@@ -92,6 +94,33 @@
     {1,  1,  1,  1,  1,  1,  1,  1,  1,  1, 80, 80, 56, 56, 32, 32},        \
     {1, 64, 32, 32, 32, 64, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32},        \
     {1,  1,  1,  1,  1,  1, 64, 64, 64, 64, 64, 64, 64, 48, 48, 48}
+
+#define TRSM_INVDIAG_NUMROWS_REAL 6
+#define TRSM_INVDIAG_NUMCOLS_REAL 5
+#define TRSM_INVDIAG_INTERVALSROW_REAL                                      \
+    24, 64, 128, 256, 512
+#define TRSM_INVDIAG_INTERVALSCOL_REAL                                      \
+    8, 64, 256, 1024
+#define TRSM_INVDIAG_BLKSIZES_REAL                                          \
+    { 0,  0,  0,  0,  0},                                                   \
+    {16, 16, 16, 32,  0},                                                   \
+    {32, 32, 32, 32,  0},                                                   \
+    {32, 32, 64, 64,  0},                                                   \
+    {32, 64, 64, 64,  0},                                                   \
+    { 0,  0,  0,  0,  0}
+
+#define TRSM_INVDIAG_NUMROWS_COMPLEX 5
+#define TRSM_INVDIAG_NUMCOLS_COMPLEX 4
+#define TRSM_INVDIAG_INTERVALSROW_COMPLEX                                   \
+    24, 64, 128, 256
+#define TRSM_INVDIAG_INTERVALSCOL_COMPLEX                                   \
+    8, 64, 512
+#define TRSM_INVDIAG_BLKSIZES_COMPLEX                                       \
+    { 0,  0,  0,  0},                                                       \
+    {16, 16, 16,  0},                                                       \
+    {32, 32, 32,  0},                                                       \
+    {32, 32, 32,  0},                                                       \
+    { 0,  0,  0,  0}
 // clang-format on
 
 /** This function returns the block size for the internal
@@ -157,6 +186,51 @@ rocblas_int rocsolver_trsm_blksize(const rocblas_int m, const rocblas_int n)
     return blk;
 }
 
+/** Returns true if the internal trsm that uses the inverses of the diagonal blocks has been
+    enabled by setting the environment variable ROCSOLVER_TRSM_INVDIAG to a non-zero value
+    (the TRSM_INVDIAG tables have not been tuned yet, so rocBLAS trsm remains the default).
+    The environment is read only once, on the first call. **/
+inline bool rocsolver_trsm_invdiag_enabled()
+{
+    static const bool enabled = [] {
+        const char* str = std::getenv("ROCSOLVER_TRSM_INVDIAG");
+        return str && std::atoi(str) != 0;
+    }();
+    return enabled;
+}
+
+/** This function returns the block size for the internal trsm that uses
+    the inverses of the diagonal blocks (rocsolver_trsm_invdiag).
+    A block size of 0 means that rocBLAS trsm should be used instead **/
+template <typename T>
+rocblas_int rocsolver_trsm_invdiag_blksize(const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           const rocblas_int batch_count)
+{
+    // single problems are better parallelized by rocBLAS trsm
+    if(batch_count < 2 || !rocsolver_trsm_invdiag_enabled())
+        return 0;
+
+    if(!is_complex<T>)
+    {
+        rocblas_int M = TRSM_INVDIAG_NUMROWS_REAL - 1;
+        rocblas_int N = TRSM_INVDIAG_NUMCOLS_REAL - 1;
+        rocblas_int intervalsM[] = {TRSM_INVDIAG_INTERVALSROW_REAL};
+        rocblas_int intervalsN[] = {TRSM_INVDIAG_INTERVALSCOL_REAL};
+        rocblas_int size[][TRSM_INVDIAG_NUMCOLS_REAL] = {TRSM_INVDIAG_BLKSIZES_REAL};
+        return size[get_index(intervalsM, M, n)][get_index(intervalsN, N, nrhs)];
+    }
+    else
+    {
+        rocblas_int M = TRSM_INVDIAG_NUMROWS_COMPLEX - 1;
+        rocblas_int N = TRSM_INVDIAG_NUMCOLS_COMPLEX - 1;
+        rocblas_int intervalsM[] = {TRSM_INVDIAG_INTERVALSROW_COMPLEX};
+        rocblas_int intervalsN[] = {TRSM_INVDIAG_INTERVALSCOL_COMPLEX};
+        rocblas_int size[][TRSM_INVDIAG_NUMCOLS_COMPLEX] = {TRSM_INVDIAG_BLKSIZES_COMPLEX};
+        return size[get_index(intervalsM, M, n)][get_index(intervalsN, N, nrhs)];
+    }
+}
+
 /** This function determine workspace size for the internal trsm **/
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_trsm_mem(const rocblas_side side,
@@ -208,6 +282,30 @@ void rocsolver_trsm_mem(const rocblas_side side,
                                      size_work2, size_work3, size_work4);
 }
 
+/** This function determines the workspace size for rocsolver_trsm_invdiag
+    (including the computation of the inverted blocks) **/
+template <bool BATCHED, typename T>
+void rocsolver_trsm_invdiag_mem(const rocblas_int n,
+                                const rocblas_int nrhs,
+                                const rocblas_int nb,
+                                const rocblas_int batch_count,
+                                size_t* size_work1,
+                                size_t* size_work2,
+                                size_t* size_work3,
+                                size_t* size_work4)
+{
+    // temporary arrays for trtri, or for the products with the inverted blocks
+    size_t size_ctemp;
+    rocblasCall_trtri_mem<BATCHED, T>(nb, batch_count, &size_ctemp, size_work2);
+    *size_work1 = std::max(size_ctemp, sizeof(T) * nb * nrhs * batch_count);
+
+    // inverted diagonal blocks
+    *size_work3 = sizeof(T) * nb * n * batch_count;
+
+    // arrays of pointers for the batched calls to trtri and gemm
+    *size_work4 = BATCHED ? 2 * sizeof(T*) * batch_count : 0;
+}
+
 /** Internal TRSM (lower case):
     Optimized function that solves a simple triangular system B <- Ax=B
     with A unit lower triangular matrix. A and B are sub blocks of the same matrix MM with
@@ -365,3 +463,195 @@ void rocsolver_trsm_upper(rocblas_handle handle,
         }
     }
 }
+
+/** Computes the inverses of the nb-by-nb diagonal blocks of the triangular matrix A
+    (the last block could be smaller), and stores them one next to the other in invD,
+    with leading dimension nb. The inverted blocks can be reused by all the calls to
+    rocsolver_trsm_invdiag with the same matrix A. **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void rocsolver_trsm_invdiag_inverse(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_diagonal diag,
+                                    const rocblas_int n,
+                                    const rocblas_int nb,
+                                    U A,
+                                    const rocblas_int shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    const rocblas_int batch_count,
+                                    T* invD,
+                                    T* ctemp,
+                                    T** ctemp_arr,
+                                    T** workArr)
+{
+    ROCSOLVER_ENTER("trsm_invdiag_inverse", "uplo:", uplo, "diag:", diag, "n:", n, "nb:", nb,
+                    "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_stride strideD = rocblas_stride(nb) * n;
+
+    // trtri only writes the triangular part of the inverses; the rest must be zero
+    // so that the blocks can be used with gemm
+    rocblas_int blocksx = (nb - 1) / 32 + 1;
+    rocblas_int blocksy = (n - 1) / 32 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                            stream, nb, n, invD, 0, nb, strideD);
+
+    for(rocblas_int j = 0; j < n; j += nb)
+    {
+        rocblas_int jb = std::min(n - j, nb);
+        rocblasCall_trtri<BATCHED, STRIDED, T>(handle, uplo, diag, jb, A, shiftA + idx2D(j, j, lda),
+                                               lda, strideA, invD, idx2D(0, j, nb), nb, strideD,
+                                               batch_count, ctemp, ctemp_arr, workArr);
+    }
+}
+
+/** Internal TRSM (inverted diagonal blocks):
+    Solves op(A)X = B, overwriting B with X, where A is an n-by-n triangular matrix
+    and the inverses of its diagonal blocks were computed by rocsolver_trsm_invdiag_inverse.
+
+    Every block of rows of X is obtained by multiplying the corresponding block of B
+    by the inverted diagonal block, and the rest of the right-hand-sides are then updated;
+    thus, the whole solve consists of gemm calls that are well parallelized over the batch. **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void rocsolver_trsm_invdiag(rocblas_handle handle,
+                            const rocblas_fill uplo,
+                            const rocblas_operation trans,
+                            const rocblas_int n,
+                            const rocblas_int nrhs,
+                            const rocblas_int nb,
+                            U A,
+                            const rocblas_int shiftA,
+                            const rocblas_int lda,
+                            const rocblas_stride strideA,
+                            U B,
+                            const rocblas_int shiftB,
+                            const rocblas_int ldb,
+                            const rocblas_stride strideB,
+                            const rocblas_int batch_count,
+                            T* invD,
+                            T* work,
+                            T** workArr)
+{
+    ROCSOLVER_ENTER("trsm_invdiag", "uplo:", uplo, "trans:", trans, "n:", n, "nrhs:", nrhs,
+                    "nb:", nb, "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    T one = 1; // constant 1 in host
+    T minone = -1; // constant -1 in host
+    T zero = 0; // constant 0 in host
+
+    const rocblas_stride strideD = rocblas_stride(nb) * n;
+    const rocblas_stride strideW = rocblas_stride(nb) * nrhs;
+    const rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+
+    // the blocks of X are computed from the top if op(A) is lower triangular,
+    // and from the bottom if op(A) is upper triangular
+    const bool forward = ((uplo == rocblas_fill_lower) == (trans == rocblas_operation_none));
+    const rocblas_int nblocks = (n - 1) / nb + 1;
+
+    for(rocblas_int k = 0; k < nblocks; k++)
+    {
+        rocblas_int j = (forward ? k : nblocks - 1 - k) * nb;
+        rocblas_int jb = std::min(n - j, nb);
+
+        // compute X_j = op(inv(A_jj)) * B_j, and overwrite B_j
+        rocblasCall_gemm<BATCHED, STRIDED, T>(handle, trans, rocblas_operation_none, jb, nrhs, jb,
+                                              &one, invD, idx2D(0, j, nb), nb, strideD, B,
+                                              shiftB + idx2D(j, 0, ldb), ldb, strideB, &zero, work,
+                                              0, jb, strideW, batch_count, workArr);
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3((jb - 1) / 32 + 1, blocksy, batch_count),
+                                dim3(32, 32), 0, stream, jb, nrhs, work, 0, jb, strideW, B,
+                                shiftB + idx2D(j, 0, ldb), ldb, strideB);
+
+        // update the right-hand-sides that are still to be solved
+        rocblas_int r = forward ? j + jb : 0;
+        rocblas_int rows = forward ? n - j - jb : j;
+        if(rows > 0)
+        {
+            rocblas_int offA
+                = (trans == rocblas_operation_none) ? idx2D(r, j, lda) : idx2D(j, r, lda);
+            rocblasCall_gemm<BATCHED, STRIDED, T>(
+                handle, trans, rocblas_operation_none, rows, nrhs, jb, &minone, A, shiftA + offA,
+                lda, strideA, B, shiftB + idx2D(j, 0, ldb), ldb, strideB, &one, B,
+                shiftB + idx2D(r, 0, ldb), ldb, strideB, batch_count, workArr);
+        }
+    }
+}
+
+/** Internal GEMV with the option of conjugating x:
+    y = alpha * op(A) * conj(x) + beta * y if conjx is true, or
+    y = alpha * op(A) * x + beta * y (rocBLAS gemv) otherwise.
+
+    When conjx is true, x is conjugated as it is loaded, which avoids conjugating x in
+    place (lacgv) before and after the product; x is never written.
+    The scalars alpha and beta must be in device memory. **/
+template <typename T, typename UA, typename UX, typename UY>
+rocblas_status rocsolver_gemv(rocblas_handle handle,
+                              const rocblas_operation trans,
+                              const bool conjx,
+                              const rocblas_int m,
+                              const rocblas_int n,
+                              const T* alpha,
+                              const rocblas_stride stride_alpha,
+                              UA A,
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              UX x,
+                              const rocblas_int shiftx,
+                              const rocblas_int incx,
+                              const rocblas_stride stridex,
+                              const T* beta,
+                              const rocblas_stride stride_beta,
+                              UY y,
+                              const rocblas_int shifty,
+                              const rocblas_int incy,
+                              const rocblas_stride stridey,
+                              const rocblas_int batch_count,
+                              T** work)
+{
+    if(!conjx)
+        return rocblasCall_gemv<T>(handle, trans, m, n, alpha, stride_alpha, A, shiftA, lda,
+                                   strideA, x, shiftx, incx, stridex, beta, stride_beta, y, shifty,
+                                   incy, stridey, batch_count, work);
+
+    ROCSOLVER_ENTER("gemv_conjx", "trans:", trans, "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "shiftX:", shiftx, "incx:", incx, "shiftY:", shifty, "incy:", incy,
+                    "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    if(trans == rocblas_operation_none)
+    {
+        // 64 rows per group, with the columns split among up to 16 threads
+        rocblas_int blocks = (m - 1) / 64 + 1;
+        rocblas_int tz = min(16, n);
+        size_t lmemsize = sizeof(T) * 64 * tz;
+        ROCSOLVER_LAUNCH_KERNEL(gemv_conjx_kernel<T>, dim3(batch_count, blocks, 1),
+                                dim3(1, 64, tz), lmemsize, stream, m, n, alpha, stride_alpha, A,
+                                shiftA, lda, strideA, x, shiftx, incx, stridex, beta, stride_beta,
+                                y, shifty, incy, stridey);
+    }
+    else
+    {
+        size_t lmemsize = sizeof(T) * BS1;
+        ROCSOLVER_LAUNCH_KERNEL(gemv_conjx_trans_kernel<T>, dim3(batch_count, n, 1),
+                                dim3(1, BS1, 1), lmemsize, stream,
+                                trans == rocblas_operation_conjugate_transpose, m, n, alpha,
+                                stride_alpha, A, shiftA, lda, strideA, x, shiftx, incx, stridex,
+                                beta, stride_beta, y, shifty, incy, stridey);
+    }
+
+    return rocblas_status_success;
+}
@@ -264,6 +264,89 @@ ROCSOLVER_KERNEL void copy_mat(copymat_direction direction,
     }
 }
 
+/** TRANSPOSE_MAT copies the transpose (or conjugate transpose if CONJ) of the m-by-n array A
+    into the n-by-m array B.
+    Tiles of BS2-by-BS2 elements are staged in LDS so that both reads and writes are coalesced.
+    Call this kernel with blocks (ceil(m/BS2), ceil(n/BS2), batch_count) of BS2-by-BS2 threads. **/
+template <typename T, bool CONJ, typename U1, typename U2>
+ROCSOLVER_KERNEL void __launch_bounds__(BS2* BS2) transpose_mat(const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                U1 A,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                U2 B,
+                                                                const rocblas_int shiftB,
+                                                                const rocblas_int ldb,
+                                                                const rocblas_stride strideB)
+{
+    const auto b = hipBlockIdx_z;
+    const auto tx = hipThreadIdx_x;
+    const auto ty = hipThreadIdx_y;
+
+    // (padding avoids bank conflicts when the tile is read by columns)
+    __shared__ T tile[BS2][BS2 + 1];
+
+    T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+    T* Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
+
+    // tile[x][y] = A(bx * BS2 + x, by * BS2 + y)
+    rocblas_int i = hipBlockIdx_x * BS2 + tx;
+    rocblas_int j = hipBlockIdx_y * BS2 + ty;
+    if(i < m && j < n)
+        tile[tx][ty] = CONJ ? conj(Ap[i + j * lda]) : Ap[i + j * lda];
+    __syncthreads();
+
+    // B(j, i) = A(i, j)
+    i = hipBlockIdx_x * BS2 + ty;
+    j = hipBlockIdx_y * BS2 + tx;
+    if(i < m && j < n)
+        Bp[j + i * ldb] = tile[ty][tx];
+}
+
+/** TRANSPOSE_SQUARE overwrites the n-by-n array A with its transpose (or conjugate transpose if
+    CONJ). Every thread-block swaps a pair of tiles that are symmetric with respect to the
+    diagonal, staging both of them in LDS.
+    Call this kernel with blocks (ceil(n/BS2), ceil(n/BS2), batch_count) of BS2-by-BS2 threads. **/
+template <typename T, bool CONJ, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS2* BS2) transpose_square(const rocblas_int n,
+                                                                   U A,
+                                                                   const rocblas_int shiftA,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA)
+{
+    const auto b = hipBlockIdx_z;
+    const auto bx = hipBlockIdx_x;
+    const auto by = hipBlockIdx_y;
+    const auto tx = hipThreadIdx_x;
+    const auto ty = hipThreadIdx_y;
+
+    // only the blocks on or below the diagonal do work
+    if(bx < by)
+        return;
+
+    __shared__ T t1[BS2][BS2 + 1];
+    __shared__ T t2[BS2][BS2 + 1];
+
+    T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+
+    // t1 holds tile (bx, by) and t2 holds tile (by, bx)
+    const rocblas_int i1 = bx * BS2 + tx;
+    const rocblas_int j1 = by * BS2 + ty;
+    const rocblas_int i2 = by * BS2 + tx;
+    const rocblas_int j2 = bx * BS2 + ty;
+    if(i1 < n && j1 < n)
+        t1[tx][ty] = CONJ ? conj(Ap[i1 + j1 * lda]) : Ap[i1 + j1 * lda];
+    if(i2 < n && j2 < n)
+        t2[tx][ty] = CONJ ? conj(Ap[i2 + j2 * lda]) : Ap[i2 + j2 * lda];
+    __syncthreads();
+
+    if(i1 < n && j1 < n)
+        Ap[i1 + j1 * lda] = t2[ty][tx];
+    if(bx != by && i2 < n && j2 < n)
+        Ap[i2 + j2 * lda] = t1[ty][tx];
+}
+
 template <typename T, typename U>
 ROCSOLVER_KERNEL void init_ident(const rocblas_int m,
                                  const rocblas_int n,
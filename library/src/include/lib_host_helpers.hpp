@@ -8,7 +8,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <hip/hip_runtime.h>
+#include <map>
+#include <mutex>
 #include <rocblas/rocblas.h>
+#include <utility>
 
 /*
  * ===========================================================================
@@ -47,6 +50,20 @@ T* const* cast2constPointer(T** array)
     return array;
 }
 
+/** Views an array of complex numbers as an array of real numbers with twice as many entries
+    (real and imaginary parts interleaved) **/
+template <typename S, typename T>
+S* cast2realType(T* array)
+{
+    return reinterpret_cast<S*>(array);
+}
+
+template <typename S, typename T>
+S* const* cast2realType(T* const* array)
+{
+    return reinterpret_cast<S* const*>(array);
+}
+
 inline rocblas_int get_index(rocblas_int* intervals, rocblas_int max, rocblas_int dim)
 {
     rocblas_int i;
@@ -60,6 +77,61 @@ inline rocblas_int get_index(rocblas_int* intervals, rocblas_int max, rocblas_in
     return i;
 }
 
+/** Returns the wavefront size of the current device (64 if it cannot be queried). The device
+    attribute is only queried the first time; the result is then cached per device. **/
+inline rocblas_int get_wavesize()
+{
+    static std::mutex mtx;
+    static std::map<int, rocblas_int> cache;
+
+    int device, wavesize;
+    if(hipGetDevice(&device) != hipSuccess)
+        return 64;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = cache.find(device);
+    if(it != cache.end())
+        return it->second;
+
+    if(hipDeviceGetAttribute(&wavesize, hipDeviceAttributeWarpSize, device) != hipSuccess)
+        wavesize = 64;
+
+    cache[device] = wavesize;
+    return wavesize;
+}
+
+/** Returns the number of workgroups of the given kernel that can be resident on the current device
+    at the same time, as required by a cooperative launch (0 if cooperative launches are not
+    supported or the device cannot be queried). The device is only queried the first time; the
+    result is then cached per device and kernel, so every call for a given kernel must use the
+    same threads and lmemsize. **/
+template <typename F>
+inline rocblas_int get_coresident_blocks(F kernel, const rocblas_int threads, const size_t lmemsize)
+{
+    static std::mutex mtx;
+    static std::map<std::pair<int, const void*>, rocblas_int> cache;
+
+    int device, coop, cus, blocks;
+    if(hipGetDevice(&device) != hipSuccess)
+        return 0;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto key = std::make_pair(device, (const void*)kernel);
+    auto it = cache.find(key);
+    if(it != cache.end())
+        return it->second;
+
+    if(hipDeviceGetAttribute(&coop, hipDeviceAttributeCooperativeLaunch, device) != hipSuccess
+       || !coop
+       || hipDeviceGetAttribute(&cus, hipDeviceAttributeMultiprocessorCount, device) != hipSuccess
+       || hipOccupancyMaxActiveBlocksPerMultiprocessor(&blocks, kernel, threads, lmemsize)
+           != hipSuccess)
+        blocks = cus = 0;
+
+    cache[key] = blocks * cus;
+    return blocks * cus;
+}
+
 #ifdef ROCSOLVER_VERIFY_ASSUMPTIONS
 // Ensure __assert_fail is declared.
 #if !__is_identifier(__assert_fail)
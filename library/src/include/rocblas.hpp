@@ -13,6 +13,7 @@
 #include "rocblas/internal/rocblas-exported-proto.hpp"
 #include "rocblas/internal/rocblas_device_malloc.hpp"
 #include "rocsolver_logger.hpp"
+#include "workspace_planner.hpp"
 
 // THESE FOLLOWING VALUES ARE TO MATCH ROCBLAS C++ INTERFACE
 // THEY ARE DEFINED/TUNED IN ROCBLAS
@@ -915,6 +916,48 @@ rocblas_status rocblasCall_trmm(rocblas_handle handle,
         strideB, cast2constPointer<T>(workArr), offsetB, ldb, strideB, batch_count);
 }
 
+// trmm overload
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocblasCall_trmm(rocblas_handle handle,
+                                rocblas_side side,
+                                rocblas_fill uplo,
+                                rocblas_operation transA,
+                                rocblas_diagonal diag,
+                                rocblas_int m,
+                                rocblas_int n,
+                                U alpha,
+                                rocblas_stride stride_alpha,
+                                T* A,
+                                rocblas_stride offsetA,
+                                rocblas_int lda,
+                                rocblas_stride strideA,
+                                T* const* B,
+                                rocblas_stride offsetB,
+                                rocblas_int ldb,
+                                rocblas_stride strideB,
+                                rocblas_int batch_count,
+                                T** workArr)
+{
+    // TODO: How to get alpha for trace logging
+    ROCBLAS_ENTER("trmm", "side:", side, "uplo:", uplo, "trans:", transA, "diag:", diag, "m:", m,
+                  "n:", n, "shiftA:", offsetA, "lda:", lda, "shiftB:", offsetB, "ldb:", ldb,
+                  "bc:", batch_count);
+
+    constexpr rocblas_int nb = (!is_complex<T> ? ROCBLAS_TRMM_REAL_NB : ROCBLAS_TRMM_COMPLEX_NB);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, A, strideA,
+                            batch_count);
+
+    return rocblas_internal_trmm_template<nb, BATCHED, T>(
+        handle, side, uplo, transA, diag, m, n, cast2constType<T>(alpha), stride_alpha,
+        cast2constType<T>(workArr), offsetA, lda, strideA, cast2constType<T>(B), offsetB, ldb,
+        strideB, B, offsetB, ldb, strideB, batch_count);
+}
+
 // syr2
 template <typename T, typename U, typename V, std::enable_if_t<!is_complex<T>, int> = 0>
 rocblas_status rocblasCall_syr2_her2(rocblas_handle handle,
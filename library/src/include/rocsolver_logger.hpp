@@ -7,6 +7,9 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 #include <fmt/ranges.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <forward_list>
 #include <fstream>
 #include <memory>
@@ -25,6 +28,9 @@
  * rocSOLVER logging macros
  ***************************************************************************/
 
+// ROCSOLVER_ENTER_TOP must be used as a statement at the function scope of a top-level (impl)
+// function, before any return: it declares the local variables _log_token and _phase_token,
+// whose lifetimes delimit the logged call and its host phases.
 #define ROCSOLVER_ENTER_TOP(name, ...)                                                      \
     std::unique_ptr<rocsolver_logger::scope_guard<T>> _log_token;                           \
     do                                                                                      \
@@ -35,7 +41,12 @@
                                                                  __VA_ARGS__);              \
             _log_token = std::make_unique<rocsolver_logger::scope_guard<T>>(true, handle);  \
         }                                                                                   \
-    } while(0)
+    } while(0);                                                                             \
+    rocsolver_logger::phase_guard<T> _phase_token(name)
+// ROCSOLVER_BEGIN_PHASE closes the current host phase of the running top-level function and
+// starts the given one. It can be used in templates and helpers called from the top-level
+// function; it has no effect when phase logging is disabled.
+#define ROCSOLVER_BEGIN_PHASE(phase) rocsolver_logger::begin_phase(rocblas_log_phase_##phase)
 #define ROCSOLVER_ENTER(name, ...)                                                              \
     std::unique_ptr<rocsolver_logger::scope_guard<T>> _log_token;                               \
     do                                                                                          \
@@ -67,6 +78,18 @@
         }                                                                                           \
         hipLaunchKernelGGL((name), __VA_ARGS__);                                                    \
     } while(0)
+#define ROCSOLVER_LAUNCH_COOPERATIVE_KERNEL(status, name, grid, block, lmemsize, stream, args)      \
+    do                                                                                              \
+    {                                                                                               \
+        std::unique_ptr<rocsolver_logger::scope_guard<T>> _kernel_log_token;                        \
+        if(rocsolver_logger::is_logging_enabled() && rocsolver_logger::is_kernel_logging_enabled()) \
+        {                                                                                           \
+            rocsolver_logger::instance()->log_enter<T>(handle, nullptr, #name);                     \
+            _kernel_log_token = std::make_unique<rocsolver_logger::scope_guard<T>>(false, handle);  \
+        }                                                                                           \
+        status = hipLaunchCooperativeKernel((const void*)(name), grid, block, args, lmemsize,       \
+                                            stream);                                                \
+    } while(0)
 
 /***************************************************************************
  * The rocsolver_log_entry struct records function data for trace and
@@ -121,6 +144,30 @@ struct rocsolver_profile_entry
     rocsolver_profile_entry(const rocsolver_profile_entry&) = delete;
 };
 
+/***************************************************************************
+ * The rocsolver_phase_entry struct records the host time spent in each
+ * phase of the calls to a top-level function for phase logging purposes.
+ ***************************************************************************/
+constexpr int rocsolver_num_phases = rocblas_log_phase_pointer_mode + 1;
+constexpr int rocsolver_phase_bins = 32;
+
+struct rocsolver_phase_entry
+{
+    int calls;
+    std::array<int, rocsolver_num_phases> phase_calls;
+    std::array<double, rocsolver_num_phases> phase_time;
+    std::array<std::array<int, rocsolver_phase_bins>, rocsolver_num_phases> histogram;
+
+    rocsolver_phase_entry()
+        : calls(0)
+        , phase_calls{}
+        , phase_time{}
+        , histogram{}
+    {
+    }
+};
+using rocsolver_phase_map = std::unordered_map<std::string, rocsolver_phase_entry>;
+
 /***************************************************************************
  * The rocsolver_logger class provides functions to be called upon entering
  * or exiting a function that will output multi-level logging information.
@@ -134,6 +181,8 @@ private:
     static std::mutex _mutex;
     // profile logging data keyed by function name
     rocsolver_profile_map profile;
+    // phase logging data keyed by function name
+    rocsolver_phase_map phases;
     // function call stack keyed by handle
     std::unordered_map<rocblas_handle, std::vector<rocsolver_log_entry>> call_stack;
     // the maximum depth at which nested function calls will appear in the log
@@ -160,6 +209,12 @@ private:
                         rocsolver_profile_map::iterator start,
                         rocsolver_profile_map::iterator end);
 
+    // prints the results of phase logging
+    void append_phases(std::string& str);
+
+    // writes the HOST PHASES section to the profile stream if phase logging is enabled
+    void write_phases();
+
     // combines a function prefix and name into an std::string
     template <typename T>
     std::string get_func_name(const char* func_prefix, const char* func_name)
@@ -235,6 +290,35 @@ private:
         from_profile.time += time;
     }
 
+    // populates phase logging data with the phase times of a top-level function call
+    // (a negative time indicates that the phase was not reached; a phase entered several
+    // times, like the pointer mode switching of nested templates, is recorded once per call
+    // with the accumulated time)
+    template <typename T>
+    void log_phases(const char* func_name, const std::array<double, rocsolver_num_phases>& times)
+    {
+        std::string name = get_func_name<T>("rocsolver", func_name);
+
+        const std::lock_guard<std::mutex> lock(rocsolver_logger::_mutex);
+
+        rocsolver_phase_entry& entry = phases[name];
+        entry.calls++;
+        for(int p = 0; p < rocsolver_num_phases; p++)
+        {
+            if(times[p] < 0)
+                continue;
+
+            // bin 0 holds times under 1 us, and bin k > 0 times in [2^(k-1), 2^k) us
+            int bin = 0;
+            for(double t = times[p]; t >= 1 && bin < rocsolver_phase_bins - 1; t *= 0.5)
+                bin++;
+
+            entry.phase_calls[p]++;
+            entry.phase_time[p] += times[p];
+            entry.histogram[p][bin]++;
+        }
+    }
+
     static std::unique_lock<std::mutex> acquire_lock()
     {
         return std::unique_lock<std::mutex>(rocsolver_logger::_mutex);
@@ -256,6 +340,20 @@ public:
                    | rocblas_layer_mode_log_profile));
     }
 
+    // returns true if the host-side phases of top-level functions are timed
+    static __forceinline__ bool is_phase_logging_enabled()
+    {
+        return (rocsolver_logger::_instance != nullptr)
+            && (rocsolver_logger::_instance->layer_mode & rocblas_layer_mode_ex_log_phases);
+    }
+
+    // closes the current phase of the running top-level function and starts the given one
+    static __forceinline__ void begin_phase(rocblas_log_phase next)
+    {
+        if(rocsolver_logger::_current_phase)
+            rocsolver_logger::_current_phase->begin(next);
+    }
+
     // returns true if logging facilities are enabled for kernels
     static __forceinline__ bool is_kernel_logging_enabled()
     {
@@ -362,6 +460,88 @@ public:
         scope_guard& operator=(const scope_guard&) = delete;
     };
 
+    /***************************************************************************
+     * The phase_timer struct times the host-side phases of a top-level function
+     * with a steady clock. The first phase is the argument checking; each call
+     * to begin closes the current phase and adds its duration to the time of
+     * that phase.
+     ***************************************************************************/
+    struct phase_timer
+    {
+        using clock = std::chrono::steady_clock;
+
+        rocblas_log_phase phase;
+        clock::time_point start;
+        std::array<double, rocsolver_num_phases> times;
+
+        // starts the argument checking phase
+        void reset()
+        {
+            phase = rocblas_log_phase_arg_check;
+            times.fill(-1);
+            start = clock::now();
+        }
+
+        // closes the current phase and starts the given one
+        void begin(rocblas_log_phase next)
+        {
+            clock::time_point now = clock::now();
+            double elapsed = std::chrono::duration<double, std::micro>(now - start).count();
+            times[phase] = std::max(times[phase], 0.0) + elapsed;
+            start = now;
+            phase = next;
+        }
+    };
+
+    /***************************************************************************
+     * The phase_guard struct makes a phase_timer the timer of the running
+     * top-level function of the calling thread while phase logging is enabled.
+     * The last phase is closed and recorded upon the function losing scope.
+     ***************************************************************************/
+    template <typename T>
+    struct phase_guard
+    {
+        bool active;
+        const char* func_name;
+        phase_timer timer;
+        phase_timer* outer;
+
+        // Constructor
+        explicit phase_guard(const char* func_name)
+            : active(rocsolver_logger::is_phase_logging_enabled())
+            , func_name(func_name)
+            , outer(rocsolver_logger::_current_phase)
+        {
+            if(active)
+            {
+                timer.reset();
+                rocsolver_logger::_current_phase = &timer;
+            }
+        }
+
+        // Copy constructor is deleted
+        phase_guard(const phase_guard&) = delete;
+
+        // Destructor
+        ~phase_guard()
+        {
+            if(active)
+            {
+                rocsolver_logger::_current_phase = outer;
+                timer.begin(timer.phase);
+                if(rocsolver_logger::instance())
+                    rocsolver_logger::instance()->log_phases<T>(func_name, timer.times);
+            }
+        }
+
+        // Assignment operator is deleted
+        phase_guard& operator=(const phase_guard&) = delete;
+    };
+
+private:
+    // timer of the top-level function running in the calling thread (when phase logging)
+    static thread_local phase_timer* _current_phase;
+
     friend rocblas_status rocsolver_log_begin(void);
     friend rocblas_status rocsolver_log_end(void);
     friend rocblas_status rocsolver_log_set_layer_mode(const rocblas_layer_mode_flags layer_mode);
@@ -369,4 +549,10 @@ public:
     friend rocblas_status rocsolver_log_restore_defaults(void);
     friend rocblas_status rocsolver_log_write_profile(void);
     friend rocblas_status rocsolver_log_flush_profile(void);
+    friend rocblas_status rocsolver_log_get_phase_stats(const char* func_name,
+                                                        const rocblas_log_phase phase,
+                                                        rocblas_int* calls,
+                                                        double* total_time,
+                                                        rocblas_int* histogram,
+                                                        const rocblas_int hist_size);
 };
@@ -182,6 +182,16 @@ struct formatter<rocsolver_logvalue<rocblas_eorder>> : formatter<char>
     }
 };
 
+template <>
+struct formatter<rocsolver_logvalue<rocblas_matfunc>> : formatter<char>
+{
+    template <typename FormatCtx>
+    auto format(rocsolver_logvalue<rocblas_matfunc> wrapper, FormatCtx& ctx) ROCSOLVER_FMT_CONST
+    {
+        return formatter<char>::format(rocblas2char_matfunc(wrapper.value), ctx);
+    }
+};
+
 template <>
 struct formatter<rocsolver_logvalue<rocblas_datatype>> : formatter<string_view>
 {
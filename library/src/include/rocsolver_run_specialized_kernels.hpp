@@ -17,6 +17,11 @@
 
 #ifdef OPTIMAL
 
+/** SMALL_WAVESIZE is the wavefront size used to instantiate a kernel specialized for DIM
+    columns on devices whose wavefront is narrower than DIM. Kernels with no more columns
+    than 32 need no extra synchronization on either width, so the wave64 instance is reused. **/
+#define SMALL_WAVESIZE(DIM) ((DIM) > 32 ? 32 : 64)
+
 template <typename T, typename U>
 rocblas_status getf2_run_panel(rocblas_handle handle,
                                const rocblas_int m,
@@ -35,6 +40,26 @@ rocblas_status getf2_run_panel(rocblas_handle handle,
                                rocblas_int* permut_idx,
                                const rocblas_stride stride);
 
+template <typename T, typename U>
+rocblas_status getf2_run_panel_coop(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    rocblas_int* ipiv,
+                                    const rocblas_int shiftP,
+                                    const rocblas_stride strideP,
+                                    rocblas_int* info,
+                                    const rocblas_int batch_count,
+                                    const bool pivot,
+                                    const rocblas_int offset,
+                                    rocblas_int* permut_idx,
+                                    const rocblas_stride stride,
+                                    T* pivotval,
+                                    rocblas_int* pivotidx);
+
 template <typename T, typename U>
 void getf2_run_scale_update(rocblas_handle handle,
                             const rocblas_int m,
@@ -92,4 +117,35 @@ void trti2_run_small(rocblas_handle handle,
                      const rocblas_stride strideA,
                      const rocblas_int batch_count);
 
+template <typename T, typename U>
+void potri_run_small(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     rocblas_int* info,
+                     const rocblas_int batch_count);
+
+/** SYTF2_SMALL_MAX_COLS returns the largest size handled by SYTF2_RUN_SMALL for type T. **/
+template <typename T>
+constexpr rocblas_int sytf2_small_max_cols()
+{
+    return is_complex<T> ? SYTF2_MAX_COLS_COMPLEX : SYTF2_MAX_COLS;
+}
+
+template <typename T, typename U>
+void sytf2_run_small(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     rocblas_int* ipiv,
+                     const rocblas_stride strideP,
+                     rocblas_int* info,
+                     const rocblas_int batch_count);
+
 #endif // OPTIMAL
@@ -0,0 +1,471 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_potrf.hpp"
+#include "rocsolver.h"
+
+/** CHOLQR_FLAG_KERNEL lists in flags the instances that need the shifted CholeskyQR3
+    algorithm, and returns their number in nflags (which must be zero on entry). These are
+    the instances whose Gram matrix is not numerically positive definite (info > 0), and
+    those whose Cholesky factor R has max|r_ii| > tol * min|r_ii| (the ratio is a lower
+    bound of the condition number of A).
+    Call this kernel with one thread per instance **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void cholqr_flag_kernel(const rocblas_int n,
+                                         U RR,
+                                         const rocblas_int shiftR,
+                                         const rocblas_int ldr,
+                                         const rocblas_stride strideR,
+                                         rocblas_int* info,
+                                         rocblas_int* flags,
+                                         rocblas_int* nflags,
+                                         const S tol,
+                                         const rocblas_int batch_count)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count)
+    {
+        bool flag = (info[b] > 0);
+
+        if(!flag)
+        {
+            T* R = load_ptr_batch<T>(RR, b, shiftR, strideR);
+
+            S rmax = std::real(R[0]);
+            S rmin = rmax;
+            for(rocblas_int k = 1; k < n; k++)
+            {
+                S r = std::real(R[k + k * ldr]);
+                rmax = (r > rmax) ? r : rmax;
+                rmin = (r < rmin) ? r : rmin;
+            }
+            flag = (rmax > tol * rmin);
+        }
+
+        if(flag)
+            flags[atomicAdd(nflags, 1)] = b;
+    }
+}
+
+/** CHOLQR_GET_ARRAYS sets arrays of pointers to the matrices A and R, and to the
+    n-by-n blocks of G, of the nflags instances listed in flags.
+    Call this kernel with one thread per listed instance **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void cholqr_get_arrays(const rocblas_int nflags,
+                                        rocblas_int* flags,
+                                        U AA,
+                                        const rocblas_int shiftA,
+                                        const rocblas_stride strideA,
+                                        U RR,
+                                        const rocblas_int shiftR,
+                                        const rocblas_stride strideR,
+                                        T* G,
+                                        const rocblas_stride strideG,
+                                        T** Aarr,
+                                        T** Rarr,
+                                        T** Garr)
+{
+    rocblas_int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(k < nflags)
+    {
+        rocblas_int b = flags[k];
+        Aarr[k] = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        Rarr[k] = load_ptr_batch<T>(RR, b, shiftR, strideR);
+        Garr[k] = G + b * strideG;
+    }
+}
+
+/** CHOLQR_SHIFT_KERNEL sets R = G + s*I (upper triangular part) for the listed instances,
+    where G is the Gram matrix A'*A (with leading dimension n) and s is the shift of the
+    first iteration of the shifted CholeskyQR3 algorithm,
+    s = 11 * (m*n + n*(n+1)) * eps * ||A||_F^2.
+    Call this kernel with one group per listed instance **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void cholqr_shift_kernel(const rocblas_int m,
+                                          const rocblas_int n,
+                                          T* const* Rarr,
+                                          const rocblas_int ldr,
+                                          T* const* Garr,
+                                          const S eps)
+{
+    rocblas_int bid = hipBlockIdx_x;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // select listed instance to work with
+    T* R = Rarr[bid];
+    T* G = Garr[bid];
+
+    __shared__ S sval;
+
+    // the trace of A'*A is the squared Frobenius norm of A
+    if(tid == 0)
+    {
+        S nrm = 0;
+        for(rocblas_int k = 0; k < n; k++)
+            nrm += std::real(G[k + k * n]);
+        sval = 11 * (S(m) * n + S(n) * (n + 1)) * eps * nrm;
+    }
+    __syncthreads();
+
+    for(rocblas_int idx = tid; idx < n * n; idx += hipBlockDim_x)
+    {
+        rocblas_int i = idx % n;
+        rocblas_int j = idx / n;
+        if(i <= j)
+            R[i + j * ldr] = G[i + j * n] + (i == j ? T(sval) : T(0));
+    }
+}
+
+/** CHOLQR_MASK_KERNEL sets the upper triangular part of R to the identity for the listed
+    instances that already failed (info > 0), so that the following CholeskyQR iteration
+    leaves them unchanged.
+    Call this kernel with one thread per entry of R and one group in z per listed instance **/
+template <typename T>
+ROCSOLVER_KERNEL void cholqr_mask_kernel(const rocblas_int n,
+                                         T* const* Rarr,
+                                         const rocblas_int ldr,
+                                         rocblas_int* flags,
+                                         rocblas_int* info)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(info[flags[bid]] > 0 && i < n && j < n && i <= j)
+    {
+        T* R = Rarr[bid];
+        R[i + j * ldr] = (i == j ? T(1) : T(0));
+    }
+}
+
+/** CHOLQR_INFO_KERNEL reports in info the result of a factorization (given in pinfo) of the
+    nflags instances listed in flags (or of the first nflags instances if flags is null).
+    If replace is true, info is overwritten; otherwise only new failures are reported **/
+template <typename T>
+ROCSOLVER_KERNEL void cholqr_info_kernel(const rocblas_int nflags,
+                                         T* flags,
+                                         T* info,
+                                         T* pinfo,
+                                         const bool replace)
+{
+    rocblas_int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(k < nflags)
+    {
+        rocblas_int b = flags ? flags[k] : k;
+        if(replace || (info[b] == 0 && pinfo[k] > 0))
+            info[b] = pinfo[k];
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_cholqr_argCheck(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int lda,
+                                         const rocblas_int ldr,
+                                         U A,
+                                         T* R,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || m < n || lda < m || ldr < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !R) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, typename T>
+void rocsolver_cholqr_getMemorySize(const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    size_t* size_scalars,
+                                    size_t* size_work1,
+                                    size_t* size_work2,
+                                    size_t* size_work3,
+                                    size_t* size_work4,
+                                    size_t* size_pivots_workArr,
+                                    size_t* size_iinfo,
+                                    size_t* size_Rtmp,
+                                    size_t* size_flags,
+                                    size_t* size_Rarr,
+                                    bool* optim_mem)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots_workArr = 0;
+        *size_iinfo = 0;
+        *size_Rtmp = 0;
+        *size_flags = 0;
+        *size_Rarr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    size_t temp1, temp2, temp3, temp4, temp5, temp6, temp7;
+    bool temp8;
+
+    // requirements for calling POTRF
+    rocsolver_potrf_getMemorySize<BATCHED, T>(n, rocblas_fill_upper, batch_count, size_scalars,
+                                              size_work1, size_work2, size_work3, size_work4,
+                                              size_pivots_workArr, size_iinfo, optim_mem);
+
+    // requirements for calling POTRF on the listed instances (through arrays of pointers)
+    rocsolver_potrf_getMemorySize<true, T>(n, rocblas_fill_upper, batch_count, &temp1, &temp2,
+                                           &temp3, &temp4, &temp5, &temp6, &temp7, &temp8);
+    *size_scalars = max(*size_scalars, temp1);
+    *size_work1 = max(*size_work1, temp2);
+    *size_work2 = max(*size_work2, temp3);
+    *size_work3 = max(*size_work3, temp4);
+    *size_work4 = max(*size_work4, temp5);
+    *size_pivots_workArr = max(*size_pivots_workArr, temp6);
+    *size_iinfo = max(*size_iinfo, temp7);
+    *optim_mem = *optim_mem && temp8;
+
+    // requirements for calling TRSM
+    rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_right, rocblas_operation_none, m, n,
+                                     batch_count, &temp1, &temp2, &temp3, &temp4);
+    *size_work1 = max(*size_work1, temp1);
+    *size_work2 = max(*size_work2, temp2);
+    *size_work3 = max(*size_work3, temp3);
+    *size_work4 = max(*size_work4, temp4);
+
+    // requirements for calling TRSM on the listed instances
+    rocblasCall_trsm_mem<true, T>(rocblas_side_right, rocblas_operation_none, m, n, batch_count,
+                                  &temp1, &temp2, &temp3, &temp4);
+    *size_work1 = max(*size_work1, temp1);
+    *size_work2 = max(*size_work2, temp2);
+    *size_work3 = max(*size_work3, temp3);
+    *size_work4 = max(*size_work4, temp4);
+
+    // array of pointers for calling TRMM in the batched case
+    if(BATCHED)
+        *size_pivots_workArr = max(*size_pivots_workArr, sizeof(T*) * batch_count);
+
+    // arrays of pointers to A, R and the temporary factors of the listed instances
+    // (and to R in the batched case)
+    *size_Rarr = sizeof(T*) * (BATCHED ? 4 : 3) * batch_count;
+
+    // temporary triangular factor
+    *size_Rtmp = sizeof(T) * n * n * batch_count;
+
+    // list of the instances that need the shift, info of the other iterations, and
+    // number of listed instances
+    *size_flags = sizeof(rocblas_int) * (2 * batch_count + 1);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_cholqr_template(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         U A,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         T* R,
+                                         const rocblas_int shiftR,
+                                         const rocblas_int ldr,
+                                         const rocblas_stride strideR,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count,
+                                         T* scalars,
+                                         void* work1,
+                                         void* work2,
+                                         void* work3,
+                                         void* work4,
+                                         void* pivots_workArr,
+                                         rocblas_int* iinfo,
+                                         T* Rtmp,
+                                         rocblas_int* flags,
+                                         T** Rarr,
+                                         bool optim_mem)
+{
+    ROCSOLVER_ENTER("cholqr", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "shiftR:", shiftR,
+                    "ldr:", ldr, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with a full rank matrix)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // constants for rocblas functions calls
+    T one = 1;
+    S s_one = 1;
+    S s_zero = 0;
+
+    // unit roundoff
+    S eps = get_epsilon<S>() / 2;
+
+    // R is accessed as the matrix A (through an array of pointers in the batched case)
+    U RR = (U)R;
+    if(BATCHED)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(get_array, gridReset, threads, 0, stream, Rarr, R, strideR,
+                                batch_count);
+        RR = (U)Rarr;
+    }
+
+    rocblas_stride strideT = n * n;
+    rocblas_int blocks = (n - 1) / BS2 + 1;
+    rocblas_int* pinfo = flags + batch_count;
+    rocblas_int* nflags = pinfo + batch_count;
+
+    // arrays of pointers to the instances that need the shift
+    T* const* Aarr = Rarr + (BATCHED ? batch_count : 0);
+    T* const* Rcarr = Aarr + batch_count;
+    T* const* Tarr = Rcarr + batch_count;
+
+    // threshold on the estimated condition number of A beyond which CholeskyQR2 is not
+    // guaranteed to give an orthogonal factor, kappa(A) <= (8 * sqrt(m*n + n*(n+1)) * eps)^(-1/2)
+    S tol = S(1) / sqrt(8 * sqrt(S(m) * n + S(n) * (n + 1)) * eps);
+
+    // 1. first iteration: R = chol(A'*A); then A = A*inv(R)
+    rocblasCall_syrk_herk<T>(handle, rocblas_fill_upper, rocblas_operation_conjugate_transpose, n,
+                             m, &s_one, A, shiftA, lda, strideA, &s_zero, RR, shiftR, ldr, strideR,
+                             batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(BS2, BS2), 0,
+                            stream, n, n, RR, shiftR, ldr, strideR, Rtmp, 0, n, strideT);
+    rocsolver_potrf_template<BATCHED, T, S>(handle, rocblas_fill_upper, n, RR, shiftR, ldr, strideR,
+                                            info, batch_count, scalars, work1, work2, work3, work4,
+                                            (T*)pivots_workArr, iinfo, optim_mem);
+
+    // list the instances whose Gram matrix is not numerically positive definite or that are
+    // ill-conditioned. Only these need the shifted CholeskyQR3 algorithm, so the number of
+    // listed instances is read back to skip its extra work when possible
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1), dim3(1), 0, stream, nflags, 1, 0);
+    ROCSOLVER_LAUNCH_KERNEL((cholqr_flag_kernel<T, S>), gridReset, threads, 0, stream, n, RR,
+                            shiftR, ldr, strideR, info, flags, nflags, tol, batch_count);
+    rocblas_int hflags;
+    hipMemcpyAsync(&hflags, nflags, sizeof(rocblas_int), hipMemcpyDeviceToHost, stream);
+    hipStreamSynchronize(stream);
+
+    rocblas_int blocksFlags = (hflags - 1) / BS1 + 1;
+    if(hflags > 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(cholqr_get_arrays<T>, dim3(blocksFlags), threads, 0, stream,
+                                hflags, flags, A, shiftA, strideA, RR, shiftR, strideR, Rtmp,
+                                strideT, (T**)Aarr, (T**)Rcarr, (T**)Tarr);
+
+        // re-factorize the listed instances with the shifted Gram matrices R = chol(A'*A + s*I)
+        ROCSOLVER_LAUNCH_KERNEL((cholqr_shift_kernel<T, S>), dim3(hflags), dim3(BS1), 0, stream,
+                                m, n, Rcarr, ldr, Tarr, eps);
+        rocsolver_potrf_template<true, T, S>(handle, rocblas_fill_upper, n, Rcarr, 0, ldr, 0,
+                                             pinfo, hflags, scalars, work1, work2, work3, work4,
+                                             (T*)pivots_workArr, iinfo, optim_mem);
+        ROCSOLVER_LAUNCH_KERNEL(cholqr_info_kernel<rocblas_int>, dim3(blocksFlags), threads, 0,
+                                stream, hflags, flags, info, pinfo, true);
+    }
+
+    rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_right, rocblas_fill_upper,
+                                 rocblas_operation_none, rocblas_diagonal_non_unit, m, n, &one, RR,
+                                 shiftR, ldr, strideR, A, shiftA, lda, strideA, batch_count,
+                                 optim_mem, work1, work2, work3, work4);
+
+    // save the triangular factor (with zeros below the diagonal)
+    ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocks, blocks, batch_count), dim3(BS2, BS2), 0,
+                            stream, n, n, RR, shiftR, ldr, strideR, rocblas_fill_upper);
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(BS2, BS2), 0,
+                            stream, n, n, RR, shiftR, ldr, strideR, Rtmp, 0, n, strideT);
+
+    // 2. second iteration: R2 = chol(A'*A), A = A*inv(R2) and R = R2*R
+    rocblasCall_syrk_herk<T>(handle, rocblas_fill_upper, rocblas_operation_conjugate_transpose, n,
+                             m, &s_one, A, shiftA, lda, strideA, &s_zero, RR, shiftR, ldr, strideR,
+                             batch_count);
+    rocsolver_potrf_template<BATCHED, T, S>(handle, rocblas_fill_upper, n, RR, shiftR, ldr, strideR,
+                                            pinfo, batch_count, scalars, work1, work2, work3, work4,
+                                            (T*)pivots_workArr, iinfo, optim_mem);
+
+    rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_right, rocblas_fill_upper,
+                                 rocblas_operation_none, rocblas_diagonal_non_unit, m, n, &one, RR,
+                                 shiftR, ldr, strideR, A, shiftA, lda, strideA, batch_count,
+                                 optim_mem, work1, work2, work3, work4);
+
+    rocblasCall_trmm<BATCHED, STRIDED, T>(handle, rocblas_side_left, rocblas_fill_upper,
+                                          rocblas_operation_none, rocblas_diagonal_non_unit, n, n,
+                                          &one, 0, RR, shiftR, ldr, strideR, Rtmp, 0, n, strideT,
+                                          batch_count, (T**)pivots_workArr);
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(BS2, BS2), 0,
+                            stream, n, n, Rtmp, 0, n, strideT, RR, shiftR, ldr, strideR);
+
+    ROCSOLVER_LAUNCH_KERNEL(cholqr_info_kernel<rocblas_int>, gridReset, threads, 0, stream,
+                            batch_count, (rocblas_int*)nullptr, info, pinfo, false);
+
+    // 3. third iteration, only for the listed instances (i.e. shifted CholeskyQR3).
+    // Listed instances that already failed are factorized as the identity, which leaves
+    // A and R unchanged
+    if(hflags > 0)
+    {
+        rocblasCall_syrk_herk<T>(handle, rocblas_fill_upper, rocblas_operation_conjugate_transpose,
+                                 n, m, &s_one, Aarr, 0, lda, 0, &s_zero, Rcarr, 0, ldr, 0, hflags);
+        ROCSOLVER_LAUNCH_KERNEL(cholqr_mask_kernel<T>, dim3(blocks, blocks, hflags),
+                                dim3(BS2, BS2), 0, stream, n, Rcarr, ldr, flags, info);
+        rocsolver_potrf_template<true, T, S>(handle, rocblas_fill_upper, n, Rcarr, 0, ldr, 0,
+                                             pinfo, hflags, scalars, work1, work2, work3, work4,
+                                             (T*)pivots_workArr, iinfo, optim_mem);
+
+        rocblasCall_trsm<true, T>(handle, rocblas_side_right, rocblas_fill_upper,
+                                  rocblas_operation_none, rocblas_diagonal_non_unit, m, n, &one,
+                                  Rcarr, 0, ldr, 0, Aarr, 0, lda, 0, hflags, optim_mem, work1,
+                                  work2, work3, work4);
+
+        rocblasCall_trmm<true, false, T>(handle, rocblas_side_left, rocblas_fill_upper,
+                                         rocblas_operation_none, rocblas_diagonal_non_unit, n, n,
+                                         &one, 0, Rcarr, 0, ldr, 0, Tarr, 0, n, 0, hflags);
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocks, hflags), dim3(BS2, BS2), 0,
+                                stream, n, n, Tarr, 0, n, 0, Rcarr, 0, ldr, 0);
+
+        ROCSOLVER_LAUNCH_KERNEL(cholqr_info_kernel<rocblas_int>, dim3(blocksFlags), threads, 0,
+                                stream, hflags, flags, info, pinfo, false);
+    }
+
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    return rocblas_status_success;
+}
@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_cholqr.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_cholqr_strided_batched_impl(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     U A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     T* R,
+                                                     const rocblas_int ldr,
+                                                     const rocblas_stride strideR,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("cholqr_strided_batched", "-m", m, "-n", n, "--lda", lda,
+                        "--strideA", strideA, "--ldr", ldr, "--strideR", strideR,
+                        "--batch_count", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_cholqr_argCheck(handle, m, n, lda, ldr, A, R, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftR = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling POTRF and TRMM
+    size_t size_pivots_workArr, size_iinfo;
+    // size of the temporary triangular factor
+    size_t size_Rtmp;
+    // size to store the instances that need the shift and the info of the second iteration
+    size_t size_flags;
+    // size of the arrays of pointers to the instances that need the shift (and to R in the
+    // batched case)
+    size_t size_Rarr;
+    rocsolver_cholqr_getMemorySize<false, T>(m, n, batch_count, &size_scalars, &size_work1,
+                                             &size_work2, &size_work3, &size_work4,
+                                             &size_pivots_workArr, &size_iinfo, &size_Rtmp,
+                                             &size_flags, &size_Rarr, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivots_workArr,
+                                                      size_iinfo, size_Rtmp, size_flags, size_Rarr);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivots_workArr, *iinfo, *Rtmp, *flags, *Rarr;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+                              size_pivots_workArr, size_iinfo, size_Rtmp, size_flags, size_Rarr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivots_workArr = mem[5];
+    iinfo = mem[6];
+    Rtmp = mem[7];
+    flags = mem[8];
+    Rarr = mem[9];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_cholqr_template<false, true, T, S>(handle, m, n, A, shiftA, lda, strideA, R,
+                                                        shiftR, ldr, strideR, info, batch_count,
+                                                        (T*)scalars, work1, work2, work3, work4,
+                                                        pivots_workArr, (rocblas_int*)iinfo,
+                                                        (T*)Rtmp, (rocblas_int*)flags, (T**)Rarr,
+                                                        optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_scholqr_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 float* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 float* R,
+                                                 const rocblas_int ldr,
+                                                 const rocblas_stride strideR,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_cholqr_strided_batched_impl<float>(handle, m, n, A, lda, strideA, R, ldr,
+                                                        strideR, info, batch_count);
+}
+
+rocblas_status rocsolver_dcholqr_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 double* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 double* R,
+                                                 const rocblas_int ldr,
+                                                 const rocblas_stride strideR,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_cholqr_strided_batched_impl<double>(handle, m, n, A, lda, strideA, R, ldr,
+                                                         strideR, info, batch_count);
+}
+
+rocblas_status rocsolver_ccholqr_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_float_complex* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 rocblas_float_complex* R,
+                                                 const rocblas_int ldr,
+                                                 const rocblas_stride strideR,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_cholqr_strided_batched_impl<rocblas_float_complex>(
+        handle, m, n, A, lda, strideA, R, ldr, strideR, info, batch_count);
+}
+
+rocblas_status rocsolver_zcholqr_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 rocblas_double_complex* R,
+                                                 const rocblas_int ldr,
+                                                 const rocblas_stride strideR,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_cholqr_strided_batched_impl<rocblas_double_complex>(
+        handle, m, n, A, lda, strideA, R, ldr, strideR, info, batch_count);
+}
+} // extern C
@@ -34,6 +34,8 @@ rocblas_status rocsolver_gebd2_strided_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -51,6 +53,8 @@ rocblas_status rocsolver_gebd2_strided_batched_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
                                                       size_Abyx_norms);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms;
     rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms);
@@ -58,12 +62,16 @@ rocblas_status rocsolver_gebd2_strided_batched_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work_workArr = mem[1];
     Abyx_norms = mem[2];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_gebd2_template<T>(handle, m, n, A, shiftA, lda, strideA, D, strideD, E,
                                        strideE, tauq, strideQ, taup, strideP, batch_count,
@@ -25,6 +25,8 @@ rocblas_status rocsolver_gebrd_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftX = 0;
@@ -57,6 +59,8 @@ rocblas_status rocsolver_gebrd_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
                                                       size_Abyx_norms, size_X, size_Y);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms, *X, *Y;
     rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms, size_X,
@@ -65,6 +69,8 @@ rocblas_status rocsolver_gebrd_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work_workArr = mem[1];
     Abyx_norms = mem[2];
@@ -73,6 +79,8 @@ rocblas_status rocsolver_gebrd_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_gebrd_template<false, false, T>(
         handle, m, n, A, shiftA, lda, strideA, D, strideD, E, strideE, tauq, strideQ, taup, strideP,
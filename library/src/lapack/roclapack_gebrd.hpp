@@ -120,9 +120,11 @@ rocblas_status rocsolver_gebrd_template(rocblas_handle handle,
                                            scalars, work_workArr, Abyx_norms);
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     while(j < dim - k)
     {
@@ -175,6 +177,8 @@ rocblas_status rocsolver_gebrd_template(rocblas_handle handle,
                                     D + j, strideD, E + j, strideE, tauq + j, strideQ, taup + j,
                                     strideP, batch_count, scalars, work_workArr, Abyx_norms);
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
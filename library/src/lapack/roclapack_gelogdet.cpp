@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gelogdet.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gelogdet_impl(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       U A,
+                                       const rocblas_int lda,
+                                       rocblas_int* ipiv,
+                                       T* sign,
+                                       S* logdet)
+{
+    ROCSOLVER_ENTER_TOP("gelogdet", "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gelogdet_argCheck(handle, n, lda, A, ipiv, sign, logdet);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftP = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    // (there is no info array; a zero pivot in U gives a zero determinant)
+    return rocsolver_gelogdet_template<T>(handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP,
+                                          sign, logdet, (rocblas_int*)nullptr, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgelogdet(rocblas_handle handle,
+                                   const rocblas_int n,
+                                   float* A,
+                                   const rocblas_int lda,
+                                   rocblas_int* ipiv,
+                                   float* sign,
+                                   float* logdet)
+{
+    return rocsolver_gelogdet_impl<float>(handle, n, A, lda, ipiv, sign, logdet);
+}
+
+rocblas_status rocsolver_dgelogdet(rocblas_handle handle,
+                                   const rocblas_int n,
+                                   double* A,
+                                   const rocblas_int lda,
+                                   rocblas_int* ipiv,
+                                   double* sign,
+                                   double* logdet)
+{
+    return rocsolver_gelogdet_impl<double>(handle, n, A, lda, ipiv, sign, logdet);
+}
+
+rocblas_status rocsolver_cgelogdet(rocblas_handle handle,
+                                   const rocblas_int n,
+                                   rocblas_float_complex* A,
+                                   const rocblas_int lda,
+                                   rocblas_int* ipiv,
+                                   rocblas_float_complex* sign,
+                                   float* logdet)
+{
+    return rocsolver_gelogdet_impl<rocblas_float_complex>(handle, n, A, lda, ipiv, sign, logdet);
+}
+
+rocblas_status rocsolver_zgelogdet(rocblas_handle handle,
+                                   const rocblas_int n,
+                                   rocblas_double_complex* A,
+                                   const rocblas_int lda,
+                                   rocblas_int* ipiv,
+                                   rocblas_double_complex* sign,
+                                   double* logdet)
+{
+    return rocsolver_gelogdet_impl<rocblas_double_complex>(handle, n, A, lda, ipiv, sign, logdet);
+}
+
+} // extern C
@@ -0,0 +1,161 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+#define LOGDET_THDS 64
+
+/** GELOGDET_KERNEL computes the sign (phase) and the logarithm of the absolute value
+    of the determinant of a matrix from its LU factorization. Each thread-block
+    reduces the diagonal of U and the parity of the row interchanges in ipiv
+    for one instance of the batch. If info is provided and info[bid] > 0 (singular
+    factor), the determinant is zero. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(LOGDET_THDS) gelogdet_kernel(const rocblas_int n,
+                                                                     U AA,
+                                                                     const rocblas_int shiftA,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideA,
+                                                                     rocblas_int* ipivA,
+                                                                     const rocblas_int shiftP,
+                                                                     const rocblas_stride strideP,
+                                                                     T* sign,
+                                                                     S* logdet,
+                                                                     rocblas_int* info)
+{
+    const int bid = hipBlockIdx_y;
+    const int tid = hipThreadIdx_x;
+
+    if(info && info[bid] > 0)
+    {
+        if(tid == 0)
+        {
+            sign[bid] = T(0);
+            logdet[bid] = -std::numeric_limits<S>::infinity();
+        }
+        return;
+    }
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    rocblas_int* ipiv = ipivA + bid * strideP + shiftP;
+
+    // shared memory setup
+    __shared__ S ssum[LOGDET_THDS];
+    __shared__ T sphase[LOGDET_THDS];
+
+    // each thread accumulates log|u_ii| and the phase u_ii / |u_ii| of its diagonal elements;
+    // every row interchange flips the sign
+    S sum = 0;
+    T phase = 1;
+    for(rocblas_int i = tid; i < n; i += LOGDET_THDS)
+    {
+        T u = A[i + i * lda];
+        S a = std::abs(u);
+        sum += log(a);
+        phase *= (a == 0 ? T(0) : u / T(a));
+        if(ipiv[i] != i + 1)
+            phase = -phase;
+    }
+    ssum[tid] = sum;
+    sphase[tid] = phase;
+    __syncthreads();
+
+    // reduction
+    for(int r = LOGDET_THDS / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+        {
+            ssum[tid] += ssum[tid + r];
+            sphase[tid] *= sphase[tid + r];
+        }
+        __syncthreads();
+    }
+
+    // write results back to global memory
+    // (the phase is re-normalized to remove the accumulated rounding errors)
+    if(tid == 0)
+    {
+        phase = sphase[0];
+        S a = std::abs(phase);
+        sign[bid] = (a == 0 ? T(0) : phase / T(a));
+        logdet[bid] = ssum[0];
+    }
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gelogdet_argCheck(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           const rocblas_int lda,
+                                           U A,
+                                           rocblas_int* ipiv,
+                                           T* sign,
+                                           S* logdet,
+                                           const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (batch_count && !sign) || (batch_count && !logdet))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gelogdet_template(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           U A,
+                                           const rocblas_int shiftA,
+                                           const rocblas_int lda,
+                                           const rocblas_stride strideA,
+                                           rocblas_int* ipiv,
+                                           const rocblas_int shiftP,
+                                           const rocblas_stride strideP,
+                                           T* sign,
+                                           S* logdet,
+                                           rocblas_int* info,
+                                           const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gelogdet", "n:", n, "shiftA:", shiftA, "lda:", lda, "shiftP:", shiftP,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return with the determinant of the empty matrix (= 1)
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, sign,
+                                batch_count, T(1));
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, logdet,
+                                batch_count, S(0));
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL(gelogdet_kernel<T>, dim3(1, batch_count, 1), dim3(LOGDET_THDS, 1, 1),
+                            0, stream, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, sign,
+                            logdet, info);
+
+    return rocblas_status_success;
+}
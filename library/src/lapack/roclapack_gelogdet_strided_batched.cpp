@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gelogdet.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gelogdet_strided_batched_impl(rocblas_handle handle,
+                                                       const rocblas_int n,
+                                                       U A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       rocblas_int* ipiv,
+                                                       const rocblas_stride strideP,
+                                                       T* sign,
+                                                       S* logdet,
+                                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gelogdet_strided_batched", "-n", n, "--lda", lda, "--strideA", strideA,
+                        "--strideP", strideP, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gelogdet_argCheck(handle, n, lda, A, ipiv, sign, logdet,
+                                                    batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftP = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    // (there is no info array; a zero pivot in U gives a zero determinant)
+    return rocsolver_gelogdet_template<T>(handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP,
+                                          sign, logdet, (rocblas_int*)nullptr, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgelogdet_strided_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   float* A,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   float* sign,
+                                                   float* logdet,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gelogdet_strided_batched_impl<float>(handle, n, A, lda, strideA, ipiv, strideP,
+                                                          sign, logdet, batch_count);
+}
+
+rocblas_status rocsolver_dgelogdet_strided_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   double* A,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   double* sign,
+                                                   double* logdet,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gelogdet_strided_batched_impl<double>(handle, n, A, lda, strideA, ipiv,
+                                                           strideP, sign, logdet, batch_count);
+}
+
+rocblas_status rocsolver_cgelogdet_strided_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   rocblas_float_complex* A,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   rocblas_float_complex* sign,
+                                                   float* logdet,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gelogdet_strided_batched_impl<rocblas_float_complex>(handle, n, A, lda,
+                                                                          strideA, ipiv, strideP,
+                                                                          sign, logdet,
+                                                                          batch_count);
+}
+
+rocblas_status rocsolver_zgelogdet_strided_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   rocblas_double_complex* A,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   rocblas_double_complex* sign,
+                                                   double* logdet,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gelogdet_strided_batched_impl<rocblas_double_complex>(handle, n, A, lda,
+                                                                           strideA, ipiv, strideP,
+                                                                           sign, logdet,
+                                                                           batch_count);
+}
+
+} // extern C
@@ -22,6 +22,8 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -47,6 +49,8 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle,
                                                       size_Abyx_norms_trfact, size_diag_tmptr,
                                                       size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
@@ -55,6 +59,8 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work_workArr = mem[1];
     Abyx_norms_trfact = mem[2];
@@ -63,6 +69,8 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_gelqf_template<false, false, T>(
         handle, m, n, A, shiftA, lda, strideA, ipiv, stridep, batch_count, (T*)scalars,
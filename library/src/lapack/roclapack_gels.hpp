@@ -38,78 +38,151 @@ ROCSOLVER_KERNEL void gels_set_zero(const rocblas_int k1,
     }
 }
 
+/** The workspace of GELS is organized in phases: the factorization of A (GEQRF/GELQF),
+    the application of the orthogonal/unitary matrix (ORMQR/ORMLQ) and the triangular
+    solve (TRSM). The buffers used by each phase are not live during the others, so they
+    can share memory. **/
+struct rocsolver_gels_workspace
+{
+    enum
+    {
+        factor,
+        apply,
+        solve,
+        phases
+    };
+
+    workspace_planner plan;
+    int work_x_temp[phases];
+    int workArr_temp_arr[phases];
+    int diag_trfac_invA[phases];
+    int trfact_workTrmm_invA_arr[phases];
+    int ipiv_savedB;
+};
+
+/** Helper to calculate the workspace required by every phase of GELS **/
+template <bool BATCHED, typename T>
+void rocsolver_gels_phaseMemorySize(const rocblas_operation trans,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    const rocblas_int batch_count,
+                                    size_t* size_scalars,
+                                    size_t* size_work_x_temp,
+                                    size_t* size_workArr_temp_arr,
+                                    size_t* size_diag_trfac_invA,
+                                    size_t* size_trfact_workTrmm_invA_arr)
+{
+    constexpr int factor = rocsolver_gels_workspace::factor;
+    constexpr int apply = rocsolver_gels_workspace::apply;
+    constexpr int solve = rocsolver_gels_workspace::solve;
+    size_t ormxx_scalars;
+
+    if(m >= n)
+    {
+        rocsolver_geqrf_getMemorySize<BATCHED, T>(
+            m, n, batch_count, size_scalars, &size_work_x_temp[factor],
+            &size_workArr_temp_arr[factor], &size_diag_trfac_invA[factor],
+            &size_trfact_workTrmm_invA_arr[factor]);
+
+        rocsolver_ormqr_unmqr_getMemorySize<BATCHED, T>(
+            rocblas_side_left, m, nrhs, n, batch_count, &ormxx_scalars, &size_work_x_temp[apply],
+            &size_workArr_temp_arr[apply], &size_diag_trfac_invA[apply],
+            &size_trfact_workTrmm_invA_arr[apply]);
+
+        ROCSOLVER_ASSUME_X(*size_scalars == ormxx_scalars, "GEQRF and ORMQR use the same scalars");
+    }
+    else
+    {
+        rocsolver_gelqf_getMemorySize<BATCHED, T>(
+            m, n, batch_count, size_scalars, &size_work_x_temp[factor],
+            &size_workArr_temp_arr[factor], &size_diag_trfac_invA[factor],
+            &size_trfact_workTrmm_invA_arr[factor]);
+
+        rocsolver_ormlq_unmlq_getMemorySize<BATCHED, T>(
+            rocblas_side_left, n, nrhs, m, batch_count, &ormxx_scalars, &size_work_x_temp[apply],
+            &size_workArr_temp_arr[apply], &size_diag_trfac_invA[apply],
+            &size_trfact_workTrmm_invA_arr[apply]);
+
+        ROCSOLVER_ASSUME_X(*size_scalars == ormxx_scalars, "GELQF and ORMLQ use the same scalars");
+    }
+
+    rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, trans, std::min(m, n), nrhs, batch_count,
+                                     &size_work_x_temp[solve], &size_workArr_temp_arr[solve],
+                                     &size_diag_trfac_invA[solve],
+                                     &size_trfact_workTrmm_invA_arr[solve]);
+}
+
+/** Helper to compute the layout of the workspace of GELS **/
 template <bool BATCHED, bool STRIDED, typename T>
-void rocsolver_gels_getMemorySize(const rocblas_operation trans,
+void rocsolver_gels_planWorkspace(const rocblas_operation trans,
                                   const rocblas_int m,
                                   const rocblas_int n,
                                   const rocblas_int nrhs,
                                   const rocblas_int batch_count,
                                   size_t* size_scalars,
-                                  size_t* size_work_x_temp,
-                                  size_t* size_workArr_temp_arr,
-                                  size_t* size_diag_trfac_invA,
-                                  size_t* size_trfact_workTrmm_invA_arr,
-                                  size_t* size_ipiv_savedB,
-                                  bool* optim_mem)
+                                  rocsolver_gels_workspace* ws,
+                                  bool* optim_mem,
+                                  const bool factorize = true)
 {
+    // always allocate all required memory for TRSM optimal performance
+    *optim_mem = true;
+
     // if quick return no workspace needed
     if(m == 0 || n == 0 || nrhs == 0 || batch_count == 0)
     {
         *size_scalars = 0;
-        *size_work_x_temp = 0;
-        *size_workArr_temp_arr = 0;
-        *size_diag_trfac_invA = 0;
-        *size_trfact_workTrmm_invA_arr = 0;
-        *size_ipiv_savedB = 0;
-        *optim_mem = true;
         return;
     }
 
-    size_t gexxf_scalars, gexxf_work, gexxf_workArr, gexxf_diag, gexxf_trfact;
-    size_t ormxx_scalars, ormxx_work, ormxx_workArr, ormxx_trfact, ormxx_workTrmm;
-    size_t trsm_x_temp, trsm_x_temp_arr, trsm_invA, trsm_invA_arr;
+    constexpr int phases = rocsolver_gels_workspace::phases;
+    size_t work_x_temp[phases], workArr_temp_arr[phases], diag_trfac_invA[phases],
+        trfact_workTrmm_invA_arr[phases];
+    rocsolver_gels_phaseMemorySize<BATCHED, T>(trans, m, n, nrhs, batch_count, size_scalars,
+                                               work_x_temp, workArr_temp_arr, diag_trfac_invA,
+                                               trfact_workTrmm_invA_arr);
 
-    if(m >= n)
+    // no workspace for the factorization if it was computed by a previous call
+    if(!factorize)
     {
-        rocsolver_geqrf_getMemorySize<BATCHED, T>(m, n, batch_count, &gexxf_scalars, &gexxf_work,
-                                                  &gexxf_workArr, &gexxf_diag, &gexxf_trfact);
-
-        rocsolver_ormqr_unmqr_getMemorySize<BATCHED, T>(rocblas_side_left, m, nrhs, n, batch_count,
-                                                        &ormxx_scalars, &ormxx_work, &ormxx_workArr,
-                                                        &ormxx_trfact, &ormxx_workTrmm);
-
-        ROCSOLVER_ASSUME_X(gexxf_scalars == ormxx_scalars, "GEQRF and ORMQR use the same scalars");
+        constexpr int factor = rocsolver_gels_workspace::factor;
+        work_x_temp[factor] = 0;
+        workArr_temp_arr[factor] = 0;
+        diag_trfac_invA[factor] = 0;
+        trfact_workTrmm_invA_arr[factor] = 0;
     }
-    else
-    {
-        rocsolver_gelqf_getMemorySize<BATCHED, T>(m, n, batch_count, &gexxf_scalars, &gexxf_work,
-                                                  &gexxf_workArr, &gexxf_diag, &gexxf_trfact);
-
-        rocsolver_ormlq_unmlq_getMemorySize<BATCHED, T>(rocblas_side_left, n, nrhs, m, batch_count,
-                                                        &ormxx_scalars, &ormxx_work, &ormxx_workArr,
-                                                        &ormxx_trfact, &ormxx_workTrmm);
 
-        ROCSOLVER_ASSUME_X(gexxf_scalars == ormxx_scalars, "GELQF and ORMLQ use the same scalars");
+    for(int p = 0; p < phases; p++)
+    {
+        ws->work_x_temp[p] = ws->plan.add(work_x_temp[p], p);
+        ws->workArr_temp_arr[p] = ws->plan.add(workArr_temp_arr[p], p);
+        ws->diag_trfac_invA[p] = ws->plan.add(diag_trfac_invA[p], p);
+        ws->trfact_workTrmm_invA_arr[p] = ws->plan.add(trfact_workTrmm_invA_arr[p], p);
     }
 
-    rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, trans, std::min(m, n), nrhs, batch_count,
-                                     &trsm_x_temp, &trsm_x_temp_arr, &trsm_invA, &trsm_invA_arr);
-
-    // TODO: rearrange to minimize total size
-    *size_scalars = gexxf_scalars;
-    *size_work_x_temp = std::max({gexxf_work, ormxx_work, trsm_x_temp});
-    *size_workArr_temp_arr = std::max({gexxf_workArr, ormxx_workArr, trsm_x_temp_arr});
-    *size_diag_trfac_invA = std::max({gexxf_diag, ormxx_trfact, trsm_invA});
-    *size_trfact_workTrmm_invA_arr = std::max({gexxf_trfact, ormxx_workTrmm, trsm_invA_arr});
-
     // size_ipiv is always less than size_savedB
+    size_t size_ipiv_savedB;
     if((trans == rocblas_operation_none && m >= n) || (trans != rocblas_operation_none && m < n))
-        *size_ipiv_savedB = sizeof(T) * std::min(m, n) * nrhs * batch_count;
+        size_ipiv_savedB = sizeof(T) * std::min(m, n) * nrhs * batch_count;
     else
-        *size_ipiv_savedB = sizeof(T) * std::max(m, n) * nrhs * batch_count;
+        size_ipiv_savedB = sizeof(T) * std::max(m, n) * nrhs * batch_count;
+    ws->ipiv_savedB = ws->plan.add(size_ipiv_savedB, 0, phases - 1);
+}
 
-    // always allocate all required memory for TRSM optimal performance
-    *optim_mem = true;
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gels_getMemorySize(const rocblas_operation trans,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  const rocblas_int batch_count,
+                                  size_t* size_scalars,
+                                  size_t* size_work,
+                                  bool* optim_mem)
+{
+    rocsolver_gels_workspace ws;
+    rocsolver_gels_planWorkspace<BATCHED, STRIDED, T>(trans, m, n, nrhs, batch_count, size_scalars,
+                                                      &ws, optim_mem);
+    *size_work = ws.plan.size();
 }
 
 template <bool COMPLEX, typename T>
@@ -150,92 +223,57 @@ rocblas_status rocsolver_gels_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
+/** Solves the least-squares problem from the QR or LQ factorization of A
+    (as computed by GEQRF or GELQF). The buffer savedB can alias tau if the Householder
+    scalars are not needed after the call. **/
 template <bool BATCHED, bool STRIDED, typename T, typename U>
-rocblas_status rocsolver_gels_template(rocblas_handle handle,
-                                       rocblas_operation trans,
-                                       const rocblas_int m,
-                                       const rocblas_int n,
-                                       const rocblas_int nrhs,
-                                       U A,
-                                       const rocblas_int shiftA,
-                                       const rocblas_int lda,
-                                       const rocblas_stride strideA,
-                                       U B,
-                                       const rocblas_int shiftB,
-                                       const rocblas_int ldb,
-                                       const rocblas_stride strideB,
-                                       rocblas_int* info,
-                                       const rocblas_int batch_count,
-                                       T* scalars,
-                                       T* work_x_temp,
-                                       T* workArr_temp_arr,
-                                       T* diag_trfac_invA,
-                                       T** trfact_workTrmm_invA_arr,
-                                       T* ipiv_savedB,
-                                       bool optim_mem)
+void local_gels_solve_template(rocblas_handle handle,
+                               rocblas_operation trans,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               U A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               T* tau,
+                               const rocblas_stride strideP,
+                               U B,
+                               const rocblas_int shiftB,
+                               const rocblas_int ldb,
+                               const rocblas_stride strideB,
+                               rocblas_int* info,
+                               const rocblas_int batch_count,
+                               T* scalars,
+                               T* const work_x_temp[],
+                               T* const workArr_temp_arr[],
+                               T* const diag_trfac_invA[],
+                               T** const trfact_workTrmm_invA_arr[],
+                               T* savedB,
+                               bool optim_mem)
 {
-    ROCSOLVER_ENTER("gels", "trans:", trans, "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA,
-                    "lda:", lda, "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
-
-    // quick return if zero instances in batch
-    if(batch_count == 0)
-        return rocblas_status_success;
-
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
-    dim3 gridReset(blocksReset, 1, 1);
-    dim3 threads(BS1, 1, 1);
-
-    // info=0 (starting with a nonsingular matrix)
-    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
-
-    // quick return if B is empty
-    if(nrhs == 0)
-        return rocblas_status_success;
-
-    // quick return if A is empty
-    if(m == 0 || n == 0)
-    {
-        rocblas_int rowsB = std::max(m, n);
-        rocblas_int blocksx = (rowsB - 1) / 32 + 1;
-        rocblas_int blocksy = (nrhs - 1) / 32 + 1;
-        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
-                                stream, rowsB, nrhs, B, shiftB, ldb, strideB);
-
-        return rocblas_status_success;
-    }
-
-    // everything must be executed with scalars on the host
-    rocblas_pointer_mode old_mode;
-    rocblas_get_pointer_mode(handle, &old_mode);
-    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    constexpr int apply = rocsolver_gels_workspace::apply;
+    constexpr int solve = rocsolver_gels_workspace::solve;
 
     // constants in host memory
-    const rocblas_stride strideP = std::min(m, n);
     const rocblas_int check_threads = std::min(((std::min(m, n) - 1) / 64 + 1) * 64, BS1);
     const rocblas_int copyblocksmin = (std::min(m, n) - 1) / 32 + 1;
     const rocblas_int copyblocksmax = (std::max(m, n) - 1) / 32 + 1;
     const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
     const T one = 1;
 
-    // TODO: apply scaling to improve accuracy over a larger range of values
-
     if(m >= n)
     {
-        // compute QR factorization of A
-        rocsolver_geqrf_template<BATCHED, STRIDED>(
-            handle, m, n, A, shiftA, lda, strideA, ipiv_savedB, strideP, batch_count, scalars,
-            work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
-
         if(trans == rocblas_operation_none)
         {
             rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
                 handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n, A,
-                shiftA, lda, strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB, batch_count,
-                scalars, (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
-                (T**)trfact_workTrmm_invA_arr);
+                shiftA, lda, strideA, tau, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+                work_x_temp[apply], workArr_temp_arr[apply], diag_trfac_invA[apply],
+                trfact_workTrmm_invA_arr[apply]);
 
             // do the equivalent of trtrs
             ROCSOLVER_LAUNCH_KERNEL(check_singularity<T>, dim3(batch_count, 1, 1),
@@ -245,19 +283,19 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
             // save elements of B that will be overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB,
-                                    ldb, strideB, ipiv_savedB, info_mask(info));
+                                    ldb, strideB, savedB, info_mask(info));
 
             // solve RX = Q'B, overwriting B with X
-            rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_upper,
-                                         rocblas_operation_none, rocblas_diagonal_non_unit, n, nrhs,
-                                         &one, A, shiftA, lda, strideA, B, shiftB, ldb, strideB,
-                                         batch_count, optim_mem, work_x_temp, workArr_temp_arr,
-                                         diag_trfac_invA, trfact_workTrmm_invA_arr);
+            rocblasCall_trsm<BATCHED, T>(
+                handle, rocblas_side_left, rocblas_fill_upper, rocblas_operation_none,
+                rocblas_diagonal_non_unit, n, nrhs, &one, A, shiftA, lda, strideA, B, shiftB, ldb,
+                strideB, batch_count, optim_mem, work_x_temp[solve], workArr_temp_arr[solve],
+                diag_trfac_invA[solve], trfact_workTrmm_invA_arr[solve]);
 
             // restore elements of B that were overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B,
-                                    shiftB, ldb, strideB, ipiv_savedB, info_mask(info));
+                                    shiftB, ldb, strideB, savedB, info_mask(info));
         }
         else
         {
@@ -269,14 +307,15 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
             // save elements of B that will be overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_to_buffer, m, nrhs, B, shiftB,
-                                    ldb, strideB, ipiv_savedB, info_mask(info));
+                                    ldb, strideB, savedB, info_mask(info));
 
             // solve R'Y = B overwriting B with Y (here Y = Q'X)
-            rocblasCall_trsm<BATCHED, T>(
-                handle, rocblas_side_left, rocblas_fill_upper,
-                rocblas_operation_conjugate_transpose, rocblas_diagonal_non_unit, n, nrhs, &one, A,
-                shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work_x_temp,
-                workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+            rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_upper,
+                                         rocblas_operation_conjugate_transpose,
+                                         rocblas_diagonal_non_unit, n, nrhs, &one, A, shiftA, lda,
+                                         strideA, B, shiftB, ldb, strideB, batch_count, optim_mem,
+                                         work_x_temp[solve], workArr_temp_arr[solve],
+                                         diag_trfac_invA[solve], trfact_workTrmm_invA_arr[solve]);
 
             // zero row n to m-1 of B in cases where info is zero
             const rocblas_int zeroblocksx = (m - n - 1) / 32 + 1;
@@ -286,23 +325,18 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
 
             rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
                 handle, rocblas_side_left, rocblas_operation_none, m, nrhs, n, A, shiftA, lda,
-                strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
-                (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
-                (T**)trfact_workTrmm_invA_arr);
+                strideA, tau, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+                work_x_temp[apply], workArr_temp_arr[apply], diag_trfac_invA[apply],
+                trfact_workTrmm_invA_arr[apply]);
 
             // restore elements of B that were overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_from_buffer, m, nrhs, B,
-                                    shiftB, ldb, strideB, ipiv_savedB, info_mask(info));
+                                    shiftB, ldb, strideB, savedB, info_mask(info));
         }
     }
     else
     {
-        // compute LQ factorization of A
-        rocsolver_gelqf_template<BATCHED, STRIDED>(
-            handle, m, n, A, shiftA, lda, strideA, ipiv_savedB, strideP, batch_count, scalars,
-            work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
-
         if(trans == rocblas_operation_none)
         {
             // do the equivalent of trtrs
@@ -313,14 +347,14 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
             // save elements of B that will be overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB,
-                                    ldb, strideB, ipiv_savedB, info_mask(info));
+                                    ldb, strideB, savedB, info_mask(info));
 
             // solve LY = B overwriting B with Y (here Y = QX)
-            rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_lower,
-                                         rocblas_operation_none, rocblas_diagonal_non_unit, m, nrhs,
-                                         &one, A, shiftA, lda, strideA, B, shiftB, ldb, strideB,
-                                         batch_count, optim_mem, work_x_temp, workArr_temp_arr,
-                                         diag_trfac_invA, trfact_workTrmm_invA_arr);
+            rocblasCall_trsm<BATCHED, T>(
+                handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
+                rocblas_diagonal_non_unit, m, nrhs, &one, A, shiftA, lda, strideA, B, shiftB, ldb,
+                strideB, batch_count, optim_mem, work_x_temp[solve], workArr_temp_arr[solve],
+                diag_trfac_invA[solve], trfact_workTrmm_invA_arr[solve]);
 
             // zero row m to n-1 of B in cases where info is zero
             const rocblas_int zeroblocksx = (n - m - 1) / 32 + 1;
@@ -330,22 +364,22 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
 
             rocsolver_ormlq_unmlq_template<BATCHED, STRIDED>(
                 handle, rocblas_side_left, rocblas_operation_conjugate_transpose, n, nrhs, m, A,
-                shiftA, lda, strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB, batch_count,
-                scalars, (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
-                (T**)trfact_workTrmm_invA_arr);
+                shiftA, lda, strideA, tau, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+                work_x_temp[apply], workArr_temp_arr[apply], diag_trfac_invA[apply],
+                trfact_workTrmm_invA_arr[apply]);
 
             // restore elements of B that were overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B,
-                                    shiftB, ldb, strideB, ipiv_savedB, info_mask(info));
+                                    shiftB, ldb, strideB, savedB, info_mask(info));
         }
         else
         {
             rocsolver_ormlq_unmlq_template<BATCHED, STRIDED>(
                 handle, rocblas_side_left, rocblas_operation_none, n, nrhs, m, A, shiftA, lda,
-                strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
-                (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
-                (T**)trfact_workTrmm_invA_arr);
+                strideA, tau, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+                work_x_temp[apply], workArr_temp_arr[apply], diag_trfac_invA[apply],
+                trfact_workTrmm_invA_arr[apply]);
 
             // do the equivalent of trtrs
             ROCSOLVER_LAUNCH_KERNEL(check_singularity<T>, dim3(batch_count, 1, 1),
@@ -355,22 +389,129 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
             // save elements of B that will be overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_to_buffer, m, nrhs, B, shiftB,
-                                    ldb, strideB, ipiv_savedB, info_mask(info));
+                                    ldb, strideB, savedB, info_mask(info));
 
             // solve L'X = QB, overwriting B with X
-            rocblasCall_trsm<BATCHED, T>(
-                handle, rocblas_side_left, rocblas_fill_lower,
-                rocblas_operation_conjugate_transpose, rocblas_diagonal_non_unit, m, nrhs, &one, A,
-                shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work_x_temp,
-                workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+            rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_lower,
+                                         rocblas_operation_conjugate_transpose,
+                                         rocblas_diagonal_non_unit, m, nrhs, &one, A, shiftA, lda,
+                                         strideA, B, shiftB, ldb, strideB, batch_count, optim_mem,
+                                         work_x_temp[solve], workArr_temp_arr[solve],
+                                         diag_trfac_invA[solve], trfact_workTrmm_invA_arr[solve]);
 
             // restore elements of B that were overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_from_buffer, m, nrhs, B,
-                                    shiftB, ldb, strideB, ipiv_savedB, info_mask(info));
+                                    shiftB, ldb, strideB, savedB, info_mask(info));
         }
     }
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gels_template(rocblas_handle handle,
+                                       rocblas_operation trans,
+                                       const rocblas_int m,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       U B,
+                                       const rocblas_int shiftB,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count,
+                                       T* scalars,
+                                       void* work,
+                                       bool optim_mem)
+{
+    ROCSOLVER_ENTER("gels", "trans:", trans, "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA,
+                    "lda:", lda, "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with a nonsingular matrix)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if B is empty
+    if(nrhs == 0)
+        return rocblas_status_success;
+
+    // quick return if A is empty
+    if(m == 0 || n == 0)
+    {
+        rocblas_int rowsB = std::max(m, n);
+        rocblas_int blocksx = (rowsB - 1) / 32 + 1;
+        rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                                stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+
+        return rocblas_status_success;
+    }
+
+    // get the layout of the workspace
+    size_t size_scalars;
+    bool unused;
+    rocsolver_gels_workspace ws;
+    rocsolver_gels_planWorkspace<BATCHED, STRIDED, T>(trans, m, n, nrhs, batch_count, &size_scalars,
+                                                      &ws, &unused);
+
+    constexpr int phases = rocsolver_gels_workspace::phases;
+    T* ipiv_savedB = ws.plan.pointer<T*>(work, ws.ipiv_savedB);
+    T *work_x_temp[phases], *workArr_temp_arr[phases], *diag_trfac_invA[phases];
+    T** trfact_workTrmm_invA_arr[phases];
+    for(int p = 0; p < phases; p++)
+    {
+        work_x_temp[p] = ws.plan.pointer<T*>(work, ws.work_x_temp[p]);
+        workArr_temp_arr[p] = ws.plan.pointer<T*>(work, ws.workArr_temp_arr[p]);
+        diag_trfac_invA[p] = ws.plan.pointer<T*>(work, ws.diag_trfac_invA[p]);
+        trfact_workTrmm_invA_arr[p] = ws.plan.pointer<T**>(work, ws.trfact_workTrmm_invA_arr[p]);
+    }
+    constexpr int factor = rocsolver_gels_workspace::factor;
+
+    // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    const rocblas_stride strideP = std::min(m, n);
+
+    // TODO: apply scaling to improve accuracy over a larger range of values
+
+    // compute QR or LQ factorization of A
+    if(m >= n)
+        rocsolver_geqrf_template<BATCHED, STRIDED>(
+            handle, m, n, A, shiftA, lda, strideA, ipiv_savedB, strideP, batch_count, scalars,
+            work_x_temp[factor], workArr_temp_arr[factor], diag_trfac_invA[factor],
+            trfact_workTrmm_invA_arr[factor]);
+    else
+        rocsolver_gelqf_template<BATCHED, STRIDED>(
+            handle, m, n, A, shiftA, lda, strideA, ipiv_savedB, strideP, batch_count, scalars,
+            work_x_temp[factor], workArr_temp_arr[factor], diag_trfac_invA[factor],
+            trfact_workTrmm_invA_arr[factor]);
+
+    // solve the least-squares problem
+    // (the Householder scalars are no longer needed, so they can be overwritten by the copy of B)
+    local_gels_solve_template<BATCHED, STRIDED>(
+        handle, trans, m, n, nrhs, A, shiftA, lda, strideA, ipiv_savedB, strideP, B, shiftB, ldb,
+        strideB, info, batch_count, scalars, work_x_temp, workArr_temp_arr, diag_trfac_invA,
+        trfact_workTrmm_invA_arr, ipiv_savedB, optim_mem);
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
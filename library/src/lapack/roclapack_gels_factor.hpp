@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gels.hpp"
+#include "rocsolver.h"
+
+template <typename T>
+rocblas_status rocsolver_gels_factor_argCheck(rocblas_handle handle,
+                                              const rocblas_int m,
+                                              const rocblas_int n,
+                                              const rocblas_int lda,
+                                              T A,
+                                              T ipiv,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || (m * n && !ipiv) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T>
+void rocsolver_gels_factor_getMemorySize(const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int batch_count,
+                                         size_t* size_scalars,
+                                         size_t* size_work_workArr,
+                                         size_t* size_Abyx_norms_trfact,
+                                         size_t* size_diag_tmptr,
+                                         size_t* size_workArr)
+{
+    // requirements for calling GEQRF or GELQF
+    if(m >= n)
+        rocsolver_geqrf_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars,
+                                                  size_work_workArr, size_Abyx_norms_trfact,
+                                                  size_diag_tmptr, size_workArr);
+    else
+        rocsolver_gelqf_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars,
+                                                  size_work_workArr, size_Abyx_norms_trfact,
+                                                  size_diag_tmptr, size_workArr);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gels_factor_template(rocblas_handle handle,
+                                              const rocblas_int m,
+                                              const rocblas_int n,
+                                              U A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              T* ipiv,
+                                              const rocblas_stride strideP,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count,
+                                              T* scalars,
+                                              void* work_workArr,
+                                              T* Abyx_norms_trfact,
+                                              T* diag_tmptr,
+                                              T** workArr)
+{
+    ROCSOLVER_ENTER("gels_factor", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with a nonsingular matrix)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if A is empty
+    if(m == 0 || n == 0)
+        return rocblas_status_success;
+
+    // compute QR or LQ factorization of A
+    if(m >= n)
+        rocsolver_geqrf_template<BATCHED, STRIDED>(handle, m, n, A, shiftA, lda, strideA, ipiv,
+                                                   strideP, batch_count, scalars, work_workArr,
+                                                   Abyx_norms_trfact, diag_tmptr, workArr);
+    else
+        rocsolver_gelqf_template<BATCHED, STRIDED>(handle, m, n, A, shiftA, lda, strideA, ipiv,
+                                                   strideP, batch_count, scalars, work_workArr,
+                                                   Abyx_norms_trfact, diag_tmptr, workArr);
+
+    // report singularities of the triangular factor
+    const rocblas_int check_threads = std::min(((std::min(m, n) - 1) / 64 + 1) * 64, BS1);
+    ROCSOLVER_LAUNCH_KERNEL(check_singularity<T>, dim3(batch_count, 1, 1),
+                            dim3(1, check_threads, 1), 0, stream, std::min(m, n), A, shiftA, lda,
+                            strideA, info);
+
+    return rocblas_status_success;
+}
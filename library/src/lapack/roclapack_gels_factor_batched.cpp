@@ -0,0 +1,148 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gels_factor.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gels_factor_batched_impl(rocblas_handle handle,
+                                                  const rocblas_int m,
+                                                  const rocblas_int n,
+                                                  U A,
+                                                  const rocblas_int lda,
+                                                  T* ipiv,
+                                                  const rocblas_stride strideP,
+                                                  rocblas_int* info,
+                                                  const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gels_factor_batched", "-m", m, "-n", n, "--lda", lda, "--strideP", strideP,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gels_factor_argCheck(handle, m, n, lda, A, ipiv, info,
+                                                       batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    const rocblas_int shiftA = 0;
+
+    // batched execution
+    const rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr, size_workArr;
+    // extra requirements for calling GEQRF/GELQF and to store temporary triangular factor
+    size_t size_Abyx_norms_trfact;
+    // extra requirements for calling GEQRF/GELQF
+    size_t size_diag_tmptr;
+    rocsolver_gels_factor_getMemorySize<true, T>(m, n, batch_count, &size_scalars,
+                                                 &size_work_workArr, &size_Abyx_norms_trfact,
+                                                 &size_diag_tmptr, &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+                                                      size_Abyx_norms_trfact, size_diag_tmptr,
+                                                      size_workArr);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
+                              size_diag_tmptr, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms_trfact = mem[2];
+    diag_tmptr = mem[3];
+    workArr = mem[4];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_gels_factor_template<true, false, T>(
+        handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, info, batch_count, (T*)scalars,
+        work_workArr, (T*)Abyx_norms_trfact, (T*)diag_tmptr, (T**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgels_factor_batched(rocblas_handle handle,
+                                              const rocblas_int m,
+                                              const rocblas_int n,
+                                              float* const A[],
+                                              const rocblas_int lda,
+                                              float* ipiv,
+                                              const rocblas_stride strideP,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count)
+{
+    return rocsolver_gels_factor_batched_impl<float>(handle, m, n, A, lda, ipiv, strideP, info,
+                                                     batch_count);
+}
+
+rocblas_status rocsolver_dgels_factor_batched(rocblas_handle handle,
+                                              const rocblas_int m,
+                                              const rocblas_int n,
+                                              double* const A[],
+                                              const rocblas_int lda,
+                                              double* ipiv,
+                                              const rocblas_stride strideP,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count)
+{
+    return rocsolver_gels_factor_batched_impl<double>(handle, m, n, A, lda, ipiv, strideP, info,
+                                                      batch_count);
+}
+
+rocblas_status rocsolver_cgels_factor_batched(rocblas_handle handle,
+                                              const rocblas_int m,
+                                              const rocblas_int n,
+                                              rocblas_float_complex* const A[],
+                                              const rocblas_int lda,
+                                              rocblas_float_complex* ipiv,
+                                              const rocblas_stride strideP,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count)
+{
+    return rocsolver_gels_factor_batched_impl<rocblas_float_complex>(handle, m, n, A, lda, ipiv,
+                                                                     strideP, info, batch_count);
+}
+
+rocblas_status rocsolver_zgels_factor_batched(rocblas_handle handle,
+                                              const rocblas_int m,
+                                              const rocblas_int n,
+                                              rocblas_double_complex* const A[],
+                                              const rocblas_int lda,
+                                              rocblas_double_complex* ipiv,
+                                              const rocblas_stride strideP,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count)
+{
+    return rocsolver_gels_factor_batched_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv,
+                                                                      strideP, info, batch_count);
+}
+
+} // extern C
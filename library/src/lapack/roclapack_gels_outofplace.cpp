@@ -38,6 +38,8 @@ rocblas_status rocsolver_gels_outofplace_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     const rocblas_int shiftA = 0;
     const rocblas_int shiftB = 0;
@@ -67,6 +69,8 @@ rocblas_status rocsolver_gels_outofplace_impl(rocblas_handle handle,
             handle, size_scalars, size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
             size_trfact_workTrmm_invA_arr, size_ipiv, size_savedB);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA, *trfact_workTrmm_invA_arr,
         *ipiv, *savedB;
@@ -77,6 +81,8 @@ rocblas_status rocsolver_gels_outofplace_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work_x_temp = mem[1];
     workArr_temp_arr = mem[2];
@@ -87,6 +93,8 @@ rocblas_status rocsolver_gels_outofplace_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_gels_outofplace_template<false, false, T>(
         handle, trans, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, X, shiftX, ldx,
@@ -46,11 +46,24 @@ void rocsolver_gels_outofplace_getMemorySize(const rocblas_operation trans,
         return;
     }
 
-    size_t unused;
+    constexpr int phases = rocsolver_gels_workspace::phases;
+    size_t work_x_temp[phases], workArr_temp_arr[phases], diag_trfac_invA[phases],
+        trfact_workTrmm_invA_arr[phases];
 
-    rocsolver_gels_getMemorySize<BATCHED, STRIDED, T>(
-        trans, m, n, nrhs, batch_count, size_scalars, size_work_x_temp, size_workArr_temp_arr,
-        size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, &unused, optim_mem);
+    rocsolver_gels_phaseMemorySize<BATCHED, T>(trans, m, n, nrhs, batch_count, size_scalars,
+                                               work_x_temp, workArr_temp_arr, diag_trfac_invA,
+                                               trfact_workTrmm_invA_arr);
+
+    *size_work_x_temp = *std::max_element(std::begin(work_x_temp), std::end(work_x_temp));
+    *size_workArr_temp_arr
+        = *std::max_element(std::begin(workArr_temp_arr), std::end(workArr_temp_arr));
+    *size_diag_trfac_invA
+        = *std::max_element(std::begin(diag_trfac_invA), std::end(diag_trfac_invA));
+    *size_trfact_workTrmm_invA_arr = *std::max_element(std::begin(trfact_workTrmm_invA_arr),
+                                                       std::end(trfact_workTrmm_invA_arr));
+
+    // always allocate all required memory for TRSM optimal performance
+    *optim_mem = true;
 
     *size_ipiv = sizeof(T) * std::min(m, n) * batch_count;
 
@@ -170,9 +183,11 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
     }
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // constants in host memory
     const rocblas_stride strideP = std::min(m, n);
@@ -328,6 +343,8 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
         }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
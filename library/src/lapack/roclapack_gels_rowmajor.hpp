@@ -0,0 +1,181 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "roclapack_gels.hpp"
+#include "rocsolver.h"
+
+/** The column-major view of a row-major m-by-n matrix A is the n-by-m matrix A^T, so the
+    least-squares problem is solved with the transposed operation on A^T (a row-major QR
+    becomes a column-major LQ and vice versa) without moving A. For complex types the
+    operation on A^T is the conjugate transpose (or none), which conjugates the solution;
+    B is then transposed into a column-major buffer, conjugated on the way in and out. **/
+
+template <bool COMPLEX, typename T>
+rocblas_status rocsolver_gels_rowmajor_argCheck(rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                T A,
+                                                const rocblas_int lda,
+                                                T B,
+                                                const rocblas_int ldb,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && trans == rocblas_operation_transpose)
+       || (!COMPLEX && trans == rocblas_operation_conjugate_transpose))
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < n || ldb < nrhs || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || ((m * nrhs || n * nrhs) && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Returns the operation applied to the column-major view of A **/
+template <bool COMPLEX>
+inline rocblas_operation gels_rowmajor_trans(const rocblas_operation trans)
+{
+    if(trans != rocblas_operation_none)
+        return rocblas_operation_none;
+    return COMPLEX ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gels_rowmajor_getMemorySize(const rocblas_operation trans,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           const rocblas_int batch_count,
+                                           size_t* size_scalars,
+                                           size_t* size_work,
+                                           size_t* size_buffer,
+                                           size_t* size_bufferArr,
+                                           bool* optim_mem)
+{
+    constexpr bool COMPLEX = is_complex<T>;
+    rocsolver_gels_getMemorySize<BATCHED, STRIDED, T>(gels_rowmajor_trans<COMPLEX>(trans), n, m,
+                                                      nrhs, batch_count, size_scalars, size_work,
+                                                      optim_mem);
+
+    // if quick return no need of the column-major copy of B
+    if(m == 0 || n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_buffer = 0;
+        *size_bufferArr = 0;
+        return;
+    }
+
+    *size_buffer = sizeof(T) * std::max(m, n) * nrhs * batch_count;
+    *size_bufferArr = BATCHED ? sizeof(T*) * batch_count : 0;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gels_rowmajor_template(rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                U A,
+                                                const rocblas_int shiftA,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                U B,
+                                                const rocblas_int shiftB,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count,
+                                                T* scalars,
+                                                void* work,
+                                                T* buffer,
+                                                T** bufferArr,
+                                                bool optim_mem)
+{
+    ROCSOLVER_ENTER("gels_rowmajor", "trans:", trans, "m:", m, "n:", n, "nrhs:", nrhs,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    constexpr bool COMPLEX = is_complex<T>;
+    const rocblas_operation cm_trans = gels_rowmajor_trans<COMPLEX>(trans);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int rowsB = std::max(m, n);
+
+    // quick return if A or B are empty
+    // (GELS only resets info, and B is zeroed here in row-major order)
+    if(m == 0 || n == 0 || nrhs == 0)
+    {
+        rocsolver_gels_template<BATCHED, STRIDED, T>(handle, cm_trans, n, m, 0, A, shiftA, lda,
+                                                     strideA, B, shiftB, ldb, strideB, info,
+                                                     batch_count, scalars, work, optim_mem);
+
+        if(rowsB > 0 && nrhs > 0)
+        {
+            rocblas_int blocksx = (nrhs - 1) / BS2 + 1;
+            rocblas_int blocksy = (rowsB - 1) / BS2 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count),
+                                    dim3(BS2, BS2), 0, stream, nrhs, rowsB, B, shiftB, ldb,
+                                    strideB);
+        }
+
+        return rocblas_status_success;
+    }
+
+    // the column-major copy of B is accessed as the matrix A (through an array of pointers in
+    // the batched case)
+    const rocblas_int ldw = rowsB;
+    const rocblas_stride strideW = rocblas_stride(ldw) * nrhs;
+    U W = (U)buffer;
+    if(BATCHED)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream,
+                                bufferArr, buffer, strideW, batch_count);
+        W = (U)bufferArr;
+    }
+
+    rocblas_int blocksx = (nrhs - 1) / BS2 + 1;
+    rocblas_int blocksy = (rowsB - 1) / BS2 + 1;
+    dim3 threads(BS2, BS2, 1);
+
+    // the row-major B is stored as a column-major nrhs-by-rowsB matrix
+    ROCSOLVER_LAUNCH_KERNEL((transpose_mat<T, COMPLEX>), dim3(blocksx, blocksy, batch_count),
+                            threads, 0, stream, nrhs, rowsB, B, shiftB, ldb, strideB, buffer, 0,
+                            ldw, strideW);
+
+    rocsolver_gels_template<BATCHED, STRIDED, T>(handle, cm_trans, n, m, nrhs, A, shiftA, lda,
+                                                 strideA, W, 0, ldw, strideW, info, batch_count,
+                                                 scalars, work, optim_mem);
+
+    ROCSOLVER_LAUNCH_KERNEL((transpose_mat<T, COMPLEX>), dim3(blocksy, blocksx, batch_count),
+                            threads, 0, stream, rowsB, nrhs, buffer, 0, ldw, strideW, B, shiftB,
+                            ldb, strideB);
+
+    return rocblas_status_success;
+}
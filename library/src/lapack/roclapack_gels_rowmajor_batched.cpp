@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gels_rowmajor.hpp"
+
+template <typename T, typename U, bool COMPLEX = is_complex<T>>
+rocblas_status rocsolver_gels_rowmajor_batched_impl(rocblas_handle handle,
+                                                    rocblas_operation trans,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    U B,
+                                                    const rocblas_int ldb,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gels_rowmajor_batched", "--trans", trans, "-m", m, "-n", n, "--nrhs", nrhs,
+                        "--lda", lda, "--ldb", ldb, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gels_rowmajor_argCheck<COMPLEX>(handle, trans, m, n, nrhs, A, lda,
+                                                                  B, ldb, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    const rocblas_int shiftA = 0;
+    const rocblas_int shiftB = 0;
+
+    // batched execution
+    const rocblas_stride strideA = 0;
+    const rocblas_stride strideB = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (shared by the calls to GEQRF/GELQF, ORMQR/ORMLQ, and TRSM,
+    // plus the Householder scalars and the copy of B)
+    bool optim_mem;
+    size_t size_work;
+    // size of the column-major copy of B (and the array of pointers to it)
+    size_t size_buffer, size_bufferArr;
+    rocsolver_gels_rowmajor_getMemorySize<true, false, T>(trans, m, n, nrhs, batch_count,
+                                                          &size_scalars, &size_work, &size_buffer,
+                                                          &size_bufferArr, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_buffer,
+                                                      size_bufferArr);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work, *buffer, *bufferArr;
+    rocblas_device_malloc mem(handle, size_scalars, size_work, size_buffer, size_bufferArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work = mem[1];
+    buffer = mem[2];
+    bufferArr = mem[3];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_gels_rowmajor_template<true, false, T>(handle, trans, m, n, nrhs, A, shiftA,
+                                                            lda, strideA, B, shiftB, ldb, strideB,
+                                                            info, batch_count, (T*)scalars, work,
+                                                            (T*)buffer, (T**)bufferArr, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgels_rowmajor_batched(rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                float* const A[],
+                                                const rocblas_int lda,
+                                                float* const B[],
+                                                const rocblas_int ldb,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gels_rowmajor_batched_impl<float>(handle, trans, m, n, nrhs, A, lda, B, ldb,
+                                                       info, batch_count);
+}
+
+rocblas_status rocsolver_dgels_rowmajor_batched(rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                double* const A[],
+                                                const rocblas_int lda,
+                                                double* const B[],
+                                                const rocblas_int ldb,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gels_rowmajor_batched_impl<double>(handle, trans, m, n, nrhs, A, lda, B, ldb,
+                                                        info, batch_count);
+}
+
+rocblas_status rocsolver_cgels_rowmajor_batched(rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_float_complex* const A[],
+                                                const rocblas_int lda,
+                                                rocblas_float_complex* const B[],
+                                                const rocblas_int ldb,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gels_rowmajor_batched_impl<rocblas_float_complex>(handle, trans, m, n, nrhs, A,
+                                                                       lda, B, ldb, info,
+                                                                       batch_count);
+}
+
+rocblas_status rocsolver_zgels_rowmajor_batched(rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_double_complex* const A[],
+                                                const rocblas_int lda,
+                                                rocblas_double_complex* const B[],
+                                                const rocblas_int ldb,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gels_rowmajor_batched_impl<rocblas_double_complex>(handle, trans, m, n, nrhs,
+                                                                        A, lda, B, ldb, info,
+                                                                        batch_count);
+}
+
+} // extern C
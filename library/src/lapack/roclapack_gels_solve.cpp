@@ -0,0 +1,151 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gels_solve.hpp"
+
+template <typename T, typename U, bool COMPLEX = is_complex<T>>
+rocblas_status rocsolver_gels_solve_impl(rocblas_handle handle,
+                                         rocblas_operation trans,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int nrhs,
+                                         U A,
+                                         const rocblas_int lda,
+                                         T* ipiv,
+                                         U B,
+                                         const rocblas_int ldb,
+                                         rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("gels_solve", "--trans", trans, "-m", m, "-n", n, "--nrhs", nrhs, "--lda",
+                        lda, "--ldb", ldb);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gels_solve_argCheck<COMPLEX>(handle, trans, m, n, nrhs, A, lda,
+                                                               ipiv, B, ldb, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    const rocblas_int shiftA = 0;
+    const rocblas_int shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    const rocblas_stride strideA = 0;
+    const rocblas_stride strideP = 0;
+    const rocblas_stride strideB = 0;
+    const rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (shared by the calls to ORMQR/ORMLQ and TRSM,
+    // plus the copy of B)
+    bool optim_mem;
+    size_t size_work;
+    rocsolver_gels_solve_getMemorySize<false, false, T>(trans, m, n, nrhs, batch_count,
+                                                        &size_scalars, &size_work, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work;
+    rocblas_device_malloc mem(handle, size_scalars, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work = mem[1];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_gels_solve_template<false, false, T>(
+        handle, trans, m, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB,
+        info, batch_count, (T*)scalars, work, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgels_solve(rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int nrhs,
+                                     float* A,
+                                     const rocblas_int lda,
+                                     float* ipiv,
+                                     float* B,
+                                     const rocblas_int ldb,
+                                     rocblas_int* info)
+{
+    return rocsolver_gels_solve_impl<float>(handle, trans, m, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+rocblas_status rocsolver_dgels_solve(rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int nrhs,
+                                     double* A,
+                                     const rocblas_int lda,
+                                     double* ipiv,
+                                     double* B,
+                                     const rocblas_int ldb,
+                                     rocblas_int* info)
+{
+    return rocsolver_gels_solve_impl<double>(handle, trans, m, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+rocblas_status rocsolver_cgels_solve(rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     const rocblas_int lda,
+                                     rocblas_float_complex* ipiv,
+                                     rocblas_float_complex* B,
+                                     const rocblas_int ldb,
+                                     rocblas_int* info)
+{
+    return rocsolver_gels_solve_impl<rocblas_float_complex>(handle, trans, m, n, nrhs, A, lda, ipiv,
+                                                            B, ldb, info);
+}
+
+rocblas_status rocsolver_zgels_solve(rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     const rocblas_int lda,
+                                     rocblas_double_complex* ipiv,
+                                     rocblas_double_complex* B,
+                                     const rocblas_int ldb,
+                                     rocblas_int* info)
+{
+    return rocsolver_gels_solve_impl<rocblas_double_complex>(handle, trans, m, n, nrhs, A, lda,
+                                                             ipiv, B, ldb, info);
+}
+
+} // extern C
@@ -0,0 +1,163 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gels.hpp"
+#include "rocsolver.h"
+
+template <bool COMPLEX, typename T, typename U>
+rocblas_status rocsolver_gels_solve_argCheck(rocblas_handle handle,
+                                             rocblas_operation trans,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             const rocblas_int nrhs,
+                                             T A,
+                                             const rocblas_int lda,
+                                             U ipiv,
+                                             T B,
+                                             const rocblas_int ldb,
+                                             rocblas_int* info,
+                                             const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && trans == rocblas_operation_transpose)
+       || (!COMPLEX && trans == rocblas_operation_conjugate_transpose))
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || (m * n && !ipiv) || ((m * nrhs || n * nrhs) && !B)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to calculate workspace sizes.
+    The factorization is not computed, so only the phases that apply the
+    Householder reflectors and solve the triangular system need workspace. **/
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gels_solve_getMemorySize(const rocblas_operation trans,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int batch_count,
+                                        size_t* size_scalars,
+                                        size_t* size_work,
+                                        bool* optim_mem)
+{
+    rocsolver_gels_workspace ws;
+    rocsolver_gels_planWorkspace<BATCHED, STRIDED, T>(trans, m, n, nrhs, batch_count, size_scalars,
+                                                      &ws, optim_mem, false);
+    *size_work = ws.plan.size();
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gels_solve_template(rocblas_handle handle,
+                                             rocblas_operation trans,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             const rocblas_int nrhs,
+                                             U A,
+                                             const rocblas_int shiftA,
+                                             const rocblas_int lda,
+                                             const rocblas_stride strideA,
+                                             T* ipiv,
+                                             const rocblas_stride strideP,
+                                             U B,
+                                             const rocblas_int shiftB,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride strideB,
+                                             rocblas_int* info,
+                                             const rocblas_int batch_count,
+                                             T* scalars,
+                                             void* work,
+                                             bool optim_mem)
+{
+    ROCSOLVER_ENTER("gels_solve", "trans:", trans, "m:", m, "n:", n, "nrhs:", nrhs,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with a nonsingular matrix)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if B is empty
+    if(nrhs == 0)
+        return rocblas_status_success;
+
+    // quick return if A is empty
+    if(m == 0 || n == 0)
+    {
+        rocblas_int rowsB = std::max(m, n);
+        rocblas_int blocksx = (rowsB - 1) / 32 + 1;
+        rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                                stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+
+        return rocblas_status_success;
+    }
+
+    // get the layout of the workspace
+    size_t size_scalars;
+    bool unused;
+    rocsolver_gels_workspace ws;
+    rocsolver_gels_planWorkspace<BATCHED, STRIDED, T>(trans, m, n, nrhs, batch_count, &size_scalars,
+                                                      &ws, &unused, false);
+
+    constexpr int phases = rocsolver_gels_workspace::phases;
+    T* savedB = ws.plan.pointer<T*>(work, ws.ipiv_savedB);
+    T *work_x_temp[phases], *workArr_temp_arr[phases], *diag_trfac_invA[phases];
+    T** trfact_workTrmm_invA_arr[phases];
+    for(int p = 0; p < phases; p++)
+    {
+        work_x_temp[p] = ws.plan.pointer<T*>(work, ws.work_x_temp[p]);
+        workArr_temp_arr[p] = ws.plan.pointer<T*>(work, ws.workArr_temp_arr[p]);
+        diag_trfac_invA[p] = ws.plan.pointer<T*>(work, ws.diag_trfac_invA[p]);
+        trfact_workTrmm_invA_arr[p] = ws.plan.pointer<T**>(work, ws.trfact_workTrmm_invA_arr[p]);
+    }
+
+    // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // solve the least-squares problem
+    // (the Householder scalars are preserved so that the factorization can be reused)
+    local_gels_solve_template<BATCHED, STRIDED>(
+        handle, trans, m, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB,
+        info, batch_count, scalars, work_x_temp, workArr_temp_arr, diag_trfac_invA,
+        trfact_workTrmm_invA_arr, savedB, optim_mem);
+
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    return rocblas_status_success;
+}
@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gels_solve.hpp"
+
+template <typename T, typename U, bool COMPLEX = is_complex<T>>
+rocblas_status rocsolver_gels_solve_strided_batched_impl(rocblas_handle handle,
+                                                         rocblas_operation trans,
+                                                         const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         const rocblas_int nrhs,
+                                                         U A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         T* ipiv,
+                                                         const rocblas_stride strideP,
+                                                         U B,
+                                                         const rocblas_int ldb,
+                                                         const rocblas_stride strideB,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gels_solve_strided_batched", "--trans", trans, "-m", m, "-n", n, "--nrhs",
+                        nrhs, "--lda", lda, "--strideA", strideA, "--strideP", strideP, "--ldb",
+                        ldb, "--strideB", strideB, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gels_solve_argCheck<COMPLEX>(handle, trans, m, n, nrhs, A, lda,
+                                                               ipiv, B, ldb, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    const rocblas_int shiftA = 0;
+    const rocblas_int shiftB = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (shared by the calls to ORMQR/ORMLQ and TRSM,
+    // plus the copy of B)
+    bool optim_mem;
+    size_t size_work;
+    rocsolver_gels_solve_getMemorySize<false, true, T>(trans, m, n, nrhs, batch_count,
+                                                       &size_scalars, &size_work, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work;
+    rocblas_device_malloc mem(handle, size_scalars, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work = mem[1];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_gels_solve_template<false, true, T>(
+        handle, trans, m, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB,
+        info, batch_count, (T*)scalars, work, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgels_solve_strided_batched(rocblas_handle handle,
+                                                     rocblas_operation trans,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     const rocblas_int nrhs,
+                                                     float* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     float* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     float* B,
+                                                     const rocblas_int ldb,
+                                                     const rocblas_stride strideB,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_gels_solve_strided_batched_impl<float>(handle, trans, m, n, nrhs, A, lda,
+                                                            strideA, ipiv, strideP, B, ldb, strideB,
+                                                            info, batch_count);
+}
+
+rocblas_status rocsolver_dgels_solve_strided_batched(rocblas_handle handle,
+                                                     rocblas_operation trans,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     const rocblas_int nrhs,
+                                                     double* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     double* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     double* B,
+                                                     const rocblas_int ldb,
+                                                     const rocblas_stride strideB,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_gels_solve_strided_batched_impl<double>(handle, trans, m, n, nrhs, A, lda,
+                                                             strideA, ipiv, strideP, B, ldb,
+                                                             strideB, info, batch_count);
+}
+
+rocblas_status rocsolver_cgels_solve_strided_batched(rocblas_handle handle,
+                                                     rocblas_operation trans,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     const rocblas_int nrhs,
+                                                     rocblas_float_complex* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_float_complex* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     rocblas_float_complex* B,
+                                                     const rocblas_int ldb,
+                                                     const rocblas_stride strideB,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_gels_solve_strided_batched_impl<rocblas_float_complex>(
+        handle, trans, m, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info,
+        batch_count);
+}
+
+rocblas_status rocsolver_zgels_solve_strided_batched(rocblas_handle handle,
+                                                     rocblas_operation trans,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     const rocblas_int nrhs,
+                                                     rocblas_double_complex* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_double_complex* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     rocblas_double_complex* B,
+                                                     const rocblas_int ldb,
+                                                     const rocblas_stride strideB,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_gels_solve_strided_batched_impl<rocblas_double_complex>(
+        handle, trans, m, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info,
+        batch_count);
+}
+
+} // extern C
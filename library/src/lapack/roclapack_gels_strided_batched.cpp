@@ -32,6 +32,8 @@ rocblas_status rocsolver_gels_strided_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     const rocblas_int shiftA = 0;
     const rocblas_int shiftB = 0;
@@ -39,44 +41,38 @@ rocblas_status rocsolver_gels_strided_batched_impl(rocblas_handle handle,
     // memory workspace sizes:
     // size for constants in rocblas calls
     size_t size_scalars;
-    // size of workspace (for calling GEQRF/GELQF, ORMQR/ORMLQ, and TRSM)
+    // size of workspace (shared by the calls to GEQRF/GELQF, ORMQR/ORMLQ, and TRSM,
+    // plus the Householder scalars and the copy of B)
     bool optim_mem;
-    size_t size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
-        size_trfact_workTrmm_invA_arr;
-    // extra requirements for calling ORMQR/ORMLQ and to copy B
-    size_t size_ipiv_savedB;
-    rocsolver_gels_getMemorySize<false, true, T>(
-        trans, m, n, nrhs, batch_count, &size_scalars, &size_work_x_temp, &size_workArr_temp_arr,
-        &size_diag_trfac_invA, &size_trfact_workTrmm_invA_arr, &size_ipiv_savedB, &optim_mem);
+    size_t size_work;
+    rocsolver_gels_getMemorySize<false, true, T>(trans, m, n, nrhs, batch_count, &size_scalars,
+                                                 &size_work, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
-            size_trfact_workTrmm_invA_arr, size_ipiv_savedB);
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
 
     // memory workspace allocation
-    void *scalars, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA, *trfact_workTrmm_invA_arr,
-        *ipiv_savedB;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
-                              size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_ipiv_savedB);
+    void *scalars, *work;
+    rocblas_device_malloc mem(handle, size_scalars, size_work);
 
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
-    work_x_temp = mem[1];
-    workArr_temp_arr = mem[2];
-    diag_trfac_invA = mem[3];
-    trfact_workTrmm_invA_arr = mem[4];
-    ipiv_savedB = mem[5];
+    work = mem[1];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
-    return rocsolver_gels_template<false, true, T>(
-        handle, trans, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, info,
-        batch_count, (T*)scalars, (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
-        (T**)trfact_workTrmm_invA_arr, (T*)ipiv_savedB, optim_mem);
+    return rocsolver_gels_template<false, true, T>(handle, trans, m, n, nrhs, A, shiftA, lda,
+                                                   strideA, B, shiftB, ldb, strideB, info,
+                                                   batch_count, (T*)scalars, work, optim_mem);
 }
 
 /*
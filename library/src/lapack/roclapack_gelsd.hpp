@@ -0,0 +1,390 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_bdsqr.hpp"
+#include "auxiliary/rocauxiliary_ormbr_unmbr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gebrd.hpp"
+#include "rocsolver.h"
+
+/** GELSD_SCALE_KERNEL computes the (mn x nrhs) matrix W = inv(S) * B(0:mn-1,:), where the
+    reciprocals of the singular values that are not larger than max(rcond * s_max, sfm) are
+    replaced by zero. The rows mn to n-1 of B are set to zero, and the effective rank of A is
+    written to rank. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gelsd_scale_kernel(const rocblas_int mn,
+                                         const rocblas_int n,
+                                         const rocblas_int nrhs,
+                                         S* SS,
+                                         const rocblas_stride strideS,
+                                         U BB,
+                                         const rocblas_int shiftB,
+                                         const rocblas_int ldb,
+                                         const rocblas_stride strideB,
+                                         T* WW,
+                                         const rocblas_int ldw,
+                                         const rocblas_stride strideW,
+                                         const S rcond,
+                                         const S sfm,
+                                         rocblas_int* rank)
+{
+    const auto bid = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    // array pointers
+    S* sv = SS + bid * strideS;
+    T* W = WW + bid * strideW;
+
+    // the singular values are in decreasing order
+    const S tol = std::max(rcond * sv[0], sfm);
+
+    if(i < n && j < nrhs)
+    {
+        T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+
+        if(i < mn)
+        {
+            S s = sv[i];
+            W[i + j * ldw] = (s > tol) ? B[i + j * ldb] / s : T(0);
+        }
+        else
+            B[i + j * ldb] = 0;
+    }
+
+    if(i == 0 && j == 0)
+    {
+        rocblas_int r = 0;
+        while(r < mn && sv[r] > tol)
+            r++;
+        rank[bid] = r;
+    }
+}
+
+/** The workspace of GELSD is organized in the stages of the algorithm: the
+    bidiagonalization of A (GEBRD), the application of Q' to B (ORMBR), the SVD of the
+    bidiagonal form (BDSQR), the solution of the diagonal system, and the application of P to
+    the solution (ORMBR). The reusable buffers of each stage are not live during the others,
+    so they can share memory. **/
+struct rocsolver_gelsd_workspace
+{
+    enum
+    {
+        bidiag,
+        applyQ,
+        bdsqr,
+        solve,
+        applyP,
+        phases
+    };
+
+    workspace_planner plan;
+    int work_workArr[phases];
+    int Abyx_norms_tmptr[phases];
+    int Abyx_norms_trfact_X[phases];
+    int diag_tmptr_Y[phases];
+    int tau;
+    int E;
+    int V;
+    int temp;
+    int workArr;
+};
+
+/** Helper to compute the layout of the workspace of GELSD **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gelsd_planWorkspace(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   rocsolver_gelsd_workspace* ws)
+{
+    // if quick return, set workspace to zero
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        return;
+    }
+
+    constexpr int bidiag = rocsolver_gelsd_workspace::bidiag;
+    constexpr int applyQ = rocsolver_gelsd_workspace::applyQ;
+    constexpr int bdsqr = rocsolver_gelsd_workspace::bdsqr;
+    constexpr int solve = rocsolver_gelsd_workspace::solve;
+    constexpr int applyP = rocsolver_gelsd_workspace::applyP;
+    constexpr int phases = rocsolver_gelsd_workspace::phases;
+
+    const rocblas_int mn = std::min(m, n);
+    size_t w[phases] = {}, a[phases] = {}, x[phases] = {}, y[phases] = {};
+    size_t arr[2] = {};
+    size_t unused;
+
+    // workspace required for the bidiagonalization
+    rocsolver_gebrd_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, &w[bidiag],
+                                              &a[bidiag], &x[bidiag], &y[bidiag]);
+
+    // workspace required to apply Q' and P
+    rocsolver_ormbr_unmbr_getMemorySize<BATCHED, T>(rocblas_column_wise, rocblas_side_left, m,
+                                                    nrhs, n, batch_count, &unused, &a[applyQ],
+                                                    &y[applyQ], &x[applyQ], &arr[0]);
+    rocsolver_ormbr_unmbr_getMemorySize<BATCHED, T>(rocblas_row_wise, rocblas_side_left, n, nrhs,
+                                                    m, batch_count, &unused, &a[applyP],
+                                                    &y[applyP], &x[applyP], &arr[1]);
+
+    // workspace required for the SVD of the bidiagonal form
+    rocsolver_bdsqr_getMemorySize<S>(mn, mn, 0, nrhs, batch_count, &w[bdsqr]);
+
+    for(int p = 0; p < phases; p++)
+    {
+        ws->work_workArr[p] = ws->plan.add(w[p], p);
+        ws->Abyx_norms_tmptr[p] = ws->plan.add(a[p], p);
+        ws->Abyx_norms_trfact_X[p] = ws->plan.add(x[p], p);
+        ws->diag_tmptr_Y[p] = ws->plan.add(y[p], p);
+    }
+
+    // size of array tau to store the householder scalars of Q and P
+    size_t size_tau = 2 * sizeof(T) * mn * batch_count;
+
+    // size of the off-diagonal of the bidiagonal form
+    size_t size_E = sizeof(S) * mn * batch_count;
+
+    // size of the right singular vectors of the bidiagonal form
+    size_t size_V = sizeof(T) * mn * mn * batch_count;
+
+    // size of the scaled right-hand sides
+    size_t size_temp = sizeof(T) * mn * nrhs * batch_count;
+
+    // size of array of pointers (only for batched case)
+    size_t size_workArr = BATCHED ? 2 * sizeof(T*) * batch_count : 0;
+    size_workArr = std::max({size_workArr, arr[0], arr[1]});
+
+    // buffers that persist across stages
+    ws->tau = ws->plan.add(size_tau, bidiag, applyP);
+    ws->E = ws->plan.add(size_E, bidiag, bdsqr);
+    ws->V = ws->plan.add(size_V, bdsqr, solve);
+    ws->temp = ws->plan.add(size_temp, solve);
+    ws->workArr = ws->plan.add(size_workArr, 0, phases - 1);
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gelsd_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work)
+{
+    rocsolver_gelsd_workspace ws;
+    rocsolver_gelsd_planWorkspace<BATCHED, T, S>(m, n, nrhs, batch_count, size_scalars, &ws);
+    *size_work = ws.plan.size();
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gelsd_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        T A,
+                                        const rocblas_int lda,
+                                        T B,
+                                        const rocblas_int ldb,
+                                        S* Sv,
+                                        rocblas_int* rank,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || ((m * nrhs || n * nrhs) && !B) || (std::min(m, n) && !Sv)
+       || (batch_count && !rank) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gelsd_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        S* Sv,
+                                        const rocblas_stride strideS,
+                                        const S rcond,
+                                        rocblas_int* rank,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work)
+{
+    ROCSOLVER_ENTER("gelsd", "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "rcond:", rcond, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with no convergence issues)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if A is empty (rank = 0 and the solution is zero)
+    if(m == 0 || n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rank, batch_count, 0);
+
+        rocblas_int rowsB = std::max(m, n);
+        if(nrhs > 0)
+        {
+            rocblas_int blocksx = (rowsB - 1) / 32 + 1;
+            rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                                    0, stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+        }
+
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    T one = 1;
+    T zero = 0;
+
+    // get the layout of the workspace
+    size_t size_scalars;
+    rocsolver_gelsd_workspace ws;
+    rocsolver_gelsd_planWorkspace<BATCHED, T, S>(m, n, nrhs, batch_count, &size_scalars, &ws);
+
+    constexpr int bidiag = rocsolver_gelsd_workspace::bidiag;
+    constexpr int applyQ = rocsolver_gelsd_workspace::applyQ;
+    constexpr int bdsqr = rocsolver_gelsd_workspace::bdsqr;
+    constexpr int applyP = rocsolver_gelsd_workspace::applyP;
+    constexpr int phases = rocsolver_gelsd_workspace::phases;
+
+    void* work_workArr[phases];
+    T *Abyx_norms_tmptr[phases], *Abyx_norms_trfact_X[phases], *diag_tmptr_Y[phases];
+    for(int p = 0; p < phases; p++)
+    {
+        work_workArr[p] = ws.plan.pointer<void*>(work, ws.work_workArr[p]);
+        Abyx_norms_tmptr[p] = ws.plan.pointer<T*>(work, ws.Abyx_norms_tmptr[p]);
+        Abyx_norms_trfact_X[p] = ws.plan.pointer<T*>(work, ws.Abyx_norms_trfact_X[p]);
+        diag_tmptr_Y[p] = ws.plan.pointer<T*>(work, ws.diag_tmptr_Y[p]);
+    }
+    T* tau = ws.plan.pointer<T*>(work, ws.tau);
+    S* E = ws.plan.pointer<S*>(work, ws.E);
+    T* V = ws.plan.pointer<T*>(work, ws.V);
+    T* temp = ws.plan.pointer<T*>(work, ws.temp);
+    T** workArr = ws.plan.pointer<T**>(work, ws.workArr);
+
+    // auxiliary sizes and variables
+    const rocblas_int mn = std::min(m, n);
+    const rocblas_int ldx = m;
+    const rocblas_int ldy = n;
+    const rocblas_stride strideX = ldx * GEBRD_GEBD2_SWITCHSIZE;
+    const rocblas_stride strideY = ldy * GEBRD_GEBD2_SWITCHSIZE;
+    const rocblas_stride strideE = mn;
+    const rocblas_int ldv = mn;
+    const rocblas_stride strideV = mn * mn;
+    const rocblas_int ldt = mn;
+    const rocblas_stride strideT = mn * nrhs;
+    const rocblas_fill uplo = (m >= n) ? rocblas_fill_upper : rocblas_fill_lower;
+    const rocblas_operation transQ = (is_complex<T> ? rocblas_operation_conjugate_transpose
+                                                    : rocblas_operation_transpose);
+    T* tauq = tau;
+    T* taup = tau + mn * batch_count;
+
+    // a negative rcond means that machine precision is used as threshold
+    const S rc = (rcond < 0) ? get_epsilon<S>() : rcond;
+    const S sfm = get_safemin<S>();
+
+    //*** STAGE 1: bidiagonalization A = Q * B * P' ***//
+    rocsolver_gebrd_template<BATCHED, STRIDED>(
+        handle, m, n, A, shiftA, lda, strideA, Sv, strideS, E, strideE, tauq, mn, taup, mn,
+        Abyx_norms_trfact_X[bidiag], 0, ldx, strideX, diag_tmptr_Y[bidiag], 0, ldy, strideY,
+        batch_count, scalars, work_workArr[bidiag], Abyx_norms_tmptr[bidiag]);
+
+    //*** STAGE 2: B <- Q' * B ***//
+    rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
+        handle, rocblas_column_wise, rocblas_side_left, transQ, m, nrhs, n, A, shiftA, lda,
+        strideA, tauq, mn, B, shiftB, ldb, strideB, batch_count, scalars, Abyx_norms_tmptr[applyQ],
+        diag_tmptr_Y[applyQ], Abyx_norms_trfact_X[applyQ], workArr);
+
+    //*** STAGE 3: SVD of the bidiagonal form; B(0:mn-1,:) <- Ub' * B(0:mn-1,:) and V <- Vb' ***//
+    rocblas_int blocks = (mn - 1) / BS2 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(init_ident<T>, dim3(blocks, blocks, batch_count), dim3(BS2, BS2), 0,
+                            stream, mn, mn, V, 0, ldv, strideV);
+
+    rocsolver_bdsqr_template<T>(handle, uplo, mn, mn, 0, nrhs, Sv, strideS, E, strideE, V, 0, ldv,
+                                strideV, (U) nullptr, 0, 1, 1, B, shiftB, ldb, strideB, info,
+                                batch_count, (S*)work_workArr[bdsqr], workArr);
+
+    if(nrhs > 0)
+    {
+        //*** STAGE 4: solve the diagonal system and compute B(0:mn-1,:) <- Vb * inv(S) * B ***//
+        rocblas_int blocksx = (std::max(m, n) - 1) / BS2 + 1;
+        rocblas_int blocksy = (nrhs - 1) / BS2 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(gelsd_scale_kernel<T>, dim3(blocksx, blocksy, batch_count),
+                                dim3(BS2, BS2, 1), 0, stream, mn, n, nrhs, Sv, strideS, B, shiftB,
+                                ldb, strideB, temp, ldt, strideT, rc, sfm, rank);
+
+        rocblasCall_gemm<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, mn, nrhs, mn,
+            &one, V, 0, ldv, strideV, temp, 0, ldt, strideT, &zero, B, shiftB, ldb, strideB,
+            batch_count, workArr);
+
+        //*** STAGE 5: B <- P * B ***//
+        rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
+            handle, rocblas_row_wise, rocblas_side_left, rocblas_operation_none, n, nrhs, m, A,
+            shiftA, lda, strideA, taup, mn, B, shiftB, ldb, strideB, batch_count, scalars,
+            Abyx_norms_tmptr[applyP], diag_tmptr_Y[applyP], Abyx_norms_trfact_X[applyP], workArr);
+    }
+    else
+    {
+        // only the effective rank is required
+        ROCSOLVER_LAUNCH_KERNEL(gelsd_scale_kernel<T>, dim3(1, 1, batch_count), dim3(1, 1, 1), 0,
+                                stream, mn, n, nrhs, Sv, strideS, B, shiftB, ldb, strideB, temp,
+                                ldt, strideT, rc, sfm, rank);
+    }
+
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    return rocblas_status_success;
+}
@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gelsd.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gelsd_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    U B,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    S* Sv,
+                                                    const rocblas_stride strideS,
+                                                    const S rcond,
+                                                    rocblas_int* rank,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gelsd_strided_batched", "-m", m, "-n", n, "--nrhs", nrhs, "--lda", lda,
+                        "--strideA", strideA, "--ldb", ldb, "--strideB", strideB, "--strideS",
+                        strideS, "--rcond", rcond, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gelsd_argCheck(handle, m, n, nrhs, A, lda, B, ldb, Sv, rank, info,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (shared by GEBRD, ORMBR and BDSQR, plus the householder scalars,
+    // the bidiagonal form, the right singular vectors and arrays of pointers)
+    size_t size_work;
+    rocsolver_gelsd_getMemorySize<false, T, S>(m, n, nrhs, batch_count, &size_scalars, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work;
+    rocblas_device_malloc mem(handle, size_scalars, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work = mem[1];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_gelsd_template<false, true, T>(handle, m, n, nrhs, A, shiftA, lda, strideA, B,
+                                                    shiftB, ldb, strideB, Sv, strideS, rcond, rank,
+                                                    info, batch_count, (T*)scalars, work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgelsd_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                float* S,
+                                                const rocblas_stride strideS,
+                                                const float rcond,
+                                                rocblas_int* rank,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsd_strided_batched_impl<float>(handle, m, n, nrhs, A, lda, strideA, B, ldb,
+                                                       strideB, S, strideS, rcond, rank, info,
+                                                       batch_count);
+}
+
+rocblas_status rocsolver_dgelsd_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                double* S,
+                                                const rocblas_stride strideS,
+                                                const double rcond,
+                                                rocblas_int* rank,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsd_strided_batched_impl<double>(handle, m, n, nrhs, A, lda, strideA, B, ldb,
+                                                        strideB, S, strideS, rcond, rank, info,
+                                                        batch_count);
+}
+
+rocblas_status rocsolver_cgelsd_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_float_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                float* S,
+                                                const rocblas_stride strideS,
+                                                const float rcond,
+                                                rocblas_int* rank,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsd_strided_batched_impl<rocblas_float_complex>(handle, m, n, nrhs, A, lda,
+                                                                       strideA, B, ldb, strideB, S,
+                                                                       strideS, rcond, rank, info,
+                                                                       batch_count);
+}
+
+rocblas_status rocsolver_zgelsd_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_double_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                double* S,
+                                                const rocblas_stride strideS,
+                                                const double rcond,
+                                                rocblas_int* rank,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsd_strided_batched_impl<rocblas_double_complex>(handle, m, n, nrhs, A, lda,
+                                                                        strideA, B, ldb, strideB, S,
+                                                                        strideS, rcond, rank, info,
+                                                                        batch_count);
+}
+
+} // extern C
@@ -0,0 +1,917 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormlq_unmlq.hpp"
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gelqf.hpp"
+#include "roclapack_geqr2.hpp"
+#include "rocsolver.h"
+
+/** GELSY_SUM returns the sum of the values val provided by all the threads in the
+    thread-block. sval is a shared array of size BS1. **/
+template <typename T>
+__device__ T gelsy_sum(T val, T* sval)
+{
+    const int tid = hipThreadIdx_x;
+
+    sval[tid] = val;
+    __syncthreads();
+
+    for(int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] += sval[tid + r];
+        __syncthreads();
+    }
+
+    T sum = sval[0];
+    __syncthreads();
+
+    return sum;
+}
+
+/** GELSY_LAIC1 applies one step of incremental condition estimation (as in LAPACK's LAIC1).
+    Given the estimate sest of the largest (job = 1) or smallest (job = 2) singular value of a
+    triangular matrix R, with approximate singular vector x, alpha = x' * w and gamma, it returns
+    the estimate sestpr for the matrix [R w; 0 gamma] and the scalars s and c such that
+    [s*x; c] is the new approximate singular vector. **/
+template <typename T, typename S>
+__device__ void gelsy_laic1(const rocblas_int job,
+                            const S sest,
+                            const T alpha,
+                            const T gamma,
+                            const S eps,
+                            S& sestpr,
+                            T& s,
+                            T& c)
+{
+    const S absalp = std::abs(alpha);
+    const S absgam = std::abs(gamma);
+    const S absest = std::abs(sest);
+    S tmp, scl;
+    T sine, cosine;
+
+    if(job == 1)
+    {
+        // estimation of the largest singular value
+        if(sest == 0)
+        {
+            S s1 = std::max(absgam, absalp);
+            if(s1 == 0)
+            {
+                s = 0;
+                c = 1;
+                sestpr = 0;
+            }
+            else
+            {
+                s = alpha / T(s1);
+                c = gamma / T(s1);
+                tmp = sqrt(std::real(conj(s) * s + conj(c) * c));
+                s = s / T(tmp);
+                c = c / T(tmp);
+                sestpr = s1 * tmp;
+            }
+        }
+        else if(absgam <= eps * absest)
+        {
+            s = 1;
+            c = 0;
+            tmp = std::max(absest, absalp);
+            S s1 = absest / tmp;
+            S s2 = absalp / tmp;
+            sestpr = tmp * sqrt(s1 * s1 + s2 * s2);
+        }
+        else if(absalp <= eps * absest)
+        {
+            if(absgam <= absest)
+            {
+                s = 1;
+                c = 0;
+                sestpr = absest;
+            }
+            else
+            {
+                s = 0;
+                c = 1;
+                sestpr = absgam;
+            }
+        }
+        else if(absest <= eps * absalp || absest <= eps * absgam)
+        {
+            S smax = std::max(absgam, absalp);
+            tmp = std::min(absgam, absalp) / smax;
+            scl = sqrt(1 + tmp * tmp);
+            sestpr = smax * scl;
+            s = (alpha / T(smax)) / T(scl);
+            c = (gamma / T(smax)) / T(scl);
+        }
+        else
+        {
+            S zeta1 = absalp / absest;
+            S zeta2 = absgam / absest;
+            S b = (1 - zeta1 * zeta1 - zeta2 * zeta2) / 2;
+            S cc = zeta1 * zeta1;
+            S t = (b > 0) ? cc / (b + sqrt(b * b + cc)) : sqrt(b * b + cc) - b;
+
+            sine = -(alpha / T(absest)) / T(t);
+            cosine = -(gamma / T(absest)) / T(1 + t);
+            tmp = sqrt(std::real(conj(sine) * sine + conj(cosine) * cosine));
+            s = sine / T(tmp);
+            c = cosine / T(tmp);
+            sestpr = sqrt(t + 1) * absest;
+        }
+    }
+    else
+    {
+        // estimation of the smallest singular value
+        if(sest == 0)
+        {
+            sestpr = 0;
+            if(std::max(absgam, absalp) == 0)
+            {
+                sine = 1;
+                cosine = 0;
+            }
+            else
+            {
+                sine = -conj(gamma);
+                cosine = conj(alpha);
+            }
+            S s1 = std::max(std::abs(sine), std::abs(cosine));
+            s = sine / T(s1);
+            c = cosine / T(s1);
+            tmp = sqrt(std::real(conj(s) * s + conj(c) * c));
+            s = s / T(tmp);
+            c = c / T(tmp);
+        }
+        else if(absgam <= eps * absest)
+        {
+            s = 0;
+            c = 1;
+            sestpr = absgam;
+        }
+        else if(absalp <= eps * absest)
+        {
+            if(absgam <= absest)
+            {
+                s = 0;
+                c = 1;
+                sestpr = absgam;
+            }
+            else
+            {
+                s = 1;
+                c = 0;
+                sestpr = absest;
+            }
+        }
+        else if(absest <= eps * absalp || absest <= eps * absgam)
+        {
+            S smax = std::max(absgam, absalp);
+            tmp = std::min(absgam, absalp) / smax;
+            scl = sqrt(1 + tmp * tmp);
+            sestpr = (absgam <= absalp) ? absest * (tmp / scl) : absest / scl;
+            s = -(conj(gamma) / T(smax)) / T(scl);
+            c = (conj(alpha) / T(smax)) / T(scl);
+        }
+        else
+        {
+            S zeta1 = absalp / absest;
+            S zeta2 = absgam / absest;
+            S norma = std::max(1 + zeta1 * zeta1 + zeta1 * zeta2, zeta1 * zeta2 + zeta2 * zeta2);
+            S test = 1 + 2 * (zeta1 - zeta2) * (zeta1 + zeta2);
+            S b, cc, t;
+
+            if(test >= 0)
+            {
+                // root is close to zero, compute directly
+                b = (zeta1 * zeta1 + zeta2 * zeta2 + 1) / 2;
+                cc = zeta2 * zeta2;
+                t = cc / (b + sqrt(std::abs(b * b - cc)));
+                sine = (alpha / T(absest)) / T(1 - t);
+                cosine = -(gamma / T(absest)) / T(t);
+                sestpr = sqrt(t + 4 * eps * eps * norma) * absest;
+            }
+            else
+            {
+                // root is closer to one, shift by that amount
+                b = (zeta2 * zeta2 + zeta1 * zeta1 - 1) / 2;
+                cc = zeta1 * zeta1;
+                t = (b >= 0) ? -cc / (b + sqrt(b * b + cc)) : b - sqrt(b * b + cc);
+                sine = -(alpha / T(absest)) / T(t);
+                cosine = -(gamma / T(absest)) / T(1 + t);
+                sestpr = sqrt(1 + t + 4 * eps * eps * norma) * absest;
+            }
+
+            tmp = sqrt(std::real(conj(sine) * sine + conj(cosine) * cosine));
+            s = sine / T(tmp);
+            c = cosine / T(tmp);
+        }
+    }
+}
+
+/** GELSY_INIT_KERNEL computes the norms of the columns of A (stored twice, in vn1 and vn2)
+    and initializes the column permutation jpvt with the identity. Each thread-block works on
+    one column. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gelsy_init_kernel(const rocblas_int m,
+                                                               const rocblas_int n,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               S* VV,
+                                                               rocblas_int* jpvtA,
+                                                               const rocblas_stride strideP)
+{
+    const auto bid = hipBlockIdx_z;
+    const rocblas_int j = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    // array pointers
+    rocblas_int* jpvt = jpvtA + bid * strideP;
+
+    if(tid == 0)
+        jpvt[j] = j + 1;
+
+    // (the norms are not needed if A is empty)
+    if(m > 0)
+    {
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        S* vn1 = VV + bid * 2 * n;
+        S* vn2 = vn1 + n;
+
+        // shared memory setup
+        __shared__ S sval[BS1];
+
+        S val = 0;
+        for(rocblas_int i = tid; i < m; i += BS1)
+            val += std::real(conj(A[i + j * lda]) * A[i + j * lda]);
+        val = sqrt(gelsy_sum<S>(val, sval));
+
+        if(tid == 0)
+        {
+            vn1[j] = val;
+            vn2[j] = val;
+        }
+    }
+}
+
+/** GELSY_PIVOT_KERNEL selects the column with the largest partial norm among columns k to n-1,
+    and interchanges it with column k (as in LAPACK's LAQP2). **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gelsy_pivot_kernel(const rocblas_int k,
+                                                                const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                S* VV,
+                                                                rocblas_int* jpvtA,
+                                                                const rocblas_stride strideP)
+{
+    const auto bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* vn1 = VV + bid * 2 * n;
+    S* vn2 = vn1 + n;
+    rocblas_int* jpvt = jpvtA + bid * strideP;
+
+    // shared memory setup
+    __shared__ S sval[BS1];
+    __shared__ rocblas_int sidx[BS1];
+
+    // find the pivot column
+    iamax<BS1>(tid, n - k, vn1 + k, 1, sval, sidx);
+    __syncthreads();
+
+    const rocblas_int p = k + sidx[0] - 1;
+    if(p != k)
+    {
+        for(rocblas_int i = tid; i < m; i += BS1)
+            swap(A[i + k * lda], A[i + p * lda]);
+
+        if(tid == 0)
+        {
+            swap(jpvt[k], jpvt[p]);
+            vn1[p] = vn1[k];
+            vn2[p] = vn2[k];
+        }
+    }
+}
+
+/** GELSY_NORMS_KERNEL updates the partial norms of columns k+1 to n-1 after the k-th
+    Householder reflector has been applied. When cancellation is detected, the norm is
+    re-computed from the remaining rows (as in LAPACK's LAQP2). Each thread-block works on one
+    column. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gelsy_norms_kernel(const rocblas_int k,
+                                                                const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                S* VV,
+                                                                const S tol3z)
+{
+    const auto bid = hipBlockIdx_z;
+    const rocblas_int j = k + 1 + hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* vn1 = VV + bid * 2 * n;
+    S* vn2 = vn1 + n;
+
+    // shared memory setup
+    __shared__ S sval[BS1];
+
+    // (all the threads must read the norms before they are updated)
+    const S v1 = vn1[j];
+    const S v2 = vn2[j];
+    __syncthreads();
+
+    if(v1 != 0)
+    {
+        S temp = std::abs(A[k + j * lda]) / v1;
+        temp = std::max(S(1) - temp * temp, S(0));
+        S temp2 = temp * (v1 / v2) * (v1 / v2);
+
+        if(temp2 <= tol3z)
+        {
+            S val = 0;
+            for(rocblas_int i = k + 1 + tid; i < m; i += BS1)
+                val += std::real(conj(A[i + j * lda]) * A[i + j * lda]);
+            val = sqrt(gelsy_sum<S>(val, sval));
+
+            if(tid == 0)
+            {
+                vn1[j] = val;
+                vn2[j] = val;
+            }
+        }
+        else if(tid == 0)
+            vn1[j] = v1 * sqrt(temp);
+    }
+}
+
+/** GELSY_RANK_KERNEL determines the effective rank of the upper triangular factor R (stored
+    in the first mn rows of A) using incremental condition estimation: the rank is the order of
+    the largest leading triangular submatrix R11 with estimated condition number smaller than
+    1/rcond. X is a workspace for the approximate singular vectors. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gelsy_rank_kernel(const rocblas_int mn,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               T* XX,
+                                                               const S rcond,
+                                                               const S eps,
+                                                               rocblas_int* rank)
+{
+    const auto bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* xmin = XX + bid * 2 * mn;
+    T* xmax = xmin + mn;
+
+    // shared memory setup
+    __shared__ T sval[BS1];
+
+    S smax = std::abs(A[0]);
+    S smin = smax;
+    if(smax == 0)
+    {
+        if(tid == 0)
+            rank[bid] = 0;
+        return;
+    }
+
+    if(tid == 0)
+    {
+        xmin[0] = 1;
+        xmax[0] = 1;
+    }
+    __syncthreads();
+
+    rocblas_int r = 1;
+    while(r < mn)
+    {
+        T* w = A + r * lda;
+
+        // alpha = x' * R(0:r-1,r) for both estimates
+        T amin = 0, amax = 0;
+        for(rocblas_int i = tid; i < r; i += BS1)
+        {
+            amin += conj(xmin[i]) * w[i];
+            amax += conj(xmax[i]) * w[i];
+        }
+        amin = gelsy_sum<T>(amin, sval);
+        amax = gelsy_sum<T>(amax, sval);
+
+        // (all the threads compute the same estimates)
+        S sminpr, smaxpr;
+        T s1, c1, s2, c2;
+        gelsy_laic1<T>(2, smin, amin, w[r], eps, sminpr, s1, c1);
+        gelsy_laic1<T>(1, smax, amax, w[r], eps, smaxpr, s2, c2);
+
+        if(smaxpr * rcond > sminpr)
+            break;
+
+        for(rocblas_int i = tid; i < r; i += BS1)
+        {
+            xmin[i] *= s1;
+            xmax[i] *= s2;
+        }
+        if(tid == 0)
+        {
+            xmin[r] = c1;
+            xmax[r] = c2;
+        }
+        __syncthreads();
+
+        smin = sminpr;
+        smax = smaxpr;
+        r++;
+    }
+
+    if(tid == 0)
+        rank[bid] = r;
+}
+
+/** GELSY_MASK_KERNEL discards the part of the factorization beyond the effective rank: it sets
+    to zero the strictly lower part of the first mn rows of A and the rows rank to mn-1 of A,
+    together with the rows rank to n-1 of B. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_mask_kernel(const rocblas_int mn,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U AA,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U BB,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        const rocblas_int* rank)
+{
+    const auto bid = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    const rocblas_int r = rank[bid];
+
+    if(i < mn && j < n && (i > j || i >= r))
+    {
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        A[i + j * lda] = 0;
+    }
+
+    if(i >= r && i < n && j < nrhs)
+    {
+        T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+        B[i + j * ldb] = 0;
+    }
+}
+
+/** GELSY_DIAG_KERNEL sets to one the diagonal elements rank to mn-1 of L, so that the
+    triangular solve is well defined (the corresponding rows of the right-hand side are
+    zero). **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_diag_kernel(const rocblas_int mn,
+                                        U AA,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int* rank)
+{
+    const auto bid = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i >= rank[bid] && i < mn)
+    {
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        A[i + i * lda] = 1;
+    }
+}
+
+/** GELSY_PERMUTE_KERNEL applies the column permutation to the solution:
+    B(jpvt(i)-1,:) = W(i,:), where W is a copy of the first n rows of B. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_permute_kernel(const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           U BB,
+                                           const rocblas_int shiftB,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride strideB,
+                                           T* WW,
+                                           const rocblas_int* jpvtA,
+                                           const rocblas_stride strideP)
+{
+    const auto bid = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < n && j < nrhs)
+    {
+        T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+        T* W = WW + bid * n * nrhs;
+        const rocblas_int* jpvt = jpvtA + bid * strideP;
+
+        B[(jpvt[i] - 1) + j * ldb] = W[i + j * n];
+    }
+}
+
+/** The workspace of GELSY is organized in phases: the QR factorization with column pivoting
+    and the rank estimation, the application of Q' to B (ORMQR), the reduction of the
+    triangular factor R(1:rank,:) to lower triangular form (GELQF), the triangular solve (TRSM),
+    and the application of the orthogonal/unitary matrix Z' to the solution (ORMLQ). The
+    reusable buffers of each phase are not live during the others, so they can share memory. **/
+struct rocsolver_gelsy_workspace
+{
+    enum
+    {
+        factor,
+        applyQ,
+        complete,
+        solve,
+        applyZ,
+        phases
+    };
+
+    workspace_planner plan;
+    int work_x_temp[phases];
+    int workArr_temp_arr[phases];
+    int diag_trfac_invA[phases];
+    int trfact_workTrmm_invA_arr[phases];
+    int tauQ;
+    int tauZ;
+    int norms;
+    int ice;
+    int temp;
+};
+
+/** Helper to compute the layout of the workspace of GELSY **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gelsy_planWorkspace(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   rocsolver_gelsy_workspace* ws,
+                                   bool* optim_mem)
+{
+    // always allocate all required memory for TRSM optimal performance
+    *optim_mem = true;
+
+    // if quick return, set workspace to zero
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        return;
+    }
+
+    constexpr int factor = rocsolver_gelsy_workspace::factor;
+    constexpr int applyQ = rocsolver_gelsy_workspace::applyQ;
+    constexpr int complete = rocsolver_gelsy_workspace::complete;
+    constexpr int solve = rocsolver_gelsy_workspace::solve;
+    constexpr int applyZ = rocsolver_gelsy_workspace::applyZ;
+    constexpr int phases = rocsolver_gelsy_workspace::phases;
+
+    const rocblas_int mn = std::min(m, n);
+    size_t w[phases] = {}, a[phases] = {}, d[phases] = {}, t[phases] = {};
+    size_t unused;
+
+    // workspace required for the QR factorization with column pivoting
+    rocsolver_geqr2_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, &w[factor],
+                                              &a[factor], &d[factor]);
+
+    if(nrhs > 0)
+    {
+        // workspace required to apply Q' and Z'
+        rocsolver_ormqr_unmqr_getMemorySize<BATCHED, T>(rocblas_side_left, m, nrhs, mn,
+                                                        batch_count, &unused, &w[applyQ],
+                                                        &a[applyQ], &d[applyQ], &t[applyQ]);
+        rocsolver_ormlq_unmlq_getMemorySize<BATCHED, T>(rocblas_side_left, n, nrhs, mn,
+                                                        batch_count, &unused, &w[applyZ],
+                                                        &a[applyZ], &d[applyZ], &t[applyZ]);
+
+        // workspace required to reduce R to lower triangular form
+        rocsolver_gelqf_getMemorySize<BATCHED, T>(mn, n, batch_count, &unused, &w[complete],
+                                                  &a[complete], &d[complete], &t[complete]);
+
+        // workspace required for the triangular solve
+        rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, rocblas_operation_none, mn, nrhs,
+                                         batch_count, &w[solve], &a[solve], &d[solve], &t[solve]);
+    }
+
+    for(int p = 0; p < phases; p++)
+    {
+        ws->work_x_temp[p] = ws->plan.add(w[p], p);
+        ws->workArr_temp_arr[p] = ws->plan.add(a[p], p);
+        ws->diag_trfac_invA[p] = ws->plan.add(d[p], p);
+        ws->trfact_workTrmm_invA_arr[p] = ws->plan.add(t[p], p);
+    }
+
+    // size of the householder scalars of Q and Z
+    size_t size_tau = sizeof(T) * mn * batch_count;
+
+    // size of the partial column norms
+    size_t size_norms = 2 * sizeof(S) * n * batch_count;
+
+    // size of the approximate singular vectors for the rank estimation
+    size_t size_ice = 2 * sizeof(T) * mn * batch_count;
+
+    // size of the copy of the solution before the permutation
+    size_t size_temp = sizeof(T) * n * nrhs * batch_count;
+
+    // buffers that persist across phases
+    ws->tauQ = ws->plan.add(size_tau, factor, applyQ);
+    ws->tauZ = ws->plan.add(nrhs > 0 ? size_tau : 0, complete, applyZ);
+    ws->norms = ws->plan.add(size_norms, factor);
+    ws->ice = ws->plan.add(size_ice, factor);
+    ws->temp = ws->plan.add(size_temp, applyZ);
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gelsy_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work,
+                                   bool* optim_mem)
+{
+    rocsolver_gelsy_workspace ws;
+    rocsolver_gelsy_planWorkspace<BATCHED, T, S>(m, n, nrhs, batch_count, size_scalars, &ws,
+                                                 optim_mem);
+    *size_work = ws.plan.size();
+}
+
+template <typename T>
+rocblas_status rocsolver_gelsy_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        T A,
+                                        const rocblas_int lda,
+                                        T B,
+                                        const rocblas_int ldb,
+                                        rocblas_int* jpvt,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || ((m * nrhs || n * nrhs) && !B) || (n && !jpvt) || (batch_count && !rank))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gelsy_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideP,
+                                        const S rcond,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("gelsy", "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "rcond:", rcond, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return if A is empty (rank = 0 and the solution is zero)
+    if(m == 0 || n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rank, batch_count, 0);
+
+        if(n > 0)
+            ROCSOLVER_LAUNCH_KERNEL((gelsy_init_kernel<T, S>), dim3(n, 1, batch_count), threads,
+                                    0, stream, m, n, A, shiftA, lda, strideA, (S*)nullptr, jpvt,
+                                    strideP);
+
+        rocblas_int rowsB = std::max(m, n);
+        if(nrhs > 0)
+        {
+            rocblas_int blocksx = (rowsB - 1) / 32 + 1;
+            rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                                    0, stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+        }
+
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    T one = 1;
+
+    // get the layout of the workspace
+    size_t size_scalars;
+    bool unused;
+    rocsolver_gelsy_workspace ws;
+    rocsolver_gelsy_planWorkspace<BATCHED, T, S>(m, n, nrhs, batch_count, &size_scalars, &ws,
+                                                 &unused);
+
+    constexpr int factor = rocsolver_gelsy_workspace::factor;
+    constexpr int applyQ = rocsolver_gelsy_workspace::applyQ;
+    constexpr int complete = rocsolver_gelsy_workspace::complete;
+    constexpr int solve = rocsolver_gelsy_workspace::solve;
+    constexpr int applyZ = rocsolver_gelsy_workspace::applyZ;
+    constexpr int phases = rocsolver_gelsy_workspace::phases;
+
+    T *work_x_temp[phases], *workArr_temp_arr[phases], *diag_trfac_invA[phases];
+    T** trfact_workTrmm_invA_arr[phases];
+    for(int p = 0; p < phases; p++)
+    {
+        work_x_temp[p] = ws.plan.pointer<T*>(work, ws.work_x_temp[p]);
+        workArr_temp_arr[p] = ws.plan.pointer<T*>(work, ws.workArr_temp_arr[p]);
+        diag_trfac_invA[p] = ws.plan.pointer<T*>(work, ws.diag_trfac_invA[p]);
+        trfact_workTrmm_invA_arr[p] = ws.plan.pointer<T**>(work, ws.trfact_workTrmm_invA_arr[p]);
+    }
+    T* tauQ = ws.plan.pointer<T*>(work, ws.tauQ);
+    T* tauZ = ws.plan.pointer<T*>(work, ws.tauZ);
+    S* norms = ws.plan.pointer<S*>(work, ws.norms);
+    T* ice = ws.plan.pointer<T*>(work, ws.ice);
+    T* temp = ws.plan.pointer<T*>(work, ws.temp);
+
+    // auxiliary sizes and variables
+    const rocblas_int mn = std::min(m, n);
+    const rocblas_stride strideT = mn;
+
+    // a negative rcond means that machine precision is used as threshold
+    const S eps = get_epsilon<S>();
+    const S rc = (rcond < 0) ? eps : rcond;
+    const S tol3z = sqrt(eps);
+
+    // TODO: apply scaling to improve accuracy over a larger range of values
+
+    //*** PHASE 1: QR factorization with column pivoting A * P = Q * R ***//
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_init_kernel<T, S>), dim3(n, 1, batch_count), threads, 0, stream,
+                            m, n, A, shiftA, lda, strideA, norms, jpvt, strideP);
+
+    for(rocblas_int k = 0; k < mn; ++k)
+    {
+        // bring the column with the largest partial norm to position k
+        ROCSOLVER_LAUNCH_KERNEL((gelsy_pivot_kernel<T, S>), dim3(1, 1, batch_count), threads, 0,
+                                stream, k, m, n, A, shiftA, lda, strideA, norms, jpvt, strideP);
+
+        // generate Householder reflector to work on column k
+        rocsolver_larfg_template(handle, m - k, A, shiftA + idx2D(k, k, lda), A,
+                                 shiftA + idx2D(std::min(k + 1, m - 1), k, lda), 1, strideA,
+                                 (tauQ + k), strideT, batch_count, work_x_temp[factor],
+                                 workArr_temp_arr[factor]);
+
+        if(k < n - 1)
+        {
+            // insert one in A(k,k) to build/apply the householder matrix
+            ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                    diag_trfac_invA[factor], 0, 1, A, shiftA + idx2D(k, k, lda),
+                                    lda, strideA, 1, true);
+
+            // conjugate tau
+            if(is_complex<T>)
+                rocsolver_lacgv_template<T>(handle, 1, tauQ, k, 1, strideT, batch_count);
+
+            // apply Householder reflector to the rest of matrix from the left
+            rocsolver_larf_template(handle, rocblas_side_left, m - k, n - k - 1, A,
+                                    shiftA + idx2D(k, k, lda), 1, strideA, (tauQ + k), strideT, A,
+                                    shiftA + idx2D(k, k + 1, lda), lda, strideA, batch_count,
+                                    scalars, workArr_temp_arr[factor], (T**)work_x_temp[factor]);
+
+            // restore original value of A(k,k)
+            ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                    stream, diag_trfac_invA[factor], 0, 1, A,
+                                    shiftA + idx2D(k, k, lda), lda, strideA, 1);
+
+            // restore tau
+            if(is_complex<T>)
+                rocsolver_lacgv_template<T>(handle, 1, tauQ, k, 1, strideT, batch_count);
+
+            // update the partial norms of the remaining columns
+            ROCSOLVER_LAUNCH_KERNEL((gelsy_norms_kernel<T, S>), dim3(n - k - 1, 1, batch_count),
+                                    threads, 0, stream, k, m, n, A, shiftA, lda, strideA, norms,
+                                    tol3z);
+        }
+    }
+
+    //*** PHASE 1 (cont.): determine the effective rank using incremental condition estimation ***//
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_rank_kernel<T, S>), dim3(1, 1, batch_count), threads, 0, stream,
+                            mn, A, shiftA, lda, strideA, ice, rc, eps, rank);
+
+    if(nrhs > 0)
+    {
+        //*** PHASE 2: B <- Q' * B ***//
+        rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, mn, A,
+            shiftA, lda, strideA, tauQ, strideT, B, shiftB, ldb, strideB, batch_count, scalars,
+            work_x_temp[applyQ], workArr_temp_arr[applyQ], diag_trfac_invA[applyQ],
+            trfact_workTrmm_invA_arr[applyQ]);
+
+        //*** PHASE 3: [R11 R12; 0 0] = [L11 0; 0 0] * Z ***//
+        // (LAPACK's TZRZF is replaced by an LQ factorization of the masked factor R)
+        rocblas_int blocksx = (n - 1) / BS2 + 1;
+        rocblas_int blocksy = (std::max(n, nrhs) - 1) / BS2 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(gelsy_mask_kernel<T>, dim3(blocksx, blocksy, batch_count),
+                                dim3(BS2, BS2, 1), 0, stream, mn, n, nrhs, A, shiftA, lda, strideA,
+                                B, shiftB, ldb, strideB, rank);
+
+        rocsolver_gelqf_template<BATCHED, STRIDED>(
+            handle, mn, n, A, shiftA, lda, strideA, tauZ, strideT, batch_count, scalars,
+            work_x_temp[complete], workArr_temp_arr[complete], diag_trfac_invA[complete],
+            trfact_workTrmm_invA_arr[complete]);
+
+        //*** PHASE 4: solve L11 * Y = B(0:rank-1,:) ***//
+        blocksx = (mn - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(gelsy_diag_kernel<T>, dim3(blocksx, 1, batch_count), threads, 0,
+                                stream, mn, A, shiftA, lda, strideA, rank);
+
+        rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_lower,
+                                     rocblas_operation_none, rocblas_diagonal_non_unit, mn, nrhs,
+                                     &one, A, shiftA, lda, strideA, B, shiftB, ldb, strideB,
+                                     batch_count, optim_mem, work_x_temp[solve],
+                                     workArr_temp_arr[solve], diag_trfac_invA[solve],
+                                     trfact_workTrmm_invA_arr[solve]);
+
+        //*** PHASE 5: B <- P * Z' * B ***//
+        rocsolver_ormlq_unmlq_template<BATCHED, STRIDED>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose, n, nrhs, mn, A,
+            shiftA, lda, strideA, tauZ, strideT, B, shiftB, ldb, strideB, batch_count, scalars,
+            work_x_temp[applyZ], workArr_temp_arr[applyZ], diag_trfac_invA[applyZ],
+            trfact_workTrmm_invA_arr[applyZ]);
+
+        blocksx = (n - 1) / BS2 + 1;
+        blocksy = (nrhs - 1) / BS2 + 1;
+        ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(blocksx, blocksy, batch_count),
+                                dim3(BS2, BS2), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB,
+                                ldb, strideB, temp);
+        ROCSOLVER_LAUNCH_KERNEL(gelsy_permute_kernel<T>, dim3(blocksx, blocksy, batch_count),
+                                dim3(BS2, BS2), 0, stream, n, nrhs, B, shiftB, ldb, strideB, temp,
+                                jpvt, strideP);
+    }
+
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    return rocblas_status_success;
+}
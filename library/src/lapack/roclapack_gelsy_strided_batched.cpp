@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gelsy.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gelsy_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    U B,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    rocblas_int* jpvt,
+                                                    const rocblas_stride strideP,
+                                                    const S rcond,
+                                                    rocblas_int* rank,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gelsy_strided_batched", "-m", m, "-n", n, "--nrhs", nrhs, "--lda", lda,
+                        "--strideA", strideA, "--ldb", ldb, "--strideB", strideB, "--strideP",
+                        strideP, "--rcond", rcond, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gelsy_argCheck(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rank,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (shared by GEQR2, ORMQR, GELQF, TRSM and ORMLQ, plus the householder
+    // scalars, the partial column norms and the approximate singular vectors)
+    size_t size_work;
+    bool optim_mem;
+    rocsolver_gelsy_getMemorySize<false, T, S>(m, n, nrhs, batch_count, &size_scalars, &size_work,
+                                               &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work;
+    rocblas_device_malloc mem(handle, size_scalars, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work = mem[1];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_gelsy_template<false, true, T>(handle, m, n, nrhs, A, shiftA, lda, strideA, B,
+                                                    shiftB, ldb, strideB, jpvt, strideP, rcond,
+                                                    rank, batch_count, (T*)scalars, work,
+                                                    optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgelsy_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideP,
+                                                const float rcond,
+                                                rocblas_int* rank,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsy_strided_batched_impl<float>(handle, m, n, nrhs, A, lda, strideA, B, ldb,
+                                                       strideB, jpvt, strideP, rcond, rank,
+                                                       batch_count);
+}
+
+rocblas_status rocsolver_dgelsy_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideP,
+                                                const double rcond,
+                                                rocblas_int* rank,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsy_strided_batched_impl<double>(handle, m, n, nrhs, A, lda, strideA, B,
+                                                        ldb, strideB, jpvt, strideP, rcond, rank,
+                                                        batch_count);
+}
+
+rocblas_status rocsolver_cgelsy_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_float_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideP,
+                                                const float rcond,
+                                                rocblas_int* rank,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsy_strided_batched_impl<rocblas_float_complex>(
+        handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, jpvt, strideP, rcond, rank,
+        batch_count);
+}
+
+rocblas_status rocsolver_zgelsy_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_double_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideP,
+                                                const double rcond,
+                                                rocblas_int* rank,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsy_strided_batched_impl<rocblas_double_complex>(
+        handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, jpvt, strideP, rcond, rank,
+        batch_count);
+}
+
+} // extern C
@@ -0,0 +1,128 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_larfb.hpp"
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+template <bool BATCHED, typename T>
+void rocsolver_gemqrt_getMemorySize(const rocblas_side side,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int k,
+                                    const rocblas_int nb,
+                                    const rocblas_int batch_count,
+                                    size_t* size_tmptr,
+                                    size_t* size_workArr)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || k == 0 || batch_count == 0)
+    {
+        *size_tmptr = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    // requirements for calling LARFB
+    // (the triangular factors are given, so LARFT is not needed)
+    rocsolver_larfb_getMemorySize<BATCHED, T>(side, m, n, min(nb, k), batch_count, size_tmptr,
+                                              size_workArr);
+}
+
+template <bool COMPLEX, typename T, typename U>
+rocblas_status rocsolver_gemqrt_argCheck(rocblas_handle handle,
+                                         const rocblas_side side,
+                                         const rocblas_operation trans,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int k,
+                                         const rocblas_int nb,
+                                         const rocblas_int ldv,
+                                         const rocblas_int ldt,
+                                         const rocblas_int ldc,
+                                         T V,
+                                         U F,
+                                         T C,
+                                         const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(side != rocblas_side_left && side != rocblas_side_right)
+        return rocblas_status_invalid_value;
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && trans == rocblas_operation_transpose)
+       || (!COMPLEX && trans == rocblas_operation_conjugate_transpose))
+        return rocblas_status_invalid_value;
+    bool left = (side == rocblas_side_left);
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || k < 0 || ldc < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(left && (k > m || ldv < m))
+        return rocblas_status_invalid_size;
+    if(!left && (k > n || ldv < n))
+        return rocblas_status_invalid_size;
+    if(nb < 1 || (k && nb > k) || ldt < nb)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !C) || (k && !F) || (left && m * k && !V) || (!left && n * k && !V))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gemqrt_template(rocblas_handle handle,
+                                         const rocblas_side side,
+                                         const rocblas_operation trans,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int k,
+                                         const rocblas_int nb,
+                                         U V,
+                                         const rocblas_int shiftV,
+                                         const rocblas_int ldv,
+                                         const rocblas_stride strideV,
+                                         T* F,
+                                         const rocblas_int ldf,
+                                         const rocblas_stride strideF,
+                                         U C,
+                                         const rocblas_int shiftC,
+                                         const rocblas_int ldc,
+                                         const rocblas_stride strideC,
+                                         const rocblas_int batch_count,
+                                         T* tmptr,
+                                         T** workArr)
+{
+    ROCSOLVER_ENTER("gemqrt", "side:", side, "trans:", trans, "m:", m, "n:", n, "k:", k, "nb:", nb,
+                    "shiftV:", shiftV, "ldv:", ldv, "ldt:", ldf, "shiftC:", shiftC, "ldc:", ldc,
+                    "bc:", batch_count);
+
+    // quick return
+    if(!n || !m || !k || !batch_count)
+        return rocblas_status_success;
+
+    // apply the block reflectors using the stored triangular factors
+    // (no Householder scalars nor extra workspace for LARFT are required)
+    return rocsolver_ormqr_unmqr_template<BATCHED, STRIDED, T>(
+        handle, side, trans, m, n, k, V, shiftV, ldv, strideV, (T*)nullptr, 0, C, shiftC, ldc,
+        strideC, batch_count, (T*)nullptr, (T*)nullptr, tmptr, (T*)nullptr, workArr, F, nb, ldf,
+        strideF);
+}
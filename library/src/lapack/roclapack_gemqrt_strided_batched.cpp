@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gemqrt.hpp"
+
+template <typename T, typename U, bool COMPLEX = is_complex<T>>
+rocblas_status rocsolver_gemqrt_strided_batched_impl(rocblas_handle handle,
+                                                     const rocblas_side side,
+                                                     const rocblas_operation trans,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     const rocblas_int k,
+                                                     const rocblas_int nb,
+                                                     U V,
+                                                     const rocblas_int ldv,
+                                                     const rocblas_stride strideV,
+                                                     T* F,
+                                                     const rocblas_int ldf,
+                                                     const rocblas_stride strideF,
+                                                     U C,
+                                                     const rocblas_int ldc,
+                                                     const rocblas_stride strideC,
+                                                     const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gemqrt_strided_batched", "--side", side, "--trans", trans, "-m", m, "-n",
+                        n, "-k", k, "--nb", nb, "--ldv", ldv, "--strideV", strideV, "--ldt", ldf,
+                        "--strideT", strideF, "--ldc", ldc, "--strideC", strideC, "--batch_count",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gemqrt_argCheck<COMPLEX>(handle, side, trans, m, n, k, nb, ldv,
+                                                           ldf, ldc, V, F, C, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftV = 0;
+    rocblas_int shiftC = 0;
+
+    // memory workspace sizes:
+    // size of temporary array for computations with
+    // triangular part of V
+    size_t size_tmptr;
+    // size of arrays of pointers (for batched cases)
+    size_t size_workArr;
+    rocsolver_gemqrt_getMemorySize<false, T>(side, m, n, k, nb, batch_count, &size_tmptr,
+                                             &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_tmptr, size_workArr);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *tmptr, *workArr;
+    rocblas_device_malloc mem(handle, size_tmptr, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    tmptr = mem[0];
+    workArr = mem[1];
+
+    // execution
+    return rocsolver_gemqrt_template<false, true, T>(handle, side, trans, m, n, k, nb, V, shiftV,
+                                                     ldv, strideV, F, ldf, strideF, C, shiftC, ldc,
+                                                     strideC, batch_count, (T*)tmptr, (T**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgemqrt_strided_batched(rocblas_handle handle,
+                                                 const rocblas_side side,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 const rocblas_int k,
+                                                 const rocblas_int nb,
+                                                 float* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 float* T,
+                                                 const rocblas_int ldt,
+                                                 const rocblas_stride strideT,
+                                                 float* C,
+                                                 const rocblas_int ldc,
+                                                 const rocblas_stride strideC,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gemqrt_strided_batched_impl<float>(handle, side, trans, m, n, k, nb, V, ldv,
+                                                        strideV, T, ldt, strideT, C, ldc, strideC,
+                                                        batch_count);
+}
+
+rocblas_status rocsolver_dgemqrt_strided_batched(rocblas_handle handle,
+                                                 const rocblas_side side,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 const rocblas_int k,
+                                                 const rocblas_int nb,
+                                                 double* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 double* T,
+                                                 const rocblas_int ldt,
+                                                 const rocblas_stride strideT,
+                                                 double* C,
+                                                 const rocblas_int ldc,
+                                                 const rocblas_stride strideC,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gemqrt_strided_batched_impl<double>(handle, side, trans, m, n, k, nb, V, ldv,
+                                                         strideV, T, ldt, strideT, C, ldc, strideC,
+                                                         batch_count);
+}
+
+rocblas_status rocsolver_cgemqrt_strided_batched(rocblas_handle handle,
+                                                 const rocblas_side side,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 const rocblas_int k,
+                                                 const rocblas_int nb,
+                                                 rocblas_float_complex* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 rocblas_float_complex* T,
+                                                 const rocblas_int ldt,
+                                                 const rocblas_stride strideT,
+                                                 rocblas_float_complex* C,
+                                                 const rocblas_int ldc,
+                                                 const rocblas_stride strideC,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gemqrt_strided_batched_impl<rocblas_float_complex>(
+        handle, side, trans, m, n, k, nb, V, ldv, strideV, T, ldt, strideT, C, ldc, strideC,
+        batch_count);
+}
+
+rocblas_status rocsolver_zgemqrt_strided_batched(rocblas_handle handle,
+                                                 const rocblas_side side,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 const rocblas_int k,
+                                                 const rocblas_int nb,
+                                                 rocblas_double_complex* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 rocblas_double_complex* T,
+                                                 const rocblas_int ldt,
+                                                 const rocblas_stride strideT,
+                                                 rocblas_double_complex* C,
+                                                 const rocblas_int ldc,
+                                                 const rocblas_stride strideC,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gemqrt_strided_batched_impl<rocblas_double_complex>(
+        handle, side, trans, m, n, k, nb, V, ldv, strideV, T, ldt, strideT, C, ldc, strideC,
+        batch_count);
+}
+
+} // extern C
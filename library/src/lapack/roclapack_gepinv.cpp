@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gepinv.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gepinv_impl(rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     U A,
+                                     const rocblas_int lda,
+                                     const S rtol,
+                                     U X,
+                                     const rocblas_int ldx,
+                                     rocblas_int* rank,
+                                     rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("gepinv", "-m", m, "-n", n, "--lda", lda, "--rtol", rtol, "--ldx", ldx);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gepinv_argCheck(handle, m, n, lda, rtol, ldx, A, X, rank, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftX = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideX = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of the workspace of gesvd
+    size_t size_work;
+    // size for the singular values and the right singular vectors
+    size_t size_S, size_E, size_V;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_gepinv_getMemorySize<false, T, S>(m, n, batch_count, &size_scalars, &size_work,
+                                                &size_S, &size_E, &size_V, &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_S,
+                                                      size_E, size_V, size_workArr);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work, *Sv, *E, *V, *workArr;
+    rocblas_device_malloc mem(handle, size_scalars, size_work, size_S, size_E, size_V,
+                              size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work = mem[1];
+    Sv = mem[2];
+    E = mem[3];
+    V = mem[4];
+    workArr = mem[5];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_gepinv_template<false, false, T>(handle, m, n, A, shiftA, lda, strideA, rtol,
+                                                      X, shiftX, ldx, strideX, rank, info,
+                                                      batch_count, (T*)scalars, work, (S*)Sv, (S*)E,
+                                                      (T*)V, (T**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgepinv(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 float* A,
+                                 const rocblas_int lda,
+                                 const float rtol,
+                                 float* X,
+                                 const rocblas_int ldx,
+                                 rocblas_int* rank,
+                                 rocblas_int* info)
+{
+    return rocsolver_gepinv_impl<float>(handle, m, n, A, lda, rtol, X, ldx, rank, info);
+}
+
+rocblas_status rocsolver_dgepinv(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 double* A,
+                                 const rocblas_int lda,
+                                 const double rtol,
+                                 double* X,
+                                 const rocblas_int ldx,
+                                 rocblas_int* rank,
+                                 rocblas_int* info)
+{
+    return rocsolver_gepinv_impl<double>(handle, m, n, A, lda, rtol, X, ldx, rank, info);
+}
+
+rocblas_status rocsolver_cgepinv(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 rocblas_float_complex* A,
+                                 const rocblas_int lda,
+                                 const float rtol,
+                                 rocblas_float_complex* X,
+                                 const rocblas_int ldx,
+                                 rocblas_int* rank,
+                                 rocblas_int* info)
+{
+    return rocsolver_gepinv_impl<rocblas_float_complex>(handle, m, n, A, lda, rtol, X, ldx, rank,
+                                                        info);
+}
+
+rocblas_status rocsolver_zgepinv(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 rocblas_double_complex* A,
+                                 const rocblas_int lda,
+                                 const double rtol,
+                                 rocblas_double_complex* X,
+                                 const rocblas_int ldx,
+                                 rocblas_int* rank,
+                                 rocblas_int* info)
+{
+    return rocsolver_gepinv_impl<rocblas_double_complex>(handle, m, n, A, lda, rtol, X, ldx, rank,
+                                                         info);
+}
+
+} // extern C
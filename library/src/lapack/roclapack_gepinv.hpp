@@ -0,0 +1,142 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gesvd_truncate.hpp"
+#include "rocsolver.h"
+
+/** Helper to calculate workspace sizes. GEPINV needs the same SVD as GESVD_TRUNCATE. **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gepinv_getMemorySize(const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    size_t* size_scalars,
+                                    size_t* size_work,
+                                    size_t* size_S,
+                                    size_t* size_E,
+                                    size_t* size_V,
+                                    size_t* size_workArr)
+{
+    rocsolver_gesvd_truncate_getMemorySize<BATCHED, T, S>(
+        m, n, batch_count, size_scalars, size_work, size_S, size_E, size_V, size_workArr);
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gepinv_argCheck(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int lda,
+                                         const S rtol,
+                                         const rocblas_int ldx,
+                                         T A,
+                                         T X,
+                                         rocblas_int* rank,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(rtol < 0)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || ldx < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || (m * n && !X) || (batch_count && !rank) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gepinv_template(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         U A,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         const S rtol,
+                                         U X,
+                                         const rocblas_int shiftX,
+                                         const rocblas_int ldx,
+                                         const rocblas_stride strideX,
+                                         rocblas_int* rank,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count,
+                                         T* scalars,
+                                         void* work,
+                                         S* Sv,
+                                         S* E,
+                                         T* V,
+                                         T** workArr)
+{
+    ROCSOLVER_ENTER("gepinv", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "rtol:", rtol,
+                    "shiftX:", shiftX, "ldx:", ldx, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return with rank = 0
+    if(m == 0 || n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, rank,
+                                batch_count, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    const rocblas_int mn = std::min(m, n);
+    const rocblas_stride strideS = mn;
+    const rocblas_int ldv = mn;
+    const rocblas_stride strideV = mn * n;
+
+    // compute the SVD; the first mn columns of A are overwritten with U
+    rocsolver_gesvd_template<BATCHED, STRIDED, T>(
+        handle, rocblas_svect_overwrite, rocblas_svect_singular, m, n, A, shiftA, lda, strideA, Sv,
+        strideS, (T*)nullptr, 1, 0, V, ldv, strideV, E, strideS, rocblas_inplace, info,
+        batch_count, scalars, work);
+
+    // V' <- inv(S) * V' (the negligible singular values are discarded)
+    rocblas_int blocksx = (mn - 1) / BS2 + 1;
+    rocblas_int blocksy = (n - 1) / BS2 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(gesvd_scale_kernel<true, T>, dim3(blocksx, blocksy, batch_count),
+                            dim3(BS2, BS2, 1), 0, stream, mn, n, Sv, strideS, V, ldv, strideV,
+                            rtol, rank);
+
+    // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    T one = 1;
+    T zero = 0;
+
+    // X = (inv(S) * V')' * U'
+    rocblasCall_gemm<BATCHED, STRIDED, T>(handle, rocblas_operation_conjugate_transpose,
+                                          rocblas_operation_conjugate_transpose, n, m, mn, &one, V,
+                                          0, ldv, strideV, A, shiftA, lda, strideA, &zero, X,
+                                          shiftX, ldx, strideX, batch_count, workArr);
+
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    return rocblas_status_success;
+}
@@ -0,0 +1,157 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_larfb.hpp"
+#include "auxiliary/rocauxiliary_larft.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqr2.hpp"
+#include "rocsolver.h"
+
+template <bool BATCHED, typename T>
+void rocsolver_geqrt_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nb,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms,
+                                   size_t* size_diag_tmptr,
+                                   size_t* size_workArr)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms = 0;
+        *size_diag_tmptr = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    size_t w1, w2, s1, s2, unused;
+    rocblas_int jb = min(nb, min(m, n));
+
+    // requirements for calling GEQR2 with sub blocks
+    rocsolver_geqr2_getMemorySize<BATCHED, T>(m, jb, batch_count, size_scalars, &w1,
+                                              size_Abyx_norms, &s1);
+
+    // requirements for calling LARFT
+    rocsolver_larft_getMemorySize<BATCHED, T>(m, jb, batch_count, &unused, &w2, size_workArr);
+
+    // requirements for calling LARFB
+    rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, n, jb, batch_count, &s2,
+                                              &unused);
+
+    *size_work_workArr = max(w1, w2);
+    *size_diag_tmptr = max(s1, s2);
+
+    // size of workArr is double to accomodate
+    // LARFB's TRMM calls in the batched case
+    if(BATCHED)
+        *size_workArr *= 2;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrt_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nb,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldt,
+                                        T A,
+                                        U ipiv,
+                                        U F,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(nb < 1 || (m * n && nb > min(m, n)) || ldt < nb)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || (m * n && !ipiv) || (m * n && !F))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_geqrt_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nb,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        T* ipiv,
+                                        const rocblas_stride strideP,
+                                        T* F,
+                                        const rocblas_int ldf,
+                                        const rocblas_stride strideF,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms,
+                                        T* diag_tmptr,
+                                        T** workArr)
+{
+    ROCSOLVER_ENTER("geqrt", "m:", m, "n:", n, "nb:", nb, "shiftA:", shiftA, "lda:", lda,
+                    "ldt:", ldf, "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int dim = min(m, n); // total number of pivots
+    rocblas_int jb;
+
+    // unlike GEQRF, the triangular factor of every block reflector (including the
+    // last one) is computed and kept in F, so that it can be re-used by GEMQRT
+    for(rocblas_int j = 0; j < dim; j += nb)
+    {
+        // Factor diagonal and subdiagonal blocks
+        jb = min(dim - j, nb); // number of columns in the block
+        rocsolver_geqr2_template<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                    (ipiv + j), strideP, batch_count, scalars, work_workArr,
+                                    Abyx_norms, diag_tmptr);
+
+        // compute and store block reflector
+        rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise, m - j,
+                                    jb, A, shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j),
+                                    strideP, F + idx2D(0, j, ldf), ldf, strideF, batch_count,
+                                    scalars, (T*)work_workArr, workArr);
+
+        // apply the block reflector to the rest of the matrix
+        if(j + jb < n)
+            rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                rocblas_forward_direction, rocblas_column_wise, m - j, n - j - jb, jb, A,
+                shiftA + idx2D(j, j, lda), lda, strideA, F, idx2D(0, j, ldf), ldf, strideF, A,
+                shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, diag_tmptr, workArr);
+    }
+
+    return rocblas_status_success;
+}
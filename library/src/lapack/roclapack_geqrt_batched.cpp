@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_geqrt.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrt_batched_impl(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int nb,
+                                            U A,
+                                            const rocblas_int lda,
+                                            T* ipiv,
+                                            const rocblas_stride stridep,
+                                            T* F,
+                                            const rocblas_int ldf,
+                                            const rocblas_stride stridef,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("geqrt_batched", "-m", m, "-n", n, "--nb", nb, "--lda", lda, "--strideP",
+                        stridep, "--ldt", ldf, "--strideT", stridef, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqrt_argCheck(handle, m, n, nb, lda, ldf, A, ipiv, F,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr, size_workArr;
+    // extra requirements for calling GEQR2
+    size_t size_Abyx_norms;
+    // extra requirements for calling GEQR2 and LARFB
+    size_t size_diag_tmptr;
+    rocsolver_geqrt_getMemorySize<true, T>(m, n, nb, batch_count, &size_scalars, &size_work_workArr,
+                                           &size_Abyx_norms, &size_diag_tmptr, &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+                                                      size_Abyx_norms, size_diag_tmptr,
+                                                      size_workArr);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms, *diag_tmptr, *workArr;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms,
+                              size_diag_tmptr, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms = mem[2];
+    diag_tmptr = mem[3];
+    workArr = mem[4];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_geqrt_template<true, false, T>(
+        handle, m, n, nb, A, shiftA, lda, strideA, ipiv, stridep, F, ldf, stridef, batch_count,
+        (T*)scalars, work_workArr, (T*)Abyx_norms, (T*)diag_tmptr, (T**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqrt_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nb,
+                                        float* const A[],
+                                        const rocblas_int lda,
+                                        float* ipiv,
+                                        const rocblas_stride strideP,
+                                        float* T,
+                                        const rocblas_int ldt,
+                                        const rocblas_stride strideT,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_geqrt_batched_impl<float>(handle, m, n, nb, A, lda, ipiv, strideP, T, ldt,
+                                               strideT, batch_count);
+}
+
+rocblas_status rocsolver_dgeqrt_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nb,
+                                        double* const A[],
+                                        const rocblas_int lda,
+                                        double* ipiv,
+                                        const rocblas_stride strideP,
+                                        double* T,
+                                        const rocblas_int ldt,
+                                        const rocblas_stride strideT,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_geqrt_batched_impl<double>(handle, m, n, nb, A, lda, ipiv, strideP, T, ldt,
+                                                strideT, batch_count);
+}
+
+rocblas_status rocsolver_cgeqrt_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nb,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_float_complex* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocblas_float_complex* T,
+                                        const rocblas_int ldt,
+                                        const rocblas_stride strideT,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_geqrt_batched_impl<rocblas_float_complex>(
+        handle, m, n, nb, A, lda, ipiv, strideP, T, ldt, strideT, batch_count);
+}
+
+rocblas_status rocsolver_zgeqrt_batched(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nb,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_double_complex* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocblas_double_complex* T,
+                                        const rocblas_int ldt,
+                                        const rocblas_stride strideT,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_geqrt_batched_impl<rocblas_double_complex>(
+        handle, m, n, nb, A, lda, ipiv, strideP, T, ldt, strideT, batch_count);
+}
+
+} // extern C
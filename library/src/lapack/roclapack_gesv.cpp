@@ -27,6 +27,8 @@ rocblas_status rocsolver_gesv_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftB = 0;
@@ -54,6 +56,8 @@ rocblas_status rocsolver_gesv_impl(rocblas_handle handle,
             handle, size_scalars, size_work, size_work1, size_work2, size_work3, size_work4,
             size_pivotval, size_pivotidx, size_iipiv, size_iinfo);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv;
     rocblas_device_malloc mem(handle, size_scalars, size_work, size_work1, size_work2, size_work3,
@@ -62,6 +66,8 @@ rocblas_status rocsolver_gesv_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work = mem[1];
     work1 = mem[2];
@@ -75,6 +81,8 @@ rocblas_status rocsolver_gesv_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_gesv_template<false, false, T>(
         handle, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, info,
@@ -131,43 +131,78 @@ rocblas_status rocsolver_gesvd_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-/** Helper to calculate workspace sizes **/
+/** Returns true if, in the normal SVD case, the lead-dimension singular vectors should be
+    obtained by back-transforming the k-by-k singular vectors of the bidiagonal form with
+    ORMBR/UNMBR, instead of generating them explicitly with ORGBR/UNGBR before BDSQR **/
+inline bool gesvd_use_backtransform(const rocblas_svect left_svect,
+                                    const rocblas_svect right_svect,
+                                    const rocblas_int m,
+                                    const rocblas_int n)
+{
+    const bool row = (m >= n);
+    const bool thinSVD = (m >= THIN_SVD_SWITCH * n || n >= THIN_SVD_SWITCH * m);
+    const rocblas_svect leadv = row ? left_svect : right_svect;
+    const rocblas_svect otherv = row ? right_svect : left_svect;
+
+    // the Householder vectors in A are needed after BDSQR, so the other-dimension
+    // vectors cannot overwrite A
+    return !thinSVD && m != n && max(m, n) >= GESVD_BACKTRANSFORM_SWITCHSIZE
+        && (leadv == rocblas_svect_singular || leadv == rocblas_svect_all)
+        && otherv != rocblas_svect_overwrite;
+}
+
+/** The workspace of GESVD is organized in the stages of the algorithm: the row (or
+    column) compression, the generation of the orthonormal/unitary matrix from the
+    compression, the bidiagonalization, the generation of the orthonormal/unitary matrices
+    from the bidiagonalization, the SVD of the bidiagonal form, and the update of the
+    singular vectors. The reusable buffers of each stage are not live during the others,
+    so they can share memory. **/
+struct rocsolver_gesvd_workspace
+{
+    enum
+    {
+        compress,
+        genQ,
+        bidiag,
+        genUV,
+        bdsqr,
+        update,
+        phases
+    };
+
+    workspace_planner plan;
+    int work_workArr[phases];
+    int Abyx_norms_tmptr[phases];
+    int Abyx_norms_trfact_X[phases];
+    int diag_tmptr_Y[phases];
+    int tau;
+    int tempArrayT;
+    int tempArrayC;
+    int workArr;
+};
+
+/** Helper to compute the layout of the workspace of GESVD **/
 template <bool BATCHED, typename T, typename S>
-void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
+void rocsolver_gesvd_planWorkspace(const rocblas_svect left_svect,
                                    const rocblas_svect right_svect,
                                    const rocblas_int m,
                                    const rocblas_int n,
                                    const rocblas_int batch_count,
                                    const rocblas_workmode fast_alg,
                                    size_t* size_scalars,
-                                   size_t* size_work_workArr,
-                                   size_t* size_Abyx_norms_tmptr,
-                                   size_t* size_Abyx_norms_trfact_X,
-                                   size_t* size_diag_tmptr_Y,
-                                   size_t* size_tau,
-                                   size_t* size_tempArrayT,
-                                   size_t* size_tempArrayC,
-                                   size_t* size_workArr)
+                                   rocsolver_gesvd_workspace* ws)
 {
     // if quick return, set workspace to zero
     if(n == 0 || m == 0 || batch_count == 0)
     {
         *size_scalars = 0;
-        *size_work_workArr = 0;
-        *size_Abyx_norms_tmptr = 0;
-        *size_Abyx_norms_trfact_X = 0;
-        *size_diag_tmptr_Y = 0;
-        *size_tau = 0;
-        *size_tempArrayT = 0;
-        *size_tempArrayC = 0;
-        *size_workArr = 0;
         return;
     }
 
     size_t w[6] = {};
-    size_t a[5] = {};
-    size_t x[6] = {};
-    size_t y[3] = {};
+    size_t a[6] = {};
+    size_t x[7] = {};
+    size_t y[4] = {};
     size_t unused;
 
     // booleans used to determine the path that the execution will follow:
@@ -190,6 +225,7 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
     const bool othervN = !row ? leftvN : rightvN;
     const bool thinSVD = (m >= THIN_SVD_SWITCH * n || n >= THIN_SVD_SWITCH * m);
     const bool fast_thinSVD = (thinSVD && fast_alg == rocblas_outofplace);
+    const bool backtransform = gesvd_use_backtransform(left_svect, right_svect, m, n);
 
     // auxiliary sizes and variables
     const rocblas_int k = min(m, n);
@@ -202,19 +238,16 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
     rocblas_int mn;
 
     // size of array of pointers to workspace
-    if(BATCHED)
-        *size_workArr = 2 * sizeof(T*) * batch_count;
-    else
-        *size_workArr = 0;
+    size_t size_workArr = BATCHED ? 2 * sizeof(T*) * batch_count : 0;
 
     // size of array tau to store householder scalars on intermediate
     // orthonormal/unitary matrices
-    *size_tau = 2 * sizeof(T) * min(m, n) * batch_count;
+    size_t size_tau = 2 * sizeof(T) * min(m, n) * batch_count;
 
     // size of arrays to store temporary copies
-    *size_tempArrayT
+    size_t size_tempArrayT
         = (fast_thinSVD || (thinSVD && leadvO && othervN)) ? sizeof(T) * k * k * batch_count : 0;
-    *size_tempArrayC
+    size_t size_tempArrayC
         = (fast_thinSVD && (othervN || othervO || leadvO)) ? sizeof(T) * m * n * batch_count : 0;
 
     // workspace required for the bidiagonalization
@@ -258,7 +291,11 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
     else
     {
         mn = (row && leftvS) ? n : m;
-        if(leftvS || leftvA)
+        if(backtransform && row)
+            rocsolver_ormbr_unmbr_getMemorySize<BATCHED, T>(rocblas_column_wise, rocblas_side_left,
+                                                            m, mn, n, batch_count, &unused, &a[5],
+                                                            &y[3], &x[6], &unused);
+        else if(leftvS || leftvA)
             rocsolver_orgbr_ungbr_getMemorySize<BATCHED, T>(
                 rocblas_column_wise, m, mn, n, batch_count, &unused, &w[3], &a[2], &x[3], &unused);
         else if(leftvO)
@@ -266,7 +303,11 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
                 rocblas_column_wise, m, k, n, batch_count, &unused, &w[3], &a[2], &x[3], &unused);
 
         mn = (!row && rightvS) ? m : n;
-        if(rightvS || rightvA)
+        if(backtransform && !row)
+            rocsolver_ormbr_unmbr_getMemorySize<BATCHED, T>(rocblas_row_wise, rocblas_side_right,
+                                                            mn, n, m, batch_count, &unused, &a[5],
+                                                            &y[3], &x[6], &unused);
+        else if(rightvS || rightvA)
             rocsolver_orgbr_ungbr_getMemorySize<BATCHED, T>(rocblas_row_wise, mn, n, m, batch_count,
                                                             &unused, &w[4], &a[3], &x[4], &unused);
         else if(rightvO)
@@ -296,11 +337,46 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
         }
     }
 
-    // get max sizes
-    *size_work_workArr = *std::max_element(std::begin(w), std::end(w));
-    *size_Abyx_norms_tmptr = *std::max_element(std::begin(a), std::end(a));
-    *size_Abyx_norms_trfact_X = *std::max_element(std::begin(x), std::end(x));
-    *size_diag_tmptr_Y = *std::max_element(std::begin(y), std::end(y));
+    // reusable buffers of every stage
+    constexpr int phases = rocsolver_gesvd_workspace::phases;
+    const size_t stage_w[phases] = {w[2], w[5], w[0], std::max(w[3], w[4]), w[1], 0};
+    const size_t stage_a[phases] = {0, a[4], a[0], std::max({a[1], a[2], a[3]}), 0, a[5]};
+    const size_t stage_x[phases] = {x[1], x[5], x[0], std::max({x[2], x[3], x[4]}), 0, x[6]};
+    const size_t stage_y[phases] = {y[1], 0, y[0], y[2], 0, y[3]};
+    for(int p = 0; p < phases; p++)
+    {
+        ws->work_workArr[p] = ws->plan.add(stage_w[p], p);
+        ws->Abyx_norms_tmptr[p] = ws->plan.add(stage_a[p], p);
+        ws->Abyx_norms_trfact_X[p] = ws->plan.add(stage_x[p], p);
+        ws->diag_tmptr_Y[p] = ws->plan.add(stage_y[p], p);
+    }
+
+    // buffers that persist across stages
+    ws->tau = ws->plan.add(size_tau, rocsolver_gesvd_workspace::compress,
+                           backtransform ? rocsolver_gesvd_workspace::update
+                                         : rocsolver_gesvd_workspace::genUV);
+    ws->tempArrayT = ws->plan.add(size_tempArrayT, rocsolver_gesvd_workspace::compress,
+                                  rocsolver_gesvd_workspace::update);
+    ws->tempArrayC = ws->plan.add(size_tempArrayC, rocsolver_gesvd_workspace::bidiag,
+                                  rocsolver_gesvd_workspace::update);
+    ws->workArr = ws->plan.add(size_workArr, 0, phases - 1);
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
+                                   const rocblas_svect right_svect,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   const rocblas_workmode fast_alg,
+                                   size_t* size_scalars,
+                                   size_t* size_work)
+{
+    rocsolver_gesvd_workspace ws;
+    rocsolver_gesvd_planWorkspace<BATCHED, T, S>(left_svect, right_svect, m, n, batch_count,
+                                                 fast_alg, size_scalars, &ws);
+    *size_work = ws.plan.size();
 }
 
 template <bool BATCHED, bool STRIDED, typename T, typename TT, typename W>
@@ -327,14 +403,7 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
                                         rocblas_int* info,
                                         const rocblas_int batch_count,
                                         T* scalars,
-                                        void* work_workArr,
-                                        T* Abyx_norms_tmptr,
-                                        T* Abyx_norms_trfact_X,
-                                        T* diag_tmptr_Y,
-                                        T* tau,
-                                        T* tempArrayT,
-                                        T* tempArrayC,
-                                        T** workArr)
+                                        void* work)
 {
     ROCSOLVER_ENTER("gesvd", "leftsv:", left_svect, "rightsv:", right_svect, "m:", m, "n:", n,
                     "shiftA:", shiftA, "lda:", lda, "ldu:", ldu, "ldv:", ldv, "mode:", fast_alg,
@@ -350,14 +419,44 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // constants to use when calling rocablas functions
     T one = 1;
     T zero = 0;
 
+    // get the layout of the workspace
+    size_t size_scalars;
+    rocsolver_gesvd_workspace ws;
+    rocsolver_gesvd_planWorkspace<BATCHED, T, TT>(left_svect, right_svect, m, n, batch_count,
+                                                  fast_alg, &size_scalars, &ws);
+
+    constexpr int compress = rocsolver_gesvd_workspace::compress;
+    constexpr int genQ = rocsolver_gesvd_workspace::genQ;
+    constexpr int bidiag = rocsolver_gesvd_workspace::bidiag;
+    constexpr int genUV = rocsolver_gesvd_workspace::genUV;
+    constexpr int bdsqr = rocsolver_gesvd_workspace::bdsqr;
+    constexpr int update = rocsolver_gesvd_workspace::update;
+    constexpr int phases = rocsolver_gesvd_workspace::phases;
+
+    void* work_workArr[phases];
+    T *Abyx_norms_tmptr[phases], *Abyx_norms_trfact_X[phases], *diag_tmptr_Y[phases];
+    for(int p = 0; p < phases; p++)
+    {
+        work_workArr[p] = ws.plan.pointer<void*>(work, ws.work_workArr[p]);
+        Abyx_norms_tmptr[p] = ws.plan.pointer<T*>(work, ws.Abyx_norms_tmptr[p]);
+        Abyx_norms_trfact_X[p] = ws.plan.pointer<T*>(work, ws.Abyx_norms_trfact_X[p]);
+        diag_tmptr_Y[p] = ws.plan.pointer<T*>(work, ws.diag_tmptr_Y[p]);
+    }
+    T* tau = ws.plan.pointer<T*>(work, ws.tau);
+    T* tempArrayT = ws.plan.pointer<T*>(work, ws.tempArrayT);
+    T* tempArrayC = ws.plan.pointer<T*>(work, ws.tempArrayC);
+    T** workArr = ws.plan.pointer<T**>(work, ws.workArr);
+
     // booleans used to determine the path that the execution will follow:
     const bool row = (m >= n);
     const bool leftvS = (left_svect == rocblas_svect_singular);
@@ -488,8 +587,9 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             //*** STAGE 1: Row (or column) compression ***//
             local_geqrlq_template<BATCHED, STRIDED>(handle, m, n, A, shiftA, lda, strideA, tau, k,
-                                                    batch_count, scalars, work_workArr,
-                                                    Abyx_norms_trfact_X, diag_tmptr_Y, workArr, row);
+                                                    batch_count, scalars, work_workArr[compress],
+                                                    Abyx_norms_trfact_X[compress],
+                                                    diag_tmptr_Y[compress], workArr, row);
 
             //*** STAGE 2: generate orthonormal/unitary matrix from row/column compression ***//
             // N/A
@@ -502,27 +602,28 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             rocsolver_gebrd_template<BATCHED, STRIDED>(
                 handle, k, k, A, shiftA, lda, strideA, S, strideS, E, strideE, tau, k,
-                (tau + k * batch_count), k, Abyx_norms_trfact_X, shiftX, ldx, strideX, diag_tmptr_Y,
-                shiftY, ldy, strideY, batch_count, scalars, work_workArr, Abyx_norms_tmptr);
+                (tau + k * batch_count), k, Abyx_norms_trfact_X[bidiag], shiftX, ldx, strideX,
+                diag_tmptr_Y[bidiag], shiftY, ldy, strideY, batch_count, scalars,
+                work_workArr[bidiag], Abyx_norms_tmptr[bidiag]);
 
             //*** STAGE 4: generate orthonormal/unitary matrices from bidiagonalization ***//
             if(!othervN)
                 rocsolver_orgbr_ungbr_template<BATCHED, STRIDED>(
                     handle, storev_other, k, k, k, A, shiftA, lda, strideA, (tau + offset_other), k,
-                    batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X,
-                    workArr);
+                    batch_count, scalars, (T*)work_workArr[genUV], Abyx_norms_tmptr[genUV],
+                    Abyx_norms_trfact_X[genUV], workArr);
 
             //*** STAGE 5: Compute singular values and vectors from the bidiagonal form ***//
             if(row)
                 rocsolver_bdsqr_template<T>(handle, rocblas_fill_upper, k, nv, nu, 0, S, strideS, E,
                                             strideE, A, shiftA, lda, strideA, U, shiftU, ldu,
                                             strideU, (W) nullptr, 0, 1, 1, info, batch_count,
-                                            (TT*)work_workArr, workArr);
+                                            (TT*)work_workArr[bdsqr], workArr);
             else
                 rocsolver_bdsqr_template<T>(handle, rocblas_fill_upper, k, nv, nu, 0, S, strideS, E,
                                             strideE, V, shiftV, ldv, strideV, A, shiftA, lda,
                                             strideA, (W) nullptr, 0, 1, 1, info, batch_count,
-                                            (TT*)work_workArr, workArr);
+                                            (TT*)work_workArr[bdsqr], workArr);
 
             //*** STAGE 6: update vectors with orthonormal/unitary matrices ***//
             if(othervS || othervA)
@@ -543,8 +644,9 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             //*** STAGE 1: Row (or column) compression ***//
             local_geqrlq_template<BATCHED, STRIDED>(handle, m, n, A, shiftA, lda, strideA, tau, k,
-                                                    batch_count, scalars, work_workArr,
-                                                    Abyx_norms_trfact_X, diag_tmptr_Y, workArr, row);
+                                                    batch_count, scalars, work_workArr[compress],
+                                                    Abyx_norms_trfact_X[compress],
+                                                    diag_tmptr_Y[compress], workArr, row);
 
             if(leadvA)
                 // copy factorization to U or V when needed
@@ -561,11 +663,13 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
             if(leadvA)
                 local_orgqrlq_ungqrlq_template<false, STRIDED>(
                     handle, kk, kk, k, UV, shiftUV, lduv, strideUV, tau, k, batch_count, scalars,
-                    (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr, row);
+                    (T*)work_workArr[genQ], Abyx_norms_tmptr[genQ], Abyx_norms_trfact_X[genQ],
+                    workArr, row);
             else
                 local_orgqrlq_ungqrlq_template<BATCHED, STRIDED>(
                     handle, m, n, k, A, shiftA, lda, strideA, tau, k, batch_count, scalars,
-                    (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr, row);
+                    (T*)work_workArr[genQ], Abyx_norms_tmptr[genQ], Abyx_norms_trfact_X[genQ],
+                    workArr, row);
 
             //*** STAGE 3: Bidiagonalization ***//
             // clean triangular factor
@@ -575,8 +679,9 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             rocsolver_gebrd_template<false, STRIDED>(
                 handle, k, k, bufferT, shiftT, ldt, strideT, S, strideS, E, strideE, tau, k,
-                (tau + k * batch_count), k, Abyx_norms_trfact_X, shiftX, ldx, strideX, diag_tmptr_Y,
-                shiftY, ldy, strideY, batch_count, scalars, work_workArr, Abyx_norms_tmptr);
+                (tau + k * batch_count), k, Abyx_norms_trfact_X[bidiag], shiftX, ldx, strideX,
+                diag_tmptr_Y[bidiag], shiftY, ldy, strideY, batch_count, scalars,
+                work_workArr[bidiag], Abyx_norms_tmptr[bidiag]);
 
             if(!othervN)
                 // copy results to generate non-lead vectors if required
@@ -588,27 +693,27 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
             // for lead-dimension vectors
             rocsolver_orgbr_ungbr_template<false, STRIDED>(
                 handle, storev_lead, k, k, k, bufferT, shiftT, ldt, strideT, (tau + offset_lead), k,
-                batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X,
-                workArr);
+                batch_count, scalars, (T*)work_workArr[genUV], Abyx_norms_tmptr[genUV],
+                Abyx_norms_trfact_X[genUV], workArr);
 
             // for the other-side vectors
             if(!othervN)
                 rocsolver_orgbr_ungbr_template<false, STRIDED>(
                     handle, storev_other, k, k, k, bufferC, shiftC, ldc, strideC,
-                    (tau + offset_other), k, batch_count, scalars, (T*)work_workArr,
-                    Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr);
+                    (tau + offset_other), k, batch_count, scalars, (T*)work_workArr[genUV],
+                    Abyx_norms_tmptr[genUV], Abyx_norms_trfact_X[genUV], workArr);
 
             //*** STAGE 5: Compute singular values and vectors from the bidiagonal form ***//
             if(row)
                 rocsolver_bdsqr_template<T>(handle, rocblas_fill_upper, k, nv, nu, 0, S, strideS, E,
                                             strideE, bufferC, shiftC, ldc, strideC, bufferT, shiftT,
                                             ldt, strideT, (T*)nullptr, 0, 1, 1, info, batch_count,
-                                            (TT*)work_workArr, workArr);
+                                            (TT*)work_workArr[bdsqr], workArr);
             else
                 rocsolver_bdsqr_template<T>(handle, rocblas_fill_upper, k, nv, nu, 0, S, strideS, E,
                                             strideE, bufferT, shiftT, ldt, strideT, bufferC, shiftC,
                                             ldc, strideC, (T*)nullptr, 0, 1, 1, info, batch_count,
-                                            (TT*)work_workArr, workArr);
+                                            (TT*)work_workArr[bdsqr], workArr);
 
             //*** STAGE 6: update vectors with orthonormal/unitary matrices ***//
             if(leadvO)
@@ -691,8 +796,9 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             //*** STAGE 1: Row (or column) compression ***//
             local_geqrlq_template<BATCHED, STRIDED>(handle, m, n, A, shiftA, lda, strideA, tau, k,
-                                                    batch_count, scalars, work_workArr,
-                                                    Abyx_norms_trfact_X, diag_tmptr_Y, workArr, row);
+                                                    batch_count, scalars, work_workArr[compress],
+                                                    Abyx_norms_trfact_X[compress],
+                                                    diag_tmptr_Y[compress], workArr, row);
 
             if(!leadvO)
                 // copy factorization to U or V when needed
@@ -711,15 +817,18 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
             if(leadvO)
                 local_orgqrlq_ungqrlq_template<BATCHED, STRIDED>(
                     handle, m, n, k, A, shiftA, lda, strideA, tau, k, batch_count, scalars,
-                    (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr, row);
+                    (T*)work_workArr[genQ], Abyx_norms_tmptr[genQ], Abyx_norms_trfact_X[genQ],
+                    workArr, row);
             else if(leadvA)
                 local_orgqrlq_ungqrlq_template<false, STRIDED>(
                     handle, kk, kk, k, UV, shiftUV, lduv, strideUV, tau, k, batch_count, scalars,
-                    (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr, row);
+                    (T*)work_workArr[genQ], Abyx_norms_tmptr[genQ], Abyx_norms_trfact_X[genQ],
+                    workArr, row);
             else
                 local_orgqrlq_ungqrlq_template<false, STRIDED>(
                     handle, m, n, k, UV, shiftUV, lduv, strideUV, tau, k, batch_count, scalars,
-                    (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr, row);
+                    (T*)work_workArr[genQ], Abyx_norms_tmptr[genQ], Abyx_norms_trfact_X[genQ],
+                    workArr, row);
 
             //*** STAGE 3: Bidiagonalization ***//
             if(othervS || othervA || (leadvO && othervN))
@@ -731,9 +840,9 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
                 rocsolver_gebrd_template<false, STRIDED>(
                     handle, k, k, bufferT, shiftT, ldt, strideT, S, strideS, E, strideE, tau, k,
-                    (tau + k * batch_count), k, Abyx_norms_trfact_X, shiftX, ldx, strideX,
-                    diag_tmptr_Y, shiftY, ldy, strideY, batch_count, scalars, work_workArr,
-                    Abyx_norms_tmptr);
+                    (tau + k * batch_count), k, Abyx_norms_trfact_X[bidiag], shiftX, ldx, strideX,
+                    diag_tmptr_Y[bidiag], shiftY, ldy, strideY, batch_count, scalars,
+                    work_workArr[bidiag], Abyx_norms_tmptr[bidiag]);
 
                 uplo = rocblas_fill_upper;
             }
@@ -746,9 +855,9 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
                 rocsolver_gebrd_template<BATCHED, STRIDED>(
                     handle, k, k, A, shiftA, lda, strideA, S, strideS, E, strideE, tau, k,
-                    (tau + k * batch_count), k, Abyx_norms_trfact_X, shiftX, ldx, strideX,
-                    diag_tmptr_Y, shiftY, ldy, strideY, batch_count, scalars, work_workArr,
-                    Abyx_norms_tmptr);
+                    (tau + k * batch_count), k, Abyx_norms_trfact_X[bidiag], shiftX, ldx, strideX,
+                    diag_tmptr_Y[bidiag], shiftY, ldy, strideY, batch_count, scalars,
+                    work_workArr[bidiag], Abyx_norms_tmptr[bidiag]);
 
                 uplo = rocblas_fill_upper;
             }
@@ -761,30 +870,33 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
                     rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
                         handle, storev_lead, side, trans, m, n, k, bufferT, shiftT, ldt, strideT,
                         (tau + offset_lead), k, A, shiftA, lda, strideA, batch_count, scalars,
-                        Abyx_norms_tmptr, diag_tmptr_Y, Abyx_norms_trfact_X, workArr);
+                        Abyx_norms_tmptr[genUV], diag_tmptr_Y[genUV], Abyx_norms_trfact_X[genUV],
+                        workArr);
                 else
                     rocsolver_ormbr_unmbr_template<false, STRIDED>(
                         handle, storev_lead, side, trans, m, n, k, bufferT, shiftT, ldt, strideT,
                         (tau + offset_lead), k, UV, shiftUV, lduv, strideUV, batch_count, scalars,
-                        Abyx_norms_tmptr, diag_tmptr_Y, Abyx_norms_trfact_X, workArr);
+                        Abyx_norms_tmptr[genUV], diag_tmptr_Y[genUV], Abyx_norms_trfact_X[genUV],
+                        workArr);
             }
             else
                 rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
                     handle, storev_lead, side, trans, m, n, k, A, shiftA, lda, strideA,
                     (tau + offset_lead), k, UV, shiftUV, lduv, strideUV, batch_count, scalars,
-                    Abyx_norms_tmptr, diag_tmptr_Y, Abyx_norms_trfact_X, workArr);
+                    Abyx_norms_tmptr[genUV], diag_tmptr_Y[genUV], Abyx_norms_trfact_X[genUV],
+                    workArr);
 
             // for the other-side vectors
             if(othervS || othervA)
                 rocsolver_orgbr_ungbr_template<false, STRIDED>(
                     handle, storev_other, k, k, k, bufferT, shiftT, ldt, strideT,
-                    (tau + offset_other), k, batch_count, scalars, (T*)work_workArr,
-                    Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr);
+                    (tau + offset_other), k, batch_count, scalars, (T*)work_workArr[genUV],
+                    Abyx_norms_tmptr[genUV], Abyx_norms_trfact_X[genUV], workArr);
             else if(othervO)
                 rocsolver_orgbr_ungbr_template<BATCHED, STRIDED>(
                     handle, storev_other, k, k, k, A, shiftA, lda, strideA, (tau + offset_other), k,
-                    batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X,
-                    workArr);
+                    batch_count, scalars, (T*)work_workArr[genUV], Abyx_norms_tmptr[genUV],
+                    Abyx_norms_trfact_X[genUV], workArr);
 
             //*** STAGE 5: Compute singular values and vectors from the bidiagonal form ***//
             uplo = rocblas_fill_upper;
@@ -793,21 +905,21 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
                 rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V,
                                             shiftV, ldv, strideV, U, shiftU, ldu, strideU,
                                             (T*)nullptr, 0, 1, 1, info, batch_count,
-                                            (TT*)work_workArr, workArr);
+                                            (TT*)work_workArr[bdsqr], workArr);
             }
             else if(leftvO && !rightvO)
             {
                 rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V,
                                             shiftV, ldv, strideV, A, shiftA, lda, strideA,
                                             (W) nullptr, 0, 1, 1, info, batch_count,
-                                            (TT*)work_workArr, workArr);
+                                            (TT*)work_workArr[bdsqr], workArr);
             }
             else
             {
                 rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, A,
                                             shiftA, lda, strideA, U, shiftU, ldu, strideU,
                                             (W) nullptr, 0, 1, 1, info, batch_count,
-                                            (TT*)work_workArr, workArr);
+                                            (TT*)work_workArr[bdsqr], workArr);
             }
 
             //*** STAGE 6: update vectors with orthonormal/unitary matrices ***//
@@ -829,11 +941,26 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
         //*** STAGE 3: Bidiagonalization ***//
         rocsolver_gebrd_template<BATCHED, STRIDED>(
             handle, m, n, A, shiftA, lda, strideA, S, strideS, E, strideE, tau, k,
-            (tau + k * batch_count), k, Abyx_norms_trfact_X, shiftX, ldx, strideX, diag_tmptr_Y,
-            shiftY, ldy, strideY, batch_count, scalars, work_workArr, Abyx_norms_tmptr);
+            (tau + k * batch_count), k, Abyx_norms_trfact_X[bidiag], shiftX, ldx, strideX,
+            diag_tmptr_Y[bidiag], shiftY, ldy, strideY, batch_count, scalars, work_workArr[bidiag],
+            Abyx_norms_tmptr[bidiag]);
+
+        /** When back-transforming, the lead-dimension vectors are initialized to the identity so
+            that BDSQR only rotates their leading k-by-k block; the orthonormal/unitary matrix
+            of the bidiagonalization is applied to them at the end. **/
+        const bool backtransform = gesvd_use_backtransform(left_svect, right_svect, m, n);
 
         //*** STAGE 4: generate orthonormal/unitary matrices from bidiagonalization ***//
-        if(leftvS || leftvA)
+        if(backtransform && row)
+        {
+            mn = leftvS ? n : m;
+            ROCSOLVER_LAUNCH_KERNEL(init_ident<T>,
+                                    dim3(blocks_m, (mn - 1) / thread_count + 1, batch_count),
+                                    dim3(thread_count, thread_count, 1), 0, stream, m, mn, U,
+                                    shiftU, ldu, strideU);
+            nu = k;
+        }
+        else if(leftvS || leftvA)
         {
             // copy data to matrix U where orthogonal matrix will be generated
             mn = (row && leftvS) ? n : m;
@@ -843,10 +970,20 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             rocsolver_orgbr_ungbr_template<false, STRIDED>(
                 handle, rocblas_column_wise, m, mn, n, U, shiftU, ldu, strideU, tau, k, batch_count,
-                scalars, (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr);
+                scalars, (T*)work_workArr[genUV], Abyx_norms_tmptr[genUV],
+                Abyx_norms_trfact_X[genUV], workArr);
         }
 
-        if(rightvS || rightvA)
+        if(backtransform && !row)
+        {
+            mn = rightvS ? m : n;
+            ROCSOLVER_LAUNCH_KERNEL(init_ident<T>,
+                                    dim3((mn - 1) / thread_count + 1, blocks_n, batch_count),
+                                    dim3(thread_count, thread_count, 1), 0, stream, mn, n, V,
+                                    shiftV, ldv, strideV);
+            nv = k;
+        }
+        else if(rightvS || rightvA)
         {
             // copy data to matrix V where othogonal matrix will be generated
             mn = (!row && rightvS) ? m : n;
@@ -856,23 +993,24 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             rocsolver_orgbr_ungbr_template<false, STRIDED>(
                 handle, rocblas_row_wise, mn, n, m, V, shiftV, ldv, strideV,
-                (tau + k * batch_count), k, batch_count, scalars, (T*)work_workArr,
-                Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr);
+                (tau + k * batch_count), k, batch_count, scalars, (T*)work_workArr[genUV],
+                Abyx_norms_tmptr[genUV], Abyx_norms_trfact_X[genUV], workArr);
         }
 
         if(leftvO)
         {
             rocsolver_orgbr_ungbr_template<BATCHED, STRIDED>(
                 handle, rocblas_column_wise, m, k, n, A, shiftA, lda, strideA, tau, k, batch_count,
-                scalars, (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, workArr);
+                scalars, (T*)work_workArr[genUV], Abyx_norms_tmptr[genUV],
+                Abyx_norms_trfact_X[genUV], workArr);
         }
 
         if(rightvO)
         {
             rocsolver_orgbr_ungbr_template<BATCHED, STRIDED>(
                 handle, rocblas_row_wise, k, n, m, A, shiftA, lda, strideA, (tau + k * batch_count),
-                k, batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X,
-                workArr);
+                k, batch_count, scalars, (T*)work_workArr[genUV], Abyx_norms_tmptr[genUV],
+                Abyx_norms_trfact_X[genUV], workArr);
         }
 
         //*** STAGE 5: Compute singular values and vectors from the bidiagonal form ***//
@@ -880,27 +1018,50 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
         {
             rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V,
                                         shiftV, ldv, strideV, U, shiftU, ldu, strideU, (T*)nullptr,
-                                        0, 1, 1, info, batch_count, (TT*)work_workArr, workArr);
+                                        0, 1, 1, info, batch_count, (TT*)work_workArr[bdsqr],
+                                        workArr);
         }
 
         else if(leftvO && !rightvO)
         {
             rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V,
                                         shiftV, ldv, strideV, A, shiftA, lda, strideA, (W) nullptr,
-                                        0, 1, 1, info, batch_count, (TT*)work_workArr, workArr);
+                                        0, 1, 1, info, batch_count, (TT*)work_workArr[bdsqr],
+                                        workArr);
         }
 
         else
         {
             rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, A,
                                         shiftA, lda, strideA, U, shiftU, ldu, strideU, (W) nullptr,
-                                        0, 1, 1, info, batch_count, (TT*)work_workArr, workArr);
+                                        0, 1, 1, info, batch_count, (TT*)work_workArr[bdsqr],
+                                        workArr);
         }
 
         //*** STAGE 6: update vectors with orthonormal/unitary matrices ***//
-        // N/A
+        if(backtransform && row)
+        {
+            mn = leftvS ? n : m;
+            rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
+                handle, rocblas_column_wise, rocblas_side_left, rocblas_operation_none, m, mn, n, A,
+                shiftA, lda, strideA, tau, k, U, shiftU, ldu, strideU, batch_count, scalars,
+                Abyx_norms_tmptr[update], diag_tmptr_Y[update], Abyx_norms_trfact_X[update],
+                workArr);
+        }
+        else if(backtransform && !row)
+        {
+            mn = rightvS ? m : n;
+            rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
+                handle, rocblas_row_wise, rocblas_side_right,
+                (COMPLEX ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose), mn,
+                n, m, A, shiftA, lda, strideA, (tau + k * batch_count), k, V, shiftV, ldv, strideV,
+                batch_count, scalars, Abyx_norms_tmptr[update], diag_tmptr_Y[update],
+                Abyx_norms_trfact_X[update], workArr);
+        }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
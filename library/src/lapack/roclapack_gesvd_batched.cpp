@@ -40,6 +40,8 @@ rocblas_status rocsolver_gesvd_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -49,55 +51,37 @@ rocblas_status rocsolver_gesvd_batched_impl(rocblas_handle handle,
     // memory workspace sizes:
     // size for constants in rocblas calls
     size_t size_scalars;
-    // size of reusable workspace and array of pointers (batched case)
-    size_t size_work_workArr;
-    // extra requirements for calling orthogonal/unitary matrix operations and factorizations
-    size_t size_Abyx_norms_tmptr, size_Abyx_norms_trfact_X, size_diag_tmptr_Y;
-    // size of array tau to store householder scalars
-    size_t size_tau;
-    // size of temporary arrays for copies
-    size_t size_tempArrayT, size_tempArrayC;
-    // size of array of pointers (only for batched case)
-    size_t size_workArr;
-
-    rocsolver_gesvd_getMemorySize<true, T, TT>(
-        left_svect, right_svect, m, n, batch_count, fast_alg, &size_scalars, &size_work_workArr,
-        &size_Abyx_norms_tmptr, &size_Abyx_norms_trfact_X, &size_diag_tmptr_Y, &size_tau,
-        &size_tempArrayT, &size_tempArrayC, &size_workArr);
+    // size of workspace (shared by the factorizations, orthogonal/unitary matrix operations
+    // and BDSQR, plus the householder scalars, temporary copies and arrays of pointers)
+    size_t size_work;
+    rocsolver_gesvd_getMemorySize<true, T, TT>(left_svect, right_svect, m, n, batch_count, fast_alg,
+                                               &size_scalars, &size_work);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work_workArr, size_Abyx_norms_tmptr, size_Abyx_norms_trfact_X,
-            size_diag_tmptr_Y, size_tau, size_tempArrayT, size_tempArrayC, size_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
 
     // memory workspace allocation
-    void *scalars, *work_workArr, *Abyx_norms_tmptr, *Abyx_norms_trfact_X, *diag_tmptr_Y, *tau;
-    void *tempArrayT, *tempArrayC, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_tmptr,
-                              size_Abyx_norms_trfact_X, size_diag_tmptr_Y, size_tau,
-                              size_tempArrayT, size_tempArrayC, size_workArr);
+    void *scalars, *work;
+    rocblas_device_malloc mem(handle, size_scalars, size_work);
 
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
-    work_workArr = mem[1];
-    Abyx_norms_tmptr = mem[2];
-    Abyx_norms_trfact_X = mem[3];
-    diag_tmptr_Y = mem[4];
-    tau = mem[5];
-    tempArrayT = mem[6];
-    tempArrayC = mem[7];
-    workArr = mem[8];
+    work = mem[1];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_gesvd_template<true, false, T>(
         handle, left_svect, right_svect, m, n, A, shiftA, lda, strideA, S, strideS, U, ldu, strideU,
-        V, ldv, strideV, E, strideE, fast_alg, info, batch_count, (T*)scalars, work_workArr,
-        (T*)Abyx_norms_tmptr, (T*)Abyx_norms_trfact_X, (T*)diag_tmptr_Y, (T*)tau, (T*)tempArrayT,
-        (T*)tempArrayC, (T**)workArr);
+        V, ldv, strideV, E, strideE, fast_alg, info, batch_count, (T*)scalars, work);
 }
 
 /*
@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesvd.hpp"
+
+template <typename T, typename TT, typename W>
+rocblas_status rocsolver_gesvd_rowmajor_batched_impl(rocblas_handle handle,
+                                                     const rocblas_svect left_svect,
+                                                     const rocblas_svect right_svect,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     W A,
+                                                     const rocblas_int lda,
+                                                     TT* S,
+                                                     const rocblas_stride strideS,
+                                                     T* U,
+                                                     const rocblas_int ldu,
+                                                     const rocblas_stride strideU,
+                                                     T* V,
+                                                     const rocblas_int ldv,
+                                                     const rocblas_stride strideV,
+                                                     TT* E,
+                                                     const rocblas_stride strideE,
+                                                     const rocblas_workmode fast_alg,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gesvd_rowmajor_batched", "--left_svect", left_svect, "--right_svect",
+                        right_svect, "-m", m, "-n", n, "--lda", lda, "--strideS", strideS, "--ldu",
+                        ldu, "--strideU", strideU, "--ldv", ldv, "--strideV", strideV, "--strideE",
+                        strideE, "--fast_alg", fast_alg, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // the column-major view of a row-major A is A^T = conj(V) * S * U^T, so the row-major
+    // U is returned as the right singular vectors of A^T, and the row-major V' as its left
+    // singular vectors; the problem is solved with m and n, and U and V, interchanged
+    // (this also checks the leading dimensions of the row-major arrays)
+
+    // argument checking
+    rocblas_status st = rocsolver_gesvd_argCheck(handle, right_svect, left_svect, n, m, A, lda, S,
+                                                 V, ldv, U, ldu, E, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (shared by the factorizations, orthogonal/unitary matrix operations
+    // and BDSQR, plus the householder scalars, temporary copies and arrays of pointers)
+    size_t size_work;
+    rocsolver_gesvd_getMemorySize<true, T, TT>(right_svect, left_svect, n, m, batch_count, fast_alg,
+                                               &size_scalars, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work;
+    rocblas_device_malloc mem(handle, size_scalars, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work = mem[1];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_gesvd_template<true, false, T>(
+        handle, right_svect, left_svect, n, m, A, shiftA, lda, strideA, S, strideS, V, ldv, strideV,
+        U, ldu, strideU, E, strideE, fast_alg, info, batch_count, (T*)scalars, work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgesvd_rowmajor_batched(rocblas_handle handle,
+                                                 const rocblas_svect left_svect,
+                                                 const rocblas_svect right_svect,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 float* const A[],
+                                                 const rocblas_int lda,
+                                                 float* S,
+                                                 const rocblas_stride strideS,
+                                                 float* U,
+                                                 const rocblas_int ldu,
+                                                 const rocblas_stride strideU,
+                                                 float* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 float* E,
+                                                 const rocblas_stride strideE,
+                                                 const rocblas_workmode fast_alg,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_rowmajor_batched_impl<float>(handle, left_svect, right_svect, m, n, A,
+                                                        lda, S, strideS, U, ldu, strideU, V, ldv,
+                                                        strideV, E, strideE, fast_alg, info,
+                                                        batch_count);
+}
+
+rocblas_status rocsolver_dgesvd_rowmajor_batched(rocblas_handle handle,
+                                                 const rocblas_svect left_svect,
+                                                 const rocblas_svect right_svect,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 double* const A[],
+                                                 const rocblas_int lda,
+                                                 double* S,
+                                                 const rocblas_stride strideS,
+                                                 double* U,
+                                                 const rocblas_int ldu,
+                                                 const rocblas_stride strideU,
+                                                 double* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 double* E,
+                                                 const rocblas_stride strideE,
+                                                 const rocblas_workmode fast_alg,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_rowmajor_batched_impl<double>(handle, left_svect, right_svect, m, n, A,
+                                                         lda, S, strideS, U, ldu, strideU, V, ldv,
+                                                         strideV, E, strideE, fast_alg, info,
+                                                         batch_count);
+}
+
+rocblas_status rocsolver_cgesvd_rowmajor_batched(rocblas_handle handle,
+                                                 const rocblas_svect left_svect,
+                                                 const rocblas_svect right_svect,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_float_complex* const A[],
+                                                 const rocblas_int lda,
+                                                 float* S,
+                                                 const rocblas_stride strideS,
+                                                 rocblas_float_complex* U,
+                                                 const rocblas_int ldu,
+                                                 const rocblas_stride strideU,
+                                                 rocblas_float_complex* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 float* E,
+                                                 const rocblas_stride strideE,
+                                                 const rocblas_workmode fast_alg,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_rowmajor_batched_impl<rocblas_float_complex>(handle, left_svect,
+                                                                        right_svect, m, n, A, lda,
+                                                                        S, strideS, U, ldu, strideU,
+                                                                        V, ldv, strideV, E, strideE,
+                                                                        fast_alg, info,
+                                                                        batch_count);
+}
+
+rocblas_status rocsolver_zgesvd_rowmajor_batched(rocblas_handle handle,
+                                                 const rocblas_svect left_svect,
+                                                 const rocblas_svect right_svect,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_double_complex* const A[],
+                                                 const rocblas_int lda,
+                                                 double* S,
+                                                 const rocblas_stride strideS,
+                                                 rocblas_double_complex* U,
+                                                 const rocblas_int ldu,
+                                                 const rocblas_stride strideU,
+                                                 rocblas_double_complex* V,
+                                                 const rocblas_int ldv,
+                                                 const rocblas_stride strideV,
+                                                 double* E,
+                                                 const rocblas_stride strideE,
+                                                 const rocblas_workmode fast_alg,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_rowmajor_batched_impl<rocblas_double_complex>(handle, left_svect,
+                                                                         right_svect, m, n, A, lda,
+                                                                         S, strideS, U, ldu,
+                                                                         strideU, V, ldv, strideV,
+                                                                         E, strideE, fast_alg, info,
+                                                                         batch_count);
+}
+
+} // extern C
@@ -0,0 +1,213 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gesvd.hpp"
+#include "rocsolver.h"
+
+/** GESVD_SCALE_KERNEL scales the first kk rows of V' (returned by GESVD) with the
+    corresponding singular values (or their reciprocals if INVERT is true). Rows whose singular
+    value is not larger than rtol times the largest one are set to zero. The number of
+    retained singular values is written to rank. **/
+template <bool INVERT, typename T, typename S>
+ROCSOLVER_KERNEL void gesvd_scale_kernel(const rocblas_int kk,
+                                         const rocblas_int n,
+                                         S* SS,
+                                         const rocblas_stride strideS,
+                                         T* VV,
+                                         const rocblas_int ldv,
+                                         const rocblas_stride strideV,
+                                         const S rtol,
+                                         rocblas_int* rank)
+{
+    const int bid = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    // array pointers
+    S* sv = SS + bid * strideS;
+    T* V = VV + bid * strideV;
+
+    // the singular values are in decreasing order
+    const S tol = rtol * sv[0];
+
+    if(i < kk && j < n)
+    {
+        S s = sv[i];
+        V[i + j * ldv] *= T(s > tol ? (INVERT ? 1 / s : s) : 0);
+    }
+
+    if(i == 0 && j == 0)
+    {
+        rocblas_int r = 0;
+        while(r < kk && sv[r] > tol)
+            r++;
+        rank[bid] = r;
+    }
+}
+
+/** Helper to calculate workspace sizes. The left singular vectors overwrite A, so that
+    only the singular values and the rows of V' are stored in the workspace. **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gesvd_truncate_getMemorySize(const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int batch_count,
+                                            size_t* size_scalars,
+                                            size_t* size_work,
+                                            size_t* size_S,
+                                            size_t* size_E,
+                                            size_t* size_V,
+                                            size_t* size_workArr)
+{
+    // if quick return, no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work = 0;
+        *size_S = 0;
+        *size_E = 0;
+        *size_V = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    const rocblas_int k = std::min(m, n);
+
+    // requirements for gesvd
+    rocsolver_gesvd_getMemorySize<BATCHED, T, S>(rocblas_svect_overwrite, rocblas_svect_singular,
+                                                 m, n, batch_count, rocblas_inplace, size_scalars,
+                                                 size_work);
+
+    // size of arrays for the singular values and the right singular vectors
+    *size_S = sizeof(S) * k * batch_count;
+    *size_E = sizeof(S) * k * batch_count;
+    *size_V = sizeof(T) * k * n * batch_count;
+
+    // size of array of pointers (only for batched case)
+    if(BATCHED)
+        *size_workArr = 2 * sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gesvd_truncate_argCheck(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 const rocblas_int lda,
+                                                 const rocblas_int k,
+                                                 const S rtol,
+                                                 const rocblas_int ldc,
+                                                 T A,
+                                                 T C,
+                                                 rocblas_int* rank,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(rtol < 0)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || k < 0 || lda < m || ldc < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || (m * n && !C) || (batch_count && !rank) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gesvd_truncate_template(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 U A,
+                                                 const rocblas_int shiftA,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 const rocblas_int k,
+                                                 const S rtol,
+                                                 U C,
+                                                 const rocblas_int shiftC,
+                                                 const rocblas_int ldc,
+                                                 const rocblas_stride strideC,
+                                                 rocblas_int* rank,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count,
+                                                 T* scalars,
+                                                 void* work,
+                                                 S* Sv,
+                                                 S* E,
+                                                 T* V,
+                                                 T** workArr)
+{
+    ROCSOLVER_ENTER("gesvd_truncate", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "k:", k,
+                    "rtol:", rtol, "shiftC:", shiftC, "ldc:", ldc, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return with rank = 0
+    if(m == 0 || n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, rank,
+                                batch_count, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    const rocblas_int mn = std::min(m, n);
+    const rocblas_int kk = std::min(k, mn);
+    const rocblas_stride strideS = mn;
+    const rocblas_int ldv = mn;
+    const rocblas_stride strideV = mn * n;
+
+    // compute the SVD; the first mn columns of A are overwritten with U
+    rocsolver_gesvd_template<BATCHED, STRIDED, T>(
+        handle, rocblas_svect_overwrite, rocblas_svect_singular, m, n, A, shiftA, lda, strideA, Sv,
+        strideS, (T*)nullptr, 1, 0, V, ldv, strideV, E, strideS, rocblas_inplace, info,
+        batch_count, scalars, work);
+
+    // V' <- S * V' (only the retained singular values)
+    rocblas_int blocksx = (std::max(kk, 1) - 1) / BS2 + 1;
+    rocblas_int blocksy = (n - 1) / BS2 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(gesvd_scale_kernel<false, T>, dim3(blocksx, blocksy, batch_count),
+                            dim3(BS2, BS2, 1), 0, stream, kk, n, Sv, strideS, V, ldv, strideV,
+                            rtol, rank);
+
+    // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    T one = 1;
+    T zero = 0;
+
+    // C = U(:,1:kk) * (S * V')(1:kk,:)
+    rocblasCall_gemm<BATCHED, STRIDED, T>(handle, rocblas_operation_none, rocblas_operation_none, m,
+                                          n, kk, &one, A, shiftA, lda, strideA, V, 0, ldv, strideV,
+                                          &zero, C, shiftC, ldc, strideC, batch_count, workArr);
+
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    return rocblas_status_success;
+}
@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesvd_truncate.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gesvd_truncate_batched_impl(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     U A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_int k,
+                                                     const S rtol,
+                                                     U C,
+                                                     const rocblas_int ldc,
+                                                     rocblas_int* rank,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gesvd_truncate_batched", "-m", m, "-n", n, "--lda", lda, "-k", k, "--rtol",
+                        rtol, "--ldc", ldc, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gesvd_truncate_argCheck(handle, m, n, lda, k, rtol, ldc, A, C,
+                                                          rank, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftC = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideC = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of the workspace of gesvd
+    size_t size_work;
+    // size for the singular values and the right singular vectors
+    size_t size_S, size_E, size_V;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_gesvd_truncate_getMemorySize<true, T, S>(m, n, batch_count, &size_scalars, &size_work,
+                                                       &size_S, &size_E, &size_V, &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_S,
+                                                      size_E, size_V, size_workArr);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work, *Sv, *E, *V, *workArr;
+    rocblas_device_malloc mem(handle, size_scalars, size_work, size_S, size_E, size_V,
+                              size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work = mem[1];
+    Sv = mem[2];
+    E = mem[3];
+    V = mem[4];
+    workArr = mem[5];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_gesvd_truncate_template<true, false, T>(handle, m, n, A, shiftA, lda, strideA,
+                                                             k, rtol, C, shiftC, ldc, strideC, rank,
+                                                             info, batch_count, (T*)scalars, work,
+                                                             (S*)Sv, (S*)E, (T*)V, (T**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgesvd_truncate_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 float* const A[],
+                                                 const rocblas_int lda,
+                                                 const rocblas_int k,
+                                                 const float rtol,
+                                                 float* const C[],
+                                                 const rocblas_int ldc,
+                                                 rocblas_int* rank,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_truncate_batched_impl<float>(handle, m, n, A, lda, k, rtol, C, ldc, rank,
+                                                        info, batch_count);
+}
+
+rocblas_status rocsolver_dgesvd_truncate_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 double* const A[],
+                                                 const rocblas_int lda,
+                                                 const rocblas_int k,
+                                                 const double rtol,
+                                                 double* const C[],
+                                                 const rocblas_int ldc,
+                                                 rocblas_int* rank,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_truncate_batched_impl<double>(handle, m, n, A, lda, k, rtol, C, ldc,
+                                                         rank, info, batch_count);
+}
+
+rocblas_status rocsolver_cgesvd_truncate_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_float_complex* const A[],
+                                                 const rocblas_int lda,
+                                                 const rocblas_int k,
+                                                 const float rtol,
+                                                 rocblas_float_complex* const C[],
+                                                 const rocblas_int ldc,
+                                                 rocblas_int* rank,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_truncate_batched_impl<rocblas_float_complex>(handle, m, n, A, lda, k,
+                                                                        rtol, C, ldc, rank, info,
+                                                                        batch_count);
+}
+
+rocblas_status rocsolver_zgesvd_truncate_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_double_complex* const A[],
+                                                 const rocblas_int lda,
+                                                 const rocblas_int k,
+                                                 const double rtol,
+                                                 rocblas_double_complex* const C[],
+                                                 const rocblas_int ldc,
+                                                 rocblas_int* rank,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_gesvd_truncate_batched_impl<rocblas_double_complex>(handle, m, n, A, lda, k,
+                                                                         rtol, C, ldc, rank, info,
+                                                                         batch_count);
+}
+
+} // extern C
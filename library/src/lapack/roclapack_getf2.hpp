@@ -376,6 +376,15 @@ int select_spkernel(const rocblas_int m, const rocblas_int n, const bool pivot)
     return ker;
 }
 
+/** Returns true if the cooperative kernel for tall panels has been enabled by setting the
+    environment variable ROCSOLVER_GETF2_COOPERATIVE to a non-zero value (the kernel is
+    opt-in until it has been tuned) **/
+inline bool getf2_use_coop()
+{
+    const char* str = std::getenv("ROCSOLVER_GETF2_COOPERATIVE");
+    return str && std::atoi(str) != 0;
+}
+
 /** Returns the thread block sizes used for the scale+update of trailing matrix**/
 inline void getf2_get_ger_blksize(const rocblas_int m,
                                   const rocblas_int n,
@@ -482,6 +491,17 @@ void rocsolver_getf2_getMemorySize(const rocblas_int m,
 
     // for pivot indices
     *size_pivotidx = pivot ? sizeof(rocblas_int) * batch_count : 0;
+
+#ifdef OPTIMAL
+    // the cooperative kernel for tall panels keeps the partial results of the pivot search of
+    // every workgroup in these arrays (the space is reserved even if the kernel is not enabled, so
+    // that the workspace size does not depend on the environment)
+    if(m > GETF2_SPKER_MAX_M && pivot)
+    {
+        *size_pivotval = sizeof(T) * 2 * GETF2_COOP_MAX_BLOCKS * batch_count;
+        *size_pivotidx = sizeof(rocblas_int) * 2 * GETF2_COOP_MAX_BLOCKS * batch_count;
+    }
+#endif
 }
 
 /** argument checking **/
@@ -589,12 +609,25 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle,
                                       info, batch_count, pivot, offset, permut_idx, stridePI);
         }
     }
+
+    // use the cooperative kernel for tall panels, if enabled
+    // (and if the whole grid can be resident on the device)
+    else if(m > GETF2_SPKER_MAX_M && n <= GETF2_COOP_MAX_N && getf2_use_coop())
+    {
+        rocblas_status status = getf2_run_panel_coop<T>(
+            handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, pivot,
+            offset, permut_idx, stridePI, pivotval, pivotidx);
+        if(status != rocblas_status_continue)
+            return status;
+    }
 #endif
 
     // everything must be executed with scalars on the device
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // prepare kernels
     rocblas_int singular_thds = getf2_get_checksingularity_blksize(n);
@@ -658,6 +691,8 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle,
 #endif
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
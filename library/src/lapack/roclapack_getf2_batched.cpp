@@ -31,6 +31,8 @@ rocblas_status rocsolver_getf2_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // using unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftP = 0;
@@ -51,6 +53,8 @@ rocblas_status rocsolver_getf2_batched_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_pivotval,
                                                       size_pivotidx);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *pivotidx, *pivotval;
     rocblas_device_malloc mem(handle, size_scalars, size_pivotval, size_pivotidx);
@@ -58,12 +62,16 @@ rocblas_status rocsolver_getf2_batched_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     pivotval = mem[1];
     pivotidx = mem[2];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_getf2_template<true, T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP,
                                              strideP, info, batch_count, (T*)scalars, (T*)pivotval,
@@ -660,9 +660,11 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
                                                       pivotval, pivotidx, pivot);
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
     T one = 1;
     T minone = -1;
 
@@ -741,6 +743,8 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
         }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
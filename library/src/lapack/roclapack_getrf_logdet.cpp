@@ -0,0 +1,150 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrf_logdet.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_getrf_logdet_impl(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           U A,
+                                           const rocblas_int lda,
+                                           rocblas_int* ipiv,
+                                           T* sign,
+                                           S* logdet,
+                                           rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("getrf_logdet", "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_getrf_logdet_argCheck(handle, n, lda, A, ipiv, sign, logdet,
+                                                        info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftP = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size to store info about singularity of each subblock
+    size_t size_iinfo, size_iipiv;
+
+    rocsolver_getrf_getMemorySize<false, false, T>(
+        n, n, true, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivotval,
+                                                      size_pivotidx, size_iipiv, size_iinfo);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_iipiv, size_iinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    iipiv = mem[7];
+    iinfo = mem[8];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_getrf_logdet_template<false, false, T>(
+        handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, sign, logdet, info, batch_count,
+        (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (rocblas_int*)pivotidx,
+        (rocblas_int*)iipiv, (rocblas_int*)iinfo, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgetrf_logdet(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       float* A,
+                                       const rocblas_int lda,
+                                       rocblas_int* ipiv,
+                                       float* sign,
+                                       float* logdet,
+                                       rocblas_int* info)
+{
+    return rocsolver_getrf_logdet_impl<float>(handle, n, A, lda, ipiv, sign, logdet, info);
+}
+
+rocblas_status rocsolver_dgetrf_logdet(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       double* A,
+                                       const rocblas_int lda,
+                                       rocblas_int* ipiv,
+                                       double* sign,
+                                       double* logdet,
+                                       rocblas_int* info)
+{
+    return rocsolver_getrf_logdet_impl<double>(handle, n, A, lda, ipiv, sign, logdet, info);
+}
+
+rocblas_status rocsolver_cgetrf_logdet(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       const rocblas_int lda,
+                                       rocblas_int* ipiv,
+                                       rocblas_float_complex* sign,
+                                       float* logdet,
+                                       rocblas_int* info)
+{
+    return rocsolver_getrf_logdet_impl<rocblas_float_complex>(handle, n, A, lda, ipiv, sign, logdet,
+                                                              info);
+}
+
+rocblas_status rocsolver_zgetrf_logdet(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       const rocblas_int lda,
+                                       rocblas_int* ipiv,
+                                       rocblas_double_complex* sign,
+                                       double* logdet,
+                                       rocblas_int* info)
+{
+    return rocsolver_getrf_logdet_impl<rocblas_double_complex>(handle, n, A, lda, ipiv, sign,
+                                                               logdet, info);
+}
+
+} // extern C
@@ -0,0 +1,84 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "roclapack_gelogdet.hpp"
+#include "roclapack_getrf.hpp"
+#include "rocsolver.h"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_getrf_logdet_argCheck(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               const rocblas_int lda,
+                                               U A,
+                                               rocblas_int* ipiv,
+                                               T* sign,
+                                               S* logdet,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (batch_count && !sign) || (batch_count && !logdet)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_getrf_logdet_template(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               U A,
+                                               const rocblas_int shiftA,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               rocblas_int* ipiv,
+                                               const rocblas_int shiftP,
+                                               const rocblas_stride strideP,
+                                               T* sign,
+                                               S* logdet,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count,
+                                               T* scalars,
+                                               void* work1,
+                                               void* work2,
+                                               void* work3,
+                                               void* work4,
+                                               T* pivotval,
+                                               rocblas_int* pivotidx,
+                                               rocblas_int* iipiv,
+                                               rocblas_int* iinfo,
+                                               const bool optim_mem)
+{
+    ROCSOLVER_ENTER("getrf_logdet", "n:", n, "shiftA:", shiftA, "lda:", lda, "shiftP:", shiftP,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    // compute the LU factorization
+    rocsolver_getrf_template<BATCHED, STRIDED, T>(
+        handle, n, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, scalars,
+        work1, work2, work3, work4, pivotval, pivotidx, iipiv, iinfo, optim_mem, true);
+
+    // reduce the diagonal of U and the pivot parity in the epilogue
+    // (singular instances, as reported by info, get a zero determinant)
+    return rocsolver_gelogdet_template<T>(handle, n, A, shiftA, lda, strideA, ipiv, shiftP,
+                                          strideP, sign, logdet, info, batch_count);
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "roclapack_getrf.hpp"
+#include "rocsolver.h"
+
+/** Row-major LU has no algebraic equivalent in terms of the column-major factorization (the
+    transposed problem would pivot columns instead of rows), so the matrix is transposed into
+    column-major order, factorized, and transposed back. Square matrices are transposed in place;
+    rectangular matrices go through a column-major m-by-n buffer. **/
+
+template <typename T>
+rocblas_status rocsolver_getrf_rowmajor_argCheck(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 const rocblas_int lda,
+                                                 T A,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count = 1)
+{
+    // in row-major order the leading dimension spans the columns of A
+    return rocsolver_getf2_getrf_argCheck(handle, n, m, lda, A, ipiv, info, true, batch_count);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_getrf_rowmajor_getMemorySize(const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int batch_count,
+                                            size_t* size_scalars,
+                                            size_t* size_work1,
+                                            size_t* size_work2,
+                                            size_t* size_work3,
+                                            size_t* size_work4,
+                                            size_t* size_pivotval,
+                                            size_t* size_pivotidx,
+                                            size_t* size_iipiv,
+                                            size_t* size_iinfo,
+                                            size_t* size_buffer,
+                                            bool* optim_mem)
+{
+    if(m == n)
+    {
+        // the factorization works in place on A
+        rocsolver_getrf_getMemorySize<BATCHED, STRIDED, T>(
+            m, n, true, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+            size_pivotval, size_pivotidx, size_iipiv, size_iinfo, optim_mem);
+        *size_buffer = 0;
+    }
+    else
+    {
+        // the factorization works on a strided column-major buffer
+        rocsolver_getrf_getMemorySize<false, true, T>(
+            m, n, true, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+            size_pivotval, size_pivotidx, size_iipiv, size_iinfo, optim_mem);
+        *size_buffer = sizeof(T) * m * n * batch_count;
+    }
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_getrf_rowmajor_template(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 U A,
+                                                 const rocblas_int shiftA,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 rocblas_int* ipiv,
+                                                 const rocblas_int shiftP,
+                                                 const rocblas_stride strideP,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count,
+                                                 T* scalars,
+                                                 void* work1,
+                                                 void* work2,
+                                                 void* work3,
+                                                 void* work4,
+                                                 T* pivotval,
+                                                 rocblas_int* pivotidx,
+                                                 rocblas_int* iipiv,
+                                                 rocblas_int* iinfo,
+                                                 T* buffer,
+                                                 const bool optim_mem)
+{
+    ROCSOLVER_ENTER("getrf_rowmajor", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "shiftP:", shiftP, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    // quick return if no dimensions
+    // (the factorization resets info)
+    if(m == 0 || n == 0)
+        return rocsolver_getrf_template<BATCHED, STRIDED, T>(
+            handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+            scalars, work1, work2, work3, work4, pivotval, pivotidx, iipiv, iinfo, optim_mem, true);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksx = (m - 1) / BS2 + 1;
+    rocblas_int blocksy = (n - 1) / BS2 + 1;
+    dim3 threads(BS2, BS2, 1);
+
+    if(m == n)
+    {
+        dim3 grid(blocksx, blocksx, batch_count);
+
+        ROCSOLVER_LAUNCH_KERNEL((transpose_square<T, false>), grid, threads, 0, stream, n, A,
+                                shiftA, lda, strideA);
+
+        rocsolver_getrf_template<BATCHED, STRIDED, T>(
+            handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+            scalars, work1, work2, work3, work4, pivotval, pivotidx, iipiv, iinfo, optim_mem, true);
+
+        ROCSOLVER_LAUNCH_KERNEL((transpose_square<T, false>), grid, threads, 0, stream, n, A,
+                                shiftA, lda, strideA);
+    }
+    else
+    {
+        rocblas_int ldb = m;
+        rocblas_stride strideB = rocblas_stride(m) * n;
+
+        // the row-major m-by-n matrix is stored as a column-major n-by-m matrix
+        ROCSOLVER_LAUNCH_KERNEL((transpose_mat<T, false>), dim3(blocksy, blocksx, batch_count),
+                                threads, 0, stream, n, m, A, shiftA, lda, strideA, buffer, 0, ldb,
+                                strideB);
+
+        rocsolver_getrf_template<false, true, T>(
+            handle, m, n, buffer, 0, ldb, strideB, ipiv, shiftP, strideP, info, batch_count,
+            scalars, work1, work2, work3, work4, pivotval, pivotidx, iipiv, iinfo, optim_mem, true);
+
+        ROCSOLVER_LAUNCH_KERNEL((transpose_mat<T, false>), dim3(blocksx, blocksy, batch_count),
+                                threads, 0, stream, m, n, buffer, 0, ldb, strideB, A, shiftA, lda,
+                                strideA);
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrf_rowmajor.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrf_rowmajor_strided_batched_impl(rocblas_handle handle,
+                                                             const rocblas_int m,
+                                                             const rocblas_int n,
+                                                             U A,
+                                                             const rocblas_int lda,
+                                                             const rocblas_stride strideA,
+                                                             rocblas_int* ipiv,
+                                                             const rocblas_stride strideP,
+                                                             rocblas_int* info,
+                                                             const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("getrf_rowmajor_strided_batched", "-m", m, "-n", n, "--lda", lda,
+                        "--strideA", strideA, "--strideP", strideP, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_getrf_rowmajor_argCheck(handle, m, n, lda, A, ipiv, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftP = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size to store info about singularity of each subblock
+    size_t size_iinfo, size_iipiv;
+    // size of the column-major copy of A
+    size_t size_buffer;
+
+    rocsolver_getrf_rowmajor_getMemorySize<false, true, T>(
+        m, n, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &size_buffer, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivotval,
+                                                      size_pivotidx, size_iipiv, size_iinfo,
+                                                      size_buffer);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv, *buffer;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_iipiv, size_iinfo, size_buffer);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    iipiv = mem[7];
+    iinfo = mem[8];
+    buffer = mem[9];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_getrf_rowmajor_template<false, true, T>(
+        handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+        (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (rocblas_int*)pivotidx,
+        (rocblas_int*)iipiv, (rocblas_int*)iinfo, (T*)buffer, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgetrf_rowmajor_strided_batched(rocblas_handle handle,
+                                                         const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         float* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_int* ipiv,
+                                                         const rocblas_stride strideP,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver_getrf_rowmajor_strided_batched_impl<float>(handle, m, n, A, lda, strideA, ipiv,
+                                                                strideP, info, batch_count);
+}
+
+rocblas_status rocsolver_dgetrf_rowmajor_strided_batched(rocblas_handle handle,
+                                                         const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         double* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_int* ipiv,
+                                                         const rocblas_stride strideP,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver_getrf_rowmajor_strided_batched_impl<double>(handle, m, n, A, lda, strideA,
+                                                                 ipiv, strideP, info, batch_count);
+}
+
+rocblas_status rocsolver_cgetrf_rowmajor_strided_batched(rocblas_handle handle,
+                                                         const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         rocblas_float_complex* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_int* ipiv,
+                                                         const rocblas_stride strideP,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver_getrf_rowmajor_strided_batched_impl<rocblas_float_complex>(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+rocblas_status rocsolver_zgetrf_rowmajor_strided_batched(rocblas_handle handle,
+                                                         const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         rocblas_double_complex* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_int* ipiv,
+                                                         const rocblas_stride strideP,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver_getrf_rowmajor_strided_batched_impl<rocblas_double_complex>(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+}
+
+} // extern C
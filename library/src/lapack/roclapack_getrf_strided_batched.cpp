@@ -32,6 +32,8 @@ rocblas_status rocsolver_getrf_strided_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftP = 0;
@@ -56,6 +58,8 @@ rocblas_status rocsolver_getrf_strided_batched_impl(rocblas_handle handle,
                                                       size_work3, size_work4, size_pivotval,
                                                       size_pivotidx, size_iipiv, size_iinfo);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv;
     rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
@@ -64,6 +68,8 @@ rocblas_status rocsolver_getrf_strided_batched_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work1 = mem[1];
     work2 = mem[2];
@@ -76,6 +82,8 @@ rocblas_status rocsolver_getrf_strided_batched_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_getrf_template<false, true, T>(
         handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
@@ -4,7 +4,7 @@
  *     Univ. of Tennessee, Univ. of California Berkeley,
  *     Univ. of Colorado Denver and NAG Ltd..
  *     December 2016
- * Copyright (c) 2019-2021 Advanced Micro Devices, Inc.
+ * Copyright (c) 2019-2022 Advanced Micro Devices, Inc.
  * ***********************************************************************/
 
 #pragma once
@@ -117,12 +117,237 @@ ROCSOLVER_KERNEL void getri_kernel_large2(const rocblas_int n,
         getri_pivot(n, a, lda, p);
 }
 
+/** GETRI_GJ_KERNEL computes the inverse of A from its LU factorization using a
+    single work-group per matrix. The matrix is swept by blocks of nb columns in
+    Gauss-Jordan fashion: inv(U) is computed from left to right, then inv(A) is
+    obtained from inv(A)*L = inv(U) from right to left, and finally the column
+    interchanges are applied. The diagonal blocks are kept in LDS (nb x nb) and the
+    panels of L in the workspace (n x nb). The rows of U12 and of L32 that are shared
+    by all the threads in the updates are staged in LDS by tiles of nb x nb, so the
+    size of shared memory should be lmemsize = 2 * nb * nb * sizeof(T). It requires
+    nb <= hipBlockDim_y. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void getri_gj_kernel(const rocblas_int n,
+                                      const rocblas_int nb,
+                                      U A,
+                                      const rocblas_int shiftA,
+                                      const rocblas_int lda,
+                                      const rocblas_stride strideA,
+                                      rocblas_int* ipiv,
+                                      const rocblas_int shiftP,
+                                      const rocblas_stride strideP,
+                                      rocblas_int* info,
+                                      T* work,
+                                      const rocblas_stride strideW,
+                                      const bool pivot)
+{
+    int b = hipBlockIdx_x;
+    int ty = hipThreadIdx_y;
+    int bdy = hipBlockDim_y;
+
+    T* a = load_ptr_batch<T>(A, b, shiftA, strideA);
+    T* w = work + b * strideW;
+
+    // shared mem for the diagonal blocks and the staged tiles
+    extern __shared__ double lmem[];
+    T* d = reinterpret_cast<T*>(lmem);
+    T* t = d + nb * nb;
+    __shared__ rocblas_int _info;
+
+    T zero = 0;
+    T one = 1;
+
+    // check singularity of U (if singular, A is not modified)
+    if(ty == 0)
+        _info = 0;
+    __syncthreads();
+
+    for(int i = ty; i < n; i += bdy)
+    {
+        if(a[i + i * lda] == 0)
+        {
+            rocblas_int _info_temp = _info;
+            while(_info_temp == 0 || _info_temp > i + 1)
+                _info_temp = atomicCAS(&_info, _info_temp, i + 1);
+        }
+    }
+    __syncthreads();
+
+    if(ty == 0)
+        info[b] = _info;
+    if(_info != 0)
+        return;
+
+    // 1. compute inv(U) by blocks of columns, from left to right
+    for(rocblas_int j = 0; j < n; j += nb)
+    {
+        rocblas_int jb = min(n - j, nb);
+
+        // load diagonal block U22 into LDS
+        for(int k = ty; k < jb * jb; k += bdy)
+        {
+            int r = k % jb;
+            int c = k / jb;
+            d[r + c * nb] = (r <= c) ? a[(j + r) + (j + c) * lda] : zero;
+        }
+        __syncthreads();
+
+        // compute W = inv(U11) * U12 by tiles of rows of U12 staged in LDS
+        // (inv(U11) is stored in A[0:j-1,0:j-1]; every thread computes its rows of W)
+        for(rocblas_int l0 = 0; l0 < j; l0 += nb)
+        {
+            rocblas_int lb = min(j - l0, nb);
+            for(int k = ty; k < lb * jb; k += bdy)
+            {
+                int r = k % lb;
+                int c = k / lb;
+                t[r + c * nb] = a[(l0 + r) + (j + c) * lda];
+            }
+            __syncthreads();
+
+            for(int r = ty; r < j; r += bdy)
+            {
+                for(int c = 0; c < jb; c++)
+                {
+                    T s = (l0 == 0) ? zero : w[r + c * n];
+                    for(int l = max(r, l0); l < l0 + lb; l++)
+                        s += a[r + l * lda] * t[(l - l0) + c * nb];
+                    w[r + c * n] = s;
+                }
+            }
+            __syncthreads();
+        }
+
+        // invert U22 in LDS
+        for(int c = 0; c < jb; c++)
+        {
+            T dc = one / d[c + c * nb];
+            T s = zero;
+            if(ty < c)
+            {
+                for(int l = ty; l < c; l++)
+                    s += d[ty + l * nb] * d[l + c * nb];
+            }
+            __syncthreads();
+
+            if(ty < c)
+                d[ty + c * nb] = -dc * s;
+            if(ty == c)
+                d[c + c * nb] = dc;
+            __syncthreads();
+        }
+
+        // A[0:j-1,j:j+jb-1] = -W * inv(U22), and A[j:j+jb-1,j:j+jb-1] = inv(U22)
+        for(int k = ty; k < j * jb; k += bdy)
+        {
+            int r = k % j;
+            int c = k / j;
+            T s = zero;
+            for(int l = 0; l <= c; l++)
+                s += w[r + l * n] * d[l + c * nb];
+            a[r + (j + c) * lda] = -s;
+        }
+        for(int k = ty; k < jb * jb; k += bdy)
+        {
+            int r = k % jb;
+            int c = k / jb;
+            if(r <= c)
+                a[(j + r) + (j + c) * lda] = d[r + c * nb];
+        }
+        __syncthreads();
+    }
+
+    // 2. solve inv(A) * L = inv(U) by blocks of columns, from right to left
+    rocblas_int nn = ((n - 1) / nb) * nb;
+    for(rocblas_int j = nn; j >= 0; j -= nb)
+    {
+        rocblas_int jb = min(n - j, nb);
+
+        // move the panel of L out of A: L22 to LDS and L32 to the workspace
+        for(int k = ty; k < (n - j) * jb; k += bdy)
+        {
+            int r = j + k % (n - j);
+            int c = k / (n - j);
+            if(r > j + c)
+            {
+                if(r < j + jb)
+                    d[(r - j) + c * nb] = a[r + (j + c) * lda];
+                else
+                    w[r + c * n] = a[r + (j + c) * lda];
+                a[r + (j + c) * lda] = 0;
+            }
+        }
+        __syncthreads();
+
+        // A[:,j:j+jb-1] = A[:,j:j+jb-1] - A[:,j+jb:n-1] * L32, by tiles of rows of L32
+        // staged in LDS (every thread updates its rows of A)
+        for(rocblas_int l0 = j + jb; l0 < n; l0 += nb)
+        {
+            rocblas_int lb = min(n - l0, nb);
+            for(int k = ty; k < lb * jb; k += bdy)
+            {
+                int r = k % lb;
+                int c = k / lb;
+                t[r + c * nb] = w[(l0 + r) + c * n];
+            }
+            __syncthreads();
+
+            for(int i = ty; i < n; i += bdy)
+            {
+                for(int c = 0; c < jb; c++)
+                {
+                    T s = a[i + (j + c) * lda];
+                    for(int l = 0; l < lb; l++)
+                        s -= a[i + (l0 + l) * lda] * t[l + c * nb];
+                    a[i + (j + c) * lda] = s;
+                }
+            }
+            __syncthreads();
+        }
+
+        // every thread computes its rows of X = A[:,j:j+jb-1] * inv(L22)
+        for(int i = ty; i < n; i += bdy)
+        {
+            for(int c = jb - 1; c >= 0; c--)
+            {
+                T s = a[i + (j + c) * lda];
+                for(int l = c + 1; l < jb; l++)
+                    s -= a[i + (j + l) * lda] * d[l + c * nb];
+                a[i + (j + c) * lda] = s;
+            }
+        }
+        __syncthreads();
+    }
+
+    // 3. apply the column interchanges (every thread swaps the entries of its rows)
+    if(pivot)
+    {
+        rocblas_int* p = load_ptr_batch<rocblas_int>(ipiv, b, shiftP, strideP);
+        for(int i = ty; i < n; i += bdy)
+        {
+            for(rocblas_int j = n - 2; j >= 0; --j)
+            {
+                rocblas_int jp = p[j] - 1;
+                if(jp != j)
+                    swap(a[i + j * lda], a[i + jp * lda]);
+            }
+        }
+    }
+}
+
 template <bool ISBATCHED>
 rocblas_int getri_get_blksize(const rocblas_int dim)
 {
     rocblas_int blk;
 
-    if(ISBATCHED)
+    if(ISBATCHED && get_wavesize() == 32)
+    {
+        rocblas_int size[] = {GETRI_BATCH_BLKSIZES_WAVE32};
+        rocblas_int intervals[] = {GETRI_BATCH_INTERVALS_WAVE32};
+        rocblas_int max = GETRI_BATCH_NUM_INTERVALS_WAVE32;
+        blk = size[get_index(intervals, max, dim)];
+    }
+    else if(ISBATCHED)
     {
         rocblas_int size[] = {GETRI_BATCH_BLKSIZES};
         rocblas_int intervals[] = {GETRI_BATCH_INTERVALS};
@@ -140,6 +365,34 @@ rocblas_int getri_get_blksize(const rocblas_int dim)
     return blk;
 }
 
+/** Returns the largest size for which the inverse is computed with the tiny-size kernel
+    on the current device (it depends on the wavefront size). **/
+template <bool ISBATCHED>
+rocblas_int getri_get_tiny_size()
+{
+    if(get_wavesize() == 32)
+        return ISBATCHED ? GETRI_BATCH_TINY_SIZE_WAVE32 : GETRI_TINY_SIZE_WAVE32;
+    else
+        return ISBATCHED ? GETRI_BATCH_TINY_SIZE : GETRI_TINY_SIZE;
+}
+
+/** Returns true if the Gauss-Jordan kernel should be used to compute the
+    inverse. A negative block size in the tables selects this kernel (with block
+    size -blk) for batched problems larger than the small-size kernels. **/
+template <bool ISBATCHED>
+bool getri_use_gj(const rocblas_int n, const rocblas_int blk)
+{
+    if(!ISBATCHED || blk >= 0 || n > GETRI_GJ_MAX_COLS)
+        return false;
+
+#ifdef OPTIMAL
+    if(n <= TRTRI_MAX_COLS)
+        return false;
+#endif
+
+    return true;
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_getri_getMemorySize(const rocblas_int n,
                                    const rocblas_int batch_count,
@@ -168,7 +421,7 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
 
 #ifdef OPTIMAL
     // if tiny size, no workspace needed
-    if((n <= GETRI_TINY_SIZE && !ISBATCHED) || (n <= GETRI_BATCH_TINY_SIZE && ISBATCHED))
+    if(n <= getri_get_tiny_size<ISBATCHED>())
     {
         *size_work1 = 0;
         *size_work2 = 0;
@@ -181,6 +434,22 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
     }
 #endif
 
+    // get block size
+    rocblas_int blk = getri_get_blksize<ISBATCHED>(n);
+
+    // if using the Gauss-Jordan kernel, only the panels of L need to be stored
+    if(getri_use_gj<ISBATCHED>(n, blk))
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_tmpcopy = sizeof(T) * n * (-blk) * batch_count;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
     bool opt1, opt2;
     size_t unused, w1a = 0, w1b = 0, w2a = 0, w2b = 0, w3a = 0, w3b = 0, w4a = 0, w4b = 0, t1, t2;
 
@@ -207,9 +476,7 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
     }
 #endif
 
-    // get block size
-    rocblas_int blk = getri_get_blksize<ISBATCHED>(n);
-    if(blk == 0)
+    if(blk <= 0)
         blk = n;
 
     // size of temporary array required for copies
@@ -304,13 +571,28 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
     static constexpr bool ISBATCHED = BATCHED || STRIDED;
 
 #ifdef OPTIMAL
-    if((n <= GETRI_TINY_SIZE && !ISBATCHED) || (n <= GETRI_BATCH_TINY_SIZE && ISBATCHED))
+    if(n <= getri_get_tiny_size<ISBATCHED>())
     {
         return getri_run_small<T>(handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,
                                   batch_count, true, pivot);
     }
 #endif
 
+    // get block size
+    rocblas_int blk = getri_get_blksize<ISBATCHED>(n);
+
+    // for batches of mid-size matrices, use the Gauss-Jordan kernel
+    if(getri_use_gj<ISBATCHED>(n, blk))
+    {
+        rocblas_int nb = -blk;
+        rocblas_int threads = min(((n - 1) / 64 + 1) * 64, BS1);
+        size_t lmemsize = sizeof(T) * 2 * nb * nb;
+        ROCSOLVER_LAUNCH_KERNEL(getri_gj_kernel<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1),
+                                lmemsize, stream, n, nb, A, shiftA, lda, strideA, ipiv, shiftP,
+                                strideP, info, tmpcopy, rocblas_stride(n) * nb, pivot);
+        return rocblas_status_success;
+    }
+
     // compute inverse of U (also check singularity and update info)
     rocsolver_trtri_template<BATCHED, STRIDED, T>(
         handle, rocblas_fill_upper, rocblas_diagonal_non_unit, n, A, shiftA, lda, strideA, info,
@@ -332,15 +614,15 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
     rocblas_int ldw = n;
     rocblas_stride strideW = n * n;
 
-    // get block size
-    rocblas_int blk = getri_get_blksize<ISBATCHED>(n);
-    if(blk == 0)
+    if(blk <= 0)
         blk = n;
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     T minone = -1;
     T one = 1;
@@ -373,7 +655,9 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
         ROCSOLVER_LAUNCH_KERNEL(getri_kernel_large2<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1),
                                 0, stream, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info);
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     return rocblas_status_success;
 }
@@ -30,6 +30,8 @@ rocblas_status rocsolver_getri_outofplace_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftP = 0;
@@ -51,12 +53,17 @@ rocblas_status rocsolver_getri_outofplace_batched_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
                                                       size_work4);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *work1, *work2, *work3, *work4;
     rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4);
 
     if(!mem)
         return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     work1 = mem[0];
     work2 = mem[1];
     work3 = mem[2];
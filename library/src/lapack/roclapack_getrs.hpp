@@ -10,6 +10,7 @@
 #pragma once
 
 #include "auxiliary/rocauxiliary_laswp.hpp"
+#include "lapack_host_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
@@ -69,9 +70,19 @@ void rocsolver_getrs_getMemorySize(rocblas_operation trans,
         return;
     }
 
-    // workspace required for calling TRSM
-    rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, trans, n, nrhs, batch_count, size_work1,
-                                     size_work2, size_work3, size_work4);
+    rocblas_int nb = rocsolver_trsm_invdiag_blksize<T>(n, nrhs, batch_count);
+    if(nb > 0)
+    {
+        // workspace required for the triangular solves with inverted diagonal blocks
+        rocsolver_trsm_invdiag_mem<BATCHED, T>(n, nrhs, nb, batch_count, size_work1, size_work2,
+                                               size_work3, size_work4);
+    }
+    else
+    {
+        // workspace required for calling TRSM
+        rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, trans, n, nrhs, batch_count,
+                                         size_work1, size_work2, size_work3, size_work4);
+    }
 
     // always allocate all required memory for TRSM optimal performance
     *optim_mem = true;
@@ -111,14 +122,48 @@ rocblas_status rocsolver_getrs_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // constants to use when calling rocblas functions
     T one = 1; // constant 1 in host
 
-    if(trans == rocblas_operation_none)
+    // for batches of small and medium-size problems, the triangular solves are
+    // executed as products with the inverted diagonal blocks of the factors
+    rocblas_int nb = rocsolver_trsm_invdiag_blksize<T>(n, nrhs, batch_count);
+    if(nb > 0)
+    {
+        if(trans == rocblas_operation_none && pivot)
+            rocsolver_laswp_template<T>(handle, nrhs, B, shiftB, ldb, strideB, 1, n, ipiv, 0,
+                                        strideP, 1, batch_count);
+
+        // the factor that is applied first is L if trans = none, and U otherwise
+        rocblas_fill uplo[2] = {rocblas_fill_lower, rocblas_fill_upper};
+        rocblas_diagonal diag[2] = {rocblas_diagonal_unit, rocblas_diagonal_non_unit};
+        if(trans != rocblas_operation_none)
+        {
+            std::swap(uplo[0], uplo[1]);
+            std::swap(diag[0], diag[1]);
+        }
+
+        for(int k = 0; k < 2; k++)
+        {
+            rocsolver_trsm_invdiag_inverse<BATCHED, !BATCHED, T>(
+                handle, uplo[k], diag[k], n, nb, A, shiftA, lda, strideA, batch_count, (T*)work3,
+                (T*)work1, (T**)work2, (T**)work4);
+            rocsolver_trsm_invdiag<BATCHED, !BATCHED, T>(
+                handle, uplo[k], trans, n, nrhs, nb, A, shiftA, lda, strideA, B, shiftB, ldb,
+                strideB, batch_count, (T*)work3, (T*)work1, (T**)work4);
+        }
+
+        if(trans != rocblas_operation_none && pivot)
+            rocsolver_laswp_template<T>(handle, nrhs, B, shiftB, ldb, strideB, 1, n, ipiv, 0,
+                                        strideP, -1, batch_count);
+    }
+    else if(trans == rocblas_operation_none)
     {
         // first apply row interchanges to the right hand sides
         if(pivot)
@@ -157,6 +202,8 @@ rocblas_status rocsolver_getrs_template(rocblas_handle handle,
                                         strideP, -1, batch_count);
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_orgqrt_ungqrt.hpp"
+
+template <typename T>
+rocblas_status rocsolver_orgqrt_ungqrt_impl(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int k,
+                                            const rocblas_int nb,
+                                            T* A,
+                                            const rocblas_int lda,
+                                            T* ipiv,
+                                            T* F,
+                                            const rocblas_int ldf)
+{
+    const char* name = (!is_complex<T> ? "orgqrt" : "ungqrt");
+    ROCSOLVER_ENTER_TOP(name, "-m", m, "-n", n, "-k", k, "--nb", nb, "--lda", lda, "--ldt", ldf);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_orgqrt_ungqrt_argCheck(handle, m, n, k, nb, lda, ldf, A, ipiv, F);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_stride strideF = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases)
+    size_t size_workArr;
+    // extra requirements for calling ORG2R/UNG2R and LARFB
+    size_t size_Abyx_tmptr;
+    rocsolver_orgqrt_ungqrt_getMemorySize<false, T>(m, n, k, nb, batch_count, &size_scalars,
+                                                    &size_Abyx_tmptr, &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_Abyx_tmptr,
+                                                      size_workArr);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *Abyx_tmptr, *workArr;
+    rocblas_device_malloc mem(handle, size_scalars, size_Abyx_tmptr, size_workArr);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    Abyx_tmptr = mem[1];
+    workArr = mem[2];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_orgqrt_ungqrt_template<false, false, T>(
+        handle, m, n, k, nb, A, shiftA, lda, strideA, ipiv, strideP, F, ldf, strideF, batch_count,
+        (T*)scalars, (T*)Abyx_tmptr, (T**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sorgqrt(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 const rocblas_int k,
+                                 const rocblas_int nb,
+                                 float* A,
+                                 const rocblas_int lda,
+                                 float* ipiv,
+                                 float* T,
+                                 const rocblas_int ldt)
+{
+    return rocsolver_orgqrt_ungqrt_impl<float>(handle, m, n, k, nb, A, lda, ipiv, T, ldt);
+}
+
+rocblas_status rocsolver_dorgqrt(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 const rocblas_int k,
+                                 const rocblas_int nb,
+                                 double* A,
+                                 const rocblas_int lda,
+                                 double* ipiv,
+                                 double* T,
+                                 const rocblas_int ldt)
+{
+    return rocsolver_orgqrt_ungqrt_impl<double>(handle, m, n, k, nb, A, lda, ipiv, T, ldt);
+}
+
+rocblas_status rocsolver_cungqrt(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 const rocblas_int k,
+                                 const rocblas_int nb,
+                                 rocblas_float_complex* A,
+                                 const rocblas_int lda,
+                                 rocblas_float_complex* ipiv,
+                                 rocblas_float_complex* T,
+                                 const rocblas_int ldt)
+{
+    return rocsolver_orgqrt_ungqrt_impl<rocblas_float_complex>(handle, m, n, k, nb, A, lda, ipiv,
+                                                               T, ldt);
+}
+
+rocblas_status rocsolver_zungqrt(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 const rocblas_int k,
+                                 const rocblas_int nb,
+                                 rocblas_double_complex* A,
+                                 const rocblas_int lda,
+                                 rocblas_double_complex* ipiv,
+                                 rocblas_double_complex* T,
+                                 const rocblas_int ldt)
+{
+    return rocsolver_orgqrt_ungqrt_impl<rocblas_double_complex>(handle, m, n, k, nb, A, lda, ipiv,
+                                                                T, ldt);
+}
+
+} // extern C
@@ -0,0 +1,120 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_larfb.hpp"
+#include "auxiliary/rocauxiliary_org2r_ung2r.hpp"
+#include "auxiliary/rocauxiliary_orgqr_ungqr.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+template <bool BATCHED, typename T>
+void rocsolver_orgqrt_ungqrt_getMemorySize(const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int k,
+                                           const rocblas_int nb,
+                                           const rocblas_int batch_count,
+                                           size_t* size_scalars,
+                                           size_t* size_Abyx_tmptr,
+                                           size_t* size_workArr)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_Abyx_tmptr = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    size_t temp, unused;
+
+    // requirements for calling ORG2R/UNG2R
+    rocsolver_org2r_ung2r_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars,
+                                                    size_Abyx_tmptr, size_workArr);
+
+    // requirements for calling LARFB
+    // (the triangular factors are given, so LARFT is not needed)
+    if(k > 0)
+    {
+        rocblas_int jb = min(nb, k);
+        rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, n - jb, jb, batch_count,
+                                                  &temp, &unused);
+        *size_Abyx_tmptr = max(*size_Abyx_tmptr, temp);
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_orgqrt_ungqrt_argCheck(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int k,
+                                                const rocblas_int nb,
+                                                const rocblas_int lda,
+                                                const rocblas_int ldt,
+                                                T A,
+                                                U ipiv,
+                                                U F)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || n > m || k < 0 || k > n || lda < m)
+        return rocblas_status_invalid_size;
+    if(nb < 1 || (k && nb > k) || ldt < nb)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((k && !ipiv) || (k && !F) || (m * n && !A))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_orgqrt_ungqrt_template(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int k,
+                                                const rocblas_int nb,
+                                                U A,
+                                                const rocblas_int shiftA,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                T* ipiv,
+                                                const rocblas_stride strideP,
+                                                T* F,
+                                                const rocblas_int ldf,
+                                                const rocblas_stride strideF,
+                                                const rocblas_int batch_count,
+                                                T* scalars,
+                                                T* Abyx_tmptr,
+                                                T** workArr)
+{
+    ROCSOLVER_ENTER("orgqrt_ungqrt", "m:", m, "n:", n, "k:", k, "nb:", nb, "shiftA:", shiftA,
+                    "lda:", lda, "ldt:", ldf, "bc:", batch_count);
+
+    // quick return
+    if(!n || !m || !batch_count)
+        return rocblas_status_success;
+
+    // generate Q using the stored triangular factors
+    // (no workspace for LARFT nor for the generated factors is required)
+    return rocsolver_orgqr_ungqr_template<BATCHED, STRIDED, T>(
+        handle, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars, (T*)nullptr,
+        Abyx_tmptr, (T*)nullptr, workArr, F, nb, ldf, strideF);
+}
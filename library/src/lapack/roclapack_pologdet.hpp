@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "roclapack_gelogdet.hpp"
+#include "rocsolver.h"
+
+/** POLOGDET_KERNEL computes the logarithm of the determinant of a Hermitian positive
+    definite matrix from its Cholesky factorization, i.e. twice the sum of the logarithms
+    of the diagonal elements of the triangular factor. Each thread-block reduces the
+    diagonal for one instance of the batch. If info is provided and info[bid] > 0 (the matrix
+    is not positive definite), the result is NaN. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(LOGDET_THDS) pologdet_kernel(const rocblas_int n,
+                                                                     U AA,
+                                                                     const rocblas_int shiftA,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideA,
+                                                                     S* logdet,
+                                                                     rocblas_int* info)
+{
+    const int bid = hipBlockIdx_y;
+    const int tid = hipThreadIdx_x;
+
+    if(info && info[bid] > 0)
+    {
+        if(tid == 0)
+            logdet[bid] = std::numeric_limits<S>::quiet_NaN();
+        return;
+    }
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+    // shared memory setup
+    __shared__ S ssum[LOGDET_THDS];
+
+    // the diagonal of the triangular factor is real and positive
+    S sum = 0;
+    for(rocblas_int i = tid; i < n; i += LOGDET_THDS)
+        sum += log(std::real(A[i + i * lda]));
+    ssum[tid] = sum;
+    __syncthreads();
+
+    // reduction
+    for(int r = LOGDET_THDS / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            ssum[tid] += ssum[tid + r];
+        __syncthreads();
+    }
+
+    // write results back to global memory
+    if(tid == 0)
+        logdet[bid] = 2 * ssum[0];
+}
+
+template <typename S, typename U>
+rocblas_status rocsolver_pologdet_argCheck(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           const rocblas_int lda,
+                                           U A,
+                                           S* logdet,
+                                           const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !logdet))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pologdet_template(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           U A,
+                                           const rocblas_int shiftA,
+                                           const rocblas_int lda,
+                                           const rocblas_stride strideA,
+                                           S* logdet,
+                                           rocblas_int* info,
+                                           const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("pologdet", "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return with the determinant of the empty matrix (= 1)
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, logdet,
+                                batch_count, S(0));
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL(pologdet_kernel<T>, dim3(1, batch_count, 1), dim3(LOGDET_THDS, 1, 1),
+                            0, stream, n, A, shiftA, lda, strideA, logdet, info);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pologdet.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pologdet_batched_impl(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               U A,
+                                               const rocblas_int lda,
+                                               S* logdet,
+                                               const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("pologdet_batched", "-n", n, "--lda", lda, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_pologdet_argCheck(handle, n, lda, A, logdet, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_pologdet_template<T>(handle, n, A, shiftA, lda, strideA, logdet,
+                                          (rocblas_int*)nullptr, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spologdet_batched(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           float* const A[],
+                                           const rocblas_int lda,
+                                           float* logdet,
+                                           const rocblas_int batch_count)
+{
+    return rocsolver_pologdet_batched_impl<float>(handle, n, A, lda, logdet, batch_count);
+}
+
+rocblas_status rocsolver_dpologdet_batched(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           double* const A[],
+                                           const rocblas_int lda,
+                                           double* logdet,
+                                           const rocblas_int batch_count)
+{
+    return rocsolver_pologdet_batched_impl<double>(handle, n, A, lda, logdet, batch_count);
+}
+
+rocblas_status rocsolver_cpologdet_batched(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           rocblas_float_complex* const A[],
+                                           const rocblas_int lda,
+                                           float* logdet,
+                                           const rocblas_int batch_count)
+{
+    return rocsolver_pologdet_batched_impl<rocblas_float_complex>(handle, n, A, lda, logdet,
+                                                                  batch_count);
+}
+
+rocblas_status rocsolver_zpologdet_batched(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           rocblas_double_complex* const A[],
+                                           const rocblas_int lda,
+                                           double* logdet,
+                                           const rocblas_int batch_count)
+{
+    return rocsolver_pologdet_batched_impl<rocblas_double_complex>(handle, n, A, lda, logdet,
+                                                                   batch_count);
+}
+
+} // extern C
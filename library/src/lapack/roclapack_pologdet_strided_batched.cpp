@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pologdet.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pologdet_strided_batched_impl(rocblas_handle handle,
+                                                       const rocblas_int n,
+                                                       U A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       S* logdet,
+                                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("pologdet_strided_batched", "-n", n, "--lda", lda, "--strideA", strideA,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_pologdet_argCheck(handle, n, lda, A, logdet, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_pologdet_template<T>(handle, n, A, shiftA, lda, strideA, logdet,
+                                          (rocblas_int*)nullptr, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spologdet_strided_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   float* A,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   float* logdet,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_pologdet_strided_batched_impl<float>(handle, n, A, lda, strideA, logdet,
+                                                          batch_count);
+}
+
+rocblas_status rocsolver_dpologdet_strided_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   double* A,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   double* logdet,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_pologdet_strided_batched_impl<double>(handle, n, A, lda, strideA, logdet,
+                                                           batch_count);
+}
+
+rocblas_status rocsolver_cpologdet_strided_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   rocblas_float_complex* A,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   float* logdet,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_pologdet_strided_batched_impl<rocblas_float_complex>(handle, n, A, lda,
+                                                                          strideA, logdet,
+                                                                          batch_count);
+}
+
+rocblas_status rocsolver_zpologdet_strided_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   rocblas_double_complex* A,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   double* logdet,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_pologdet_strided_batched_impl<rocblas_double_complex>(handle, n, A, lda,
+                                                                           strideA, logdet,
+                                                                           batch_count);
+}
+
+} // extern C
@@ -9,7 +9,7 @@
 
 #pragma once
 
-#include "auxiliary/rocauxiliary_lacgv.hpp"
+#include "lapack_host_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
@@ -167,9 +167,11 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
         return rocblas_status_success;
 
     // everything must be executed with scalars on the device
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // (TODO: When the matrix is detected to be non positive definite, we need to
     //  prevent GEMV and SCAL to modify further the input matrix; ideally with no
@@ -191,19 +193,11 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
             // Compute elements J+1:N of row J
             if(j < n - 1)
             {
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, j, A, shiftA + idx2D(0, j, lda), 1, strideA,
-                                                batch_count);
-
-                rocblasCall_gemv<T>(handle, rocblas_operation_transpose, j, n - j - 1, scalars, 0,
-                                    A, shiftA + idx2D(0, j + 1, lda), lda, strideA, A,
-                                    shiftA + idx2D(0, j, lda), 1, strideA, scalars + 2, 0, A,
-                                    shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count,
-                                    nullptr);
-
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, j, A, shiftA + idx2D(0, j, lda), 1, strideA,
-                                                batch_count);
+                rocsolver_gemv<T>(handle, rocblas_operation_transpose, COMPLEX, j, n - j - 1,
+                                  scalars, 0, A, shiftA + idx2D(0, j + 1, lda), lda, strideA, A,
+                                  shiftA + idx2D(0, j, lda), 1, strideA, scalars + 2, 0, A,
+                                  shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count,
+                                  nullptr);
 
                 rocblasCall_scal<T>(handle, n - j - 1, pivots, 1, A, shiftA + idx2D(j, j + 1, lda),
                                     lda, strideA, batch_count);
@@ -227,18 +221,10 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
             // Compute elements J+1:N of column J
             if(j < n - 1)
             {
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, j, A, shiftA + idx2D(j, 0, lda), lda,
-                                                strideA, batch_count);
-
-                rocblasCall_gemv<T>(handle, rocblas_operation_none, n - j - 1, j, scalars, 0, A,
-                                    shiftA + idx2D(j + 1, 0, lda), lda, strideA, A,
-                                    shiftA + idx2D(j, 0, lda), lda, strideA, scalars + 2, 0, A,
-                                    shiftA + idx2D(j + 1, j, lda), 1, strideA, batch_count, nullptr);
-
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, j, A, shiftA + idx2D(j, 0, lda), lda,
-                                                strideA, batch_count);
+                rocsolver_gemv<T>(handle, rocblas_operation_none, COMPLEX, n - j - 1, j, scalars,
+                                  0, A, shiftA + idx2D(j + 1, 0, lda), lda, strideA, A,
+                                  shiftA + idx2D(j, 0, lda), lda, strideA, scalars + 2, 0, A,
+                                  shiftA + idx2D(j + 1, j, lda), 1, strideA, batch_count, nullptr);
 
                 rocblasCall_scal<T>(handle, n - j - 1, pivots, 1, A, shiftA + idx2D(j + 1, j, lda),
                                     1, strideA, batch_count);
@@ -246,6 +232,8 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
         }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
@@ -129,9 +129,11 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
         return rocblas_status_success;
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the
     // algorithm
@@ -225,6 +227,8 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
                                 batch_count);
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
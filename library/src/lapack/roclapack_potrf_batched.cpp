@@ -26,6 +26,8 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -51,6 +53,8 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
                                                       size_work3, size_work4, size_pivots,
                                                       size_iinfo);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo;
     rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
@@ -59,6 +63,8 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work1 = mem[1];
     work2 = mem[2];
@@ -69,6 +75,8 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_potrf_template<true, T, S>(handle, uplo, n, A, shiftA, lda, strideA, info,
                                                 batch_count, (T*)scalars, work1, work2, work3,
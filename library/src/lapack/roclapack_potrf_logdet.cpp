@@ -0,0 +1,138 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_potrf_logdet.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_potrf_logdet_impl(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int n,
+                                           U A,
+                                           const rocblas_int lda,
+                                           S* logdet,
+                                           rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("potrf_logdet", "--uplo", uplo, "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_potrf_logdet_argCheck(handle, uplo, n, lda, A, logdet, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling POTF2
+    size_t size_pivots;
+    // size to store info about positiveness of each subblock
+    size_t size_iinfo;
+    rocsolver_potrf_getMemorySize<false, T>(n, uplo, batch_count, &size_scalars, &size_work1,
+                                            &size_work2, &size_work3, &size_work4, &size_pivots,
+                                            &size_iinfo, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivots,
+                                                      size_iinfo);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+                              size_pivots, size_iinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivots = mem[5];
+    iinfo = mem[6];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_potrf_logdet_template<false, T>(
+        handle, uplo, n, A, shiftA, lda, strideA, logdet, info, batch_count, (T*)scalars, work1,
+        work2, work3, work4, (T*)pivots, (rocblas_int*)iinfo, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spotrf_logdet(rocblas_handle handle,
+                                       const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       float* A,
+                                       const rocblas_int lda,
+                                       float* logdet,
+                                       rocblas_int* info)
+{
+    return rocsolver_potrf_logdet_impl<float>(handle, uplo, n, A, lda, logdet, info);
+}
+
+rocblas_status rocsolver_dpotrf_logdet(rocblas_handle handle,
+                                       const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       double* A,
+                                       const rocblas_int lda,
+                                       double* logdet,
+                                       rocblas_int* info)
+{
+    return rocsolver_potrf_logdet_impl<double>(handle, uplo, n, A, lda, logdet, info);
+}
+
+rocblas_status rocsolver_cpotrf_logdet(rocblas_handle handle,
+                                       const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       const rocblas_int lda,
+                                       float* logdet,
+                                       rocblas_int* info)
+{
+    return rocsolver_potrf_logdet_impl<rocblas_float_complex>(handle, uplo, n, A, lda, logdet,
+                                                              info);
+}
+
+rocblas_status rocsolver_zpotrf_logdet(rocblas_handle handle,
+                                       const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       const rocblas_int lda,
+                                       double* logdet,
+                                       rocblas_int* info)
+{
+    return rocsolver_potrf_logdet_impl<rocblas_double_complex>(handle, uplo, n, A, lda, logdet,
+                                                               info);
+}
+
+} // extern C
@@ -0,0 +1,78 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "roclapack_pologdet.hpp"
+#include "roclapack_potrf.hpp"
+#include "rocsolver.h"
+
+template <typename S, typename U>
+rocblas_status rocsolver_potrf_logdet_argCheck(rocblas_handle handle,
+                                               const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               const rocblas_int lda,
+                                               U A,
+                                               S* logdet,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !logdet) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, typename T, typename S, typename U>
+rocblas_status rocsolver_potrf_logdet_template(rocblas_handle handle,
+                                               const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               U A,
+                                               const rocblas_int shiftA,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               S* logdet,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count,
+                                               T* scalars,
+                                               void* work1,
+                                               void* work2,
+                                               void* work3,
+                                               void* work4,
+                                               T* pivots,
+                                               rocblas_int* iinfo,
+                                               bool optim_mem)
+{
+    ROCSOLVER_ENTER("potrf_logdet", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    // compute the Cholesky factorization
+    rocsolver_potrf_template<BATCHED, T, S>(handle, uplo, n, A, shiftA, lda, strideA, info,
+                                            batch_count, scalars, work1, work2, work3, work4,
+                                            pivots, iinfo, optim_mem);
+
+    // reduce the diagonal of the triangular factor in the epilogue
+    // (instances that are not positive definite, as reported by info, get NaN)
+    return rocsolver_pologdet_template<T>(handle, n, A, shiftA, lda, strideA, logdet, info,
+                                          batch_count);
+}
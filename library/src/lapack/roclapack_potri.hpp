@@ -4,14 +4,16 @@
  *     Univ. of Tennessee, Univ. of California Berkeley,
  *     Univ. of Colorado Denver and NAG Ltd..
  *     December 2016
- * Copyright (c) 2019-2021 Advanced Micro Devices, Inc.
+ * Copyright (c) 2019-2022 Advanced Micro Devices, Inc.
  * ***********************************************************************/
 
 #pragma once
 
+#include "rocauxiliary_lauum.hpp"
 #include "rocblas.hpp"
 #include "roclapack_trtri.hpp"
 #include "rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
 
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_potri_getMemorySize(const rocblas_int n,
@@ -37,12 +39,27 @@ void rocsolver_potri_getMemorySize(const rocblas_int n,
         return;
     }
 
+#ifdef OPTIMAL
+    // if very small size, the fused kernel needs no workspace
+    if(n <= POTRI_MAX_COLS)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_tmpcopy = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+#endif
+
     // requirements for calling TRTRI
     rocsolver_trtri_getMemorySize<BATCHED, STRIDED, T>(rocblas_diagonal_non_unit, n, batch_count,
                                                        size_work1, size_work2, size_work3, size_work4,
                                                        size_tmpcopy, size_workArr, optim_mem);
 
-    // required space to copy A
+    // required space to save the singular instances while calling LAUUM
     *size_tmpcopy = std::max(*size_tmpcopy, sizeof(T) * n * n * batch_count);
 }
 
@@ -113,36 +130,34 @@ rocblas_status rocsolver_potri_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+#ifdef OPTIMAL
+    // if very small size, use the fused kernel (TRTRI + LAUUM in a single launch)
+    if(n <= POTRI_MAX_COLS)
+    {
+        potri_run_small<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count);
+        return rocblas_status_success;
+    }
+#endif
+
     // compute inverse of U or L (also check singularity and update info)
     rocsolver_trtri_template<BATCHED, STRIDED, T>(handle, uplo, rocblas_diagonal_non_unit, n, A,
                                                   shiftA, lda, strideA, info, batch_count, work1,
                                                   work2, work3, work4, tmpcopy, workArr, optim_mem);
 
-    // everything must be executed with scalars on the host
-    rocblas_pointer_mode old_mode;
-    rocblas_get_pointer_mode(handle, &old_mode);
-    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
-
-    // constants in host memory
+    // save copy of A in cases where info is nonzero (TRTRI left them unchanged)
     const rocblas_int copyblocks = (n - 1) / 32 + 1;
-    T one = 1;
-
-    // copy elements of A to serve as B matrix for TRMM
     ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocks, copyblocks, batch_count), dim3(32, 32), 0,
                             stream, copymat_to_buffer, n, n, A, shiftA, lda, strideA, tmpcopy,
-                            no_mask{}, uplo);
+                            info_mask(info), uplo);
 
-    // compute inv(U) * inv(U)' or inv(L)' * inv(L) and store in tmpcopy
-    rocblas_side side = (uplo == rocblas_fill_upper ? rocblas_side_right : rocblas_side_left);
-    rocblasCall_trmm<BATCHED, STRIDED, T>(handle, side, uplo, rocblas_operation_conjugate_transpose,
-                                          rocblas_diagonal_non_unit, n, n, &one, 0, A, shiftA, lda,
-                                          strideA, tmpcopy, 0, n, n * n, batch_count, workArr);
+    // compute inv(U) * inv(U)' or inv(L)' * inv(L) in place
+    rocsolver_lauum_template<BATCHED, STRIDED, T>(handle, uplo, n, A, shiftA, lda, strideA,
+                                                  batch_count);
 
-    // copy elements of tmpcopy into A in cases where info is zero
+    // restore A in cases where info is nonzero
     ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocks, copyblocks, batch_count), dim3(32, 32), 0,
                             stream, copymat_from_buffer, n, n, A, shiftA, lda, strideA, tmpcopy,
-                            info_mask(info, info_mask::negate), uplo, rocblas_diagonal_non_unit);
+                            info_mask(info), uplo);
 
-    rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
 }
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "lapack_host_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
@@ -65,6 +66,17 @@ void rocsolver_potrs_getMemorySize(const rocblas_int n,
         return;
     }
 
+    rocblas_int nb = rocsolver_trsm_invdiag_blksize<T>(n, nrhs, batch_count);
+    if(nb > 0)
+    {
+        // workspace required for the triangular solves with inverted diagonal blocks
+        // (the same inverted blocks are used for both solves)
+        rocsolver_trsm_invdiag_mem<BATCHED, T>(n, nrhs, nb, batch_count, size_work1, size_work2,
+                                               size_work3, size_work4);
+        *optim_mem = true;
+        return;
+    }
+
     // workspace required for calling TRSM
     // call with both rocblas_operation_none and rocblas_operation_conjugate_transpose and take maximum memory
     size_t size_work1_temp1, size_work1_temp2, size_work2_temp1, size_work2_temp2, size_work3_temp1,
@@ -116,14 +128,37 @@ rocblas_status rocsolver_potrs_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // constants to use when calling rocblas functions
     T one = 1; // constant 1 in host
 
-    if(uplo == rocblas_fill_upper)
+    // for batches of small and medium-size problems, the triangular solves are
+    // executed as products with the inverted diagonal blocks of the factor
+    rocblas_int nb = rocsolver_trsm_invdiag_blksize<T>(n, nrhs, batch_count);
+    if(nb > 0)
+    {
+        rocsolver_trsm_invdiag_inverse<BATCHED, !BATCHED, T>(
+            handle, uplo, rocblas_diagonal_non_unit, n, nb, A, shiftA, lda, strideA, batch_count,
+            (T*)work3, (T*)work1, (T**)work2, (T**)work4);
+
+        // solve U'*X = B and then U*X = B, or L*X = B and then L'*X = B,
+        // reusing the inverted blocks
+        rocblas_operation trans[2]
+            = {rocblas_operation_conjugate_transpose, rocblas_operation_none};
+        if(uplo == rocblas_fill_lower)
+            std::swap(trans[0], trans[1]);
+
+        for(int k = 0; k < 2; k++)
+            rocsolver_trsm_invdiag<BATCHED, !BATCHED, T>(
+                handle, uplo, trans[k], n, nrhs, nb, A, shiftA, lda, strideA, B, shiftB, ldb,
+                strideB, batch_count, (T*)work3, (T*)work1, (T**)work4);
+    }
+    else if(uplo == rocblas_fill_upper)
     {
         // solve U'*X = B, overwriting B with X
         rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, uplo,
@@ -152,6 +187,8 @@ rocblas_status rocsolver_potrs_template(rocblas_handle handle,
                                      strideB, batch_count, optim_mem, work1, work2, work3, work4);
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
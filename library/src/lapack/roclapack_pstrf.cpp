@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pstrf.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pstrf_impl(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    rocblas_int* piv,
+                                    rocblas_int* rank,
+                                    const S tol,
+                                    rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("pstrf", "--uplo", uplo, "-n", n, "--lda", lda, "--tol", tol);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_pstrf_argCheck(handle, uplo, n, lda, A, piv, rank, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of the partial norms of the rows
+    size_t size_work;
+    // size to store the stopping tolerance and the current pivot value
+    size_t size_dvals;
+    // size to store the inverses of the pivots and the pivot indices
+    size_t size_pivots, size_pvtidx;
+    rocsolver_pstrf_getMemorySize<T, S>(n, batch_count, &size_scalars, &size_work, &size_dvals,
+                                        &size_pivots, &size_pvtidx);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_dvals,
+                                                      size_pivots, size_pvtidx);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work, *dvals, *pivots, *pvtidx;
+    rocblas_device_malloc mem(handle, size_scalars, size_work, size_dvals, size_pivots,
+                              size_pvtidx);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work = mem[1];
+    dvals = mem[2];
+    pivots = mem[3];
+    pvtidx = mem[4];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_pstrf_template<T>(handle, uplo, n, A, shiftA, lda, strideA, piv, strideP, rank,
+                                       tol, info, batch_count, (T*)scalars, (S*)work, (S*)dvals,
+                                       (T*)pivots, (rocblas_int*)pvtidx);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spstrf(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                rocblas_int* piv,
+                                rocblas_int* rank,
+                                const float tol,
+                                rocblas_int* info)
+{
+    return rocsolver_pstrf_impl<float>(handle, uplo, n, A, lda, piv, rank, tol, info);
+}
+
+rocblas_status rocsolver_dpstrf(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                rocblas_int* piv,
+                                rocblas_int* rank,
+                                const double tol,
+                                rocblas_int* info)
+{
+    return rocsolver_pstrf_impl<double>(handle, uplo, n, A, lda, piv, rank, tol, info);
+}
+
+rocblas_status rocsolver_cpstrf(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* piv,
+                                rocblas_int* rank,
+                                const float tol,
+                                rocblas_int* info)
+{
+    return rocsolver_pstrf_impl<rocblas_float_complex>(handle, uplo, n, A, lda, piv, rank, tol,
+                                                       info);
+}
+
+rocblas_status rocsolver_zpstrf(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* piv,
+                                rocblas_int* rank,
+                                const double tol,
+                                rocblas_int* info)
+{
+    return rocsolver_pstrf_impl<rocblas_double_complex>(handle, uplo, n, A, lda, piv, rank, tol,
+                                                        info);
+}
+
+} // extern C
@@ -0,0 +1,437 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.10.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     June 2021
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_host_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/** The kernels in this file work on the lower triangular part of the matrix; the upper
+    triangular case is handled by transposing the indices, as U = L' for a Hermitian matrix.
+    An instance of the batch is considered finished once its rank is smaller than n. **/
+__device__ __forceinline__ rocblas_int
+    pstrf_idx(const bool lower, const rocblas_int i, const rocblas_int j, const rocblas_int lda)
+{
+    return lower ? i + j * lda : j + i * lda;
+}
+
+/** PSTRF_BETTER returns true if the candidate pivot (val2, idx2) should replace (val1, idx1).
+    Invalid indices are negative, NaNs are propagated, and ties go to the smallest index. **/
+template <typename S>
+__device__ __forceinline__ bool
+    pstrf_better(const S val2, const rocblas_int idx2, const S val1, const rocblas_int idx1)
+{
+    if(idx2 < 0)
+        return false;
+    if(idx1 < 0)
+        return true;
+    if(val1 != val1)
+        return val2 != val2 && idx2 < idx1;
+    return val2 != val2 || val2 > val1 || (val2 == val1 && idx2 < idx1);
+}
+
+/** PSTRF_INIT_KERNEL sets the permutation to the identity, and initializes rank = n and
+    info = 0 **/
+ROCSOLVER_KERNEL void pstrf_init_kernel(const rocblas_int n,
+                                        rocblas_int* pivA,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* rank,
+                                        rocblas_int* info)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n)
+        pivA[bid * strideP + i] = i + 1;
+
+    if(i == 0)
+    {
+        rank[bid] = n;
+        info[bid] = 0;
+    }
+}
+
+/** PSTRF_PIVOT_KERNEL adds the contribution of column j-1 to the norms of the remaining rows
+    (if j is not the first column of the current block), and finds the largest element of the
+    updated diagonal A(j:n-1,j:n-1). If it is not larger than the stopping tolerance, the
+    factorization of the instance finishes with rank = j. Otherwise, the pivot index and value are
+    stored in pvtidx and dvals.
+    When j = 0, the stopping tolerance is also set as tol, or as n*eps times the largest diagonal
+    element if tol < 0. Launched with one thread-block of BS1 threads per instance. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) pstrf_pivot_kernel(const bool lower,
+                                                                const rocblas_int n,
+                                                                const rocblas_int j,
+                                                                const rocblas_int k,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                const S tol,
+                                                                const S eps,
+                                                                S* normsA,
+                                                                S* dvals,
+                                                                T* pivots,
+                                                                rocblas_int* pvtidx,
+                                                                rocblas_int* rank,
+                                                                rocblas_int* info)
+{
+    rocblas_int bid = hipBlockIdx_x;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // skip finished instances
+    if(rank[bid] < n)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* norms = normsA + bid * n;
+    S* dstop = dvals + 2 * bid;
+
+    __shared__ S sval[BS1];
+    __shared__ rocblas_int sidx[BS1];
+
+    // update norms and find the local maximum of the remaining diagonal
+    S val1 = 0, val2;
+    rocblas_int idx1 = -1;
+    for(rocblas_int i = j + tid; i < n; i += BS1)
+    {
+        if(j > k)
+        {
+            T a = A[pstrf_idx(lower, i, j - 1, lda)];
+            norms[i] += std::real(conj(a) * a);
+        }
+
+        val2 = std::real(A[pstrf_idx(lower, i, i, lda)]) - norms[i];
+        if(pstrf_better(val2, i, val1, idx1))
+        {
+            val1 = val2;
+            idx1 = i;
+        }
+    }
+    sval[tid] = val1;
+    sidx[tid] = idx1;
+    __syncthreads();
+
+    // reduction in shared memory
+    for(rocblas_int s = BS1 / 2; s > 0; s /= 2)
+    {
+        if(tid < s && pstrf_better(sval[tid + s], sidx[tid + s], sval[tid], sidx[tid]))
+        {
+            sval[tid] = sval[tid + s];
+            sidx[tid] = sidx[tid + s];
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        S ajj = sval[0];
+        rocblas_int pvt = sidx[0];
+
+        if(j == 0)
+            dstop[0] = (tol < 0) ? n * eps * ajj : tol;
+
+        if(ajj != ajj || ajj <= (j == 0 ? S(0) : dstop[0]))
+        {
+            // stop the factorization; the matrix is rank deficient or not semidefinite
+            if(j > 0)
+                A[pstrf_idx(lower, j, j, lda)] = ajj;
+            rank[bid] = j;
+            info[bid] = 1;
+            pivots[bid] = 1;
+        }
+        else
+        {
+            pvtidx[bid] = pvt;
+            dstop[1] = ajj;
+            pivots[bid] = T(S(1) / sqrt(ajj));
+        }
+    }
+}
+
+/** PSTRF_SWAP_KERNEL interchanges rows and columns j and pvtidx of the Hermitian matrix (only
+    the referenced triangular part), together with the corresponding norms and permutation entries,
+    and sets the new diagonal element A(j,j) = sqrt(ajj). Each thread i < n moves the elements
+    (j,i) or (i,j), and (pvt,i) or (i,pvt), so that no element is accessed by two threads. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void pstrf_swap_kernel(const bool lower,
+                                        const rocblas_int n,
+                                        const rocblas_int j,
+                                        U AA,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* pivA,
+                                        const rocblas_stride strideP,
+                                        S* normsA,
+                                        S* dvals,
+                                        rocblas_int* pvtidx,
+                                        rocblas_int* rank)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    // skip finished instances
+    if(i >= n || rank[bid] < n)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    rocblas_int p = pvtidx[bid];
+
+    if(i == j)
+    {
+        // diagonal elements, norms and permutation
+        if(p != j)
+        {
+            A[pstrf_idx(lower, p, p, lda)] = A[pstrf_idx(lower, j, j, lda)];
+            swap(normsA[bid * n + j], normsA[bid * n + p]);
+            swap(pivA[bid * strideP + j], pivA[bid * strideP + p]);
+        }
+        A[pstrf_idx(lower, j, j, lda)] = sqrt(dvals[2 * bid + 1]);
+    }
+
+    if(p == j)
+        return;
+
+    if(i < j)
+    {
+        // already factorized part of rows j and p
+        swap(A[pstrf_idx(lower, j, i, lda)], A[pstrf_idx(lower, p, i, lda)]);
+    }
+    else if(i > j && i < p)
+    {
+        // elements between j and p
+        T temp = conj(A[pstrf_idx(lower, i, j, lda)]);
+        A[pstrf_idx(lower, i, j, lda)] = conj(A[pstrf_idx(lower, p, i, lda)]);
+        A[pstrf_idx(lower, p, i, lda)] = temp;
+    }
+    else if(i == p)
+    {
+        // element (p,j) stays in place
+        A[pstrf_idx(lower, p, j, lda)] = conj(A[pstrf_idx(lower, p, j, lda)]);
+    }
+    else if(i > p)
+    {
+        // trailing part of columns j and p
+        swap(A[pstrf_idx(lower, i, j, lda)], A[pstrf_idx(lower, i, p, lda)]);
+    }
+}
+
+template <typename T, typename S>
+void rocsolver_pstrf_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work,
+                                   size_t* size_dvals,
+                                   size_t* size_pivots,
+                                   size_t* size_pvtidx)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work = 0;
+        *size_dvals = 0;
+        *size_pivots = 0;
+        *size_pvtidx = 0;
+        return;
+    }
+
+    // size of scalars (constants)
+    *size_scalars = sizeof(T) * 3;
+
+    // size of the partial norms of the rows of the current block
+    *size_work = sizeof(S) * n * batch_count;
+
+    // size to store the stopping tolerance and the current pivot value
+    *size_dvals = sizeof(S) * 2 * batch_count;
+
+    // size of array to store the inverses of the pivots
+    *size_pivots = sizeof(T) * batch_count;
+
+    // size of array to store the pivot indices
+    *size_pvtidx = sizeof(rocblas_int) * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_pstrf_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        rocblas_int* piv,
+                                        rocblas_int* rank,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !piv) || (batch_count && !rank) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U, bool COMPLEX = is_complex<T>>
+rocblas_status rocsolver_pstrf_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* piv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* rank,
+                                        const S tol,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        S* work,
+                                        S* dvals,
+                                        T* pivots,
+                                        rocblas_int* pvtidx)
+{
+    ROCSOLVER_ENTER("pstrf", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda, "tol:", tol,
+                    "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocksReset, 1, 1), dim3(BS1, 1, 1), 0, stream,
+                                rank, batch_count, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocksReset, 1, 1), dim3(BS1, 1, 1), 0, stream,
+                                info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the device
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    const bool lower = (uplo == rocblas_fill_lower);
+    const S eps = get_epsilon<S>();
+    S s_one = 1;
+    S s_minone = -1;
+
+    rocblas_int blocks = (n - 1) / BS1 + 1;
+    dim3 grid(blocks, batch_count, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // piv = identity, rank = n and info = 0
+    ROCSOLVER_LAUNCH_KERNEL(pstrf_init_kernel, grid, threads, 0, stream, n, piv, strideP, rank,
+                            info);
+
+    // (Instances that stop early keep being updated by GEMV, SCAL and SYRK/HERK; this only
+    //  modifies the columns beyond the computed rank, whose content is not referenced.)
+
+    rocblas_int nb = PSTRF_BLOCKSIZE;
+    for(rocblas_int k = 0; k < n; k += nb)
+    {
+        rocblas_int jb = min(n - k, nb);
+
+        // reset the partial norms of the rows for the current block
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3((n * batch_count - 1) / BS1 + 1, 1, 1), threads,
+                                0, stream, work, n * batch_count, 0);
+
+        for(rocblas_int j = k; j < k + jb; ++j)
+        {
+            // find pivot and test for rank deficiency
+            ROCSOLVER_LAUNCH_KERNEL((pstrf_pivot_kernel<T>), dim3(batch_count, 1, 1), threads, 0,
+                                    stream, lower, n, j, k, A, shiftA, lda, strideA, tol, eps, work,
+                                    dvals, pivots, pvtidx, rank, info);
+
+            // interchange rows and columns j and pvt
+            ROCSOLVER_LAUNCH_KERNEL((pstrf_swap_kernel<T>), grid, threads, 0, stream, lower, n, j,
+                                    A, shiftA, lda, strideA, piv, strideP, work, dvals, pvtidx,
+                                    rank);
+
+            if(j < n - 1)
+            {
+                if(lower)
+                {
+                    // compute elements j+1:n-1 of column j
+                    if(j > k)
+                        rocsolver_gemv<T>(handle, rocblas_operation_none, COMPLEX, n - j - 1, j - k,
+                                          scalars, 0, A, shiftA + idx2D(j + 1, k, lda), lda,
+                                          strideA, A, shiftA + idx2D(j, k, lda), lda, strideA,
+                                          scalars + 2, 0, A, shiftA + idx2D(j + 1, j, lda), 1,
+                                          strideA, batch_count, nullptr);
+
+                    rocblasCall_scal<T>(handle, n - j - 1, pivots, 1, A,
+                                        shiftA + idx2D(j + 1, j, lda), 1, strideA, batch_count);
+                }
+                else
+                {
+                    // compute elements j+1:n-1 of row j
+                    if(j > k)
+                        rocsolver_gemv<T>(handle, rocblas_operation_transpose, COMPLEX, j - k,
+                                          n - j - 1, scalars, 0, A, shiftA + idx2D(k, j + 1, lda),
+                                          lda, strideA, A, shiftA + idx2D(k, j, lda), 1, strideA,
+                                          scalars + 2, 0, A, shiftA + idx2D(j, j + 1, lda), lda,
+                                          strideA, batch_count, nullptr);
+
+                    rocblasCall_scal<T>(handle, n - j - 1, pivots, 1, A,
+                                        shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count);
+                }
+            }
+        }
+
+        // update trailing submatrix
+        rocblas_int j = k + jb;
+        if(j < n)
+        {
+            ROCSOLVER_BEGIN_PHASE(pointer_mode);
+            rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+            ROCSOLVER_BEGIN_PHASE(execution);
+            if(lower)
+                rocblasCall_syrk_herk<T>(handle, uplo, rocblas_operation_none, n - j, jb, &s_minone,
+                                         A, shiftA + idx2D(j, k, lda), lda, strideA, &s_one, A,
+                                         shiftA + idx2D(j, j, lda), lda, strideA, batch_count);
+            else
+                rocblasCall_syrk_herk<T>(handle, uplo, rocblas_operation_conjugate_transpose, n - j,
+                                         jb, &s_minone, A, shiftA + idx2D(k, j, lda), lda, strideA,
+                                         &s_one, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                         batch_count);
+            ROCSOLVER_BEGIN_PHASE(pointer_mode);
+            rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+            ROCSOLVER_BEGIN_PHASE(execution);
+        }
+    }
+
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    return rocblas_status_success;
+}
@@ -0,0 +1,154 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_steqr.hpp"
+#include "auxiliary/rocauxiliary_sterf.hpp"
+#include "rocblas.hpp"
+#include "roclapack_sbtrd_hbtrd.hpp"
+#include "rocsolver.h"
+
+/** Helper to calculate workspace sizes **/
+template <typename T, typename S>
+void rocsolver_sbev_hbev_getMemorySize(const rocblas_evect evect,
+                                       const rocblas_int n,
+                                       const rocblas_int kd,
+                                       const rocblas_int batch_count,
+                                       size_t* size_work_stack)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work_stack = 0;
+        return;
+    }
+
+    size_t w1 = 0, w2 = 0;
+
+    // requirements for tridiagonalization (sbtrd/hbtrd)
+    rocsolver_sbtrd_hbtrd_getMemorySize<T>(n, kd, batch_count, &w1);
+
+    if(evect == rocblas_evect_original)
+        // extra requirements for computing eigenvalues and vectors (steqr)
+        rocsolver_steqr_getMemorySize<T, S>(evect, n, batch_count, &w2);
+    else
+        // extra requirements for computing only the eigenvalues (sterf)
+        rocsolver_sterf_getMemorySize<S>(n, batch_count, &w2);
+
+    // get max values
+    *size_work_stack = std::max(w1, w2);
+}
+
+/** Argument checking **/
+template <typename T, typename S>
+rocblas_status rocsolver_sbev_hbev_argCheck(rocblas_handle handle,
+                                            const rocblas_evect evect,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            const rocblas_int kd,
+                                            T A,
+                                            const rocblas_int lda,
+                                            S* D,
+                                            S* E,
+                                            T Z,
+                                            const rocblas_int ldz,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if((evect != rocblas_evect_original && evect != rocblas_evect_none)
+       || (uplo != rocblas_fill_lower && uplo != rocblas_fill_upper))
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || kd < 0 || lda < kd + 1 || (evect == rocblas_evect_original && ldz < n)
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !D) || (n && !E) || (evect == rocblas_evect_original && n && !Z)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_sbev_hbev_template(rocblas_handle handle,
+                                            const rocblas_evect evect,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            const rocblas_int kd,
+                                            U A,
+                                            const rocblas_int shiftA,
+                                            const rocblas_int lda,
+                                            const rocblas_stride strideA,
+                                            S* D,
+                                            const rocblas_stride strideD,
+                                            S* E,
+                                            const rocblas_stride strideE,
+                                            U Z,
+                                            const rocblas_int shiftZ,
+                                            const rocblas_int ldz,
+                                            const rocblas_stride strideZ,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count,
+                                            void* work_stack)
+{
+    ROCSOLVER_ENTER("sbev_hbev", "evect:", evect, "uplo:", uplo, "n:", n, "kd:", kd, "shiftA:",
+                    shiftA, "lda:", lda, "shiftZ:", shiftZ, "ldz:", ldz, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info = 0
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    // reduce A to tridiagonal form directly in band storage; the orthogonal/unitary matrix of
+    // the reduction is accumulated in Z
+    rocblas_evect evect_trd
+        = (evect == rocblas_evect_original ? rocblas_evect_tridiagonal : rocblas_evect_none);
+    rocsolver_sbtrd_hbtrd_template<T>(handle, evect_trd, uplo, n, kd, A, shiftA, lda, strideA, D,
+                                      strideD, E, strideE, Z, shiftZ, ldz, strideZ, batch_count,
+                                      (T*)work_stack);
+
+    if(evect != rocblas_evect_original)
+    {
+        // only compute eigenvalues
+        rocsolver_sterf_template<S>(handle, n, D, 0, strideD, E, 0, strideE, info, batch_count,
+                                    (rocblas_int*)work_stack);
+    }
+    else
+    {
+        // compute eigenvalues and eigenvectors
+        rocsolver_steqr_template<T>(handle, evect, n, D, 0, strideD, E, 0, strideE, Z, shiftZ, ldz,
+                                    strideZ, info, batch_count, work_stack);
+    }
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sbev_hbev.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_sbev_hbev_batched_impl(rocblas_handle handle,
+                                                const rocblas_evect evect,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                const rocblas_int kd,
+                                                U A,
+                                                const rocblas_int lda,
+                                                S* D,
+                                                const rocblas_stride strideD,
+                                                S* E,
+                                                const rocblas_stride strideE,
+                                                U Z,
+                                                const rocblas_int ldz,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    const char* name = (!is_complex<T> ? "sbev_batched" : "hbev_batched");
+    ROCSOLVER_ENTER_TOP(name, "--evect", evect, "--uplo", uplo, "-n", n, "--kd", kd, "--lda", lda,
+                        "--strideD", strideD, "--strideE", strideE, "--ldz", ldz, "--batch_count",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_sbev_hbev_argCheck(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz, info,
+                                       batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftZ = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideZ = 0;
+
+    // memory workspace sizes:
+    // size of reusable workspace and stack
+    size_t size_work_stack;
+    rocsolver_sbev_hbev_getMemorySize<T, S>(evect, n, kd, batch_count, &size_work_stack);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work_stack);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void* work_stack;
+    rocblas_device_malloc mem(handle, size_work_stack);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    work_stack = mem[0];
+
+    // execution
+    return rocsolver_sbev_hbev_template<T>(handle, evect, uplo, n, kd, A, shiftA, lda, strideA, D,
+                                           strideD, E, strideE, Z, shiftZ, ldz, strideZ, info,
+                                           batch_count, work_stack);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_ssbev_batched(rocblas_handle handle,
+                                       const rocblas_evect evect,
+                                       const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       const rocblas_int kd,
+                                       float* const A[],
+                                       const rocblas_int lda,
+                                       float* D,
+                                       const rocblas_stride strideD,
+                                       float* E,
+                                       const rocblas_stride strideE,
+                                       float* const Z[],
+                                       const rocblas_int ldz,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count)
+{
+    return rocsolver_sbev_hbev_batched_impl<float>(handle, evect, uplo, n, kd, A, lda, D, strideD,
+                                                   E, strideE, Z, ldz, info, batch_count);
+}
+
+rocblas_status rocsolver_dsbev_batched(rocblas_handle handle,
+                                       const rocblas_evect evect,
+                                       const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       const rocblas_int kd,
+                                       double* const A[],
+                                       const rocblas_int lda,
+                                       double* D,
+                                       const rocblas_stride strideD,
+                                       double* E,
+                                       const rocblas_stride strideE,
+                                       double* const Z[],
+                                       const rocblas_int ldz,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count)
+{
+    return rocsolver_sbev_hbev_batched_impl<double>(handle, evect, uplo, n, kd, A, lda, D, strideD,
+                                                    E, strideE, Z, ldz, info, batch_count);
+}
+
+rocblas_status rocsolver_chbev_batched(rocblas_handle handle,
+                                       const rocblas_evect evect,
+                                       const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       const rocblas_int kd,
+                                       rocblas_float_complex* const A[],
+                                       const rocblas_int lda,
+                                       float* D,
+                                       const rocblas_stride strideD,
+                                       float* E,
+                                       const rocblas_stride strideE,
+                                       rocblas_float_complex* const Z[],
+                                       const rocblas_int ldz,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count)
+{
+    return rocsolver_sbev_hbev_batched_impl<rocblas_float_complex>(handle, evect, uplo, n, kd, A,
+                                                                   lda, D, strideD, E, strideE, Z,
+                                                                   ldz, info, batch_count);
+}
+
+rocblas_status rocsolver_zhbev_batched(rocblas_handle handle,
+                                       const rocblas_evect evect,
+                                       const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       const rocblas_int kd,
+                                       rocblas_double_complex* const A[],
+                                       const rocblas_int lda,
+                                       double* D,
+                                       const rocblas_stride strideD,
+                                       double* E,
+                                       const rocblas_stride strideE,
+                                       rocblas_double_complex* const Z[],
+                                       const rocblas_int ldz,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count)
+{
+    return rocsolver_sbev_hbev_batched_impl<rocblas_double_complex>(handle, evect, uplo, n, kd, A,
+                                                                    lda, D, strideD, E, strideE, Z,
+                                                                    ldz, info, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,158 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sbevd_hbevd.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_sbevd_hbevd_impl(rocblas_handle handle,
+                                          const rocblas_evect evect,
+                                          const rocblas_fill uplo,
+                                          const rocblas_int n,
+                                          const rocblas_int kd,
+                                          U A,
+                                          const rocblas_int lda,
+                                          S* D,
+                                          S* E,
+                                          U Z,
+                                          const rocblas_int ldz,
+                                          rocblas_int* info)
+{
+    const char* name = (!is_complex<T> ? "sbevd" : "hbevd");
+    ROCSOLVER_ENTER_TOP(name, "--evect", evect, "--uplo", uplo, "-n", n, "--kd", kd, "--lda", lda,
+                        "--ldz", ldz);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_sbev_hbev_argCheck(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftZ = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideD = 0;
+    rocblas_stride strideE = 0;
+    rocblas_stride strideZ = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of reusable workspace and stack
+    size_t size_work_stack;
+    // extra requirements for computing the eigenvectors with stedc
+    size_t size_tempvect, size_tempgemm;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_sbevd_hbevd_getMemorySize<false, T, S>(evect, n, kd, batch_count, &size_work_stack,
+                                                     &size_tempvect, &size_tempgemm, &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work_stack, size_tempvect,
+                                                      size_tempgemm, size_workArr);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *work_stack, *tempvect, *tempgemm, *workArr;
+    rocblas_device_malloc mem(handle, size_work_stack, size_tempvect, size_tempgemm, size_workArr);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    work_stack = mem[0];
+    tempvect = mem[1];
+    tempgemm = mem[2];
+    workArr = mem[3];
+
+    // execution
+    return rocsolver_sbevd_hbevd_template<false, false, T>(
+        handle, evect, uplo, n, kd, A, shiftA, lda, strideA, D, strideD, E, strideE, Z, shiftZ, ldz,
+        strideZ, info, batch_count, work_stack, (S*)tempvect, (S*)tempgemm, (S**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_ssbevd(rocblas_handle handle,
+                                const rocblas_evect evect,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                const rocblas_int kd,
+                                float* A,
+                                const rocblas_int lda,
+                                float* D,
+                                float* E,
+                                float* Z,
+                                const rocblas_int ldz,
+                                rocblas_int* info)
+{
+    return rocsolver_sbevd_hbevd_impl<float>(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz,
+                                             info);
+}
+
+rocblas_status rocsolver_dsbevd(rocblas_handle handle,
+                                const rocblas_evect evect,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                const rocblas_int kd,
+                                double* A,
+                                const rocblas_int lda,
+                                double* D,
+                                double* E,
+                                double* Z,
+                                const rocblas_int ldz,
+                                rocblas_int* info)
+{
+    return rocsolver_sbevd_hbevd_impl<double>(handle, evect, uplo, n, kd, A, lda, D, E, Z, ldz,
+                                              info);
+}
+
+rocblas_status rocsolver_chbevd(rocblas_handle handle,
+                                const rocblas_evect evect,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                const rocblas_int kd,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                float* D,
+                                float* E,
+                                rocblas_float_complex* Z,
+                                const rocblas_int ldz,
+                                rocblas_int* info)
+{
+    return rocsolver_sbevd_hbevd_impl<rocblas_float_complex>(handle, evect, uplo, n, kd, A, lda, D,
+                                                             E, Z, ldz, info);
+}
+
+rocblas_status rocsolver_zhbevd(rocblas_handle handle,
+                                const rocblas_evect evect,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                const rocblas_int kd,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                double* D,
+                                double* E,
+                                rocblas_double_complex* Z,
+                                const rocblas_int ldz,
+                                rocblas_int* info)
+{
+    return rocsolver_sbevd_hbevd_impl<rocblas_double_complex>(handle, evect, uplo, n, kd, A, lda, D,
+                                                              E, Z, ldz, info);
+}
+
+} // extern C
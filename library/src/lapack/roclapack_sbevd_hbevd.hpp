@@ -0,0 +1,112 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_stedc.hpp"
+#include "rocblas.hpp"
+#include "roclapack_sbev_hbev.hpp"
+#include "roclapack_sbtrd_hbtrd.hpp"
+#include "rocsolver.h"
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_sbevd_hbevd_getMemorySize(const rocblas_evect evect,
+                                         const rocblas_int n,
+                                         const rocblas_int kd,
+                                         const rocblas_int batch_count,
+                                         size_t* size_work_stack,
+                                         size_t* size_tempvect,
+                                         size_t* size_tempgemm,
+                                         size_t* size_workArr)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work_stack = 0;
+        *size_tempvect = 0;
+        *size_tempgemm = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    size_t w1 = 0, w2 = 0;
+
+    // requirements for tridiagonalization (sbtrd/hbtrd)
+    rocsolver_sbtrd_hbtrd_getMemorySize<T>(n, kd, batch_count, &w1);
+
+    // extra requirements for computing eigenvalues and vectors (stedc)
+    rocsolver_stedc_getMemorySize<BATCHED, T, S>(evect, n, batch_count, &w2, size_tempvect,
+                                                 size_tempgemm, size_workArr);
+
+    // get max values
+    *size_work_stack = std::max(w1, w2);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_sbevd_hbevd_template(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              const rocblas_int kd,
+                                              U A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              S* D,
+                                              const rocblas_stride strideD,
+                                              S* E,
+                                              const rocblas_stride strideE,
+                                              U Z,
+                                              const rocblas_int shiftZ,
+                                              const rocblas_int ldz,
+                                              const rocblas_stride strideZ,
+                                              rocblas_int* info,
+                                              const rocblas_int batch_count,
+                                              void* work_stack,
+                                              S* tempvect,
+                                              S* tempgemm,
+                                              S** workArr)
+{
+    ROCSOLVER_ENTER("sbevd_hbevd", "evect:", evect, "uplo:", uplo, "n:", n, "kd:", kd, "shiftA:",
+                    shiftA, "lda:", lda, "shiftZ:", shiftZ, "ldz:", ldz, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info = 0
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    // reduce A to tridiagonal form directly in band storage; the orthogonal/unitary matrix of
+    // the reduction is accumulated in Z
+    rocblas_evect evect_trd
+        = (evect == rocblas_evect_original ? rocblas_evect_tridiagonal : rocblas_evect_none);
+    rocsolver_sbtrd_hbtrd_template<T>(handle, evect_trd, uplo, n, kd, A, shiftA, lda, strideA, D,
+                                      strideD, E, strideE, Z, shiftZ, ldz, strideZ, batch_count,
+                                      (T*)work_stack);
+
+    // compute eigenvalues (and eigenvectors, updating Z) of the tridiagonal form
+    rocsolver_stedc_template<BATCHED, STRIDED, T>(handle, evect, n, D, 0, strideD, E, 0, strideE,
+                                                  Z, shiftZ, ldz, strideZ, info, batch_count,
+                                                  work_stack, tempvect, tempgemm, workArr);
+
+    return rocblas_status_success;
+}
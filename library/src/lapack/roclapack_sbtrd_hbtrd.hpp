@@ -0,0 +1,343 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+#define SBTRD_THDS 256
+
+/** SBTRD_SUM returns the sum of the values val provided by all the threads in the
+    thread-block. sval is a shared array of size SBTRD_THDS. **/
+template <typename S>
+__device__ S sbtrd_sum(S val, S* sval)
+{
+    const int tid = hipThreadIdx_x;
+
+    sval[tid] = val;
+    __syncthreads();
+
+    for(int r = SBTRD_THDS / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] += sval[tid + r];
+        __syncthreads();
+    }
+
+    S sum = sval[0];
+    __syncthreads();
+
+    return sum;
+}
+
+/** SBTRD_KERNEL reduces a Hermitian band matrix with kd super/sub-diagonals to real symmetric
+    tridiagonal form. Each thread-block works on one instance of the batch.
+
+    The band is copied into a lower band work array W with room for the bulges (W(i,j) is
+    stored in W[(i-j) + j*ldw], with ldw = 2*kb+1). Column s is annihilated with a Householder
+    reflector acting on rows s+1:s+kb, and the bulge that this creates below the band is chased
+    down the matrix by annihilating, one after the other, the first column of every new bulge.
+    The reflectors are applied to Q (from the right) as soon as they are generated, so that
+    A = Q*T*Q' when Q is initialized with the identity. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(SBTRD_THDS) sbtrd_kernel(const rocblas_evect evect,
+                                                                 const rocblas_fill uplo,
+                                                                 const rocblas_int n,
+                                                                 const rocblas_int kd,
+                                                                 U AA,
+                                                                 const rocblas_int shiftA,
+                                                                 const rocblas_int lda,
+                                                                 const rocblas_stride strideA,
+                                                                 S* DD,
+                                                                 const rocblas_stride strideD,
+                                                                 S* EE,
+                                                                 const rocblas_stride strideE,
+                                                                 U QQ,
+                                                                 const rocblas_int shiftQ,
+                                                                 const rocblas_int ldq,
+                                                                 const rocblas_stride strideQ,
+                                                                 T* WW)
+{
+    const int bid = hipBlockIdx_y;
+    const int tid = hipThreadIdx_x;
+
+    const rocblas_int kb = std::min(kd, n - 1);
+    const rocblas_int ldw = 2 * kb + 1;
+    const rocblas_stride strideW = rocblas_stride(ldw) * n + 2 * kb;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* Q = (evect != rocblas_evect_none ? load_ptr_batch<T>(QQ, bid, shiftQ, strideQ) : nullptr);
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+    T* W = WW + bid * strideW;
+    T* v = W + rocblas_stride(ldw) * n;
+    T* y = v + kb;
+
+    // shared memory setup
+    __shared__ S sval[SBTRD_THDS];
+
+    // copy the band into the lower band work array and zero the room for the bulges
+    for(rocblas_stride idx = tid; idx < rocblas_stride(ldw) * n; idx += SBTRD_THDS)
+    {
+        rocblas_int i = idx % ldw;
+        rocblas_int j = idx / ldw;
+        T a = 0;
+        if(i <= kb && j + i < n)
+        {
+            if(uplo == rocblas_fill_lower)
+                a = A[i + j * lda];
+            else
+                a = conj(A[(kd - i) + (j + i) * lda]);
+        }
+        W[idx] = (i == 0 ? T(std::real(a)) : a);
+    }
+
+    // initialize Q with the identity if the vectors of the tridiagonal form are required
+    if(evect == rocblas_evect_tridiagonal)
+    {
+        for(rocblas_stride idx = tid; idx < rocblas_stride(n) * n; idx += SBTRD_THDS)
+        {
+            rocblas_int i = idx % n;
+            rocblas_int j = idx / n;
+            Q[i + j * ldq] = (i == j ? T(1) : T(0));
+        }
+    }
+    __syncthreads();
+
+    // sweeps annihilating column s
+    for(rocblas_int s = 0; s < n - 1 && kb > 0; s++)
+    {
+        // the reflector of every step annihilates rows d+1:d+len-1 of column c
+        rocblas_int c = s;
+        rocblas_int d = s + 1;
+        rocblas_int len = std::min(kb, n - d);
+
+        while(len > 0)
+        {
+            T* x = W + (d - c) + c * ldw;
+
+            // generate the Householder reflector H = I - tau*v*v' such that H'*x = beta*e1
+            T alpha = x[0];
+            S xnorm2 = 0;
+            for(rocblas_int k = tid + 1; k < len; k += SBTRD_THDS)
+                xnorm2 += std::real(conj(x[k]) * x[k]);
+            xnorm2 = sbtrd_sum<S>(xnorm2, sval);
+
+            if(xnorm2 > 0 || alpha != T(std::real(alpha)))
+            {
+                S beta = sqrt(xnorm2 + std::real(conj(alpha) * alpha));
+                beta = std::real(alpha) >= 0 ? -beta : beta;
+                T tau = (T(beta) - alpha) / T(beta);
+                T scale = T(1) / (alpha - T(beta));
+                S tau2 = std::real(conj(tau) * tau);
+
+                // set v and overwrite x with beta*e1
+                for(rocblas_int k = tid; k < len; k += SBTRD_THDS)
+                {
+                    v[k] = (k == 0 ? T(1) : x[k] * scale);
+                    x[k] = (k == 0 ? T(beta) : T(0));
+                }
+                __syncthreads();
+
+                // apply H' from the left to the rest of the previous bulge
+                for(rocblas_int j = c + 1 + tid; j < d; j += SBTRD_THDS)
+                {
+                    T* col = W + (d - j) + j * ldw;
+                    T t = 0;
+                    for(rocblas_int k = 0; k < len; k++)
+                        t += conj(v[k]) * col[k];
+                    t *= conj(tau);
+                    for(rocblas_int k = 0; k < len; k++)
+                        col[k] -= t * v[k];
+                }
+
+                // apply H from the right to the rows below the block (this creates the new bulge)
+                rocblas_int iend = std::min(n, d + len + kb);
+                for(rocblas_int i = d + len + tid; i < iend; i += SBTRD_THDS)
+                {
+                    T t = 0;
+                    for(rocblas_int k = 0; k < len; k++)
+                        t += W[(i - d - k) + (d + k) * ldw] * v[k];
+                    t *= tau;
+                    for(rocblas_int k = 0; k < len; k++)
+                        W[(i - d - k) + (d + k) * ldw] -= t * conj(v[k]);
+                }
+
+                // apply H from the right to Q
+                if(evect != rocblas_evect_none)
+                {
+                    for(rocblas_int i = tid; i < n; i += SBTRD_THDS)
+                    {
+                        T t = 0;
+                        for(rocblas_int k = 0; k < len; k++)
+                            t += Q[i + (d + k) * ldq] * v[k];
+                        t *= tau;
+                        for(rocblas_int k = 0; k < len; k++)
+                            Q[i + (d + k) * ldq] -= t * conj(v[k]);
+                    }
+                }
+
+                // y = B*v, where B is the Hermitian diagonal block in rows and columns d:d+len-1
+                S vy = 0;
+                for(rocblas_int i = tid; i < len; i += SBTRD_THDS)
+                {
+                    T t = 0;
+                    for(rocblas_int k = 0; k < len; k++)
+                    {
+                        if(i >= k)
+                            t += W[(i - k) + (d + k) * ldw] * v[k];
+                        else
+                            t += conj(W[(k - i) + (d + i) * ldw]) * v[k];
+                    }
+                    y[i] = t;
+                    vy += std::real(conj(v[i]) * t);
+                }
+                vy = sbtrd_sum<S>(vy, sval);
+
+                // y = tau*y - 0.5*|tau|^2*(v'*B*v)*v
+                for(rocblas_int i = tid; i < len; i += SBTRD_THDS)
+                    y[i] = tau * y[i] - T(S(0.5) * tau2 * vy) * v[i];
+                __syncthreads();
+
+                // B = H'*B*H = B - y*v' - v*y' (lower triangular part)
+                for(rocblas_int idx = tid; idx < len * len; idx += SBTRD_THDS)
+                {
+                    rocblas_int i = idx % len;
+                    rocblas_int k = idx / len;
+                    if(i > k)
+                        W[(i - k) + (d + k) * ldw] -= y[i] * conj(v[k]) + v[i] * conj(y[k]);
+                    else if(i == k)
+                        W[(d + k) * ldw] -= T(2 * std::real(y[i] * conj(v[k])));
+                }
+                __syncthreads();
+            }
+
+            // move to the new bulge
+            c = d;
+            d += len;
+            len = std::min(kb, n - d);
+        }
+    }
+
+    // write the tridiagonal form back to D, E and the band of A
+    for(rocblas_int j = tid; j < n; j += SBTRD_THDS)
+    {
+        D[j] = std::real(W[j * ldw]);
+        if(j < n - 1)
+            E[j] = (kb > 0 ? std::real(W[1 + j * ldw]) : S(0));
+
+        for(rocblas_int i = 0; i <= kd && j + i < n; i++)
+        {
+            T a = (i == 0 ? T(D[j]) : (i == 1 ? T(E[j]) : T(0)));
+            if(uplo == rocblas_fill_lower)
+                A[i + j * lda] = a;
+            else
+                A[(kd - i) + (j + i) * lda] = a;
+        }
+    }
+}
+
+/** Helper to calculate workspace sizes **/
+template <typename T>
+void rocsolver_sbtrd_hbtrd_getMemorySize(const rocblas_int n,
+                                         const rocblas_int kd,
+                                         const rocblas_int batch_count,
+                                         size_t* size_work)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of the lower band work array with room for the bulges, and of the
+    // temporary vectors of the reflectors
+    rocblas_int kb = std::min(kd, n - 1);
+    *size_work = sizeof(T) * ((2 * kb + 1) * size_t(n) + 2 * kb) * batch_count;
+}
+
+/** Argument checking **/
+template <typename T, typename S>
+rocblas_status rocsolver_sbtrd_hbtrd_argCheck(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              const rocblas_int kd,
+                                              const rocblas_int lda,
+                                              const rocblas_int ldq,
+                                              T A,
+                                              S D,
+                                              S E,
+                                              T Q,
+                                              const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if((evect != rocblas_evect_original && evect != rocblas_evect_tridiagonal
+        && evect != rocblas_evect_none)
+       || (uplo != rocblas_fill_lower && uplo != rocblas_fill_upper))
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || kd < 0 || lda < kd + 1 || (evect != rocblas_evect_none && ldq < n)
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !D) || (n && !E) || (evect != rocblas_evect_none && n && !Q))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_sbtrd_hbtrd_template(rocblas_handle handle,
+                                              const rocblas_evect evect,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              const rocblas_int kd,
+                                              U A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              S* D,
+                                              const rocblas_stride strideD,
+                                              S* E,
+                                              const rocblas_stride strideE,
+                                              U Q,
+                                              const rocblas_int shiftQ,
+                                              const rocblas_int ldq,
+                                              const rocblas_stride strideQ,
+                                              const rocblas_int batch_count,
+                                              T* work)
+{
+    ROCSOLVER_ENTER("sbtrd_hbtrd", "evect:", evect, "uplo:", uplo, "n:", n, "kd:", kd, "shiftA:",
+                    shiftA, "lda:", lda, "shiftQ:", shiftQ, "ldq:", ldq, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL(sbtrd_kernel<T>, dim3(1, batch_count, 1), dim3(SBTRD_THDS, 1, 1), 0,
+                            stream, evect, uplo, n, kd, A, shiftA, lda, strideA, D, strideD, E,
+                            strideE, Q, shiftQ, ldq, strideQ, work);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sbtrd_hbtrd.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_sbtrd_hbtrd_strided_batched_impl(rocblas_handle handle,
+                                                          const rocblas_evect evect,
+                                                          const rocblas_fill uplo,
+                                                          const rocblas_int n,
+                                                          const rocblas_int kd,
+                                                          U A,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          S* D,
+                                                          const rocblas_stride strideD,
+                                                          S* E,
+                                                          const rocblas_stride strideE,
+                                                          U Q,
+                                                          const rocblas_int ldq,
+                                                          const rocblas_stride strideQ,
+                                                          const rocblas_int batch_count)
+{
+    const char* name = (!is_complex<T> ? "sbtrd_strided_batched" : "hbtrd_strided_batched");
+    ROCSOLVER_ENTER_TOP(name, "--evect", evect, "--uplo", uplo, "-n", n, "--kd", kd, "--lda", lda,
+                        "--strideA", strideA, "--strideD", strideD, "--strideE", strideE, "--ldq",
+                        ldq, "--strideQ", strideQ, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_sbtrd_hbtrd_argCheck(handle, evect, uplo, n, kd, lda, ldq, A, D, E, Q,
+                                         batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftQ = 0;
+
+    // memory workspace sizes:
+    // size of the band work array and the temporary vectors
+    size_t size_work;
+    rocsolver_sbtrd_hbtrd_getMemorySize<T>(n, kd, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void* work;
+    rocblas_device_malloc mem(handle, size_work);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_sbtrd_hbtrd_template<T>(handle, evect, uplo, n, kd, A, shiftA, lda, strideA, D,
+                                             strideD, E, strideE, Q, shiftQ, ldq, strideQ,
+                                             batch_count, (T*)work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_ssbtrd_strided_batched(rocblas_handle handle,
+                                                const rocblas_evect evect,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                const rocblas_int kd,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* D,
+                                                const rocblas_stride strideD,
+                                                float* E,
+                                                const rocblas_stride strideE,
+                                                float* Q,
+                                                const rocblas_int ldq,
+                                                const rocblas_stride strideQ,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_sbtrd_hbtrd_strided_batched_impl<float>(handle, evect, uplo, n, kd, A, lda,
+                                                             strideA, D, strideD, E, strideE, Q,
+                                                             ldq, strideQ, batch_count);
+}
+
+rocblas_status rocsolver_dsbtrd_strided_batched(rocblas_handle handle,
+                                                const rocblas_evect evect,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                const rocblas_int kd,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* D,
+                                                const rocblas_stride strideD,
+                                                double* E,
+                                                const rocblas_stride strideE,
+                                                double* Q,
+                                                const rocblas_int ldq,
+                                                const rocblas_stride strideQ,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_sbtrd_hbtrd_strided_batched_impl<double>(handle, evect, uplo, n, kd, A, lda,
+                                                              strideA, D, strideD, E, strideE, Q,
+                                                              ldq, strideQ, batch_count);
+}
+
+rocblas_status rocsolver_chbtrd_strided_batched(rocblas_handle handle,
+                                                const rocblas_evect evect,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                const rocblas_int kd,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* D,
+                                                const rocblas_stride strideD,
+                                                float* E,
+                                                const rocblas_stride strideE,
+                                                rocblas_float_complex* Q,
+                                                const rocblas_int ldq,
+                                                const rocblas_stride strideQ,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_sbtrd_hbtrd_strided_batched_impl<rocblas_float_complex>(handle, evect, uplo, n,
+                                                                             kd, A, lda, strideA, D,
+                                                                             strideD, E, strideE, Q,
+                                                                             ldq, strideQ,
+                                                                             batch_count);
+}
+
+rocblas_status rocsolver_zhbtrd_strided_batched(rocblas_handle handle,
+                                                const rocblas_evect evect,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                const rocblas_int kd,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* D,
+                                                const rocblas_stride strideD,
+                                                double* E,
+                                                const rocblas_stride strideE,
+                                                rocblas_double_complex* Q,
+                                                const rocblas_int ldq,
+                                                const rocblas_stride strideQ,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_sbtrd_hbtrd_strided_batched_impl<rocblas_double_complex>(handle, evect, uplo,
+                                                                              n, kd, A, lda,
+                                                                              strideA, D, strideD,
+                                                                              E, strideE, Q, ldq,
+                                                                              strideQ, batch_count);
+}
+
+} // extern C
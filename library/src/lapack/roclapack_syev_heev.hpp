@@ -10,6 +10,7 @@
 #pragma once
 
 #include "auxiliary/rocauxiliary_orgtr_ungtr.hpp"
+#include "auxiliary/rocauxiliary_ormtr_unmtr.hpp"
 #include "auxiliary/rocauxiliary_steqr.hpp"
 #include "auxiliary/rocauxiliary_sterf.hpp"
 #include "rocblas.hpp"
@@ -59,6 +60,34 @@ ROCSOLVER_KERNEL void scalar_case(const rocblas_evect evect,
     }
 }
 
+/** Returns true if the eigenvectors should be computed as a real matrix and back-transformed
+    with UNMTR, instead of applying the rotations of STEQR to the matrix generated by UNGTR **/
+template <typename T>
+inline bool syev_heev_use_backtransform(const rocblas_evect evect, const rocblas_int n)
+{
+    return is_complex<T> && evect == rocblas_evect_original && n >= HEEV_BACKTRANSFORM_SWITCHSIZE;
+}
+
+/** Copies the real n-by-n matrices in ZZ into the complex matrices in CC **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void syev_heev_copy_real(const rocblas_int n,
+                                          S* ZZ,
+                                          const rocblas_stride strideZ,
+                                          T* CC,
+                                          const rocblas_stride strideC)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < n)
+    {
+        S* Z = ZZ + b * strideZ;
+        T* C = CC + b * strideC;
+        C[i + j * n] = T(Z[i + j * n]);
+    }
+}
+
 /** Helper to calculate workspace sizes **/
 template <bool BATCHED, typename T, typename S>
 void rocsolver_syev_heev_getMemorySize(const rocblas_evect evect,
@@ -70,6 +99,7 @@ void rocsolver_syev_heev_getMemorySize(const rocblas_evect evect,
                                        size_t* size_Abyx_norms_tmptr,
                                        size_t* size_tmptau_trfact,
                                        size_t* size_tau,
+                                       size_t* size_workVec,
                                        size_t* size_workArr)
 {
     // if quick return, set workspace to zero
@@ -80,6 +110,7 @@ void rocsolver_syev_heev_getMemorySize(const rocblas_evect evect,
         *size_Abyx_norms_tmptr = 0;
         *size_tmptau_trfact = 0;
         *size_tau = 0;
+        *size_workVec = 0;
         *size_workArr = 0;
         return;
     }
@@ -93,7 +124,25 @@ void rocsolver_syev_heev_getMemorySize(const rocblas_evect evect,
     rocsolver_sytrd_hetrd_getMemorySize<BATCHED, T>(n, batch_count, size_scalars, &w1, &a1, &t1,
                                                     size_workArr);
 
-    if(evect == rocblas_evect_original)
+    *size_workVec = 0;
+
+    if(syev_heev_use_backtransform<T>(evect, n))
+    {
+        // extra requirements for computing the real eigenvectors of the tridiagonal form (steqr)
+        rocsolver_steqr_getMemorySize<S, S>(rocblas_evect_tridiagonal, n, batch_count, &w2);
+
+        // extra requirements for unmtr
+        size_t wa;
+        rocsolver_ormtr_unmtr_getMemorySize<BATCHED, T>(rocblas_side_left, uplo, n, n, batch_count,
+                                                        &unused, &a2, &w3, &t2, &wa);
+
+        // size of the real and complex copies of the eigenvectors
+        *size_workVec = (sizeof(S) + sizeof(T)) * n * n * batch_count;
+
+        // pointers to the complex copies are needed when A is batched
+        *size_workArr = std::max({*size_workArr, wa, BATCHED ? 2 * sizeof(T*) * batch_count : 0});
+    }
+    else if(evect == rocblas_evect_original)
     {
         // extra requirements for orgtr/ungtr
         rocsolver_orgtr_ungtr_getMemorySize<BATCHED, T>(uplo, n, batch_count, &unused, &w2, &a2,
@@ -172,6 +221,7 @@ rocblas_status rocsolver_syev_heev_template(rocblas_handle handle,
                                             T* Abyx_norms_tmptr,
                                             T* tmptau_trfact,
                                             T* tau,
+                                            T* workVec,
                                             T** workArr)
 {
     ROCSOLVER_ENTER("syev_heev", "evect:", evect, "uplo:", uplo, "n:", n, "shiftA:", shiftA,
@@ -214,6 +264,32 @@ rocblas_status rocsolver_syev_heev_template(rocblas_handle handle,
         rocsolver_sterf_template<S>(handle, n, D, 0, strideD, E, 0, strideE, info, batch_count,
                                     (rocblas_int*)work_stack);
     }
+    else if(syev_heev_use_backtransform<T>(evect, n))
+    {
+        /** The rotations of STEQR are applied to a real matrix Z, which is then
+            copied to complex C and multiplied by the unitary matrix of the
+            tridiagonalization. A keeps the Householder vectors until the end. **/
+        rocblas_int blocks = (n - 1) / 32 + 1;
+        rocblas_stride strideZ = n * n;
+        T* C = workVec;
+        S* Z = (S*)(workVec + strideZ * batch_count);
+
+        // compute eigenvalues and eigenvectors of the tridiagonal form
+        rocsolver_steqr_template<S>(handle, rocblas_evect_tridiagonal, n, D, 0, strideD, E, 0,
+                                    strideE, Z, 0, n, strideZ, info, batch_count, work_stack);
+
+        ROCSOLVER_LAUNCH_KERNEL((syev_heev_copy_real<T>), dim3(blocks, blocks, batch_count),
+                                dim3(32, 32), 0, stream, n, Z, strideZ, C, strideZ);
+
+        // back-transform eigenvectors
+        rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
+            handle, rocblas_side_left, uplo, rocblas_operation_none, n, n, A, shiftA, lda, strideA,
+            tau, n, C, 0, n, strideZ, batch_count, scalars, Abyx_norms_tmptr, (T*)work_stack,
+            tmptau_trfact, workArr);
+
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0,
+                                stream, copymat_from_buffer, n, n, A, shiftA, lda, strideA, C);
+    }
     else
     {
         // update orthogonal matrix
@@ -31,6 +31,8 @@ rocblas_status rocsolver_syev_heev_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -48,37 +50,48 @@ rocblas_status rocsolver_syev_heev_batched_impl(rocblas_handle handle,
     size_t size_workArr;
     // size for temporary householder scalars
     size_t size_tau;
+    // size of temporary copies of the eigenvectors when they are back-transformed
+    size_t size_workVec;
 
     rocsolver_syev_heev_getMemorySize<true, T, S>(evect, uplo, n, batch_count, &size_scalars,
                                                   &size_work_stack, &size_Abyx_norms_tmptr,
-                                                  &size_tmptau_trfact, &size_tau, &size_workArr);
+                                                  &size_tmptau_trfact, &size_tau, &size_workVec,
+                                                  &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_stack,
                                                       size_Abyx_norms_tmptr, size_tmptau_trfact,
-                                                      size_tau, size_workArr);
+                                                      size_tau, size_workVec, size_workArr);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
 
     // memory workspace allocation
-    void *scalars, *work_stack, *Abyx_norms_tmptr, *tmptau_trfact, *tau, *workArr;
+    void *scalars, *work_stack, *Abyx_norms_tmptr, *tmptau_trfact, *tau, *workVec, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_work_stack, size_Abyx_norms_tmptr,
-                              size_tmptau_trfact, size_tau, size_workArr);
+                              size_tmptau_trfact, size_tau, size_workVec, size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work_stack = mem[1];
     Abyx_norms_tmptr = mem[2];
     tmptau_trfact = mem[3];
     tau = mem[4];
-    workArr = mem[5];
+    workVec = mem[5];
+    workArr = mem[6];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_syev_heev_template<true, false, T>(
         handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE, info, batch_count,
-        (T*)scalars, work_stack, (T*)Abyx_norms_tmptr, (T*)tmptau_trfact, (T*)tau, (T**)workArr);
+        (T*)scalars, work_stack, (T*)Abyx_norms_tmptr, (T*)tmptau_trfact, (T*)tau, (T*)workVec,
+        (T**)workArr);
 }
 
 /*
@@ -33,6 +33,8 @@ rocblas_status rocsolver_syevd_heevd_strided_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -58,6 +60,8 @@ rocblas_status rocsolver_syevd_heevd_strided_batched_impl(rocblas_handle handle,
                                                       size_work3, size_tmptau_W, size_tau,
                                                       size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *tmptau_W, *tau, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3,
@@ -66,6 +70,8 @@ rocblas_status rocsolver_syevd_heevd_strided_batched_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work1 = mem[1];
     work2 = mem[2];
@@ -76,6 +82,8 @@ rocblas_status rocsolver_syevd_heevd_strided_batched_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_syevd_heevd_template<false, true, T>(
         handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE, info, batch_count,
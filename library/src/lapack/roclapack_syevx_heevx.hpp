@@ -134,86 +134,120 @@ rocblas_status rocsolver_syevx_heevx_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-/** Helper to calculate workspace sizes **/
+/** The workspace of SYEVX/HEEVX is organized in phases: the tridiagonalization
+    (SYTRD/HETRD), the computation of the eigenvalues (STEBZ), the computation of the
+    eigenvectors (STEIN) and the back-transformation (ORMTR/UNMTR). The tridiagonal
+    elements, Householder scalars and block indices persist across the phases that use
+    them; all the other buffers can share memory. **/
+struct rocsolver_syevx_heevx_workspace
+{
+    enum
+    {
+        tridiag,
+        eigvals,
+        eigvecs,
+        backtransf,
+        phases
+    };
+
+    workspace_planner plan;
+    int work1[phases];
+    int work2[phases];
+    int work3[phases];
+    int nsplit_workArr[phases];
+    int work4;
+    int work5;
+    int work6;
+    int D;
+    int E;
+    int iblock;
+    int isplit;
+    int tau;
+};
+
+/** Helper to compute the layout of the workspace of SYEVX/HEEVX **/
 template <bool BATCHED, typename T, typename S>
-void rocsolver_syevx_heevx_getMemorySize(const rocblas_evect evect,
+void rocsolver_syevx_heevx_planWorkspace(const rocblas_evect evect,
                                          const rocblas_fill uplo,
                                          const rocblas_int n,
                                          const rocblas_int batch_count,
                                          size_t* size_scalars,
-                                         size_t* size_work1,
-                                         size_t* size_work2,
-                                         size_t* size_work3,
-                                         size_t* size_work4,
-                                         size_t* size_work5,
-                                         size_t* size_work6,
-                                         size_t* size_D,
-                                         size_t* size_E,
-                                         size_t* size_iblock,
-                                         size_t* size_isplit,
-                                         size_t* size_tau,
-                                         size_t* size_nsplit_workArr)
+                                         rocsolver_syevx_heevx_workspace* ws)
 {
     // if quick return, set workspace to zero
     if(n == 0 || batch_count == 0)
     {
         *size_scalars = 0;
-        *size_work1 = 0;
-        *size_work2 = 0;
-        *size_work3 = 0;
-        *size_work4 = 0;
-        *size_work5 = 0;
-        *size_work6 = 0;
-        *size_D = 0;
-        *size_E = 0;
-        *size_iblock = 0;
-        *size_isplit = 0;
-        *size_tau = 0;
-        *size_nsplit_workArr = 0;
         return;
     }
 
+    constexpr int tridiag = rocsolver_syevx_heevx_workspace::tridiag;
+    constexpr int eigvals = rocsolver_syevx_heevx_workspace::eigvals;
+    constexpr int eigvecs = rocsolver_syevx_heevx_workspace::eigvecs;
+    constexpr int backtransf = rocsolver_syevx_heevx_workspace::backtransf;
+    constexpr int phases = rocsolver_syevx_heevx_workspace::phases;
+
     size_t unused;
-    size_t a1 = 0, a2 = 0, a3 = 0, a4 = 0;
-    size_t b1 = 0, b2 = 0, b3 = 0, b4 = 0;
-    size_t c1 = 0, c2 = 0, c3 = 0;
+    size_t w1[phases] = {}, w2[phases] = {}, w3[phases] = {}, w4[phases] = {};
+    size_t size_work4, size_work5, size_work6;
 
     // requirements for tridiagonalization (sytrd/hetrd)
-    rocsolver_sytrd_hetrd_getMemorySize<BATCHED, T>(n, batch_count, size_scalars, &a1, &b1, &c1,
-                                                    size_nsplit_workArr);
+    rocsolver_sytrd_hetrd_getMemorySize<BATCHED, T>(n, batch_count, size_scalars, &w1[tridiag],
+                                                    &w2[tridiag], &w3[tridiag], &w4[tridiag]);
 
-    // extra requirements for computing the eigenvalues (stebz)
-    rocsolver_stebz_getMemorySize<T>(n, batch_count, &a2, &b2, &c2, size_work4, size_work5,
-                                     size_work6);
+    // requirements for computing the eigenvalues (stebz)
+    rocsolver_stebz_getMemorySize<T>(n, batch_count, &w1[eigvals], &w2[eigvals], &w3[eigvals],
+                                     &size_work4, &size_work5, &size_work6);
+    // size of array for temporary split off block sizes
+    w4[eigvals] = sizeof(rocblas_int) * batch_count;
 
     if(evect == rocblas_evect_original)
     {
-        // extra requirements for ormtr/unmtr
-        rocsolver_ormtr_unmtr_getMemorySize<BATCHED, T>(rocblas_side_left, uplo, n, n, batch_count,
-                                                        &unused, &a3, &b3, &c3, &unused);
+        // requirements for computing the eigenvectors (stein)
+        rocsolver_stein_getMemorySize<T, S>(n, batch_count, &w1[eigvecs], &w2[eigvecs]);
 
-        // extra requirements for computing the eigenvectors (stein)
-        rocsolver_stein_getMemorySize<T, S>(n, batch_count, &a4, &b4);
+        // requirements for ormtr/unmtr
+        rocsolver_ormtr_unmtr_getMemorySize<BATCHED, T>(rocblas_side_left, uplo, n, n, batch_count,
+                                                        &unused, &w1[backtransf], &w2[backtransf],
+                                                        &w3[backtransf], &w4[backtransf]);
     }
 
-    // get max values
-    *size_work1 = std::max({a1, a2, a3, a4});
-    *size_work2 = std::max({b1, b2, b3, b4});
-    *size_work3 = std::max({c1, c2, c3});
+    for(int p = 0; p < phases; p++)
+    {
+        ws->work1[p] = ws->plan.add(w1[p], p);
+        ws->work2[p] = ws->plan.add(w2[p], p);
+        ws->work3[p] = ws->plan.add(w3[p], p);
+        ws->nsplit_workArr[p] = ws->plan.add(w4[p], p);
+    }
+    ws->work4 = ws->plan.add(size_work4, eigvals);
+    ws->work5 = ws->plan.add(size_work5, eigvals);
+    ws->work6 = ws->plan.add(size_work6, eigvals);
 
-    // size of arrays for temporary tridiagonal elements
-    *size_D = sizeof(S) * n * batch_count;
-    *size_E = sizeof(S) * n * batch_count;
+    // arrays for temporary tridiagonal elements
+    ws->D = ws->plan.add(sizeof(S) * n * batch_count, tridiag, eigvecs);
+    ws->E = ws->plan.add(sizeof(S) * n * batch_count, tridiag, eigvecs);
 
-    // size of arrays for temporary submatrix indices
-    *size_iblock = sizeof(rocblas_int) * n * batch_count;
-    *size_isplit = sizeof(rocblas_int) * n * batch_count;
+    // arrays for temporary submatrix indices
+    ws->iblock = ws->plan.add(sizeof(rocblas_int) * n * batch_count, eigvals, eigvecs);
+    ws->isplit = ws->plan.add(sizeof(rocblas_int) * n * batch_count, eigvals, eigvecs);
 
-    // size of array for temporary householder scalars
-    *size_tau = sizeof(T) * n * batch_count;
+    // array for temporary householder scalars
+    ws->tau = ws->plan.add(sizeof(T) * n * batch_count, tridiag, backtransf);
+}
 
-    // size of array for temporary split off block sizes
-    *size_nsplit_workArr = max(*size_nsplit_workArr, sizeof(rocblas_int) * batch_count);
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_syevx_heevx_getMemorySize(const rocblas_evect evect,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int n,
+                                         const rocblas_int batch_count,
+                                         size_t* size_scalars,
+                                         size_t* size_work)
+{
+    rocsolver_syevx_heevx_workspace ws;
+    rocsolver_syevx_heevx_planWorkspace<BATCHED, T, S>(evect, uplo, n, batch_count, size_scalars,
+                                                       &ws);
+    *size_work = ws.plan.size();
 }
 
 template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
@@ -243,18 +277,7 @@ rocblas_status rocsolver_syevx_heevx_template(rocblas_handle handle,
                                               rocblas_int* info,
                                               const rocblas_int batch_count,
                                               T* scalars,
-                                              void* work1,
-                                              void* work2,
-                                              void* work3,
-                                              void* work4,
-                                              void* work5,
-                                              void* work6,
-                                              S* D,
-                                              S* E,
-                                              rocblas_int* iblock,
-                                              rocblas_int* isplit,
-                                              T* tau,
-                                              void* nsplit_workArr)
+                                              void* work)
 {
     ROCSOLVER_ENTER("syevx_heevx", "evect:", evect, "erange:", erange, "uplo:", uplo, "n:", n,
                     "shiftA:", shiftA, "lda:", lda, "vl:", vl, "vu:", vu, "il:", il, "iu:", iu,
@@ -281,34 +304,66 @@ rocblas_status rocsolver_syevx_heevx_template(rocblas_handle handle,
 
     // TODO: Scale the matrix
 
+    // get the layout of the workspace
+    size_t size_scalars;
+    rocsolver_syevx_heevx_workspace ws;
+    rocsolver_syevx_heevx_planWorkspace<BATCHED, T, S>(evect, uplo, n, batch_count, &size_scalars,
+                                                       &ws);
+
+    constexpr int tridiag = rocsolver_syevx_heevx_workspace::tridiag;
+    constexpr int eigvals = rocsolver_syevx_heevx_workspace::eigvals;
+    constexpr int eigvecs = rocsolver_syevx_heevx_workspace::eigvecs;
+    constexpr int backtransf = rocsolver_syevx_heevx_workspace::backtransf;
+    constexpr int phases = rocsolver_syevx_heevx_workspace::phases;
+
+    void *work1[phases], *work2[phases], *work3[phases], *nsplit_workArr[phases];
+    for(int p = 0; p < phases; p++)
+    {
+        work1[p] = ws.plan.pointer<void*>(work, ws.work1[p]);
+        work2[p] = ws.plan.pointer<void*>(work, ws.work2[p]);
+        work3[p] = ws.plan.pointer<void*>(work, ws.work3[p]);
+        nsplit_workArr[p] = ws.plan.pointer<void*>(work, ws.nsplit_workArr[p]);
+    }
+    S* D = ws.plan.pointer<S*>(work, ws.D);
+    S* E = ws.plan.pointer<S*>(work, ws.E);
+    rocblas_int* iblock = ws.plan.pointer<rocblas_int*>(work, ws.iblock);
+    rocblas_int* isplit = ws.plan.pointer<rocblas_int*>(work, ws.isplit);
+    T* tau = ws.plan.pointer<T*>(work, ws.tau);
+
     const rocblas_stride stride = n;
 
     // reduce A to tridiagonal form
     rocsolver_sytrd_hetrd_template<BATCHED, T>(handle, uplo, n, A, shiftA, lda, strideA, D, stride,
                                                E, stride, tau, stride, batch_count, scalars,
-                                               (T*)work1, (T*)work2, (T*)work3, (T**)nsplit_workArr);
+                                               (T*)work1[tridiag], (T*)work2[tridiag],
+                                               (T*)work3[tridiag], (T**)nsplit_workArr[tridiag]);
 
     // compute eigenvalues
     rocblas_eorder eorder
         = (evect == rocblas_evect_none ? rocblas_eorder_entire : rocblas_eorder_blocks);
     rocsolver_stebz_template<S>(handle, erange, eorder, n, vl, vu, il, iu, abstol, D, 0, stride, E,
-                                0, stride, nev, (rocblas_int*)nsplit_workArr, W, strideW, iblock,
-                                stride, isplit, stride, info, batch_count, (rocblas_int*)work1,
-                                (S*)work2, (S*)work3, (S*)work4, (S*)work5, (rocblas_int*)work6);
+                                0, stride, nev, (rocblas_int*)nsplit_workArr[eigvals], W, strideW,
+                                iblock, stride, isplit, stride, info, batch_count,
+                                (rocblas_int*)work1[eigvals], (S*)work2[eigvals],
+                                (S*)work3[eigvals], ws.plan.pointer<S*>(work, ws.work4),
+                                ws.plan.pointer<S*>(work, ws.work5),
+                                ws.plan.pointer<rocblas_int*>(work, ws.work6));
 
     if(evect != rocblas_evect_none)
     {
         // compute eigenvectors
         rocsolver_stein_template<T>(handle, n, D, 0, stride, E, 0, stride, nev, W, 0, strideW,
                                     iblock, stride, isplit, stride, Z, shiftZ, ldz, strideZ, ifail,
-                                    strideF, info, batch_count, (S*)work1, (rocblas_int*)work2);
+                                    strideF, info, batch_count, (S*)work1[eigvecs],
+                                    (rocblas_int*)work2[eigvecs]);
 
         // apply unitary matrix to eigenvectors
         rocblas_int h_nev = (erange == rocblas_erange_index ? iu - il + 1 : n);
         rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
             handle, rocblas_side_left, uplo, rocblas_operation_none, n, h_nev, A, shiftA, lda,
-            strideA, tau, stride, Z, shiftZ, ldz, strideZ, batch_count, scalars, (T*)work1,
-            (T*)work2, (T*)work3, (T**)nsplit_workArr);
+            strideA, tau, stride, Z, shiftZ, ldz, strideZ, batch_count, scalars,
+            (T*)work1[backtransf], (T*)work2[backtransf], (T*)work3[backtransf],
+            (T**)nsplit_workArr[backtransf]);
 
         // sort eigenvalues and eigenvectors
         dim3 grid(1, batch_count, 1);
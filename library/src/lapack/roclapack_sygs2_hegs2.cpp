@@ -25,6 +25,8 @@ rocblas_status rocsolver_sygs2_hegs2_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftB = 0;
@@ -48,6 +50,8 @@ rocblas_status rocsolver_sygs2_hegs2_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work,
                                                       size_store_wcs, size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work, *store_wcs, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_work, size_store_wcs, size_workArr);
@@ -55,6 +59,8 @@ rocblas_status rocsolver_sygs2_hegs2_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work = mem[1];
     store_wcs = mem[2];
@@ -62,6 +68,8 @@ rocblas_status rocsolver_sygs2_hegs2_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_sygs2_hegs2_template<false, T>(handle, itype, uplo, n, A, shiftA, lda, strideA,
                                                     B, shiftB, ldb, strideB, batch_count,
@@ -99,6 +99,32 @@ ROCSOLVER_KERNEL void sygs2_set_diag3(const rocblas_int k,
     }
 }
 
+/** HEGS2_CONJ_COPY copies the conjugate of the n-vector x (with increment incx)
+    into the contiguous vector y, so that B is never written by HEGS2.
+
+    Call this kernel with 'batch_count' groups in z, and enough groups in y to
+    cover the n entries. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void hegs2_conj_copy(const rocblas_int n,
+                                      U XX,
+                                      const rocblas_int shiftX,
+                                      const rocblas_int incx,
+                                      const rocblas_stride strideX,
+                                      T* Y,
+                                      const rocblas_stride strideY)
+{
+    rocblas_int b = hipBlockIdx_z;
+    rocblas_int i = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < n)
+    {
+        T* x = load_ptr_batch<T>(XX, b, shiftX, strideX);
+        T* y = Y + b * strideY;
+
+        y[i] = conj(x[i * incx]);
+    }
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_sygs2_hegs2_getMemorySize(const rocblas_eform itype,
                                          const rocblas_int n,
@@ -141,6 +167,10 @@ void rocsolver_sygs2_hegs2_getMemorySize(const rocblas_eform itype,
         // extra workspace (for calling TRMV)
         *size_work = sizeof(T) * n * batch_count;
     }
+
+    // extra workspace to hold the conjugated rows of B (complex case)
+    if(is_complex<T>)
+        *size_work += sizeof(T) * n * batch_count;
 }
 
 template <typename T>
@@ -207,15 +237,21 @@ rocblas_status rocsolver_sygs2_hegs2_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // everything must be executed with scalars on the device
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     rocblas_int blocks_batch = (batch_count - 1) / BS1 + 1;
     rocblas_int waves_batch = (batch_count - 1) / warpSize + 1;
     dim3 blocks(blocks_batch, 1, 1);
     dim3 threads(min(BS1, warpSize * waves_batch), 1, 1);
 
+    // (complex case) conjugated rows of B are stored after the workspace for TRMV
+    rocblas_stride strideC = rocblas_stride(n);
+    T* conjB = (T*)work + (itype == rocblas_eform_ax ? 0 : n * batch_count);
+
     if(itype == rocblas_eform_ax)
     {
         rocblas_stride strideS = 3;
@@ -240,28 +276,48 @@ rocblas_status rocsolver_sygs2_hegs2_template(rocblas_handle handle,
                         rocsolver_lacgv_template<T>(handle, n - k - 1, A,
                                                     shiftA + idx2D(k, k + 1, lda), lda, strideA,
                                                     batch_count);
-                        rocsolver_lacgv_template<T>(handle, n - k - 1, B,
-                                                    shiftB + idx2D(k, k + 1, ldb), ldb, strideB,
-                                                    batch_count);
-                    }
 
-                    rocblasCall_axpy<T>(handle, n - k - 1, ((T*)store_wcs) + 1, strideS, B,
-                                        shiftB + idx2D(k, k + 1, ldb), ldb, strideB, A,
-                                        shiftA + idx2D(k, k + 1, lda), lda, strideA, batch_count);
+                        // use a conjugated copy of the row of B (B is never written)
+                        rocblas_int blocks = (n - k - 2) / BS1 + 1;
+                        ROCSOLVER_LAUNCH_KERNEL(hegs2_conj_copy<T>, dim3(1, blocks, batch_count),
+                                                dim3(1, BS1, 1), 0, stream, n - k - 1, B,
+                                                shiftB + idx2D(k, k + 1, ldb), ldb, strideB,
+                                                conjB, strideC);
 
-                    rocblasCall_syr2_her2<T>(
-                        handle, uplo, n - k - 1, scalars, A, shiftA + idx2D(k, k + 1, lda), lda,
-                        strideA, B, shiftB + idx2D(k, k + 1, ldb), ldb, strideB, A,
-                        shiftA + idx2D(k + 1, k + 1, lda), lda, strideA, batch_count, workArr);
+                        ROCSOLVER_LAUNCH_KERNEL(axpy_kernel<T>, dim3(batch_count, blocks, 1),
+                                                dim3(1, BS1, 1), 0, stream, n - k - 1,
+                                                ((T*)store_wcs) + 1, strideS, conjB, 0, 1, strideC,
+                                                A, shiftA + idx2D(k, k + 1, lda), lda, strideA);
 
-                    rocblasCall_axpy<T>(handle, n - k - 1, ((T*)store_wcs) + 1, strideS, B,
-                                        shiftB + idx2D(k, k + 1, ldb), ldb, strideB, A,
-                                        shiftA + idx2D(k, k + 1, lda), lda, strideA, batch_count);
-
-                    if(COMPLEX)
-                        rocsolver_lacgv_template<T>(handle, n - k - 1, B,
-                                                    shiftB + idx2D(k, k + 1, ldb), ldb, strideB,
-                                                    batch_count);
+                        rocblasCall_syr2_her2<T>(handle, uplo, n - k - 1, scalars, A,
+                                                 shiftA + idx2D(k, k + 1, lda), lda, strideA,
+                                                 conjB, 0, 1, strideC, A,
+                                                 shiftA + idx2D(k + 1, k + 1, lda), lda, strideA,
+                                                 batch_count, workArr);
+
+                        ROCSOLVER_LAUNCH_KERNEL(axpy_kernel<T>, dim3(batch_count, blocks, 1),
+                                                dim3(1, BS1, 1), 0, stream, n - k - 1,
+                                                ((T*)store_wcs) + 1, strideS, conjB, 0, 1, strideC,
+                                                A, shiftA + idx2D(k, k + 1, lda), lda, strideA);
+                    }
+                    else
+                    {
+                        rocblasCall_axpy<T>(handle, n - k - 1, ((T*)store_wcs) + 1, strideS, B,
+                                            shiftB + idx2D(k, k + 1, ldb), ldb, strideB, A,
+                                            shiftA + idx2D(k, k + 1, lda), lda, strideA,
+                                            batch_count);
+
+                        rocblasCall_syr2_her2<T>(handle, uplo, n - k - 1, scalars, A,
+                                                 shiftA + idx2D(k, k + 1, lda), lda, strideA, B,
+                                                 shiftB + idx2D(k, k + 1, ldb), ldb, strideB, A,
+                                                 shiftA + idx2D(k + 1, k + 1, lda), lda, strideA,
+                                                 batch_count, workArr);
+
+                        rocblasCall_axpy<T>(handle, n - k - 1, ((T*)store_wcs) + 1, strideS, B,
+                                            shiftB + idx2D(k, k + 1, ldb), ldb, strideB, A,
+                                            shiftA + idx2D(k, k + 1, lda), lda, strideA,
+                                            batch_count);
+                    }
 
                     rocblasCall_trsv<BATCHED, T>(handle, uplo, rocblas_operation_conjugate_transpose,
                                                  rocblas_diagonal_non_unit, n - k - 1, B,
@@ -372,24 +428,44 @@ rocblas_status rocsolver_sygs2_hegs2_template(rocblas_handle handle,
                                     batch_count);
 
                 if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, k, B, shiftB + idx2D(k, 0, ldb), ldb,
-                                                strideB, batch_count);
-
-                rocblasCall_axpy<T>(handle, k, ((T*)store_wcs) + 1, strideS, B,
-                                    shiftB + idx2D(k, 0, ldb), ldb, strideB, A,
-                                    shiftA + idx2D(k, 0, lda), lda, strideA, batch_count);
-
-                rocblasCall_syr2_her2<T>(handle, uplo, k, scalars + 2, A, shiftA + idx2D(k, 0, lda),
-                                         lda, strideA, B, shiftB + idx2D(k, 0, ldb), ldb, strideB,
-                                         A, shiftA, lda, strideA, batch_count, workArr);
-
-                rocblasCall_axpy<T>(handle, k, ((T*)store_wcs) + 1, strideS, B,
-                                    shiftB + idx2D(k, 0, ldb), ldb, strideB, A,
-                                    shiftA + idx2D(k, 0, lda), lda, strideA, batch_count);
-
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, k, B, shiftB + idx2D(k, 0, ldb), ldb,
-                                                strideB, batch_count);
+                {
+                    // use a conjugated copy of the row of B (B is never written)
+                    rocblas_int blocks = (k - 1) / BS1 + 1;
+                    ROCSOLVER_LAUNCH_KERNEL(hegs2_conj_copy<T>, dim3(1, blocks, batch_count),
+                                            dim3(1, BS1, 1), 0, stream, k, B,
+                                            shiftB + idx2D(k, 0, ldb), ldb, strideB, conjB,
+                                            strideC);
+
+                    ROCSOLVER_LAUNCH_KERNEL(axpy_kernel<T>, dim3(batch_count, blocks, 1),
+                                            dim3(1, BS1, 1), 0, stream, k, ((T*)store_wcs) + 1,
+                                            strideS, conjB, 0, 1, strideC, A,
+                                            shiftA + idx2D(k, 0, lda), lda, strideA);
+
+                    rocblasCall_syr2_her2<T>(handle, uplo, k, scalars + 2, A,
+                                             shiftA + idx2D(k, 0, lda), lda, strideA, conjB, 0, 1,
+                                             strideC, A, shiftA, lda, strideA, batch_count,
+                                             workArr);
+
+                    ROCSOLVER_LAUNCH_KERNEL(axpy_kernel<T>, dim3(batch_count, blocks, 1),
+                                            dim3(1, BS1, 1), 0, stream, k, ((T*)store_wcs) + 1,
+                                            strideS, conjB, 0, 1, strideC, A,
+                                            shiftA + idx2D(k, 0, lda), lda, strideA);
+                }
+                else
+                {
+                    rocblasCall_axpy<T>(handle, k, ((T*)store_wcs) + 1, strideS, B,
+                                        shiftB + idx2D(k, 0, ldb), ldb, strideB, A,
+                                        shiftA + idx2D(k, 0, lda), lda, strideA, batch_count);
+
+                    rocblasCall_syr2_her2<T>(handle, uplo, k, scalars + 2, A,
+                                             shiftA + idx2D(k, 0, lda), lda, strideA, B,
+                                             shiftB + idx2D(k, 0, ldb), ldb, strideB, A, shiftA,
+                                             lda, strideA, batch_count, workArr);
+
+                    rocblasCall_axpy<T>(handle, k, ((T*)store_wcs) + 1, strideS, B,
+                                        shiftB + idx2D(k, 0, ldb), ldb, strideB, A,
+                                        shiftA + idx2D(k, 0, lda), lda, strideA, batch_count);
+                }
 
                 rocblasCall_scal<T>(handle, k, (T*)store_wcs, strideS, A, shiftA + idx2D(k, 0, lda),
                                     lda, strideA, batch_count);
@@ -405,6 +481,8 @@ rocblas_status rocsolver_sygs2_hegs2_template(rocblas_handle handle,
         }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
@@ -13,6 +13,66 @@
 #include "roclapack_sygs2_hegs2.hpp"
 #include "rocsolver.h"
 
+/** Returns true if the reduction of the problem should be done by explicitly inverting the
+    triangular factor of B (TRTRI followed by two TRMM) instead of using the blocked algorithm **/
+inline bool sygst_use_inverse(const rocblas_eform itype, const rocblas_int n)
+{
+    return (itype == rocblas_eform_ax && n >= xxGST_INVERSE_SWITCHSIZE);
+}
+
+/** SYGST_SYMMETRIZE copies the conjugate of the triangular part of the n-by-n matrix A
+    given by uplo into the opposite triangular part, so that A is stored in full. The original
+    content of the opposite (non-referenced) triangular part is saved in the same positions of W,
+    which are not referenced by the triangular factor stored in W **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void sygst_symmetrize(const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       T* W,
+                                       const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const bool lower = (uplo == rocblas_fill_lower);
+
+    if(i < n && j < n && ((lower && i < j) || (!lower && i > j)))
+    {
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        T* Wp = W + b * strideW;
+        Wp[i + j * n] = Ap[i + j * lda];
+        Ap[i + j * lda] = conj(Ap[j + i * lda]);
+    }
+}
+
+/** SYGST_RESTORE copies back the non-referenced triangular part of A saved in W by
+    SYGST_SYMMETRIZE **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void sygst_restore(const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    T* W,
+                                    const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const bool lower = (uplo == rocblas_fill_lower);
+
+    if(i < n && j < n && ((lower && i < j) || (!lower && i > j)))
+    {
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        T* Wp = W + b * strideW;
+        Ap[i + j * lda] = Wp[i + j * n];
+    }
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_sygst_hegst_getMemorySize(const rocblas_fill uplo,
                                          const rocblas_eform itype,
@@ -37,7 +97,21 @@ void rocsolver_sygst_hegst_getMemorySize(const rocblas_fill uplo,
         return;
     }
 
-    if(n < xxGST_BLOCKSIZE)
+    if(sygst_use_inverse(itype, n))
+    {
+        // requirements for calling TRTRI out-of-place
+        rocblasCall_trtri_mem<BATCHED, T>(n, batch_count, size_work_x_temp, size_workArr_temp_arr);
+
+        // size of the inverse of the triangular factor
+        *size_store_wcs_invA = sizeof(T) * n * n * batch_count;
+
+        // size of the array of pointers to the inverse (batched cases)
+        *size_invA_arr = BATCHED ? sizeof(T*) * batch_count : 0;
+
+        *size_scalars = 0;
+        *optim_mem = true;
+    }
+    else if(n < xxGST_BLOCKSIZE)
     {
         // requirements for calling a single SYGS2/HEGS2
         rocsolver_sygs2_hegs2_getMemorySize<BATCHED, T>(itype, n, batch_count, size_scalars,
@@ -130,9 +204,11 @@ rocblas_status rocsolver_sygst_hegst_template(rocblas_handle handle,
             scalars, work_x_temp, store_wcs_invA, (T**)workArr_temp_arr);
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     S s_one = 1;
     T t_one = 1;
@@ -140,7 +216,56 @@ rocblas_status rocsolver_sygst_hegst_template(rocblas_handle handle,
     T t_minone = -1;
     T t_minhalf = -0.5;
 
-    if(itype == rocblas_eform_ax)
+    if(sygst_use_inverse(itype, n))
+    {
+        // Compute W = inv(U) or W = inv(L) out-of-place
+        T* W = (T*)store_wcs_invA;
+        rocblas_stride strideW = rocblas_stride(n) * n;
+
+        rocblasCall_trtri<BATCHED, STRIDED, T>(handle, uplo, rocblas_diagonal_non_unit, n, B,
+                                               shiftB, ldb, strideB, W, 0, n, strideW, batch_count,
+                                               (T*)work_x_temp, (T**)workArr_temp_arr,
+                                               (T**)invA_arr);
+
+        // store A in full so that it can be multiplied from both sides
+        // (the non-referenced triangular part of A is kept in the unused triangular part of W)
+        rocblas_int blocks = (n - 1) / 32 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(sygst_symmetrize<T>, dim3(blocks, blocks, batch_count),
+                                dim3(32, 32), 0, stream, uplo, n, A, shiftA, lda, strideA, W,
+                                strideW);
+
+        if(uplo == rocblas_fill_upper)
+        {
+            // Compute inv(U')*A*inv(U) as W'*(A*W)
+            rocblasCall_trmm<BATCHED, STRIDED, T>(
+                handle, rocblas_side_right, uplo, rocblas_operation_none,
+                rocblas_diagonal_non_unit, n, n, &t_one, 0, W, 0, n, strideW, A, shiftA, lda,
+                strideA, batch_count, (T**)invA_arr);
+
+            rocblasCall_trmm<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, uplo, rocblas_operation_conjugate_transpose,
+                rocblas_diagonal_non_unit, n, n, &t_one, 0, W, 0, n, strideW, A, shiftA, lda,
+                strideA, batch_count, (T**)invA_arr);
+        }
+        else
+        {
+            // Compute inv(L)*A*inv(L') as (W*A)*W'
+            rocblasCall_trmm<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, uplo, rocblas_operation_none, rocblas_diagonal_non_unit,
+                n, n, &t_one, 0, W, 0, n, strideW, A, shiftA, lda, strideA, batch_count,
+                (T**)invA_arr);
+
+            rocblasCall_trmm<BATCHED, STRIDED, T>(
+                handle, rocblas_side_right, uplo, rocblas_operation_conjugate_transpose,
+                rocblas_diagonal_non_unit, n, n, &t_one, 0, W, 0, n, strideW, A, shiftA, lda,
+                strideA, batch_count, (T**)invA_arr);
+        }
+
+        // restore the non-referenced triangular part of A
+        ROCSOLVER_LAUNCH_KERNEL(sygst_restore<T>, dim3(blocks, blocks, batch_count), dim3(32, 32),
+                                0, stream, uplo, n, A, shiftA, lda, strideA, W, strideW);
+    }
+    else if(itype == rocblas_eform_ax)
     {
         if(uplo == rocblas_fill_upper)
         {
@@ -321,6 +446,8 @@ rocblas_status rocsolver_sygst_hegst_template(rocblas_handle handle,
         }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
@@ -30,6 +30,8 @@ rocblas_status rocsolver_sygst_hegst_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftB = 0;
@@ -53,6 +55,8 @@ rocblas_status rocsolver_sygst_hegst_batched_impl(rocblas_handle handle,
                                                       size_workArr_temp_arr, size_store_wcs_invA,
                                                       size_invA_arr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work_x_temp, *workArr_temp_arr, *store_invA, *invA_arr;
     rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
@@ -61,6 +65,8 @@ rocblas_status rocsolver_sygst_hegst_batched_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work_x_temp = mem[1];
     workArr_temp_arr = mem[2];
@@ -69,6 +75,8 @@ rocblas_status rocsolver_sygst_hegst_batched_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_sygst_hegst_template<true, false, T, S>(
         handle, itype, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count,
@@ -40,6 +40,7 @@ void rocsolver_sygv_hegv_getMemorySize(const rocblas_eform itype,
                                        size_t* size_work2,
                                        size_t* size_work3,
                                        size_t* size_work4,
+                                       size_t* size_workVec,
                                        size_t* size_pivots_workArr,
                                        size_t* size_iinfo,
                                        bool* optim_mem)
@@ -52,6 +53,7 @@ void rocsolver_sygv_hegv_getMemorySize(const rocblas_eform itype,
         *size_work2 = 0;
         *size_work3 = 0;
         *size_work4 = 0;
+        *size_workVec = 0;
         *size_pivots_workArr = 0;
         *size_iinfo = 0;
         *optim_mem = true;
@@ -77,7 +79,7 @@ void rocsolver_sygv_hegv_getMemorySize(const rocblas_eform itype,
 
     // requirements for calling SYEV/HEEV
     rocsolver_syev_heev_getMemorySize<BATCHED, T, S>(evect, uplo, n, batch_count, &unused, &temp1,
-                                                     &temp2, &temp3, &temp4, &temp5);
+                                                     &temp2, &temp3, &temp4, size_workVec, &temp5);
     *size_work1 = max(*size_work1, temp1);
     *size_work2 = max(*size_work2, temp2);
     *size_work3 = max(*size_work3, temp3);
@@ -172,6 +174,7 @@ rocblas_status rocsolver_sygv_hegv_template(rocblas_handle handle,
                                             void* work2,
                                             void* work3,
                                             void* work4,
+                                            void* workVec,
                                             void* pivots_workArr,
                                             rocblas_int* iinfo,
                                             bool optim_mem)
@@ -199,9 +202,11 @@ rocblas_status rocsolver_sygv_hegv_template(rocblas_handle handle,
         return rocblas_status_success;
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // constants for rocblas functions calls
     T one = 1;
@@ -223,7 +228,7 @@ rocblas_status rocsolver_sygv_hegv_template(rocblas_handle handle,
 
     rocsolver_syev_heev_template<BATCHED, STRIDED, T>(
         handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE, iinfo, batch_count,
-        scalars, work1, (T*)work2, (T*)work3, (T*)work4, (T**)pivots_workArr);
+        scalars, work1, (T*)work2, (T*)work3, (T*)work4, (T*)workVec, (T**)pivots_workArr);
 
     // combine info from POTRF with info from SYEV/HEEV
     ROCSOLVER_LAUNCH_KERNEL(sygv_update_info, gridReset, threads, 0, stream, info, iinfo, n,
@@ -259,6 +264,8 @@ rocblas_status rocsolver_sygv_hegv_template(rocblas_handle handle,
         }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
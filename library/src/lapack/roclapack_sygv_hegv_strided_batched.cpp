@@ -37,6 +37,8 @@ rocblas_status rocsolver_sygv_hegv_strided_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftB = 0;
@@ -48,41 +50,48 @@ rocblas_status rocsolver_sygv_hegv_strided_batched_impl(rocblas_handle handle,
     bool optim_mem;
     size_t size_work1, size_work2, size_work3, size_work4;
     // extra requirements for calling POTRF and SYEV/HEEV
-    size_t size_pivots_workArr;
+    size_t size_workVec, size_pivots_workArr;
     // size of temporary info array
     size_t size_iinfo;
     rocsolver_sygv_hegv_getMemorySize<false, T, S>(
         itype, evect, uplo, n, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3,
-        &size_work4, &size_pivots_workArr, &size_iinfo, &optim_mem);
+        &size_work4, &size_workVec, &size_pivots_workArr, &size_iinfo, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
-                                                      size_work3, size_work4, size_pivots_workArr,
-                                                      size_iinfo);
+                                                      size_work3, size_work4, size_workVec,
+                                                      size_pivots_workArr, size_iinfo);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
 
     // memory workspace allocation
-    void *scalars, *work1, *work2, *work3, *work4, *pivots_workArr, *iinfo;
+    void *scalars, *work1, *work2, *work3, *work4, *workVec, *pivots_workArr, *iinfo;
     rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
-                              size_pivots_workArr, size_iinfo);
+                              size_workVec, size_pivots_workArr, size_iinfo);
 
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work1 = mem[1];
     work2 = mem[2];
     work3 = mem[3];
     work4 = mem[4];
-    pivots_workArr = mem[5];
-    iinfo = mem[6];
+    workVec = mem[5];
+    pivots_workArr = mem[6];
+    iinfo = mem[7];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_sygv_hegv_template<false, true, T>(
         handle, itype, evect, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, D, strideD,
-        E, strideE, info, batch_count, (T*)scalars, work1, work2, work3, work4, pivots_workArr,
-        (rocblas_int*)iinfo, optim_mem);
+        E, strideE, info, batch_count, (T*)scalars, work1, work2, work3, work4, workVec,
+        pivots_workArr, (rocblas_int*)iinfo, optim_mem);
 }
 
 /*
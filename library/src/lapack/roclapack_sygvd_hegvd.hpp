@@ -30,7 +30,8 @@ void rocsolver_sygvd_hegvd_getMemorySize(const rocblas_eform itype,
                                          size_t* size_tau,
                                          size_t* size_pivots_workArr,
                                          size_t* size_iinfo,
-                                         bool* optim_mem)
+                                         bool* optim_mem,
+                                         const bool factorize = true)
 {
     // if quick return no need of workspace
     if(n == 0 || batch_count == 0)
@@ -47,18 +48,33 @@ void rocsolver_sygvd_hegvd_getMemorySize(const rocblas_eform itype,
         return;
     }
 
-    bool opt1, opt2, opt3 = true;
+    bool opt1 = true, opt2, opt3 = true;
     size_t unused, temp1, temp2, temp3, temp4, temp5;
 
-    // requirements for calling POTRF
-    rocsolver_potrf_getMemorySize<BATCHED, T>(n, uplo, batch_count, size_scalars, size_work1,
-                                              size_work2, size_work3, size_work4,
-                                              size_pivots_workArr, size_iinfo, &opt1);
+    if(factorize)
+    {
+        // requirements for calling POTRF
+        rocsolver_potrf_getMemorySize<BATCHED, T>(n, uplo, batch_count, size_scalars, size_work1,
+                                                  size_work2, size_work3, size_work4,
+                                                  size_pivots_workArr, size_iinfo, &opt1);
+    }
+    else
+    {
+        // B already contains its Cholesky factor
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots_workArr = 0;
+        *size_iinfo = 0;
+    }
     *size_iinfo = max(*size_iinfo, sizeof(rocblas_int) * batch_count);
 
     // requirements for calling SYGST/HEGST
     rocsolver_sygst_hegst_getMemorySize<BATCHED, T>(uplo, itype, n, batch_count, &unused, &temp1,
                                                     &temp2, &temp3, &temp4, &opt2);
+    *size_scalars = max(*size_scalars, unused);
     *size_work1 = max(*size_work1, temp1);
     *size_work2 = max(*size_work2, temp2);
     *size_work3 = max(*size_work3, temp3);
@@ -67,6 +83,7 @@ void rocsolver_sygvd_hegvd_getMemorySize(const rocblas_eform itype,
     // requirements for calling SYEV/HEEV
     rocsolver_syevd_heevd_getMemorySize<BATCHED, T, S>(evect, uplo, n, batch_count, &unused, &temp1,
                                                        &temp2, &temp3, &temp4, size_tau, &temp5);
+    *size_scalars = max(*size_scalars, unused);
     *size_work1 = max(*size_work1, temp1);
     *size_work2 = max(*size_work2, temp2);
     *size_work3 = max(*size_work3, temp3);
@@ -124,7 +141,8 @@ rocblas_status rocsolver_sygvd_hegvd_template(rocblas_handle handle,
                                               T* tau,
                                               void* pivots_workArr,
                                               rocblas_int* iinfo,
-                                              bool optim_mem)
+                                              bool optim_mem,
+                                              const bool factorize = true)
 {
     ROCSOLVER_ENTER("sygvd_hegvd", "itype:", itype, "evect:", evect, "uplo:", uplo, "n:", n,
                     "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
@@ -149,17 +167,21 @@ rocblas_status rocsolver_sygvd_hegvd_template(rocblas_handle handle,
         return rocblas_status_success;
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // constants for rocblas functions calls
     T one = 1;
 
-    // perform Cholesky factorization of B
-    rocsolver_potrf_template<BATCHED, T, S>(handle, uplo, n, B, shiftB, ldb, strideB, info,
-                                            batch_count, scalars, work1, work2, work3, work4,
-                                            (T*)pivots_workArr, iinfo, optim_mem);
+    // perform Cholesky factorization of B (unless the factor was provided by the user;
+    // B is then only read, so it can be shared by all the problems in the batch)
+    if(factorize)
+        rocsolver_potrf_template<BATCHED, T, S>(handle, uplo, n, B, shiftB, ldb, strideB, info,
+                                                batch_count, scalars, work1, work2, work3, work4,
+                                                (T*)pivots_workArr, iinfo, optim_mem);
 
     /** (TODO: Strictly speaking, computations should stop here is B is not positive definite.
         A should not be modified in this case as no eigenvalues or eigenvectors can be computed.
@@ -203,6 +225,8 @@ rocblas_status rocsolver_sygvd_hegvd_template(rocblas_handle handle,
         }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
@@ -92,75 +92,80 @@ rocblas_status rocsolver_sygvx_hegvx_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
+/** The workspace of SYGVX/HEGVX is organized in phases: the Cholesky factorization of B
+    (POTRF), the reduction to standard form (SYGST/HEGST), the solution of the standard
+    eigenvalue problem (SYEVX/HEEVX) and the back-transformation of the eigenvectors
+    (TRSM/TRMM). Only the info returned by POTRF must persist until it is combined with
+    the info returned by SYEVX/HEEVX. **/
+struct rocsolver_sygvx_hegvx_workspace
+{
+    enum
+    {
+        cholesky,
+        reduction,
+        standard,
+        backtransf,
+        phases
+    };
+
+    workspace_planner plan;
+    int work1[phases];
+    int work2[phases];
+    int work3[phases];
+    int work4[phases];
+    int pivots_workArr[phases];
+    int iinfo;
+};
+
+/** Helper to compute the layout of the workspace of SYGVX/HEGVX **/
 template <bool BATCHED, typename T, typename S>
-void rocsolver_sygvx_hegvx_getMemorySize(const rocblas_eform itype,
+void rocsolver_sygvx_hegvx_planWorkspace(const rocblas_eform itype,
                                          const rocblas_evect evect,
                                          const rocblas_fill uplo,
                                          const rocblas_int n,
                                          const rocblas_int batch_count,
                                          size_t* size_scalars,
-                                         size_t* size_work1,
-                                         size_t* size_work2,
-                                         size_t* size_work3,
-                                         size_t* size_work4,
-                                         size_t* size_work5,
-                                         size_t* size_work6,
-                                         size_t* size_D,
-                                         size_t* size_E,
-                                         size_t* size_iblock,
-                                         size_t* size_isplit,
-                                         size_t* size_tau,
-                                         size_t* size_work7_workArr,
-                                         size_t* size_iinfo,
-                                         bool* optim_mem)
+                                         rocsolver_sygvx_hegvx_workspace* ws,
+                                         bool* optim_mem,
+                                         const bool factorize = true)
 {
     // if quick return no need of workspace
     if(n == 0 || batch_count == 0)
     {
         *size_scalars = 0;
-        *size_work1 = 0;
-        *size_work2 = 0;
-        *size_work3 = 0;
-        *size_work4 = 0;
-        *size_work5 = 0;
-        *size_work6 = 0;
-        *size_D = 0;
-        *size_E = 0;
-        *size_iblock = 0;
-        *size_isplit = 0;
-        *size_tau = 0;
-        *size_work7_workArr = 0;
-        *size_iinfo = 0;
         *optim_mem = true;
         return;
     }
 
-    bool opt1, opt2, opt3 = true;
-    size_t unused, temp1, temp2, temp3, temp4, temp5;
-
-    // requirements for calling POTRF
-    rocsolver_potrf_getMemorySize<BATCHED, T>(n, uplo, batch_count, size_scalars, size_work1,
-                                              size_work2, size_work3, size_work4,
-                                              size_work7_workArr, size_iinfo, &opt1);
-    *size_iinfo = max(*size_iinfo, sizeof(rocblas_int) * batch_count);
+    constexpr int cholesky = rocsolver_sygvx_hegvx_workspace::cholesky;
+    constexpr int reduction = rocsolver_sygvx_hegvx_workspace::reduction;
+    constexpr int standard = rocsolver_sygvx_hegvx_workspace::standard;
+    constexpr int backtransf = rocsolver_sygvx_hegvx_workspace::backtransf;
+    constexpr int phases = rocsolver_sygvx_hegvx_workspace::phases;
+
+    bool opt1 = true, opt2, opt3 = true;
+    size_t unused, size_iinfo = 0;
+    size_t w1[phases] = {}, w2[phases] = {}, w3[phases] = {}, w4[phases] = {}, w5[phases] = {};
+
+    // requirements for calling POTRF (if B already contains its Cholesky factor, the
+    // corresponding phase of the workspace is empty)
+    *size_scalars = 0;
+    if(factorize)
+        rocsolver_potrf_getMemorySize<BATCHED, T>(n, uplo, batch_count, size_scalars,
+                                                  &w1[cholesky], &w2[cholesky], &w3[cholesky],
+                                                  &w4[cholesky], &w5[cholesky], &size_iinfo, &opt1);
+    size_iinfo = max(size_iinfo, sizeof(rocblas_int) * batch_count);
 
     // requirements for calling SYGST/HEGST
-    rocsolver_sygst_hegst_getMemorySize<BATCHED, T>(uplo, itype, n, batch_count, &unused, &temp1,
-                                                    &temp2, &temp3, &temp4, &opt2);
-    *size_work1 = max(*size_work1, temp1);
-    *size_work2 = max(*size_work2, temp2);
-    *size_work3 = max(*size_work3, temp3);
-    *size_work4 = max(*size_work4, temp4);
-
-    // requirements for calling SYEVX/HEEVX
-    rocsolver_syevx_heevx_getMemorySize<BATCHED, T, S>(
-        evect, uplo, n, batch_count, &unused, &temp1, &temp2, &temp3, &temp4, size_work5,
-        size_work6, size_D, size_E, size_iblock, size_isplit, size_tau, &temp5);
-    *size_work1 = max(*size_work1, temp1);
-    *size_work2 = max(*size_work2, temp2);
-    *size_work3 = max(*size_work3, temp3);
-    *size_work4 = max(*size_work4, temp4);
-    *size_work7_workArr = max(*size_work7_workArr, temp5);
+    rocsolver_sygst_hegst_getMemorySize<BATCHED, T>(uplo, itype, n, batch_count, &unused,
+                                                    &w1[reduction], &w2[reduction], &w3[reduction],
+                                                    &w4[reduction], &opt2);
+    *size_scalars = max(*size_scalars, unused);
+
+    // requirements for calling SYEVX/HEEVX (its whole workspace is a single buffer)
+    rocsolver_syevx_heevx_getMemorySize<BATCHED, T, S>(evect, uplo, n, batch_count, &unused,
+                                                       &w1[standard]);
+    *size_scalars = max(*size_scalars, unused);
 
     if(evect == rocblas_evect_original)
     {
@@ -170,19 +175,49 @@ void rocsolver_sygvx_hegvx_getMemorySize(const rocblas_eform itype,
                 = (uplo == rocblas_fill_upper ? rocblas_operation_none
                                               : rocblas_operation_conjugate_transpose);
             // requirements for calling TRSM
-            rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, trans, n, n, batch_count, &temp1,
-                                             &temp2, &temp3, &temp4);
-            *size_work1 = max(*size_work1, temp1);
-            *size_work2 = max(*size_work2, temp2);
-            *size_work3 = max(*size_work3, temp3);
-            *size_work4 = max(*size_work4, temp4);
+            rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, trans, n, n, batch_count,
+                                             &w1[backtransf], &w2[backtransf], &w3[backtransf],
+                                             &w4[backtransf]);
 
             // always allocate all required memory for TRSM optimal performance
             opt3 = true;
         }
+        else
+        {
+            // requirements for calling TRMM
+            w5[backtransf] = BATCHED ? sizeof(T*) * batch_count : 0;
+        }
     }
 
     *optim_mem = opt1 && opt2 && opt3;
+
+    for(int p = 0; p < phases; p++)
+    {
+        ws->work1[p] = ws->plan.add(w1[p], p);
+        ws->work2[p] = ws->plan.add(w2[p], p);
+        ws->work3[p] = ws->plan.add(w3[p], p);
+        ws->work4[p] = ws->plan.add(w4[p], p);
+        ws->pivots_workArr[p] = ws->plan.add(w5[p], p);
+    }
+    ws->iinfo = ws->plan.add(size_iinfo, cholesky, standard);
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_sygvx_hegvx_getMemorySize(const rocblas_eform itype,
+                                         const rocblas_evect evect,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int n,
+                                         const rocblas_int batch_count,
+                                         size_t* size_scalars,
+                                         size_t* size_work,
+                                         bool* optim_mem,
+                                         const bool factorize = true)
+{
+    rocsolver_sygvx_hegvx_workspace ws;
+    rocsolver_sygvx_hegvx_planWorkspace<BATCHED, T, S>(itype, evect, uplo, n, batch_count,
+                                                       size_scalars, &ws, optim_mem, factorize);
+    *size_work = ws.plan.size();
 }
 
 template <bool BATCHED, bool STRIDED, typename T, typename S, typename U, bool COMPLEX = is_complex<T>>
@@ -217,20 +252,9 @@ rocblas_status rocsolver_sygvx_hegvx_template(rocblas_handle handle,
                                               rocblas_int* info,
                                               const rocblas_int batch_count,
                                               T* scalars,
-                                              void* work1,
-                                              void* work2,
-                                              void* work3,
-                                              void* work4,
-                                              void* work5,
-                                              void* work6,
-                                              S* D,
-                                              S* E,
-                                              rocblas_int* iblock,
-                                              rocblas_int* isplit,
-                                              T* tau,
-                                              void* work7_workArr,
-                                              rocblas_int* iinfo,
-                                              bool optim_mem)
+                                              void* work,
+                                              bool optim_mem,
+                                              const bool factorize = true)
 {
     ROCSOLVER_ENTER("sygvx_hegvx", "itype:", itype, "evect:", evect, "erange:", erange,
                     "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB,
@@ -259,17 +283,46 @@ rocblas_status rocsolver_sygvx_hegvx_template(rocblas_handle handle,
     }
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // constants for rocblas functions calls
     T one = 1;
 
-    // perform Cholesky factorization of B
-    rocsolver_potrf_template<BATCHED, T, S>(handle, uplo, n, B, shiftB, ldb, strideB, info,
-                                            batch_count, scalars, work1, work2, work3, work4,
-                                            (T*)work7_workArr, iinfo, optim_mem);
+    // get the layout of the workspace
+    size_t size_scalars;
+    bool unused;
+    rocsolver_sygvx_hegvx_workspace ws;
+    rocsolver_sygvx_hegvx_planWorkspace<BATCHED, T, S>(itype, evect, uplo, n, batch_count,
+                                                       &size_scalars, &ws, &unused, factorize);
+
+    constexpr int cholesky = rocsolver_sygvx_hegvx_workspace::cholesky;
+    constexpr int reduction = rocsolver_sygvx_hegvx_workspace::reduction;
+    constexpr int standard = rocsolver_sygvx_hegvx_workspace::standard;
+    constexpr int backtransf = rocsolver_sygvx_hegvx_workspace::backtransf;
+    constexpr int phases = rocsolver_sygvx_hegvx_workspace::phases;
+
+    void *work1[phases], *work2[phases], *work3[phases], *work4[phases], *pivots_workArr[phases];
+    for(int p = 0; p < phases; p++)
+    {
+        work1[p] = ws.plan.pointer<void*>(work, ws.work1[p]);
+        work2[p] = ws.plan.pointer<void*>(work, ws.work2[p]);
+        work3[p] = ws.plan.pointer<void*>(work, ws.work3[p]);
+        work4[p] = ws.plan.pointer<void*>(work, ws.work4[p]);
+        pivots_workArr[p] = ws.plan.pointer<void*>(work, ws.pivots_workArr[p]);
+    }
+    rocblas_int* iinfo = ws.plan.pointer<rocblas_int*>(work, ws.iinfo);
+
+    // perform Cholesky factorization of B (unless the factor was provided by the user;
+    // B is then only read, so it can be shared by all the problems in the batch)
+    if(factorize)
+        rocsolver_potrf_template<BATCHED, T, S>(handle, uplo, n, B, shiftB, ldb, strideB, info,
+                                                batch_count, scalars, work1[cholesky],
+                                                work2[cholesky], work3[cholesky], work4[cholesky],
+                                                (T*)pivots_workArr[cholesky], iinfo, optim_mem);
 
     /** (TODO: Strictly speaking, computations should stop here if B is not positive definite.
         A should not be modified in this case as no eigenvalues or eigenvectors can be computed.
@@ -279,12 +332,12 @@ rocblas_status rocsolver_sygvx_hegvx_template(rocblas_handle handle,
     // reduce to standard eigenvalue problem and solve
     rocsolver_sygst_hegst_template<BATCHED, STRIDED, T, S>(
         handle, itype, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count,
-        scalars, work1, work2, work3, work4, optim_mem);
+        scalars, work1[reduction], work2[reduction], work3[reduction], work4[reduction], optim_mem);
 
     rocsolver_syevx_heevx_template<BATCHED, STRIDED, T>(
         handle, evect, erange, uplo, n, A, shiftA, lda, strideA, vl, vu, il, iu, abstol, nev, W,
-        strideW, Z, shiftZ, ldz, strideZ, ifail, strideF, iinfo, batch_count, scalars, work1, work2,
-        work3, work4, work5, work6, D, E, iblock, isplit, tau, (T**)work7_workArr);
+        strideW, Z, shiftZ, ldz, strideZ, ifail, strideF, iinfo, batch_count, scalars,
+        work1[standard]);
 
     // combine info from POTRF with info from SYEVX/HEEVX
     ROCSOLVER_LAUNCH_KERNEL(sygvx_update_info, gridReset, threads, 0, stream, info, iinfo, nev, n,
@@ -306,7 +359,8 @@ rocblas_status rocsolver_sygvx_hegvx_template(rocblas_handle handle,
             rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, uplo, trans,
                                          rocblas_diagonal_non_unit, n, h_nev, &one, B, shiftB, ldb,
                                          strideB, Z, shiftZ, ldz, strideZ, batch_count, optim_mem,
-                                         work1, work2, work3, work4);
+                                         work1[backtransf], work2[backtransf], work3[backtransf],
+                                         work4[backtransf]);
         }
         else
         {
@@ -316,10 +370,12 @@ rocblas_status rocsolver_sygvx_hegvx_template(rocblas_handle handle,
             rocblasCall_trmm<BATCHED, STRIDED, T>(handle, rocblas_side_left, uplo, trans,
                                                   rocblas_diagonal_non_unit, n, h_nev, &one, 0, B,
                                                   shiftB, ldb, strideB, Z, shiftZ, ldz, strideZ,
-                                                  batch_count, (T**)work7_workArr);
+                                                  batch_count, (T**)pivots_workArr[backtransf]);
         }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
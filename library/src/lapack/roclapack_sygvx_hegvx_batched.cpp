@@ -46,6 +46,8 @@ rocblas_status rocsolver_sygvx_hegvx_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
     rocblas_int shiftB = 0;
@@ -59,58 +61,39 @@ rocblas_status rocsolver_sygvx_hegvx_batched_impl(rocblas_handle handle,
     // memory workspace sizes:
     // size for constants in rocblas calls
     size_t size_scalars;
-    // size of reusable workspaces (and for calling TRSM, SYGST/HEGST, and SYEVX/HEEVX)
+    // size of workspace (shared by the calls to POTRF, SYGST/HEGST, SYEVX/HEEVX, and TRSM,
+    // plus the temporary info array)
     bool optim_mem;
-    size_t size_work1, size_work2, size_work3, size_work4, size_work5, size_work6;
-    // extra requirements for calling SYEVX/HEEVX
-    size_t size_D, size_E, size_iblock, size_isplit, size_tau;
-    // extra requirements for calling POTRF and SYEVX/HEEVX
-    size_t size_work7_workArr;
-    // size of temporary info array
-    size_t size_iinfo;
-    rocsolver_sygvx_hegvx_getMemorySize<true, T, S>(
-        itype, evect, uplo, n, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3,
-        &size_work4, &size_work5, &size_work6, &size_D, &size_E, &size_iblock, &size_isplit,
-        &size_tau, &size_work7_workArr, &size_iinfo, &optim_mem);
+    size_t size_work;
+    rocsolver_sygvx_hegvx_getMemorySize<true, T, S>(itype, evect, uplo, n, batch_count,
+                                                    &size_scalars, &size_work, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
-                                                      size_work3, size_work4, size_work5, size_work6,
-                                                      size_D, size_E, size_iblock, size_isplit,
-                                                      size_tau, size_work7_workArr, size_iinfo);
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
 
     // memory workspace allocation
-    void *scalars, *work1, *work2, *work3, *work4, *work5, *work6, *D, *E, *iblock, *isplit, *tau,
-        *work7_workArr, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
-                              size_work5, size_work6, size_D, size_E, size_iblock, size_isplit,
-                              size_tau, size_work7_workArr, size_iinfo);
+    void *scalars, *work;
+    rocblas_device_malloc mem(handle, size_scalars, size_work);
 
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
-    work1 = mem[1];
-    work2 = mem[2];
-    work3 = mem[3];
-    work4 = mem[4];
-    work5 = mem[5], work6 = mem[6], D = mem[7];
-    E = mem[8];
-    iblock = mem[9];
-    isplit = mem[10];
-    tau = mem[11];
-    work7_workArr = mem[12];
-    iinfo = mem[13];
+    work = mem[1];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_sygvx_hegvx_template<true, false, T>(
         handle, itype, evect, erange, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, vl,
         vu, il, iu, abstol, nev, W, strideW, Z, shiftZ, ldz, strideZ, ifail, strideF, info,
-        batch_count, (T*)scalars, work1, work2, work3, work4, work5, work6, (S*)D, (S*)E,
-        (rocblas_int*)iblock, (rocblas_int*)isplit, (T*)tau, work7_workArr, (rocblas_int*)iinfo,
-        optim_mem);
+        batch_count, (T*)scalars, work, optim_mem);
 }
 
 /*
@@ -0,0 +1,501 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_syevd_heevd.hpp"
+#include "rocsolver.h"
+
+#define SYMATFUNC_MAX_SWEEPS 30
+
+/** SYMATFUNC_EVAL clamps the eigenvalue x from below with the given clamp value
+    and overwrites it with f(x). If the clamped value is outside of the domain of f,
+    x is set to zero and false is returned. **/
+template <typename S>
+__device__ bool symatfunc_eval(const rocblas_matfunc func, const S clamp, S& x)
+{
+    if(x < clamp)
+        x = clamp;
+
+    switch(func)
+    {
+    case rocblas_matfunc_sqrt:
+        if(x < 0)
+            break;
+        x = sqrt(x);
+        return true;
+    case rocblas_matfunc_invsqrt:
+        if(x <= 0)
+            break;
+        x = 1 / sqrt(x);
+        return true;
+    case rocblas_matfunc_exp: x = exp(x); return true;
+    case rocblas_matfunc_log:
+        if(x <= 0)
+            break;
+        x = log(x);
+        return true;
+    }
+
+    x = 0;
+    return false;
+}
+
+/** SYMATFUNC_JACOBI_KERNEL computes f(A) for a matrix of at most SYMATFUNC_JACOBI_MAX_N
+    columns with a single thread-block of n-by-n threads. The full Hermitian matrix and
+    the eigenvectors are kept in shared memory and diagonalized with sweeps of the parallel
+    (round-robin) two-sided Jacobi method; every round applies n/2 disjoint rotations
+    simultaneously. The result V * f(D) * V' overwrites the whole matrix A. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(SYMATFUNC_JACOBI_MAX_N* SYMATFUNC_JACOBI_MAX_N)
+    symatfunc_jacobi_kernel(const rocblas_matfunc func,
+                            const rocblas_fill uplo,
+                            const rocblas_int n,
+                            U AA,
+                            const rocblas_int shiftA,
+                            const rocblas_int lda,
+                            const rocblas_stride strideA,
+                            const S clamp,
+                            rocblas_int* info)
+{
+    const int bid = hipBlockIdx_z;
+    const int i = hipThreadIdx_x;
+    const int j = hipThreadIdx_y;
+    const int tid = i + j * n;
+    const int ld = SYMATFUNC_JACOBI_MAX_N;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+    // shared memory setup
+    __shared__ T sA[SYMATFUNC_JACOBI_MAX_N * SYMATFUNC_JACOBI_MAX_N];
+    __shared__ T sV[SYMATFUNC_JACOBI_MAX_N * SYMATFUNC_JACOBI_MAX_N];
+    __shared__ S soff[SYMATFUNC_JACOBI_MAX_N];
+    __shared__ S sdiag[SYMATFUNC_JACOBI_MAX_N];
+    __shared__ S sc[SYMATFUNC_JACOBI_MAX_N];
+    __shared__ T ss[SYMATFUNC_JACOBI_MAX_N];
+    __shared__ rocblas_int spart[SYMATFUNC_JACOBI_MAX_N];
+    __shared__ bool sfirst[SYMATFUNC_JACOBI_MAX_N];
+    __shared__ bool sstop;
+    __shared__ rocblas_int sinfo;
+
+    // read the full Hermitian matrix from the referenced triangle, and set V = I
+    const bool lower = (uplo == rocblas_fill_lower);
+    T a;
+    if(i == j)
+        a = T(std::real(A[i + i * lda]));
+    else if(lower == (i > j))
+        a = A[i + j * lda];
+    else
+        a = conj(A[j + i * lda]);
+    sA[i + j * ld] = a;
+    sV[i + j * ld] = (i == j ? T(1) : T(0));
+    __syncthreads();
+
+    // number of indices in the round-robin ordering
+    // (if n is odd, index n is a dummy that leaves its partner untouched)
+    const rocblas_int m = n + (n & 1);
+    const S tol = n * std::numeric_limits<S>::epsilon();
+    T v;
+
+    for(rocblas_int sweep = 0;; sweep++)
+    {
+        // squared Frobenius norms of the off-diagonal and diagonal parts of every row
+        if(j == 0)
+        {
+            S off = 0, diag = 0;
+            for(rocblas_int k = 0; k < n; k++)
+            {
+                S t = std::abs(sA[i + k * ld]);
+                if(k == i)
+                    diag = t * t;
+                else
+                    off += t * t;
+            }
+            soff[i] = off;
+            sdiag[i] = diag;
+        }
+        __syncthreads();
+
+        // convergence check
+        if(tid == 0)
+        {
+            S off = 0, nrm = 0;
+            for(rocblas_int k = 0; k < n; k++)
+            {
+                off += soff[k];
+                nrm += soff[k] + sdiag[k];
+            }
+            S bound = tol * tol * nrm;
+
+            // if not converged, info is the number of rows with non-negligible
+            // off-diagonal part
+            sinfo = 0;
+            if(off > bound)
+            {
+                for(rocblas_int k = 0; k < n; k++)
+                    sinfo += (soff[k] > bound / n ? 1 : 0);
+            }
+            sstop = (sinfo == 0 || sweep >= SYMATFUNC_MAX_SWEEPS);
+        }
+        __syncthreads();
+
+        if(sstop)
+            break;
+
+        for(rocblas_int r = 0; r < m - 1; r++)
+        {
+            // compute the rotations for the pairs of this round
+            if(tid < m / 2)
+            {
+                rocblas_int p, q;
+                if(tid == 0)
+                {
+                    p = r;
+                    q = m - 1;
+                }
+                else
+                {
+                    p = (r + tid) % (m - 1);
+                    q = (r - tid + m - 1) % (m - 1);
+                }
+                if(p > q)
+                    swap(p, q);
+
+                if(q < n)
+                {
+                    // rotation [c, s*u; -s*conj(u), c] with u = b / |b| annihilating A(p,q) = b
+                    T b = sA[p + q * ld];
+                    S ab = std::abs(b);
+                    S c = 1;
+                    T su = 0;
+                    if(ab > 0)
+                    {
+                        S theta
+                            = (std::real(sA[q + q * ld]) - std::real(sA[p + p * ld])) / (2 * ab);
+                        S t = (theta >= 0 ? S(1) : S(-1))
+                            / (std::abs(theta) + sqrt(1 + theta * theta));
+                        c = 1 / sqrt(1 + t * t);
+                        su = (b / T(ab)) * T(t * c);
+                    }
+                    spart[p] = q;
+                    spart[q] = p;
+                    sfirst[p] = true;
+                    sfirst[q] = false;
+                    sc[p] = c;
+                    sc[q] = c;
+                    ss[p] = su;
+                    ss[q] = su;
+                }
+                else
+                    spart[p] = -1;
+            }
+            __syncthreads();
+
+            // apply the rotations to the columns of A and V
+            rocblas_int pk = spart[j];
+            a = sA[i + j * ld];
+            v = sV[i + j * ld];
+            if(pk >= 0)
+            {
+                T c = sc[j];
+                T su = ss[j];
+                if(sfirst[j])
+                {
+                    a = a * c - sA[i + pk * ld] * conj(su);
+                    v = v * c - sV[i + pk * ld] * conj(su);
+                }
+                else
+                {
+                    a = sA[i + pk * ld] * su + a * c;
+                    v = sV[i + pk * ld] * su + v * c;
+                }
+            }
+            __syncthreads();
+            sA[i + j * ld] = a;
+            sV[i + j * ld] = v;
+            __syncthreads();
+
+            // apply the rotations to the rows of A
+            pk = spart[i];
+            if(pk >= 0)
+            {
+                T c = sc[i];
+                T su = ss[i];
+                if(sfirst[i])
+                    a = a * c - su * sA[pk + j * ld];
+                else
+                    a = conj(su) * sA[pk + j * ld] + a * c;
+            }
+            __syncthreads();
+            sA[i + j * ld] = a;
+            __syncthreads();
+        }
+    }
+
+    // evaluate the function on the eigenvalues
+    // (soff is reused to store f(D) and sdiag to flag values outside of the domain)
+    if(j == 0)
+    {
+        S x = std::real(sA[i + i * ld]);
+        sdiag[i] = symatfunc_eval(func, clamp, x) ? 0 : 1;
+        soff[i] = x;
+    }
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        rocblas_int nbad = 0;
+        for(rocblas_int k = 0; k < n; k++)
+            nbad += (sdiag[k] > 0 ? 1 : 0);
+        if(sinfo == 0 && nbad > 0)
+            sinfo = n + nbad;
+        info[bid] = sinfo;
+    }
+
+    // reconstruct f(A) = V * f(D) * V'
+    a = 0;
+    for(rocblas_int k = 0; k < n; k++)
+        a += sV[i + k * ld] * T(soff[k]) * conj(sV[j + k * ld]);
+    A[i + j * lda] = (i == j ? T(std::real(a)) : a);
+}
+
+/** SYMATFUNC_EVAL_KERNEL overwrites the eigenvalues in D with f(D). If the eigensolver
+    converged, info is set to n plus the number of eigenvalues outside of the
+    domain of f. **/
+template <typename S>
+ROCSOLVER_KERNEL void symatfunc_eval_kernel(const rocblas_matfunc func,
+                                            const rocblas_int n,
+                                            S* DD,
+                                            const rocblas_stride strideD,
+                                            const S clamp,
+                                            rocblas_int* info)
+{
+    const int bid = hipBlockIdx_y;
+    const int tid = hipThreadIdx_x;
+
+    // array pointers
+    S* D = DD + bid * strideD;
+
+    __shared__ rocblas_int snbad;
+    if(tid == 0)
+        snbad = 0;
+    __syncthreads();
+
+    for(rocblas_int k = tid; k < n; k += hipBlockDim_x)
+    {
+        S x = D[k];
+        if(!symatfunc_eval(func, clamp, x))
+            atomicAdd(&snbad, 1);
+        D[k] = x;
+    }
+    __syncthreads();
+
+    if(tid == 0 && snbad > 0 && info[bid] == 0)
+        info[bid] = n + snbad;
+}
+
+/** SYMATFUNC_SCALE_KERNEL computes W = V * f(D), where the eigenvectors V
+    are stored in A. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void symatfunc_scale_kernel(const rocblas_int n,
+                                             U AA,
+                                             const rocblas_int shiftA,
+                                             const rocblas_int lda,
+                                             const rocblas_stride strideA,
+                                             S* DD,
+                                             const rocblas_stride strideD,
+                                             T* WW,
+                                             const rocblas_int ldw,
+                                             const rocblas_stride strideW)
+{
+    const int bid = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < n && j < n)
+    {
+        // array pointers
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        S* D = DD + bid * strideD;
+        T* W = WW + bid * strideW;
+
+        W[i + j * ldw] = A[i + j * lda] * T(D[j]);
+    }
+}
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_symatfunc_hematfunc_getMemorySize(const rocblas_fill uplo,
+                                                 const rocblas_int n,
+                                                 const rocblas_int batch_count,
+                                                 size_t* size_scalars,
+                                                 size_t* size_work1,
+                                                 size_t* size_work2,
+                                                 size_t* size_work3,
+                                                 size_t* size_tmptau_W,
+                                                 size_t* size_tau,
+                                                 size_t* size_workArr,
+                                                 size_t* size_D,
+                                                 size_t* size_E,
+                                                 size_t* size_tmpC)
+{
+    // if quick return or small size (computed with a single kernel), set workspace to zero
+    if(n <= SYMATFUNC_JACOBI_MAX_N || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_tmptau_W = 0;
+        *size_tau = 0;
+        *size_workArr = 0;
+        *size_D = 0;
+        *size_E = 0;
+        *size_tmpC = 0;
+        return;
+    }
+
+    // requirements for the eigendecomposition (syevd/heevd)
+    // (the workspace for the eigenvectors, tmptau_W, is reused to hold V * f(D))
+    rocsolver_syevd_heevd_getMemorySize<BATCHED, T, S>(rocblas_evect_original, uplo, n,
+                                                       batch_count, size_scalars, size_work1,
+                                                       size_work2, size_work3, size_tmptau_W,
+                                                       size_tau, size_workArr);
+
+    // size of arrays for the eigenvalues and off-diagonal elements
+    *size_D = sizeof(S) * n * batch_count;
+    *size_E = sizeof(S) * n * batch_count;
+
+    // size of array for the reconstructed matrix
+    *size_tmpC = sizeof(T) * n * n * batch_count;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_symatfunc_hematfunc_argCheck(rocblas_handle handle,
+                                                      const rocblas_matfunc func,
+                                                      const rocblas_fill uplo,
+                                                      const rocblas_int n,
+                                                      T A,
+                                                      const rocblas_int lda,
+                                                      rocblas_int* info,
+                                                      const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(func != rocblas_matfunc_sqrt && func != rocblas_matfunc_invsqrt
+       && func != rocblas_matfunc_exp && func != rocblas_matfunc_log)
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_symatfunc_hematfunc_template(rocblas_handle handle,
+                                                      const rocblas_matfunc func,
+                                                      const rocblas_fill uplo,
+                                                      const rocblas_int n,
+                                                      U A,
+                                                      const rocblas_int shiftA,
+                                                      const rocblas_int lda,
+                                                      const rocblas_stride strideA,
+                                                      const S clamp,
+                                                      rocblas_int* info,
+                                                      const rocblas_int batch_count,
+                                                      T* scalars,
+                                                      void* work1,
+                                                      void* work2,
+                                                      void* work3,
+                                                      T* tmptau_W,
+                                                      T* tau,
+                                                      T** workArr,
+                                                      S* D,
+                                                      S* E,
+                                                      T* tmpC)
+{
+    ROCSOLVER_ENTER("symatfunc_hematfunc", "func:", func, "uplo:", uplo, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "clamp:", clamp, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // small sizes are computed with a single kernel
+    if(n <= SYMATFUNC_JACOBI_MAX_N)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(symatfunc_jacobi_kernel<T>, dim3(1, 1, batch_count), dim3(n, n, 1),
+                                0, stream, func, uplo, n, A, shiftA, lda, strideA, clamp, info);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    T one = 1;
+    T zero = 0;
+
+    const rocblas_stride strideD = n;
+    const rocblas_int ldw = n;
+    const rocblas_stride strideW = n * n;
+    const rocblas_int blocks = (n - 1) / BS2 + 1;
+
+    // compute the eigendecomposition A = V * D * V' (V overwrites A)
+    rocsolver_syevd_heevd_template<BATCHED, STRIDED>(
+        handle, rocblas_evect_original, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideD,
+        info, batch_count, scalars, work1, work2, work3, tmptau_W, tau, workArr);
+
+    // D <- f(D)
+    ROCSOLVER_LAUNCH_KERNEL(symatfunc_eval_kernel<S>, dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                            stream, func, n, D, strideD, clamp, info);
+
+    // W = V * f(D)
+    ROCSOLVER_LAUNCH_KERNEL(symatfunc_scale_kernel<T>, dim3(blocks, blocks, batch_count),
+                            dim3(BS2, BS2, 1), 0, stream, n, A, shiftA, lda, strideA, D, strideD,
+                            tmptau_W, ldw, strideW);
+
+    // C = W * V'
+    rocblasCall_gemm<BATCHED, STRIDED, T>(
+        handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, n, n, n, &one,
+        tmptau_W, 0, ldw, strideW, A, shiftA, lda, strideA, &zero, tmpC, 0, ldw, strideW,
+        batch_count, workArr);
+
+    // copy the result back into A
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(BS2, BS2), 0,
+                            stream, n, n, tmpC, 0, ldw, strideW, A, shiftA, lda, strideA);
+
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
+    rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
+    return rocblas_status_success;
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_symatfunc_hematfunc.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_symatfunc_hematfunc_strided_batched_impl(rocblas_handle handle,
+                                                                  const rocblas_matfunc func,
+                                                                  const rocblas_fill uplo,
+                                                                  const rocblas_int n,
+                                                                  U A,
+                                                                  const rocblas_int lda,
+                                                                  const rocblas_stride strideA,
+                                                                  const S clamp,
+                                                                  rocblas_int* info,
+                                                                  const rocblas_int batch_count)
+{
+    const char* name = (!is_complex<T> ? "symatfunc_strided_batched" : "hematfunc_strided_batched");
+    ROCSOLVER_ENTER_TOP(name, "--func", func, "--uplo", uplo, "-n", n, "--lda", lda, "--strideA",
+                        strideA, "--clamp", clamp, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_symatfunc_hematfunc_argCheck(handle, func, uplo, n, A, lda, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspaces
+    size_t size_work1;
+    size_t size_work2;
+    size_t size_work3;
+    size_t size_tmptau_W;
+    // size for temporary householder scalars
+    size_t size_tau;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    // size for the eigenvalues and off-diagonal elements
+    size_t size_D;
+    size_t size_E;
+    // size for the reconstructed matrix
+    size_t size_tmpC;
+
+    rocsolver_symatfunc_hematfunc_getMemorySize<false, T, S>(
+        uplo, n, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_tmptau_W,
+        &size_tau, &size_workArr, &size_D, &size_E, &size_tmpC);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+                                                      size_work3, size_tmptau_W, size_tau,
+                                                      size_workArr, size_D, size_E, size_tmpC);
+
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *tmptau_W, *tau, *workArr, *D, *E, *tmpC;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3,
+                              size_tmptau_W, size_tau, size_workArr, size_D, size_E, size_tmpC);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    tmptau_W = mem[4];
+    tau = mem[5];
+    workArr = mem[6];
+    D = mem[7];
+    E = mem[8];
+    tmpC = mem[9];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    ROCSOLVER_BEGIN_PHASE(execution);
+
+    // execution
+    return rocsolver_symatfunc_hematfunc_template<false, true, T>(
+        handle, func, uplo, n, A, shiftA, lda, strideA, clamp, info, batch_count, (T*)scalars,
+        work1, work2, work3, (T*)tmptau_W, (T*)tau, (T**)workArr, (S*)D, (S*)E, (T*)tmpC);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_ssymatfunc_strided_batched(rocblas_handle handle,
+                                                    const rocblas_matfunc func,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    float* A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    const float clamp,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_symatfunc_hematfunc_strided_batched_impl<float>(
+        handle, func, uplo, n, A, lda, strideA, clamp, info, batch_count);
+}
+
+rocblas_status rocsolver_dsymatfunc_strided_batched(rocblas_handle handle,
+                                                    const rocblas_matfunc func,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    double* A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    const double clamp,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_symatfunc_hematfunc_strided_batched_impl<double>(
+        handle, func, uplo, n, A, lda, strideA, clamp, info, batch_count);
+}
+
+rocblas_status rocsolver_chematfunc_strided_batched(rocblas_handle handle,
+                                                    const rocblas_matfunc func,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    rocblas_float_complex* A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    const float clamp,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_symatfunc_hematfunc_strided_batched_impl<rocblas_float_complex>(
+        handle, func, uplo, n, A, lda, strideA, clamp, info, batch_count);
+}
+
+rocblas_status rocsolver_zhematfunc_strided_batched(rocblas_handle handle,
+                                                    const rocblas_matfunc func,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    rocblas_double_complex* A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    const double clamp,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_symatfunc_hematfunc_strided_batched_impl<rocblas_double_complex>(
+        handle, func, uplo, n, A, lda, strideA, clamp, info, batch_count);
+}
+
+} // extern C
@@ -25,6 +25,8 @@ rocblas_status rocsolver_sytd2_hetd2_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -51,6 +53,8 @@ rocblas_status rocsolver_sytd2_hetd2_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_norms,
                                                       size_tmptau, size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work, *norms, *tmptau, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_work, size_norms, size_tmptau, size_workArr);
@@ -58,6 +62,8 @@ rocblas_status rocsolver_sytd2_hetd2_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work = mem[1];
     norms = mem[2];
@@ -66,6 +72,8 @@ rocblas_status rocsolver_sytd2_hetd2_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_sytd2_hetd2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, D, strideD,
                                              E, strideE, tau, strideP, batch_count, (T*)scalars,
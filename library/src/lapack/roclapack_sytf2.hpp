@@ -13,6 +13,7 @@
 #include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
 
 /** thread-block size for calling the sytf2 kernel.
     (MAX_THDS sizes must be one of 128, 256, 512, or 1024) **/
@@ -486,6 +487,16 @@ rocblas_status rocsolver_sytf2_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+#ifdef OPTIMAL
+    // if very small size, use the specialized kernel (matrix kept in registers)
+    if(n <= sytf2_small_max_cols<T>())
+    {
+        sytf2_run_small<T>(handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP, info,
+                           batch_count);
+        return rocblas_status_success;
+    }
+#endif
+
     dim3 grid(1, batch_count, 1);
     dim3 threads(SYTF2_MAX_THDS, 1, 1);
 
@@ -27,6 +27,8 @@ rocblas_status rocsolver_sytf2_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // using unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -37,6 +39,8 @@ rocblas_status rocsolver_sytf2_batched_impl(rocblas_handle handle,
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_status_size_unchanged;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_sytf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP,
                                        info, batch_count);
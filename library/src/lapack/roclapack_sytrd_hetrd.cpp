@@ -25,6 +25,8 @@ rocblas_status rocsolver_sytrd_hetrd_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -49,6 +51,8 @@ rocblas_status rocsolver_sytrd_hetrd_impl(rocblas_handle handle,
         return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_norms,
                                                       size_tmptau_W, size_workArr);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void *scalars, *work, *norms, *tmptau_W, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_work, size_norms, size_tmptau_W,
@@ -57,6 +61,8 @@ rocblas_status rocsolver_sytrd_hetrd_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(init_scalars);
+
     scalars = mem[0];
     work = mem[1];
     norms = mem[2];
@@ -65,6 +71,8 @@ rocblas_status rocsolver_sytrd_hetrd_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     // execution
     return rocsolver_sytrd_hetrd_template<false, T>(
         handle, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE, tau, strideP, batch_count,
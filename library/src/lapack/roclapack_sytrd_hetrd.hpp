@@ -123,9 +123,11 @@ rocblas_status rocsolver_sytrd_hetrd_template(rocblas_handle handle,
                                               norms, tmptau_W, workArr);
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // scalars for rocblas calls
     T minonej = -1; //complex -1
@@ -200,6 +202,8 @@ rocblas_status rocsolver_sytrd_hetrd_template(rocblas_handle handle,
     ROCSOLVER_LAUNCH_KERNEL(set_tridiag<T>, dim3(blocks, batch_count), dim3(BS1), 0, stream, uplo,
                             n, A, shiftA, lda, strideA, D, strideD, E, strideE);
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
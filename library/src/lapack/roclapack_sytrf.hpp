@@ -194,6 +194,16 @@ rocblas_status rocsolver_sytrf_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+#ifdef OPTIMAL
+    // if very small size, use the specialized kernel (matrix kept in registers)
+    if(n <= sytf2_small_max_cols<T>())
+    {
+        sytf2_run_small<T>(handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP, info,
+                           batch_count);
+        return rocblas_status_success;
+    }
+#endif
+
     dim3 grid(1, batch_count, 1);
     dim3 threads(SYTRF_MAX_THDS, 1, 1);
 
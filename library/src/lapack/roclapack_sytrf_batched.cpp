@@ -27,6 +27,8 @@ rocblas_status rocsolver_sytrf_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    ROCSOLVER_BEGIN_PHASE(memory_size);
+
     // using unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -41,6 +43,8 @@ rocblas_status rocsolver_sytrf_batched_impl(rocblas_handle handle,
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_work);
 
+    ROCSOLVER_BEGIN_PHASE(device_malloc);
+
     // memory workspace allocation
     void* work;
     rocblas_device_malloc mem(handle, size_work);
@@ -48,6 +52,8 @@ rocblas_status rocsolver_sytrf_batched_impl(rocblas_handle handle,
     if(!mem)
         return rocblas_status_memory_error;
 
+    ROCSOLVER_BEGIN_PHASE(execution);
+
     work = mem[0];
 
     // execution
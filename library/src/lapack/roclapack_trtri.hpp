@@ -219,9 +219,11 @@ void trti2(rocblas_handle handle,
     rocblas_stride stdw = rocblas_stride(n);
 
     // everything must be executed with scalars on the device
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    ROCSOLVER_BEGIN_PHASE(execution);
 
     // inverse of the diagonal (reciprocals)
     rocblas_int blocks = (n - 1) / 32 + 1;
@@ -253,7 +255,9 @@ void trti2(rocblas_handle handle,
         }
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
 }
 
 template <bool BATCHED, bool STRIDED, typename T, typename U>
@@ -296,9 +300,11 @@ rocblas_status rocsolver_trtri_template(rocblas_handle handle,
         return rocblas_status_success;
 
     // everything must be executed with scalars on the host
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    ROCSOLVER_BEGIN_PHASE(execution);
     T one = 1;
     T minone = -1;
 
@@ -401,6 +407,8 @@ rocblas_status rocsolver_trtri_template(rocblas_handle handle,
                                 info_mask(info));
     }
 
+    ROCSOLVER_BEGIN_PHASE(pointer_mode);
     rocblas_set_pointer_mode(handle, old_mode);
+    ROCSOLVER_BEGIN_PHASE(execution);
     return rocblas_status_success;
 }
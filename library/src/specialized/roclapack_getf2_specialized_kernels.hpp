@@ -11,6 +11,8 @@
 
 #include "rocsolver_run_specialized_kernels.hpp"
 
+#include <hip/hip_cooperative_groups.h>
+
 /*************************************************************
     Templated kernels are instantiated in separate cpp
     files in order to improve compilation times and reduce
@@ -479,6 +481,214 @@ ROCSOLVER_KERNEL void getf2_npvt_panel_kernel(const rocblas_int m,
         *info = myinfo + offset;
 }
 
+/** getf2_coop_maxloc reduces the pairs (val1, idx1) of all the threads in the workgroup to the one
+    with the largest value (the smallest index is kept in case of ties). The result is left in
+    sval[0] and sidx[0] **/
+template <typename S>
+__device__ void
+    getf2_coop_maxloc(const int tid, S val1, rocblas_int idx1, S* sval, rocblas_int* sidx)
+{
+    S val2;
+    rocblas_int idx2;
+
+    sval[tid] = val1;
+    sidx[tid] = idx1;
+    __syncthreads();
+
+    for(int i = GETF2_COOP_THDS / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+        {
+            val2 = sval[tid + i];
+            idx2 = sidx[tid + i];
+            if((val1 < val2) || (val1 == val2 && idx1 > idx2))
+            {
+                sval[tid] = val1 = val2;
+                sidx[tid] = idx1 = idx2;
+            }
+        }
+        __syncthreads();
+    }
+}
+
+/** getf2_panel_coop_kernel takes care of tall panels (m > GETF2_SPKER_MAX_M) in a single
+    cooperative launch. The rows of every batch instance are distributed among hipGridDim_x
+    workgroups that keep updating their own rows; the search of the pivot and the interchange
+    of rows are synchronized across the grid **/
+template <bool PIVOT, typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GETF2_COOP_THDS)
+    getf2_panel_coop_kernel(const rocblas_int m,
+                            const rocblas_int n,
+                            U AA,
+                            const rocblas_int shiftA,
+                            const rocblas_int lda,
+                            const rocblas_stride strideA,
+                            rocblas_int* ipivA,
+                            const rocblas_int shiftP,
+                            const rocblas_stride strideP,
+                            rocblas_int* infoA,
+                            const rocblas_int offset,
+                            rocblas_int* permut_idx,
+                            const rocblas_stride stridePI,
+                            S* gvalA,
+                            rocblas_int* gidxA)
+{
+    cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+
+    const int tid = hipThreadIdx_x;
+    const int bid = hipBlockIdx_x;
+    const int nblk = hipGridDim_x;
+    const int id = hipBlockIdx_z;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    rocblas_int *ipiv, *permut;
+    if(PIVOT)
+    {
+        ipiv = load_ptr_batch<rocblas_int>(ipivA, id, shiftP, strideP);
+        if(permut_idx)
+            permut = permut_idx + id * stridePI;
+    }
+    rocblas_int* info = infoA + id;
+
+    // partial results of the pivot search (two sets, alternated between consecutive columns, so
+    // that no workgroup overwrites the results still being read by the others)
+    S* gval = gvalA + id * 2 * nblk;
+    rocblas_int* gidx = gidxA + id * 2 * nblk;
+
+    // rows owned by this workgroup
+    const rocblas_int nrows = (m - 1) / nblk + 1;
+    const rocblas_int r0 = bid * nrows;
+    const rocblas_int r1 = min(m, r0 + nrows);
+
+    // shared memory (for communication between threads in group)
+    extern __shared__ double lmem[];
+    T* y = reinterpret_cast<T*>(lmem);
+    T* z = y + n;
+    S* sval = reinterpret_cast<S*>(z + n);
+    rocblas_int* sidx = reinterpret_cast<rocblas_int*>(sval + GETF2_COOP_THDS);
+
+    // local variables
+    S val1 = -1;
+    rocblas_int idx1 = m;
+    T valtmp, pivot_val;
+    rocblas_int pivot_idx;
+    bool own_k, own_p;
+    int myinfo = 0; // to build info
+
+    // init step: local maximum of column zero
+    if(PIVOT)
+    {
+        for(rocblas_int i = r0 + tid; i < r1; i += GETF2_COOP_THDS)
+        {
+            if(aabs<S>(A[i]) > val1)
+            {
+                val1 = aabs<S>(A[i]);
+                idx1 = i;
+            }
+        }
+    }
+
+    // main loop (for each pivot)
+    const rocblas_int dim = min(m, n);
+    for(rocblas_int k = 0; k < dim; ++k)
+    {
+        if(PIVOT)
+        {
+            // find pivot (maximum in column) among the rows owned by this workgroup...
+            getf2_coop_maxloc(tid, val1, idx1, sval, sidx);
+            if(tid == 0)
+            {
+                gval[(k % 2) * nblk + bid] = sval[0];
+                gidx[(k % 2) * nblk + bid] = sidx[0];
+            }
+            grid.sync();
+
+            // ...and then among all the workgroups
+            val1 = (tid < nblk) ? gval[(k % 2) * nblk + tid] : -1;
+            idx1 = (tid < nblk) ? gidx[(k % 2) * nblk + tid] : m;
+            getf2_coop_maxloc(tid, val1, idx1, sval, sidx);
+            pivot_idx = (sval[0] > 0) ? sidx[0] : k;
+        }
+        else
+        {
+            // wait for row k to be updated
+            grid.sync();
+            pivot_idx = k;
+        }
+        own_k = (k >= r0 && k < r1);
+        own_p = (pivot_idx >= r0 && pivot_idx < r1);
+
+        // put pivot row in shared mem (and also row k, if this workgroup is to hold it)
+        for(rocblas_int j = tid; j < n; j += GETF2_COOP_THDS)
+        {
+            y[j] = A[pivot_idx + j * lda];
+            if(own_p && pivot_idx != k)
+                z[j] = A[k + j * lda];
+        }
+        __syncthreads();
+
+        // check singularity and scale value for current column
+        pivot_val = y[k];
+        if(pivot_val == T(0))
+        {
+            pivot_val = 1;
+            if(myinfo == 0)
+                myinfo = k + 1;
+        }
+        else
+            pivot_val = S(1) / pivot_val;
+
+        if(PIVOT)
+        {
+            // update ipiv
+            if(bid == 0 && tid == 0)
+            {
+                ipiv[k] = pivot_idx + 1 + offset;
+                if(permut_idx)
+                    swap(permut[k], permut[pivot_idx]);
+            }
+
+            // swap pivot row with row k once all the workgroups have read them
+            if(pivot_idx != k)
+            {
+                grid.sync();
+                for(rocblas_int j = tid; j < n; j += GETF2_COOP_THDS)
+                {
+                    if(own_k)
+                        A[k + j * lda] = y[j];
+                    if(own_p)
+                        A[pivot_idx + j * lda] = z[j];
+                }
+                __syncthreads();
+            }
+        }
+
+        // scale column k and update the trailing rows owned by this workgroup, while looking for
+        // the local maximum of the next column
+        val1 = -1;
+        idx1 = m;
+        for(rocblas_int i = max(r0, k + 1) + tid; i < r1; i += GETF2_COOP_THDS)
+        {
+            valtmp = A[i + k * lda] * pivot_val;
+            A[i + k * lda] = valtmp;
+            for(rocblas_int j = k + 1; j < n; ++j)
+            {
+                A[i + j * lda] -= valtmp * y[j];
+                if(PIVOT && j == k + 1 && aabs<S>(A[i + j * lda]) > val1)
+                {
+                    val1 = aabs<S>(A[i + j * lda]);
+                    idx1 = i;
+                }
+            }
+        }
+    }
+
+    // update info
+    if(bid == 0 && tid == 0 && *info == 0 && myinfo > 0)
+        *info = myinfo + offset;
+}
+
 /** getf2_scale_update_kernel executes an optimized scaled rank-update (scal + ger)
     for panel matrices (matrices with less than 128 columns).
     Useful to speedup the factorization of block-columns in getrf **/
@@ -560,13 +770,13 @@ rocblas_status getf2_run_small(rocblas_handle handle,
                                rocblas_int* permut_idx,
                                const rocblas_stride stride)
 {
-#define RUN_LUFACT_SMALL(DIM)                                                                      \
-    if(pivot)                                                                                      \
-        ROCSOLVER_LAUNCH_KERNEL((getf2_small_kernel<DIM, T>), grid, block, lmemsize, stream, m, A, \
-                                shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,    \
-                                offset, permut_idx, stride);                                       \
-    else                                                                                           \
-        ROCSOLVER_LAUNCH_KERNEL((getf2_npvt_small_kernel<DIM, T>), grid, block, lmemsize, stream,  \
+#define RUN_LUFACT_SMALL(DIM)                                                                     \
+    if(pivot)                                                                                     \
+        ROCSOLVER_LAUNCH_KERNEL((getf2_small_kernel<DIM, T>), grid, block, lmemsize, stream, m,   \
+                                A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,             \
+                                batch_count, offset, permut_idx, stride);                         \
+    else                                                                                          \
+        ROCSOLVER_LAUNCH_KERNEL((getf2_npvt_small_kernel<DIM, T>), grid, block, lmemsize, stream, \
                                 m, A, shiftA, lda, strideA, info, batch_count, offset)
 
     // determine sizes
@@ -726,6 +936,78 @@ rocblas_status getf2_run_panel(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/** launcher of getf2_panel_coop_kernel. Returns rocblas_status_continue, without doing any
+    work, if the grid cannot be (or could not be) launched cooperatively on the current device **/
+template <typename T, typename U>
+rocblas_status getf2_run_panel_coop(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    rocblas_int* ipiv,
+                                    const rocblas_int shiftP,
+                                    const rocblas_stride strideP,
+                                    rocblas_int* info,
+                                    const rocblas_int batch_count,
+                                    const bool pivot,
+                                    const rocblas_int offset,
+                                    rocblas_int* permut_idx,
+                                    const rocblas_stride stride,
+                                    T* pivotval,
+                                    rocblas_int* pivotidx)
+{
+    using S = decltype(std::real(T{}));
+
+    // determine sizes
+    rocblas_int nblk = std::min((m - 1) / GETF2_COOP_THDS + 1, GETF2_COOP_MAX_BLOCKS);
+    size_t lmemsize = 2 * n * sizeof(T) + GETF2_COOP_THDS * (sizeof(rocblas_int) + sizeof(S));
+
+    // all the workgroups must be resident at the same time
+    // (the residency is queried once, for the largest panel, and then cached)
+    size_t lmemmax
+        = 2 * GETF2_COOP_MAX_N * sizeof(T) + GETF2_COOP_THDS * (sizeof(rocblas_int) + sizeof(S));
+    rocblas_int maxblocks
+        = pivot ? get_coresident_blocks(getf2_panel_coop_kernel<true, T, S, U>, GETF2_COOP_THDS,
+                                        lmemmax)
+                : get_coresident_blocks(getf2_panel_coop_kernel<false, T, S, U>, GETF2_COOP_THDS,
+                                        lmemmax);
+    if(int64_t(nblk) * batch_count > maxblocks)
+        return rocblas_status_continue;
+
+    // prepare kernel launch
+    dim3 grid(nblk, 1, batch_count);
+    dim3 block(GETF2_COOP_THDS, 1, 1);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // pivotval and pivotidx hold the partial results of the pivot search
+    S* gval = (S*)pivotval;
+    void* args[] = {(void*)&m,       (void*)&n,       (void*)&A,        (void*)&shiftA,
+                    (void*)&lda,     (void*)&strideA, (void*)&ipiv,     (void*)&shiftP,
+                    (void*)&strideP, (void*)&info,    (void*)&offset,   (void*)&permut_idx,
+                    (void*)&stride,  (void*)&gval,    (void*)&pivotidx};
+
+    hipError_t status;
+    if(pivot)
+        ROCSOLVER_LAUNCH_COOPERATIVE_KERNEL(status, (getf2_panel_coop_kernel<true, T, S, U>), grid,
+                                            block, lmemsize, stream, args);
+    else
+        ROCSOLVER_LAUNCH_COOPERATIVE_KERNEL(status, (getf2_panel_coop_kernel<false, T, S, U>), grid,
+                                            block, lmemsize, stream, args);
+
+    // if the launch failed, nothing has been done; clear the error and let the caller continue
+    // with the non-cooperative path
+    if(status != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return rocblas_status_continue;
+    }
+
+    return rocblas_status_success;
+}
+
 /** launcher of getf2_scale_update_kernel **/
 template <typename T, typename U>
 void getf2_run_scale_update(rocblas_handle handle,
@@ -770,6 +1052,14 @@ void getf2_run_scale_update(rocblas_handle handle,
         rocblas_int* ipiv, const rocblas_int shiftP, const rocblas_stride strideP,     \
         rocblas_int* info, const rocblas_int batch_count, const bool pivot,            \
         const rocblas_int offset, rocblas_int* permut_idx, const rocblas_stride stride)
+#define INSTANTIATE_GETF2_PANEL_COOP(T, U)                                              \
+    template rocblas_status getf2_run_panel_coop<T, U>(                                 \
+        rocblas_handle handle, const rocblas_int m, const rocblas_int n, U A,           \
+        const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,  \
+        rocblas_int* ipiv, const rocblas_int shiftP, const rocblas_stride strideP,      \
+        rocblas_int* info, const rocblas_int batch_count, const bool pivot,             \
+        const rocblas_int offset, rocblas_int* permut_idx, const rocblas_stride stride, \
+        T* pivotval, rocblas_int* pivotidx)
 #define INSTANTIATE_GETF2_SCALE_UPDATE(T, U)                                               \
     template void getf2_run_scale_update<T, U>(                                            \
         rocblas_handle handle, const rocblas_int m, const rocblas_int n, T* pivotval, U A, \
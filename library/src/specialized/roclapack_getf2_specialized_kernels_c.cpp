@@ -11,5 +11,8 @@
 INSTANTIATE_GETF2_PANEL(rocblas_float_complex, rocblas_float_complex*);
 INSTANTIATE_GETF2_PANEL(rocblas_float_complex, rocblas_float_complex* const*);
 
+INSTANTIATE_GETF2_PANEL_COOP(rocblas_float_complex, rocblas_float_complex*);
+INSTANTIATE_GETF2_PANEL_COOP(rocblas_float_complex, rocblas_float_complex* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_float_complex, rocblas_float_complex*);
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_float_complex, rocblas_float_complex* const*);
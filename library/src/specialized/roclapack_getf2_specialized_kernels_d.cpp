@@ -11,5 +11,8 @@
 INSTANTIATE_GETF2_PANEL(double, double*);
 INSTANTIATE_GETF2_PANEL(double, double* const*);
 
+INSTANTIATE_GETF2_PANEL_COOP(double, double*);
+INSTANTIATE_GETF2_PANEL_COOP(double, double* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(double, double*);
 INSTANTIATE_GETF2_SCALE_UPDATE(double, double* const*);
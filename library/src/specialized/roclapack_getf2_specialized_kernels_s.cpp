@@ -11,5 +11,8 @@
 INSTANTIATE_GETF2_PANEL(float, float*);
 INSTANTIATE_GETF2_PANEL(float, float* const*);
 
+INSTANTIATE_GETF2_PANEL_COOP(float, float*);
+INSTANTIATE_GETF2_PANEL_COOP(float, float* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(float, float*);
 INSTANTIATE_GETF2_SCALE_UPDATE(float, float* const*);
@@ -11,5 +11,8 @@
 INSTANTIATE_GETF2_PANEL(rocblas_double_complex, rocblas_double_complex*);
 INSTANTIATE_GETF2_PANEL(rocblas_double_complex, rocblas_double_complex* const*);
 
+INSTANTIATE_GETF2_PANEL_COOP(rocblas_double_complex, rocblas_double_complex*);
+INSTANTIATE_GETF2_PANEL_COOP(rocblas_double_complex, rocblas_double_complex* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_double_complex, rocblas_double_complex*);
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_double_complex, rocblas_double_complex* const*);
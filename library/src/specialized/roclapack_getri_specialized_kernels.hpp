@@ -17,7 +17,7 @@
     the library size.
 *************************************************************/
 
-template <rocblas_int DIM, typename T, typename U>
+template <rocblas_int DIM, rocblas_int WAVESIZE, typename T, typename U>
 ROCSOLVER_KERNEL void __launch_bounds__(TRTRI_MAX_COLS)
     getri_kernel_small(U AA,
                        const rocblas_int shiftA,
@@ -123,6 +123,10 @@ ROCSOLVER_KERNEL void __launch_bounds__(TRTRI_MAX_COLS)
             temp += rA[ii] * common[ii];
 
         rA[j] -= temp;
+
+        // threads in other wavefronts may still be reading the shared column
+        if(DIM > WAVESIZE)
+            __syncthreads();
     }
 
     // apply pivots (getri_pivot)
@@ -162,12 +166,19 @@ rocblas_status getri_run_small(rocblas_handle handle,
                                const bool complete,
                                const bool pivot)
 {
-#define RUN_GETRI_SMALL(DIM)                                                                      \
-    ROCSOLVER_LAUNCH_KERNEL((getri_kernel_small<DIM, T>), grid, block, 0, stream, A, shiftA, lda, \
-                            strideA, ipiv, shiftP, strideP, info, complete, pivot)
+#define RUN_GETRI_SMALL(DIM)                                                                       \
+    if(DIM > wavesize)                                                                             \
+        ROCSOLVER_LAUNCH_KERNEL((getri_kernel_small<DIM, SMALL_WAVESIZE(DIM), T>), grid, block, 0, \
+                                stream, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,      \
+                                complete, pivot);                                                  \
+    else                                                                                           \
+        ROCSOLVER_LAUNCH_KERNEL((getri_kernel_small<DIM, 64, T>), grid, block, 0, stream, A,       \
+                                shiftA, lda, strideA, ipiv, shiftP, strideP, info, complete, pivot)
 
+    // one thread per row, rounded up to a whole number of wavefronts
+    rocblas_int wavesize = get_wavesize();
     dim3 grid(batch_count, 1, 1);
-    dim3 block(TRTRI_MAX_COLS, 1, 1);
+    dim3 block(((n - 1) / wavesize + 1) * wavesize, 1, 1);
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
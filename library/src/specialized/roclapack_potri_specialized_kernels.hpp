@@ -0,0 +1,286 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsolver_run_specialized_kernels.hpp"
+
+/*************************************************************
+    Templated kernels are instantiated in separate cpp
+    files in order to improve compilation times and reduce
+    the library size.
+*************************************************************/
+
+/** POTRI_KERNEL_SMALL computes the inverse of a positive definite matrix from its
+    Cholesky factor in a single launch: it checks the diagonal for singularities,
+    computes the inverse of the triangular factor (as in TRTI2_KERNEL_SMALL), and
+    then the product U * U' or L' * L (as in LAUUM). Each thread keeps one row of
+    the matrix in registers; if the factor is singular, A is not modified. **/
+template <rocblas_int DIM, typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(POTRI_MAX_COLS)
+    potri_kernel_small(const rocblas_fill uplo,
+                       U AA,
+                       const rocblas_int shiftA,
+                       const rocblas_int lda,
+                       const rocblas_stride strideA,
+                       rocblas_int* info)
+{
+    int b = hipBlockIdx_x;
+    int i = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+
+    // read corresponding row from global memory in local array
+    T rA[DIM];
+#pragma unroll
+    for(int j = 0; j < DIM; ++j)
+        rA[j] = A[i + j * lda];
+
+    // shared memory (for communication between threads in group)
+    __shared__ T common[DIM];
+    __shared__ T diag[DIM];
+    __shared__ rocblas_int sinfo;
+
+    // check for singularities (the first zero element in the diagonal)
+    diag[i] = rA[i];
+    __syncthreads();
+
+    if(i == 0)
+    {
+        sinfo = 0;
+        for(rocblas_int j = DIM - 1; j >= 0; j--)
+        {
+            if(diag[j] == 0)
+                sinfo = j + 1;
+        }
+        info[b] = sinfo;
+    }
+    __syncthreads();
+
+    if(sinfo != 0)
+        return;
+
+    // 1. inverse of the triangular factor
+    rA[i] = 1.0 / rA[i];
+    diag[i] = -rA[i];
+    T temp;
+
+    if(uplo == rocblas_fill_upper)
+    {
+#pragma unroll
+        for(rocblas_int j = 1; j < DIM; j++)
+        {
+            // share current column
+            common[i] = rA[j];
+            __syncthreads();
+
+            if(i < j)
+            {
+                temp = rA[i] * common[i];
+
+                for(rocblas_int ii = i + 1; ii < j; ii++)
+                    temp += rA[ii] * common[ii];
+
+                rA[j] = diag[j] * temp;
+            }
+            __syncthreads();
+        }
+    }
+    else
+    {
+#pragma unroll
+        for(rocblas_int j = DIM - 2; j >= 0; j--)
+        {
+            // share current column
+            common[i] = rA[j];
+            __syncthreads();
+
+            if(i > j)
+            {
+                temp = rA[i] * common[i];
+
+                for(rocblas_int ii = j + 1; ii < i; ii++)
+                    temp += rA[ii] * common[ii];
+
+                rA[j] = diag[j] * temp;
+            }
+            __syncthreads();
+        }
+    }
+
+    // 2. product with the conjugate transpose
+    if(uplo == rocblas_fill_upper)
+    {
+        // (U * U')_ij = sum_{k >= j} U_ik * conj(U_jk), for i <= j
+#pragma unroll
+        for(rocblas_int j = 0; j < DIM; j++)
+        {
+            // share row j
+            if(i == j)
+            {
+#pragma unroll
+                for(rocblas_int k = j; k < DIM; k++)
+                    common[k] = rA[k];
+            }
+            __syncthreads();
+
+            if(i <= j)
+            {
+                temp = 0;
+#pragma unroll
+                for(rocblas_int k = j; k < DIM; k++)
+                    temp += rA[k] * conj(common[k]);
+                rA[j] = temp;
+            }
+            __syncthreads();
+        }
+    }
+    else
+    {
+        // (L' * L)_ij = sum_{k >= i} conj(L_ki) * L_kj, for i >= j
+#pragma unroll
+        for(rocblas_int k = 0; k < DIM; k++)
+        {
+            // share row k
+            if(i == k)
+            {
+#pragma unroll
+                for(rocblas_int j = 0; j <= k; j++)
+                {
+                    common[j] = rA[j];
+                    rA[j] = 0;
+                }
+            }
+            __syncthreads();
+
+            if(i <= k)
+            {
+                temp = conj(common[i]);
+#pragma unroll
+                for(rocblas_int j = 0; j < DIM; j++)
+                {
+                    if(j <= i)
+                        rA[j] += temp * common[j];
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    // write results to global memory from local array
+    // (only the referenced triangle)
+#pragma unroll
+    for(int j = 0; j < DIM; j++)
+    {
+        if(uplo == rocblas_fill_upper ? j >= i : j <= i)
+            A[i + j * lda] = rA[j];
+    }
+}
+
+/*************************************************************
+    Launchers of specilized  kernels
+*************************************************************/
+
+template <typename T, typename U>
+void potri_run_small(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     rocblas_int* info,
+                     const rocblas_int batch_count)
+{
+#define RUN_POTRI_SMALL(DIM)                                                                      \
+    ROCSOLVER_LAUNCH_KERNEL((potri_kernel_small<DIM, T>), grid, dim3(DIM, 1, 1), 0, stream, uplo, \
+                            A, shiftA, lda, strideA, info)
+
+    dim3 grid(batch_count, 1, 1);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make number of columns n known at compile time
+    // this should allow loop unrolling.
+    switch(n)
+    {
+    case 1: RUN_POTRI_SMALL(1); break;
+    case 2: RUN_POTRI_SMALL(2); break;
+    case 3: RUN_POTRI_SMALL(3); break;
+    case 4: RUN_POTRI_SMALL(4); break;
+    case 5: RUN_POTRI_SMALL(5); break;
+    case 6: RUN_POTRI_SMALL(6); break;
+    case 7: RUN_POTRI_SMALL(7); break;
+    case 8: RUN_POTRI_SMALL(8); break;
+    case 9: RUN_POTRI_SMALL(9); break;
+    case 10: RUN_POTRI_SMALL(10); break;
+    case 11: RUN_POTRI_SMALL(11); break;
+    case 12: RUN_POTRI_SMALL(12); break;
+    case 13: RUN_POTRI_SMALL(13); break;
+    case 14: RUN_POTRI_SMALL(14); break;
+    case 15: RUN_POTRI_SMALL(15); break;
+    case 16: RUN_POTRI_SMALL(16); break;
+    case 17: RUN_POTRI_SMALL(17); break;
+    case 18: RUN_POTRI_SMALL(18); break;
+    case 19: RUN_POTRI_SMALL(19); break;
+    case 20: RUN_POTRI_SMALL(20); break;
+    case 21: RUN_POTRI_SMALL(21); break;
+    case 22: RUN_POTRI_SMALL(22); break;
+    case 23: RUN_POTRI_SMALL(23); break;
+    case 24: RUN_POTRI_SMALL(24); break;
+    case 25: RUN_POTRI_SMALL(25); break;
+    case 26: RUN_POTRI_SMALL(26); break;
+    case 27: RUN_POTRI_SMALL(27); break;
+    case 28: RUN_POTRI_SMALL(28); break;
+    case 29: RUN_POTRI_SMALL(29); break;
+    case 30: RUN_POTRI_SMALL(30); break;
+    case 31: RUN_POTRI_SMALL(31); break;
+    case 32: RUN_POTRI_SMALL(32); break;
+    case 33: RUN_POTRI_SMALL(33); break;
+    case 34: RUN_POTRI_SMALL(34); break;
+    case 35: RUN_POTRI_SMALL(35); break;
+    case 36: RUN_POTRI_SMALL(36); break;
+    case 37: RUN_POTRI_SMALL(37); break;
+    case 38: RUN_POTRI_SMALL(38); break;
+    case 39: RUN_POTRI_SMALL(39); break;
+    case 40: RUN_POTRI_SMALL(40); break;
+    case 41: RUN_POTRI_SMALL(41); break;
+    case 42: RUN_POTRI_SMALL(42); break;
+    case 43: RUN_POTRI_SMALL(43); break;
+    case 44: RUN_POTRI_SMALL(44); break;
+    case 45: RUN_POTRI_SMALL(45); break;
+    case 46: RUN_POTRI_SMALL(46); break;
+    case 47: RUN_POTRI_SMALL(47); break;
+    case 48: RUN_POTRI_SMALL(48); break;
+    case 49: RUN_POTRI_SMALL(49); break;
+    case 50: RUN_POTRI_SMALL(50); break;
+    case 51: RUN_POTRI_SMALL(51); break;
+    case 52: RUN_POTRI_SMALL(52); break;
+    case 53: RUN_POTRI_SMALL(53); break;
+    case 54: RUN_POTRI_SMALL(54); break;
+    case 55: RUN_POTRI_SMALL(55); break;
+    case 56: RUN_POTRI_SMALL(56); break;
+    case 57: RUN_POTRI_SMALL(57); break;
+    case 58: RUN_POTRI_SMALL(58); break;
+    case 59: RUN_POTRI_SMALL(59); break;
+    case 60: RUN_POTRI_SMALL(60); break;
+    case 61: RUN_POTRI_SMALL(61); break;
+    case 62: RUN_POTRI_SMALL(62); break;
+    case 63: RUN_POTRI_SMALL(63); break;
+    case 64: RUN_POTRI_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+}
+
+/*************************************************************
+    Instantiation macros
+*************************************************************/
+
+#define INSTANTIATE_POTRI_SMALL(T, U)                                                        \
+    template void potri_run_small<T, U>(rocblas_handle handle, const rocblas_fill uplo,      \
+                                        const rocblas_int n, U A, const rocblas_int shiftA,  \
+                                        const rocblas_int lda, const rocblas_stride strideA, \
+                                        rocblas_int* info, const rocblas_int batch_count)
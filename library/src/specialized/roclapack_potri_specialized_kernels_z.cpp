@@ -0,0 +1,12 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_potri_specialized_kernels.hpp"
+
+/*************************************************************
+    Instantiate template methods using macros
+*************************************************************/
+
+INSTANTIATE_POTRI_SMALL(rocblas_double_complex, rocblas_double_complex*);
+INSTANTIATE_POTRI_SMALL(rocblas_double_complex, rocblas_double_complex* const*);
@@ -0,0 +1,421 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsolver_run_specialized_kernels.hpp"
+
+/*************************************************************
+    Templated kernels are instantiated in separate cpp
+    files in order to improve compilation times and reduce
+    the library size.
+*************************************************************/
+
+/** SYTF2_KERNEL_SMALL computes the Bunch-Kaufman factorization of a symmetric matrix
+    in a single launch. Each thread keeps one row of the full symmetric matrix in registers
+    (the non-referenced triangle is taken from the referenced one), and the rows needed by
+    the pivot search, the interchanges and the updates are shared through LDS. The result
+    (including ipiv and info) is the same as that of SYTF2_DEVICE_UPPER/LOWER. **/
+template <rocblas_int DIM, typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(SYTF2_MAX_COLS)
+    sytf2_kernel_small(const rocblas_fill uplo,
+                       U AA,
+                       const rocblas_int shiftA,
+                       const rocblas_int lda,
+                       const rocblas_stride strideA,
+                       rocblas_int* ipivA,
+                       const rocblas_stride strideP,
+                       rocblas_int* info)
+{
+    using S = decltype(std::real(T{}));
+    const S alpha = S((1.0 + std::sqrt(17.0)) / 8.0);
+
+    int b = hipBlockIdx_x;
+    int i = hipThreadIdx_x;
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    rocblas_int* ipiv = ipivA + b * strideP;
+
+    // read corresponding row from global memory in local array
+    T rA[DIM];
+#pragma unroll
+    for(int j = 0; j < DIM; ++j)
+        rA[j] = (upper ? j >= i : j <= i) ? A[i + j * lda] : A[j + i * lda];
+
+    // shared memory (for communication between threads in group)
+    __shared__ T sk[DIM];
+    __shared__ T sc[DIM];
+    __shared__ T swk[DIM];
+    __shared__ T swc[DIM];
+    __shared__ S absakk, colmax, absaii, rowmax;
+    __shared__ rocblas_int imax;
+
+    // local variables
+    rocblas_int k = upper ? DIM - 1 : 0;
+    rocblas_int kstep, kp, kk, c;
+    T r1, r2, e, akk, acc;
+    S val;
+    int myinfo = 0; // to build info
+
+    // main loop (for each pivot block)
+    while(upper ? k >= 0 : k < DIM)
+    {
+        kstep = 1;
+        kp = k;
+
+        // find max off-diagonal entry in column k
+        // (the first one in case of ties, as in IAMAX)
+        if(i == k)
+        {
+            colmax = 0;
+            imax = -1;
+#pragma unroll
+            for(int j = 0; j < DIM; ++j)
+            {
+                val = aabs<S>(rA[j]);
+                if(j == k)
+                    absakk = val;
+                else if((upper ? j < k : j > k) && (colmax < val || imax == -1))
+                {
+                    colmax = val;
+                    imax = j;
+                }
+            }
+        }
+        __syncthreads();
+
+        if(max(absakk, colmax) == 0)
+        {
+            // singularity found
+            if(myinfo == 0)
+                myinfo = k + 1;
+        }
+        else
+        {
+            if(absakk >= alpha * colmax)
+                // no interchange (1-by-1 block)
+                kp = k;
+            else
+            {
+                // find max off-diagonal entry in row imax
+                if(i == imax)
+                {
+                    rowmax = 0;
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                    {
+                        val = aabs<S>(rA[j]);
+                        if(j == imax)
+                            absaii = val;
+                        else if(upper ? j <= k : j >= k)
+                            rowmax = max(rowmax, val);
+                    }
+                }
+                __syncthreads();
+
+                if(absakk >= alpha * colmax * (colmax / rowmax))
+                    // no interchange (1-by-1 block)
+                    kp = k;
+                else if(absaii >= alpha * rowmax)
+                    // interchange rows and columns kk = k and kp = imax (1-by-1 block)
+                    kp = imax;
+                else
+                {
+                    // interchange rows and columns kk = k-1 (k+1 if lower) and kp = imax
+                    // (2-by-2 block)
+                    kp = imax;
+                    kstep = 2;
+                }
+            }
+
+            kk = upper ? k - kstep + 1 : k + kstep - 1;
+            if(kp != kk)
+            {
+                // interchange rows and columns kp and kk of the active submatrix
+                if(i == kk)
+                {
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                        sk[j] = rA[j];
+                }
+                if(i == kp)
+                {
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                        sc[j] = rA[j];
+                }
+                __syncthreads();
+
+                if(upper ? i <= k : i >= k)
+                {
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                    {
+                        if(upper ? j <= k : j >= k)
+                        {
+                            c = (j == kk) ? kp : (j == kp ? kk : j);
+                            if(i == kk)
+                                rA[j] = sc[c];
+                            else if(i == kp)
+                                rA[j] = sk[c];
+                            else if(j == kk)
+                                rA[j] = sc[i];
+                            else if(j == kp)
+                                rA[j] = sk[i];
+                        }
+                    }
+                }
+                __syncthreads();
+            }
+
+            if(kstep == 1)
+            {
+                // 1-by-1 pivot block
+
+                // share column k
+                if(i == k)
+                {
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                        sk[j] = rA[j];
+                }
+                __syncthreads();
+
+                // perform rank 1 update of the trailing submatrix (syr)
+                // and update column k (scal)
+                r1 = T(1) / sk[k];
+                if(upper ? i < k : i > k)
+                {
+                    r2 = -r1 * sk[i];
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                    {
+                        if(upper ? j < k : j > k)
+                            rA[j] = (upper ? j >= i : j <= i) ? rA[j] + sk[i] * (-r1 * sk[j])
+                                                              : rA[j] + sk[j] * r2;
+                        else if(j == k)
+                            rA[j] = sk[i] * r1;
+                    }
+                }
+                else if(i == k)
+                {
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                    {
+                        if(upper ? j < k : j > k)
+                            rA[j] = sk[j] * r1;
+                    }
+                }
+            }
+            else
+            {
+                // 2-by-2 pivot block
+
+                // share columns k and c = k-1 (k+1 if lower)
+                c = upper ? k - 1 : k + 1;
+                if(i == k)
+                {
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                        sk[j] = rA[j];
+                }
+                if(i == c)
+                {
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                        sc[j] = rA[j];
+                }
+                __syncthreads();
+
+                // compute the multipliers of the trailing rows
+                e = sk[c];
+                acc = sc[c] / e;
+                akk = sk[k] / e;
+                e = T(1) / ((akk * acc - T(1)) * e);
+                if(upper ? i < c : i > c)
+                {
+                    swk[i] = e * (acc * sk[i] - sc[i]);
+                    swc[i] = e * (akk * sc[i] - sk[i]);
+                }
+                __syncthreads();
+
+                // perform rank 2 update of the trailing submatrix
+                // and update columns k and c
+                if(upper ? i < c : i > c)
+                {
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                    {
+                        if(upper ? j < c : j > c)
+                            rA[j] = (upper ? j >= i : j <= i)
+                                ? rA[j] - sk[i] * swk[j] - sc[i] * swc[j]
+                                : rA[j] - sk[j] * swk[i] - sc[j] * swc[i];
+                        else if(j == k)
+                            rA[j] = swk[i];
+                        else if(j == c)
+                            rA[j] = swc[i];
+                    }
+                }
+                else if(i == k || i == c)
+                {
+#pragma unroll
+                    for(int j = 0; j < DIM; ++j)
+                    {
+                        if(upper ? j < c : j > c)
+                            rA[j] = (i == k) ? swk[j] : swc[j];
+                    }
+                }
+            }
+        }
+
+        // update ipiv (1-based index to match LAPACK)
+        if(i == 0)
+        {
+            if(kstep == 1)
+                ipiv[k] = kp + 1;
+            else
+            {
+                ipiv[k] = -(kp + 1);
+                ipiv[upper ? k - 1 : k + 1] = -(kp + 1);
+            }
+        }
+        __syncthreads();
+
+        k = upper ? k - kstep : k + kstep;
+    }
+
+    // update info
+    if(i == 0)
+        info[b] = myinfo;
+
+    // write results to global memory from local array
+    // (only the referenced triangle)
+#pragma unroll
+    for(int j = 0; j < DIM; ++j)
+    {
+        if(upper ? j >= i : j <= i)
+            A[i + j * lda] = rA[j];
+    }
+}
+
+/*************************************************************
+    Launchers of specilized  kernels
+*************************************************************/
+
+template <typename T, typename U>
+void sytf2_run_small(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     rocblas_int* ipiv,
+                     const rocblas_stride strideP,
+                     rocblas_int* info,
+                     const rocblas_int batch_count)
+{
+#define RUN_SYTF2_SMALL(DIM)                                                                      \
+    ROCSOLVER_LAUNCH_KERNEL((sytf2_kernel_small<DIM, T>), grid, dim3(DIM, 1, 1), 0, stream, uplo, \
+                            A, shiftA, lda, strideA, ipiv, strideP, info)
+
+    dim3 grid(batch_count, 1, 1);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make number of columns n known at compile time
+    // this should allow loop unrolling.
+    switch(n)
+    {
+    case 1: RUN_SYTF2_SMALL(1); break;
+    case 2: RUN_SYTF2_SMALL(2); break;
+    case 3: RUN_SYTF2_SMALL(3); break;
+    case 4: RUN_SYTF2_SMALL(4); break;
+    case 5: RUN_SYTF2_SMALL(5); break;
+    case 6: RUN_SYTF2_SMALL(6); break;
+    case 7: RUN_SYTF2_SMALL(7); break;
+    case 8: RUN_SYTF2_SMALL(8); break;
+    case 9: RUN_SYTF2_SMALL(9); break;
+    case 10: RUN_SYTF2_SMALL(10); break;
+    case 11: RUN_SYTF2_SMALL(11); break;
+    case 12: RUN_SYTF2_SMALL(12); break;
+    case 13: RUN_SYTF2_SMALL(13); break;
+    case 14: RUN_SYTF2_SMALL(14); break;
+    case 15: RUN_SYTF2_SMALL(15); break;
+    case 16: RUN_SYTF2_SMALL(16); break;
+    case 17: RUN_SYTF2_SMALL(17); break;
+    case 18: RUN_SYTF2_SMALL(18); break;
+    case 19: RUN_SYTF2_SMALL(19); break;
+    case 20: RUN_SYTF2_SMALL(20); break;
+    case 21: RUN_SYTF2_SMALL(21); break;
+    case 22: RUN_SYTF2_SMALL(22); break;
+    case 23: RUN_SYTF2_SMALL(23); break;
+    case 24: RUN_SYTF2_SMALL(24); break;
+    case 25: RUN_SYTF2_SMALL(25); break;
+    case 26: RUN_SYTF2_SMALL(26); break;
+    case 27: RUN_SYTF2_SMALL(27); break;
+    case 28: RUN_SYTF2_SMALL(28); break;
+    case 29: RUN_SYTF2_SMALL(29); break;
+    case 30: RUN_SYTF2_SMALL(30); break;
+    case 31: RUN_SYTF2_SMALL(31); break;
+    case 32: RUN_SYTF2_SMALL(32); break;
+    default:
+        // larger sizes are only instantiated for real types (see SYTF2_MAX_COLS_COMPLEX)
+        if constexpr(!is_complex<T>)
+        {
+            switch(n)
+            {
+            case 33: RUN_SYTF2_SMALL(33); break;
+            case 34: RUN_SYTF2_SMALL(34); break;
+            case 35: RUN_SYTF2_SMALL(35); break;
+            case 36: RUN_SYTF2_SMALL(36); break;
+            case 37: RUN_SYTF2_SMALL(37); break;
+            case 38: RUN_SYTF2_SMALL(38); break;
+            case 39: RUN_SYTF2_SMALL(39); break;
+            case 40: RUN_SYTF2_SMALL(40); break;
+            case 41: RUN_SYTF2_SMALL(41); break;
+            case 42: RUN_SYTF2_SMALL(42); break;
+            case 43: RUN_SYTF2_SMALL(43); break;
+            case 44: RUN_SYTF2_SMALL(44); break;
+            case 45: RUN_SYTF2_SMALL(45); break;
+            case 46: RUN_SYTF2_SMALL(46); break;
+            case 47: RUN_SYTF2_SMALL(47); break;
+            case 48: RUN_SYTF2_SMALL(48); break;
+            case 49: RUN_SYTF2_SMALL(49); break;
+            case 50: RUN_SYTF2_SMALL(50); break;
+            case 51: RUN_SYTF2_SMALL(51); break;
+            case 52: RUN_SYTF2_SMALL(52); break;
+            case 53: RUN_SYTF2_SMALL(53); break;
+            case 54: RUN_SYTF2_SMALL(54); break;
+            case 55: RUN_SYTF2_SMALL(55); break;
+            case 56: RUN_SYTF2_SMALL(56); break;
+            case 57: RUN_SYTF2_SMALL(57); break;
+            case 58: RUN_SYTF2_SMALL(58); break;
+            case 59: RUN_SYTF2_SMALL(59); break;
+            case 60: RUN_SYTF2_SMALL(60); break;
+            case 61: RUN_SYTF2_SMALL(61); break;
+            case 62: RUN_SYTF2_SMALL(62); break;
+            case 63: RUN_SYTF2_SMALL(63); break;
+            case 64: RUN_SYTF2_SMALL(64); break;
+            default: ROCSOLVER_UNREACHABLE();
+            }
+        }
+        else
+            ROCSOLVER_UNREACHABLE();
+    }
+}
+
+/*************************************************************
+    Instantiation macros
+*************************************************************/
+
+#define INSTANTIATE_SYTF2_SMALL(T, U)                                                        \
+    template void sytf2_run_small<T, U>(rocblas_handle handle, const rocblas_fill uplo,      \
+                                        const rocblas_int n, U A, const rocblas_int shiftA,  \
+                                        const rocblas_int lda, const rocblas_stride strideA, \
+                                        rocblas_int* ipiv, const rocblas_stride strideP,     \
+                                        rocblas_int* info, const rocblas_int batch_count)
@@ -17,7 +17,7 @@
     the library size.
 *************************************************************/
 
-template <rocblas_int DIM, typename T, typename U>
+template <rocblas_int DIM, rocblas_int WAVESIZE, typename T, typename U>
 ROCSOLVER_KERNEL void __launch_bounds__(TRTRI_MAX_COLS)
     trti2_kernel_small(const rocblas_fill uplo,
                        const rocblas_diagonal diagtype,
@@ -77,6 +77,10 @@ ROCSOLVER_KERNEL void __launch_bounds__(TRTRI_MAX_COLS)
 
                 rA[j] = diag[j] * temp;
             }
+
+            // threads in other wavefronts may still be reading the shared column
+            if(DIM > WAVESIZE)
+                __syncthreads();
         }
     }
     else
@@ -97,6 +101,10 @@ ROCSOLVER_KERNEL void __launch_bounds__(TRTRI_MAX_COLS)
 
                 rA[j] = diag[j] * temp;
             }
+
+            // threads in other wavefronts may still be reading the shared column
+            if(DIM > WAVESIZE)
+                __syncthreads();
         }
     }
 
@@ -121,12 +129,18 @@ void trti2_run_small(rocblas_handle handle,
                      const rocblas_stride strideA,
                      const rocblas_int batch_count)
 {
-#define RUN_TRTI2_SMALL(DIM)                                                                     \
-    ROCSOLVER_LAUNCH_KERNEL((trti2_kernel_small<DIM, T>), grid, block, 0, stream, uplo, diag, A, \
-                            shiftA, lda, strideA)
-
+#define RUN_TRTI2_SMALL(DIM)                                                                       \
+    if(DIM > wavesize)                                                                             \
+        ROCSOLVER_LAUNCH_KERNEL((trti2_kernel_small<DIM, SMALL_WAVESIZE(DIM), T>), grid, block, 0, \
+                                stream, uplo, diag, A, shiftA, lda, strideA);                      \
+    else                                                                                           \
+        ROCSOLVER_LAUNCH_KERNEL((trti2_kernel_small<DIM, 64, T>), grid, block, 0, stream, uplo,    \
+                                diag, A, shiftA, lda, strideA)
+
+    // one thread per row, rounded up to a whole number of wavefronts
+    rocblas_int wavesize = get_wavesize();
     dim3 grid(batch_count, 1, 1);
-    dim3 block(TRTRI_MAX_COLS, 1, 1);
+    dim3 block(((n - 1) / wavesize + 1) * wavesize, 1, 1);
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);